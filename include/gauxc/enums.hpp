@@ -51,6 +51,63 @@ enum class ExecutionSpace {
   Device ///< Execute task on the device (e.g. GPU)
 };
 
+/**
+ *  @brief Strategy used to merge quadrature tasks which share the same
+ *  screening data
+ */
+enum class TaskMergePolicy {
+  Sort, ///< Lexicographic sort of the shell lists followed by a linear scan
+  Hash  ///< Grouping on hashed shell list signatures (expected linear time)
+};
+
+/**
+ *  @brief Spatial partitioning scheme used to generate quadrature batches
+ *  from the atomic grids
+ */
+enum class BatchPartitioner {
+  Spherical, ///< Per-atom SphericalMicroBatcher batches (IntegratorXX)
+  Octree,    ///< Cost-driven octree with cells shared by all atoms
+  Bisection  ///< Cost-driven recursive median bisection of each atomic grid
+};
+
+/**
+ *  @brief Execution order of local quadrature tasks in the host integrators
+ *
+ *  The space-filling curve orderings group tasks into cost-descending chunks
+ *  (tasks whose modeled cost shares the same power of two) and order each
+ *  chunk along the curve through the centers of the task bounding boxes.
+ */
+enum class TaskOrdering {
+  Cost,   ///< Descending modeled cost
+  Morton, ///< Cost-descending chunks, Morton (Z-order) curve within chunks
+  Hilbert ///< Cost-descending chunks, Hilbert curve within chunks
+};
+
+/// Implementation of the host basis function collocation
+enum class HostCollocation {
+  Gau2grid, ///< gau2grid (generic fallback if built without gau2grid)
+  Native    ///< GauXC kernels specialized per angular momentum / shell type
+};
+
+/// Integrand of an XCIntegrator invocation (see estimate_memory)
+enum class XCIntegrand {
+  Density,    ///< integrate_den
+  EXC,        ///< eval_exc
+  EXC_VXC,    ///< eval_exc_vxc
+  FXC,        ///< eval_fxc_contraction
+  EXC_Grad,   ///< eval_exc_grad
+  EXX,        ///< eval_exx (sn-LinK)
+  EXC_VXC_EXX ///< eval_exc_vxc_exx
+};
+
+/// Class (rung) of an XC functional
+enum class XCFunctionalClass {
+  LDA,
+  GGA,
+  MGGA,          ///< Meta-GGA depending on tau
+  MGGA_Laplacian ///< Meta-GGA depending on the Laplacian of the density
+};
+
 /// Supported Algorithms / Integrands
 enum class SupportedAlg {
   XC,
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <memory>
+#include <array>
+#include <tuple>
 #include <gauxc/types.hpp>
 
 namespace GauXC {
@@ -24,6 +26,12 @@ using BatchSize    = detail::NamedType< int64_t, struct BatchSizeType   >;
 /// A named type pertaining to a scaling factor for a radial quadrature
 using RadialScale  = detail::NamedType< double,  struct RadialScaleType >;
 
+/// A batch of quadrature points: (box lower bound, box upper bound, points, weights)
+using grid_batch_type = std::tuple< 
+  std::array<double,3>, std::array<double,3>,
+  quadrature_type::point_container, 
+  quadrature_type::weight_container >;
+
 namespace detail {
   /// A class which contains the implementation details of a Grid instance
   class GridImpl;
@@ -81,6 +89,26 @@ public:
    */
   batcher_type& batcher();
 
+  /**
+   *  @brief Generate a quadrature batch translated to a new center
+   *
+   *  Batches are generated from an immutable snapshot of the reference
+   *  (origin-centered) quadrature taken at construction, so this
+   *  function does not modify the Grid and may be called concurrently.
+   *  Points are generated as ref_point + center, which matches a single
+   *  recenter of the reference quadrature bitwise.
+   *
+   *  @param[in] ibatch Index of the batch to generate
+   *  @param[in] center Center to translate the batch to
+   *
+   *  @returns Bounding box, points and weights of the translated batch
+   */
+  grid_batch_type translated_batch( size_t ibatch, 
+    const std::array<double,3>& center ) const;
+
+  /// Number of batches in the reference quadrature
+  size_t nbatches() const;
+
 }; // class Grid
 
 } // namespace GauXC
@@ -7,6 +7,7 @@
  */
 #pragma once
 #include <gauxc/grid.hpp>
+#include <gauxc/atom.hpp>
 #include <integratorxx/composite_quadratures/spherical_quadrature.hpp>
 #include <integratorxx/composite_quadratures/pruned_spherical_quadrature.hpp>
 
@@ -57,11 +58,30 @@ PrunedAtomicGridSpecification treutler_pruning_scheme(
   UnprunedAtomicGridSpecification
 );
 
+/**
+ *  @brief Generate an adaptive pruning specification from an unpruned
+ *         quadrature specification
+ *
+ *  For each radial shell, the smallest Lebedev order is selected for which
+ *  the angular integration error of a model integrand (the Becke-partitioned
+ *  promolecular density of a homonuclear diatomic), relative to the base
+ *  angular quadrature of `unp`, is below `target_error / nrad`.
+ *
+ *  @param[in] Z            Atomic number of the parent atom
+ *  @param[in] unp          Unpruned quadrature (reference) specification
+ *  @param[in] target_error Target error in the integrated model density
+ */
+PrunedAtomicGridSpecification adaptive_pruning_scheme(
+  AtomicNumber Z, UnprunedAtomicGridSpecification unp,
+  double target_error = 1e-8
+);
+
 /// High-level specification of pruning schemes for atomic quadratures
 enum class PruningScheme {
   Unpruned, /// Unpruned atomic quadrature
   Robust,   /// The "Robust" scheme of Psi4
-  Treutler  /// The Treutler-Aldrichs scheme
+  Treutler, /// The Treutler-Aldrichs scheme
+  Adaptive  /// Promolecular density driven pruning (default target error)
 };
 
 /// Generate a pruning specification from a specificed pruning scheme and 
@@ -70,6 +90,12 @@ PrunedAtomicGridSpecification create_pruned_spec(
   PruningScheme, UnprunedAtomicGridSpecification
 );
 
+/// Generate a pruning specification from a specificed pruning scheme and 
+/// an unpruned grid specification for a particular element
+PrunedAtomicGridSpecification create_pruned_spec(
+  PruningScheme, AtomicNumber, UnprunedAtomicGridSpecification
+);
+
 using atomic_grid_variant = 
   std::variant<UnprunedAtomicGridSpecification,
                PrunedAtomicGridSpecification>;
@@ -9,13 +9,18 @@
 
 #include <gauxc/molgrid.hpp>
 #include <gauxc/molmeta.hpp>
+#include <gauxc/point_group.hpp>
 #include <gauxc/basisset.hpp>
 #include <gauxc/basisset_map.hpp>
 #include <gauxc/shell_pair.hpp>
 #include <gauxc/xc_task.hpp>
+#include <gauxc/enums.hpp>
 #include <gauxc/util/timer.hpp>
 #include <gauxc/runtime_environment.hpp>
 
+#include <functional>
+#include <string>
+
 namespace GauXC {
 
 namespace detail {
@@ -27,6 +32,47 @@ namespace detail {
 struct LoadBalancerState {
   bool modified_weights_are_stored = false; 
     ///< Whether the load balancer currently stores partitioned weights
+  XCWeightAlg weight_alg = XCWeightAlg::SSF;
+    ///< Partitioning scheme of the stored partitioned weights
+  TaskMergePolicy task_merge_policy = TaskMergePolicy::Hash;
+    ///< Strategy used to merge equivalent tasks upon task creation
+  BatchPartitioner batch_partitioner = BatchPartitioner::Spherical;
+    ///< Scheme used to partition the atomic grids into batches (Host only)
+  size_t min_batch_size = 32;
+    ///< Target minimum batch size for the cost-driven (non-Spherical) partitioners,
+    ///< also the per-batch overhead (in points) of their cost model
+  TaskOrdering task_ordering = TaskOrdering::Cost;
+    ///< Order in which the host integrators execute local tasks
+  PointGroup point_group;
+    ///< Point group exploited by the host load balancer / integrators. Only
+    ///< the symmetry-unique grid points are generated and the integrated
+    ///< quantities are symmetrized. Must be set prior to task generation and
+    ///< requires totally symmetric densities. FXC contractions, GKS and 
+    ///< multi-matrix EXX, whose inputs are not totally symmetric in general,
+    ///< throw if the point group is non-trivial.
+  std::string task_scratch_dir;
+    ///< If non-empty, the local tasks are moved to a scratch file in this
+    ///< directory once the partitioned weights are stored and are streamed
+    ///< through the (host) integrators in chunks. Accessing the tasks through
+    ///< LoadBalancer::get_tasks loads them back into memory, non-const access
+    ///< discards the scratch file which is rewritten on the next stream.
+  size_t task_chunk_size = 64 * 1024 * 1024;
+    ///< Target size (bytes) of the out-of-core task chunks
+  size_t task_read_ahead = 1;
+    ///< Number of out-of-core task chunks read ahead while streaming
+};
+
+/// I/O statistics of the out-of-core task store (see LoadBalancerState::task_scratch_dir)
+struct TaskStoreStatistics {
+  size_t nchunks             = 0;  ///< Number of chunks in the scratch file
+  size_t file_bytes          = 0;  ///< Size of the scratch file
+  size_t bytes_written       = 0;  ///< Total bytes written to scratch
+  size_t bytes_read          = 0;  ///< Total bytes read from scratch
+  double write_time          = 0.; ///< Time spent writing (s)
+  double read_time           = 0.; ///< Time spent reading (s), overlaps the integration
+  double read_wait_time      = 0.; ///< Time the integrators waited on reads (s)
+  size_t peak_resident_bytes = 0;  ///< Largest (serialized) size of the task
+                                   ///< chunks held in memory while streaming
 };
 
 
@@ -65,6 +111,28 @@ public:
   /// Get underlying (local) quadrature tasks for this process (non-cost)
         std::vector<XCTask>& get_tasks()      ;
 
+  /**
+   *  @brief Apply an operation to the local tasks in chunks
+   *
+   *  If LoadBalancerState::task_scratch_dir is set and the partitioned weights
+   *  are stored, the tasks are moved out-of-core (if not already) and streamed
+   *  from scratch with read-ahead. Otherwise op is applied once to the
+   *  in-memory tasks. Modifications of streamed chunks are not persisted.
+   */
+  void stream_tasks( const std::function<void(std::vector<XCTask>&)>& op );
+
+  /// Whether the local tasks are currently held (valid) out-of-core
+  bool tasks_out_of_core() const;
+
+  /// Generation of the local tasks. Changes whenever the tasks may have been
+  /// replaced or modified, i.e. on creation, non-const get_tasks, 
+  /// rebalance_* and when they are loaded back from out-of-core. Operations
+  /// applied through stream_tasks are not considered modifications
+  size_t task_generation() const;
+
+  /// Return the I/O statistics of the out-of-core task store
+  const TaskStoreStatistics& task_store_statistics() const;
+
   /// Rebalance quadrature batches according to weight-only cost
   void rebalance_weights();
 
@@ -86,6 +154,12 @@ public:
   /// Return the maximum npts x nde product for local tasks 
   size_t max_npts_x_nbe() const;
 
+  /// Return the mean effective basis dimension over local tasks
+  double mean_nbe() const;
+
+  /// Return the total modeled EXC/VXC cost (XCTask::cost_exc_vxc) of local tasks
+  size_t total_exc_vxc_cost() const;
+
   /// Return the underlying molecule instance used to generate this LoadBalancer 
   const Molecule& molecule() const;
 
@@ -102,6 +176,9 @@ public:
   const shell_pair_type& shell_pairs() const;
   const shell_pair_type& shell_pairs();
 
+  /// Whether the shell pairs have been generated (see shell_pairs())
+  bool has_shell_pairs() const;
+
   /// Return the runtime handle used to construct this LoadBalancer
   const RuntimeEnvironment& runtime() const;
   
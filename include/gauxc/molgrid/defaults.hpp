@@ -16,6 +16,9 @@ namespace GauXC {
   double clementi_radius_67(AtomicNumber);
   double default_atomic_radius(AtomicNumber);
 
+  /// Spherical (neutral atom) promolecular density model from Slater's rules
+  double promolecular_density(AtomicNumber, double r);
+
   RadialScale default_mk_radial_scaling_factor( AtomicNumber );
   RadialScale default_mhl_radial_scaling_factor( AtomicNumber );
   RadialScale default_ta_radial_scaling_factor( AtomicNumber );
@@ -36,9 +39,10 @@ namespace GauXC {
 
     template <typename... Args>
     inline static atomic_grid_variant 
-      create_default_pruned_grid_spec( PruningScheme scheme, Args&&... args ) {
-      return create_pruned_spec( scheme, 
-        create_default_unpruned_grid_spec(std::forward<Args>(args)...)
+      create_default_pruned_grid_spec( PruningScheme scheme, AtomicNumber Z,
+        Args&&... args ) {
+      return create_pruned_spec( scheme, Z,
+        create_default_unpruned_grid_spec(Z, std::forward<Args>(args)...)
       );
     }
 
@@ -0,0 +1,104 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/molecule.hpp>
+#include <array>
+#include <string>
+#include <vector>
+
+namespace GauXC {
+
+/**
+ *  @brief Symmetry operation r -> center + R * (r - center)
+ *
+ *  R is stored row-major and must be a signed permutation matrix, i.e. the
+ *  operation maps the Cartesian axes onto (possibly inverted) Cartesian
+ *  axes. This admits every subgroup of O_h in its standard orientation
+ *  (all subgroups of D2h, as well as T, Td, Th, O and Oh) and keeps the
+ *  action of the group on the (octahedrally symmetric) atomic quadratures
+ *  exact.
+ */
+using SymmetryOperation = std::array<double,9>;
+
+/**
+ *  @brief A molecular point group
+ *
+ *  The default constructed instance is the trivial group (C1), in which case
+ *  no symmetry is exploited.
+ */
+class PointGroup {
+
+  std::array<double,3>           center_;     ///< Fixed point of the group
+  std::vector<SymmetryOperation> operations_; ///< Group elements (identity first)
+
+public:
+
+  /// Construct the trivial group (C1)
+  PointGroup();
+
+  /**
+   *  @brief Construct a PointGroup from a list of symmetry operations
+   *
+   *  @param[in] ops     Group elements. Must be closed under multiplication
+   *                     and contain the identity.
+   *  @param[in] center  Fixed point of the group (e.g. the center of charge)
+   */
+  PointGroup( std::vector<SymmetryOperation> ops,
+    std::array<double,3> center = {0., 0., 0.} );
+
+  PointGroup( const PointGroup& );
+  PointGroup( PointGroup&& ) noexcept;
+  PointGroup& operator=( const PointGroup& );
+  PointGroup& operator=( PointGroup&& ) noexcept;
+  ~PointGroup() noexcept;
+
+  /// Number of group elements
+  size_t order() const { return operations_.size(); }
+
+  /// Whether this is the trivial group (C1)
+  bool is_trivial() const { return order() == 1; }
+
+  /// Group elements (the identity is always the first element)
+  const auto& operations() const { return operations_; }
+
+  /// Fixed point of the group
+  const auto& center() const { return center_; }
+
+  /// Schoenflies symbol of the group (e.g. "C2v", "D2h", "Td")
+  std::string name() const;
+
+  /**
+   *  @brief Permutation of the atoms of a molecule induced by an operation
+   *
+   *  Throws if the operation does not map the molecule onto itself.
+   *
+   *  @param[in] mol   Molecule
+   *  @param[in] iop   Index of the operation
+   *  @param[in] tol   Distance tolerance for equivalent atoms
+   *  @returns   atom_map such that operation iop maps atom i onto atom_map[i]
+   */
+  std::vector<int64_t> atom_map( const Molecule& mol, size_t iop,
+    double tol = 1e-6 ) const;
+
+}; // class PointGroup
+
+/**
+ *  @brief Detect the point group of a molecule
+ *
+ *  Returns the largest group of signed permutation operations about the
+ *  center of nuclear charge which maps the molecule onto itself. Molecules
+ *  must be in a standard orientation (symmetry elements along the Cartesian
+ *  axes / diagonals) for their full symmetry to be detected.
+ *
+ *  @param[in] mol Molecule
+ *  @param[in] tol Distance tolerance for equivalent atoms
+ */
+PointGroup detect_point_group( const Molecule& mol, double tol = 1e-6 );
+
+}
@@ -11,17 +11,86 @@
 #include <gauxc/runtime_environment.hpp>
 #include <typeindex>
 #include <any>
+#include <vector>
 
 namespace GauXC {
 
 namespace detail {
   class ReductionDriverImpl;
+  class ReductionRequestImpl;
 }
 
 enum class ReductionOp : int {
   Sum
 };
 
+/// Description of a (column-major) buffer participating in a packed
+/// reduction. Symmetric buffers only communicate their lower triangle
+/// and have their upper triangle restored once the reduction completes.
+struct ReductionBuffer {
+  void*  data      = nullptr; ///< Buffer to be reduced in place
+  size_t m         = 0;       ///< Number of rows
+  size_t n         = 1;       ///< Number of columns
+  size_t ld        = 0;       ///< Leading dimension (0 implies ld = m)
+  bool   symmetric = false;   ///< Only reduce the lower triangle (m == n)
+
+  /// Single scalar
+  template <typename T>
+  static ReductionBuffer scalar( T* data ) {
+    return ReductionBuffer{ data, 1, 1, 1, false };
+  }
+
+  /// Contiguous vector of length n
+  template <typename T>
+  static ReductionBuffer vector( T* data, size_t n ) {
+    return ReductionBuffer{ data, n, 1, n, false };
+  }
+
+  /// General m x n matrix with leading dimension ld
+  template <typename T>
+  static ReductionBuffer matrix( T* data, size_t m, size_t n, size_t ld ) {
+    return ReductionBuffer{ data, m, n, ld, false };
+  }
+
+  /// Symmetric n x n matrix with leading dimension ld
+  template <typename T>
+  static ReductionBuffer symmetric_matrix( T* data, size_t n, size_t ld ) {
+    return ReductionBuffer{ data, n, n, ld, true };
+  }
+
+  inline size_t leading_dim() const { return ld ? ld : m; }
+};
+
+/// Handle to an outstanding (non-blocking) reduction. Results are only
+/// guaranteed to be present in the user buffers after wait() (or a
+/// successful test()) returns. Destroying the last handle to an
+/// outstanding reduction completes it.
+class ReductionRequest {
+
+  using pimpl_type = detail::ReductionRequestImpl;
+  std::shared_ptr<pimpl_type> pimpl_;
+
+public:
+
+  /// Construct a request which is already complete
+  ReductionRequest();
+  ReductionRequest( std::shared_ptr<pimpl_type> pimpl );
+
+  ReductionRequest( const ReductionRequest& );
+  ReductionRequest( ReductionRequest&& ) noexcept;
+  ReductionRequest& operator=( const ReductionRequest& );
+  ReductionRequest& operator=( ReductionRequest&& ) noexcept;
+
+  ~ReductionRequest() noexcept;
+
+  /// Block until the reduction has completed
+  void wait();
+
+  /// Check (without blocking) whether the reduction has completed
+  bool test();
+
+};
+
 class ReductionDriver {
 
   using pimpl_type = detail::ReductionDriverImpl;
@@ -48,8 +117,54 @@ public:
     allreduce_inplace_typeerased( data, size, op, std::type_index(typeid(T)), optional_args );
   }
 
+  /// Reduce several buffers of the same type with a single collective
+  template <typename T>
+  inline void allreduce_packed( const std::vector<ReductionBuffer>& buffers,
+    ReductionOp op, std::any optional_args = std::any() ) {
+    allreduce_packed_typeerased( buffers, op, std::type_index(typeid(T)), 
+      optional_args );
+  }
+
+  /// Non-blocking variant of allreduce_packed. The buffers must not be
+  /// accessed until the returned request has completed.
+  template <typename T>
+  inline ReductionRequest iallreduce_packed( 
+    const std::vector<ReductionBuffer>& buffers, ReductionOp op, 
+    std::any optional_args = std::any() ) {
+    return iallreduce_packed_typeerased( buffers, op, 
+      std::type_index(typeid(T)), optional_args );
+  }
+
+  /// Whether the driver supports node-shared accumulation (see 
+  /// node_shared_buffer)
+  bool supports_node_shared() const;
+
+  /// Zeroed buffer of `count` elements, shared by all ranks on the same
+  /// (shared memory) node. Ranks accumulate their contributions directly
+  /// into this buffer, concurrent updates must be atomic. Collective over 
+  /// the ranks of the node. The buffer remains valid until the next 
+  /// reduction issued through this driver.
+  template <typename T>
+  inline T* node_shared_buffer( size_t count ) {
+    return static_cast<T*>( node_shared_buffer_typeerased( count * sizeof(T) ) );
+  }
+
+  /// Reduce the node-shared buffer over all nodes and copy the result into 
+  /// `buffers`. The node-shared buffer holds the (dense, ld = m) m x n 
+  /// blocks of `buffers` back to back, only the lower triangles of
+  /// symmetric buffers need to be accumulated. Collective over all ranks.
+  template <typename T>
+  inline void reduce_node_shared( const std::vector<ReductionBuffer>& buffers,
+    ReductionOp op ) {
+    reduce_node_shared_typeerased( buffers, op, std::type_index(typeid(T)) );
+  }
+
   void allreduce_typeerased( const void*, void*, size_t, ReductionOp, std::type_index, std::any );
   void allreduce_inplace_typeerased( void*, size_t, ReductionOp, std::type_index, std::any );
+  void allreduce_packed_typeerased( const std::vector<ReductionBuffer>&, ReductionOp, std::type_index, std::any );
+  ReductionRequest iallreduce_packed_typeerased( const std::vector<ReductionBuffer>&, ReductionOp, std::type_index, std::any );
+  void* node_shared_buffer_typeerased( size_t bytes );
+  void reduce_node_shared_typeerased( const std::vector<ReductionBuffer>&, ReductionOp, std::type_index );
 
   bool takes_host_memory() const;
   bool takes_device_memory() const;
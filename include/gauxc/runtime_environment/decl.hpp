@@ -8,12 +8,58 @@
 #pragma once
 #include <gauxc/runtime_environment/fwd.hpp>
 #include <memory>
+#include <functional>
+#include <vector>
 #include <gauxc/util/mpi.hpp>
 
 namespace GauXC {
 
+/// Binding of host (OpenMP) threads to logical CPUs
+enum class ThreadBinding {
+  Inherit, ///< Keep the binding of the process environment (e.g. OMP_PROC_BIND)
+  Compact, ///< Bind consecutive threads to consecutive CPUs, filling NUMA nodes in turn
+  Scatter  ///< Bind consecutive threads round-robin over the NUMA nodes
+};
+
+/**
+ *  Placement of the large shared host integrator buffers (e.g. VXC / K).
+ *  The OS places a page on first touch, zeroing a caller-owned buffer only
+ *  places pages which have not been touched before (e.g. a freshly allocated
+ *  output). Pages which are already resident are never moved.
+ */
+enum class MemoryPlacement {
+  Inherit,    ///< Default OS policy, buffers are zeroed by the calling thread
+  FirstTouch, ///< Buffers are zeroed by all threads before integration
+  Interleave  ///< Pages of buffers allocated by GauXC (e.g. the node-shared
+              ///< reduction buffer) are interleaved over the NUMA nodes,
+              ///< caller-owned buffers are treated as FirstTouch
+};
+
+/**
+ *  Host thread / memory placement policy of a RuntimeEnvironment. Thread
+ *  local integrator scratch is allocated by the thread which uses it.
+ */
+struct HostPlacementPolicy {
+  int             nthreads  = 0; ///< Number of host threads (0: runtime default)
+  ThreadBinding   binding   = ThreadBinding::Inherit;
+  MemoryPlacement placement = MemoryPlacement::Inherit;
+};
+
+/// Host placement in effect for a RuntimeEnvironment
+struct HostPlacement {
+  HostPlacementPolicy policy;         ///< Requested policy
+  int nthreads    = 1;                ///< Number of host threads
+  int nnuma_nodes = 1;                ///< Number of NUMA nodes available to the process
+  std::vector<int> thread_cpus;       ///< Logical CPU of each thread (-1 if unknown)
+  std::vector<int> thread_nodes;      ///< NUMA node of each thread (-1 if unknown)
+  std::vector<int> threads_per_node;  ///< Number of threads on each NUMA node
+};
+
 namespace detail {
   class RuntimeEnvironmentImpl;
+  class ThreadedCommunicator;
+  std::shared_ptr<ThreadedCommunicator> 
+    threaded_communicator( const RuntimeEnvironment& );
   #ifdef GAUXC_HAS_DEVICE
   DeviceRuntimeEnvironment as_device_runtime( const RuntimeEnvironment& );
   #endif
@@ -27,6 +73,8 @@ protected:
   friend DeviceRuntimeEnvironment 
     detail::as_device_runtime(const RuntimeEnvironment&); 
 #endif
+  friend std::shared_ptr<detail::ThreadedCommunicator>
+    detail::threaded_communicator(const RuntimeEnvironment&);
 
   using pimpl_type = detail::RuntimeEnvironmentImpl;
   using pimpl_ptr_type = std::shared_ptr<pimpl_type>;
@@ -35,7 +83,16 @@ protected:
 
 public:
 
+  /// Construct a RuntimeEnvironment, the threading environment of the 
+  /// calling process is left untouched
   explicit RuntimeEnvironment(GAUXC_MPI_CODE(MPI_Comm comm));
+
+  /// Construct a RuntimeEnvironment and apply a host placement policy 
+  /// to the (OpenMP) threads of the calling process. The thread count and
+  /// binding are process wide and persist beyond this RuntimeEnvironment
+  explicit RuntimeEnvironment(GAUXC_MPI_CODE(MPI_Comm comm,) 
+    HostPlacementPolicy policy);
+
   virtual ~RuntimeEnvironment() noexcept;
 
   RuntimeEnvironment( const RuntimeEnvironment& );
@@ -45,8 +102,53 @@ public:
   int comm_rank() const;
   int comm_size() const;
 
+  /// Number of ranks (including this one) which share the host memory of
+  /// the calling rank
+  int node_size() const;
+
   int shared_usage_count() const;
 
+  /// Host thread / memory placement policy of this runtime
+  const HostPlacementPolicy& host_placement_policy() const;
+
+  /// Host thread / memory placement currently in effect
+  HostPlacement host_placement() const;
+
+};
+
+/**
+ *  RuntimeEnvironment which simulates a multi-rank execution within a 
+ *  single process. Each virtual rank is driven by its own thread and
+ *  collectives are performed through shared memory.
+ *
+ *  Intended for testing and benchmarking of distributed code paths
+ *  (task distribution, LoadBalancer::rebalance_*, reductions, memory
+ *  estimates) without an MPI launch. Not supported are
+ *    - reduction drivers other than "THREADED" (e.g. "BASICMPI", 
+ *      "HIERARCHICAL", "NCCL") and thus node-shared accumulation,
+ *    - device execution spaces,
+ *    - user code which communicates through comm(), which refers to
+ *      MPI_COMM_SELF for every virtual rank.
+ */
+class ThreadedRuntimeEnvironment : public RuntimeEnvironment {
+
+  using parent_type = RuntimeEnvironment;
+
+public:
+
+  ThreadedRuntimeEnvironment( std::shared_ptr<detail::ThreadedCommunicator> comm, 
+    int rank );
+
+  ~ThreadedRuntimeEnvironment() noexcept;
+  ThreadedRuntimeEnvironment( const ThreadedRuntimeEnvironment& );
+  ThreadedRuntimeEnvironment( ThreadedRuntimeEnvironment&& ) noexcept;
+
+  /// Execute `func` on `nranks` virtual ranks (one thread per rank) and
+  /// wait for completion. The first exception thrown by any rank is
+  /// rethrown on the calling thread.
+  static void launch( int nranks, 
+    const std::function<void(const RuntimeEnvironment&)>& func );
+
 };
 
 #ifdef GAUXC_HAS_DEVICE
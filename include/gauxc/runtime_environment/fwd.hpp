@@ -11,6 +11,7 @@
 namespace GauXC {
 
 class RuntimeEnvironment;
+class ThreadedRuntimeEnvironment;
 
 #ifdef GAUXC_HAS_DEVICE
 class DeviceRuntimeEnvironment;
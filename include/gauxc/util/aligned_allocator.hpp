@@ -0,0 +1,70 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <vector>
+
+namespace GauXC {
+namespace util  {
+
+/// Default alignment (bytes) for host batch buffers - one cache line / AVX-512 register
+inline constexpr std::size_t default_buffer_alignment = 64;
+
+/**
+ *  @brief Minimal STL allocator returning storage aligned to `Alignment` bytes
+ *
+ *  Used for host batch buffers (SoA grid points, collocation, Z-matrices, etc)
+ *  such that the leading element of every buffer lands on a cache line
+ *  boundary.
+ */
+template <typename T, std::size_t Alignment = default_buffer_alignment>
+struct aligned_allocator {
+
+  static_assert( Alignment >= alignof(T), "Alignment must satisfy alignof(T)" );
+  static_assert( (Alignment & (Alignment-1)) == 0, "Alignment must be a power of 2" );
+
+  using value_type = T;
+
+  template <typename U>
+  struct rebind { using other = aligned_allocator<U,Alignment>; };
+
+  aligned_allocator() noexcept = default;
+  template <typename U>
+  aligned_allocator( const aligned_allocator<U,Alignment>& ) noexcept { }
+
+  T* allocate( std::size_t n ) {
+    if( n > std::numeric_limits<std::size_t>::max() / sizeof(T) )
+      throw std::bad_array_new_length();
+    return static_cast<T*>(
+      ::operator new( n * sizeof(T), std::align_val_t(Alignment) ) );
+  }
+
+  void deallocate( T* ptr, std::size_t ) noexcept {
+    ::operator delete( ptr, std::align_val_t(Alignment) );
+  }
+
+};
+
+template <typename T, typename U, std::size_t A>
+inline bool operator==( const aligned_allocator<T,A>&, const aligned_allocator<U,A>& ) noexcept {
+  return true;
+}
+template <typename T, typename U, std::size_t A>
+inline bool operator!=( const aligned_allocator<T,A>&, const aligned_allocator<U,A>& ) noexcept {
+  return false;
+}
+
+/// std::vector whose data() is aligned to `default_buffer_alignment`
+template <typename T>
+using aligned_vector = std::vector< T, aligned_allocator<T> >;
+
+}
+}
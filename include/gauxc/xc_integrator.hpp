@@ -8,6 +8,8 @@
 #pragma once
 
 #include <memory>
+#include <vector>
+#include <tuple>
 
 #include <gauxc/types.hpp>
 #include <gauxc/load_balancer.hpp>
@@ -36,6 +38,10 @@ public:
   using exc_vxc_type_gks  = std::tuple< value_type, matrix_type, matrix_type, matrix_type, matrix_type >;
   using exc_grad_type = std::vector< value_type >;
   using exx_type      = matrix_type;
+  using exx_type_multi = std::vector< matrix_type >;
+  using exc_vxc_exx_type_rks = std::tuple< value_type, matrix_type, matrix_type >;
+  using fxc_type_rks  = std::vector< matrix_type >;
+  using fxc_type_uks  = std::tuple< std::vector<matrix_type>, std::vector<matrix_type> >;
 
 private:
 
@@ -66,10 +72,27 @@ public:
   exc_vxc_type_gks  eval_exc_vxc ( const MatrixType&, const MatrixType&, const MatrixType&, const MatrixType&,
                                    const IntegratorSettingsXC& = IntegratorSettingsXC{});
 
-  exc_grad_type eval_exc_grad( const MatrixType& );
+  fxc_type_rks  eval_fxc_contraction( const MatrixType&, const std::vector<MatrixType>&,
+                                     const IntegratorSettingsXC& = IntegratorSettingsFXC{} );
+  fxc_type_uks  eval_fxc_contraction( const MatrixType&, const MatrixType&,
+                                     const std::vector<MatrixType>&, const std::vector<MatrixType>&,
+                                     const IntegratorSettingsXC& = IntegratorSettingsFXC{} );
+
+  exc_grad_type eval_exc_grad( const MatrixType&, 
+                               const IntegratorSettingsXC& = IntegratorSettingsEXCGrad{} );
+  exc_grad_type eval_exc_grad( const MatrixType&, const MatrixType&,
+                               const IntegratorSettingsXC& = IntegratorSettingsEXCGrad{} );
+  exc_grad_type eval_exc_grad( const MatrixType&, const MatrixType&, const MatrixType&, const MatrixType&,
+                               const IntegratorSettingsXC& = IntegratorSettingsEXCGrad{} );
 
   exx_type      eval_exx     ( const MatrixType&, 
                                const IntegratorSettingsEXX& = IntegratorSettingsEXX{} );
+  exx_type_multi eval_exx    ( const std::vector<MatrixType>&, 
+                               const IntegratorSettingsEXX& = IntegratorSettingsEXX{} );
+
+  exc_vxc_exx_type_rks eval_exc_vxc_exx( const MatrixType&,
+                                         const IntegratorSettingsXC&  = IntegratorSettingsXC{},
+                                         const IntegratorSettingsEXX& = IntegratorSettingsEXX{} );
 
 
   const util::Timer& get_timings() const;
@@ -74,11 +74,46 @@ typename XCIntegrator<MatrixType>::exc_vxc_type_gks
         return pimpl_->eval_exc_vxc(Ps, Pz, Py, Px, ks_settings);
   };
 
+template <typename MatrixType>
+typename XCIntegrator<MatrixType>::fxc_type_rks
+  XCIntegrator<MatrixType>::eval_fxc_contraction( const MatrixType& P, 
+    const std::vector<MatrixType>& tP, const IntegratorSettingsXC& ks_settings ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->eval_fxc_contraction(P, tP, ks_settings);
+};
+
+template <typename MatrixType>
+typename XCIntegrator<MatrixType>::fxc_type_uks
+  XCIntegrator<MatrixType>::eval_fxc_contraction( const MatrixType& Ps, 
+    const MatrixType& Pz, const std::vector<MatrixType>& tPs, 
+    const std::vector<MatrixType>& tPz, const IntegratorSettingsXC& ks_settings ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->eval_fxc_contraction(Ps, Pz, tPs, tPz, ks_settings);
+};
+
+template <typename MatrixType>
+typename XCIntegrator<MatrixType>::exc_grad_type
+  XCIntegrator<MatrixType>::eval_exc_grad( const MatrixType& P, 
+    const IntegratorSettingsXC& settings ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->eval_exc_grad(P, settings);
+};
+
+template <typename MatrixType>
+typename XCIntegrator<MatrixType>::exc_grad_type
+  XCIntegrator<MatrixType>::eval_exc_grad( const MatrixType& Ps, 
+    const MatrixType& Pz, const IntegratorSettingsXC& settings ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->eval_exc_grad(Ps, Pz, settings);
+};
+
 template <typename MatrixType>
 typename XCIntegrator<MatrixType>::exc_grad_type
-  XCIntegrator<MatrixType>::eval_exc_grad( const MatrixType& P ) {
+  XCIntegrator<MatrixType>::eval_exc_grad( const MatrixType& Ps, 
+    const MatrixType& Pz, const MatrixType& Py, const MatrixType& Px, 
+    const IntegratorSettingsXC& settings ) {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
-  return pimpl_->eval_exc_grad(P);
+  return pimpl_->eval_exc_grad(Ps, Pz, Py, Px, settings);
 };
 
 template <typename MatrixType>
@@ -89,6 +124,23 @@ typename XCIntegrator<MatrixType>::exx_type
   return pimpl_->eval_exx(P,settings);
 };
 
+template <typename MatrixType>
+typename XCIntegrator<MatrixType>::exx_type_multi
+  XCIntegrator<MatrixType>::eval_exx( const std::vector<MatrixType>& P,
+                                      const IntegratorSettingsEXX& settings ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->eval_exx(P,settings);
+};
+
+template <typename MatrixType>
+typename XCIntegrator<MatrixType>::exc_vxc_exx_type_rks
+  XCIntegrator<MatrixType>::eval_exc_vxc_exx( const MatrixType& P,
+                                              const IntegratorSettingsXC&  ks_settings,
+                                              const IntegratorSettingsEXX& exx_settings ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->eval_exc_vxc_exx(P, ks_settings, exx_settings);
+};
+
 template <typename MatrixType>
 const util::Timer& XCIntegrator<MatrixType>::get_timings() const {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
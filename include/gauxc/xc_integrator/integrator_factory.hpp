@@ -8,6 +8,7 @@
 #pragma once
 #include <gauxc/xc_integrator/impl.hpp>
 #include <stdexcept>
+#include <type_traits>
 
 #include <gauxc/xc_integrator/local_work_driver.hpp>
 #include <gauxc/xc_integrator/replicated/replicated_xc_integrator_factory.hpp>
@@ -31,19 +32,22 @@ public:
    *  @param[in] integrator_input_type   Input type for XC integration (e.g. "Replicated")
    *  @param[in] integrator_kernel_name  Name of Integraion scaffold kernel to load (e.g. "Reference" or "Default")
    *  @param[in] local_work_kerenl_name  Name of LWD to load (e.g. "Reference" or "Default")
-   *  @param[in] setting                 Settings to pass to LWD (not currently used)
+   *  @param[in] setting                 Settings to pass to LWD (e.g. LocalHostWorkSettings)
    */
+  template <typename SettingsType = LocalWorkSettings,
+    typename = std::enable_if_t<std::is_base_of_v<LocalWorkSettings,SettingsType>>
+  >
   XCIntegratorFactory( ExecutionSpace ex, 
                        std::string integrator_input_type,
                        std::string integrator_kernel_name,
                        std::string local_work_kernel_name,
                        std::string reduction_kernel_name,
-                       LocalWorkSettings settings = LocalWorkSettings() ) :
+                       SettingsType settings = SettingsType() ) :
     ex_(ex), input_type_(integrator_input_type), 
     integrator_kernel_(integrator_kernel_name),
     lwd_kernel_(local_work_kernel_name), 
     rd_kernel_(reduction_kernel_name),
-    local_work_settings_(settings) {}
+    local_work_settings_(std::make_shared<SettingsType>(std::move(settings))) {}
 
  
   /** Generate XCIntegrator instance
@@ -57,7 +61,7 @@ public:
 
     // Create Local Work Driver
     auto lwd = LocalWorkDriverFactory::make_local_work_driver( ex_, 
-      lwd_kernel_, local_work_settings_ );
+      lwd_kernel_, *local_work_settings_ );
 
     // Create Reduction Driver
     auto rd = ReductionDriverFactory::get_shared_instance( 
@@ -101,7 +105,7 @@ private:
 
   ExecutionSpace ex_;
   std::string input_type_, integrator_kernel_, lwd_kernel_, rd_kernel_;
-  LocalWorkSettings local_work_settings_;
+  std::shared_ptr<LocalWorkSettings> local_work_settings_; ///< Stored by pointer to retain the derived type
 
 };
 
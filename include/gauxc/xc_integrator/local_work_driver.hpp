@@ -20,9 +20,31 @@ struct LocalWorkDriver {
 /// Base type for all types that specify LWD settings (trivial)
 struct LocalWorkSettings { virtual ~LocalWorkSettings() noexcept = default; };
 
+/// Settings for Host LWD instances
+struct LocalHostWorkSettings : public LocalWorkSettings {
 
+  /** Collocation screening tolerance
+   *
+   *  Grid points are processed in blocks of `collocation_block_size`. For
+   *  each block, primitives whose magnitude (and that of their derivatives)
+   *  is estimated to fall below this value at every point of the block are
+   *  dropped, and shells with no surviving primitives are skipped outright.
+   *  Non-positive values disable collocation screening.
+   */
+  double collocation_tol = 1e-14;
+
+  /// Number of grid points per collocation screening block
+  size_t collocation_block_size = 64;
 
+  /** Host collocation implementation
+   *
+   *  The native kernels produce the same output (up to round off) as
+   *  gau2grid and honor the same screening settings. The native backend
+   *  is also selected by the "Native" host LWD name.
+   */
+  HostCollocation collocation_backend = HostCollocation::Gau2grid;
 
+};
 
 /// Factory to generate LocalWorkDriver instances
 class LocalWorkDriverFactory {
@@ -34,12 +56,14 @@ public:
   /** Generate a LWD instance
    * 
    *  @param[in] ex        The Execution space for the LWD driver
-   *  @param[in] name      The name of the LWD driver to construct (e.g. "Default" or "Reference")
-   *  @param[in] settings  Settings to pass to LWD construction
+   *  @param[in] name      The name of the LWD driver to construct (e.g. "Default", "Reference" or "Native")
+   *  @param[in] settings  Settings to pass to LWD construction. Settings types
+   *                       not matching the execution space (e.g. the trivial
+   *                       base) yield the default settings for that space.
    */
   static ptr_return_t make_local_work_driver(ExecutionSpace ex, 
     std::string name = "Default", 
-    LocalWorkSettings settings = LocalWorkSettings());
+    const LocalWorkSettings& settings = LocalWorkSettings());
 
 private:
 
@@ -0,0 +1,82 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include <gauxc/load_balancer.hpp>
+#include <gauxc/enums.hpp>
+
+#include <string>
+#include <vector>
+
+namespace GauXC {
+
+/// Integrator invocation to model in estimate_memory
+struct MemoryEstimateSettings {
+  XCIntegrand       integrand  = XCIntegrand::EXC_VXC;
+  XCFunctionalClass func_class = XCFunctionalClass::GGA;
+  int     nspin    = 1; ///< Density components: 1 (RKS), 2 (UKS) or 4 (GKS)
+  int64_t nmat     = 1; ///< Number of densities (EXX)
+  int64_t ntrial   = 1; ///< Number of trial densities (FXC)
+  int     nthreads = 0; ///< Host threads, 0 selects the thread count of the runtime
+};
+
+/// Predicted storage of one component of an integrator invocation
+struct MemoryComponent {
+  std::string name;
+  size_t bytes      = 0;     ///< Predicted peak bytes (per thread if per_thread)
+  bool   per_thread = false; ///< Held by every host thread
+  bool   allocated  = false; ///< Already held by the LoadBalancer prior to the call
+  int    phase      = 0;     ///< 0: held throughout the call, otherwise only
+                             ///< during that (non-overlapping) phase of the call
+};
+
+/// Predicted peak host memory of an integrator invocation
+struct MemoryEstimate {
+  std::vector<MemoryComponent> components;
+  int nthreads = 1;
+
+  size_t ntasks    = 0; ///< Number of local tasks
+  size_t task_cost = 0; ///< Modeled EXC/VXC cost of the local tasks
+
+  /// peak_bytes() / ntasks / task_cost of every rank of the runtime
+  std::vector<size_t> rank_peak_bytes;
+  std::vector<size_t> rank_ntasks;
+  std::vector<size_t> rank_task_cost;
+
+  /// Peak bytes per thread (largest phase)
+  size_t per_thread_bytes() const;
+
+  /// Peak bytes including all threads: persistent components + largest phase
+  size_t peak_bytes() const;
+
+  /// peak_bytes() excluding the components already held by the LoadBalancer
+  size_t call_bytes() const;
+};
+
+/**
+ *  @brief Predict the peak host memory of an XCIntegrator invocation
+ *
+ *  Models the allocations of the Replicated host integrators (Reference /
+ *  Default) from the local tasks of a LoadBalancer without performing the
+ *  integration:
+ *    - the per thread XCHostData buffers, each sized by the largest task,
+ *    - the replicated output matrices (VXC / K / FXC),
+ *    - the task data generated on first use (SoA points, submatrix maps),
+ *    - for sn-LinK, the ShellPairCollection and the dense nbf x ntasks
+ *      screening arrays. The EK screening dependent dimensions are bounded
+ *      by nbf and the EK task data is not modeled.
+ *
+ *  Collective over the runtime of the LoadBalancer.
+ *
+ *  @param[in] lb        LoadBalancer with the partition weights applied
+ *  @param[in] settings  Integrand, functional class, spin and thread count
+ *  @returns   The estimate of this rank along with the totals of all ranks
+ */
+MemoryEstimate estimate_memory( const LoadBalancer& lb,
+  const MemoryEstimateSettings& settings = MemoryEstimateSettings{} );
+
+}
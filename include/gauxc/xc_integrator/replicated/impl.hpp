@@ -157,15 +157,119 @@ typename ReplicatedXCIntegrator<MatrixType>::exc_vxc_type_gks
 
 }
 
+template <typename MatrixType>
+typename ReplicatedXCIntegrator<MatrixType>::fxc_type_rks
+  ReplicatedXCIntegrator<MatrixType>::eval_fxc_contraction_( const MatrixType& P, 
+    const std::vector<MatrixType>& tP, const IntegratorSettingsXC& ks_settings ) {
+
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+
+  const size_t n      = P.rows();
+  const size_t ntrial = tP.size();
+  const size_t n2     = n * n;
+
+  // Pack trial densities contiguously
+  std::vector<value_type> tP_pack( ntrial * n2 ), FXC_pack( ntrial * n2 );
+  for( size_t k = 0; k < ntrial; ++k ) {
+    if( size_t(tP[k].rows()) != n or size_t(tP[k].cols()) != n )
+      GAUXC_GENERIC_EXCEPTION("Trial Density Dimension Mismatch");
+    std::copy_n( tP[k].data(), n2, tP_pack.data() + k*n2 );
+  }
+
+  pimpl_->eval_fxc_contraction( n, n, P.data(), n, ntrial, tP_pack.data(), n,
+                                FXC_pack.data(), n, ks_settings );
+
+  fxc_type_rks FXC( ntrial, matrix_type( n, n ) );
+  for( size_t k = 0; k < ntrial; ++k ) 
+    std::copy_n( FXC_pack.data() + k*n2, n2, FXC[k].data() );
+
+  return FXC;
+
+}
+
+template <typename MatrixType>
+typename ReplicatedXCIntegrator<MatrixType>::fxc_type_uks
+  ReplicatedXCIntegrator<MatrixType>::eval_fxc_contraction_( const MatrixType& Ps, 
+    const MatrixType& Pz, const std::vector<MatrixType>& tPs, 
+    const std::vector<MatrixType>& tPz, const IntegratorSettingsXC& ks_settings ) {
+
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+
+  const size_t n      = Ps.rows();
+  const size_t ntrial = tPs.size();
+  const size_t n2     = n * n;
+  if( tPz.size() != ntrial )
+    GAUXC_GENERIC_EXCEPTION("Inconsistent Number of Trial Densities");
+
+  // Pack trial densities contiguously
+  std::vector<value_type> tPs_pack( ntrial * n2 ), tPz_pack( ntrial * n2 );
+  std::vector<value_type> FXCs_pack( ntrial * n2 ), FXCz_pack( ntrial * n2 );
+  for( size_t k = 0; k < ntrial; ++k ) {
+    if( size_t(tPs[k].rows()) != n or size_t(tPs[k].cols()) != n or
+        size_t(tPz[k].rows()) != n or size_t(tPz[k].cols()) != n )
+      GAUXC_GENERIC_EXCEPTION("Trial Density Dimension Mismatch");
+    std::copy_n( tPs[k].data(), n2, tPs_pack.data() + k*n2 );
+    std::copy_n( tPz[k].data(), n2, tPz_pack.data() + k*n2 );
+  }
+
+  pimpl_->eval_fxc_contraction( n, n, Ps.data(), n, Pz.data(), n, ntrial,
+                                tPs_pack.data(), n, tPz_pack.data(), n,
+                                FXCs_pack.data(), n, FXCz_pack.data(), n, 
+                                ks_settings );
+
+  std::vector<matrix_type> FXCs( ntrial, matrix_type( n, n ) );
+  std::vector<matrix_type> FXCz( ntrial, matrix_type( n, n ) );
+  for( size_t k = 0; k < ntrial; ++k ) {
+    std::copy_n( FXCs_pack.data() + k*n2, n2, FXCs[k].data() );
+    std::copy_n( FXCz_pack.data() + k*n2, n2, FXCz[k].data() );
+  }
+
+  return std::make_tuple( FXCs, FXCz );
+
+}
+
 template <typename MatrixType>
 typename ReplicatedXCIntegrator<MatrixType>::exc_grad_type 
-  ReplicatedXCIntegrator<MatrixType>::eval_exc_grad_( const MatrixType& P ) {
+  ReplicatedXCIntegrator<MatrixType>::eval_exc_grad_( const MatrixType& P,
+    const IntegratorSettingsXC& settings ) {
 
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
 
   std::vector<value_type> EXC_GRAD( 3*pimpl_->load_balancer().molecule().natoms() );
   pimpl_->eval_exc_grad( P.rows(), P.cols(), P.data(), P.rows(),
-                         EXC_GRAD.data() );
+                         EXC_GRAD.data(), settings );
+
+  return EXC_GRAD;
+
+}
+
+template <typename MatrixType>
+typename ReplicatedXCIntegrator<MatrixType>::exc_grad_type 
+  ReplicatedXCIntegrator<MatrixType>::eval_exc_grad_( const MatrixType& Ps,
+    const MatrixType& Pz, const IntegratorSettingsXC& settings ) {
+
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+
+  std::vector<value_type> EXC_GRAD( 3*pimpl_->load_balancer().molecule().natoms() );
+  pimpl_->eval_exc_grad( Ps.rows(), Ps.cols(), Ps.data(), Ps.rows(),
+                         Pz.data(), Pz.rows(), EXC_GRAD.data(), settings );
+
+  return EXC_GRAD;
+
+}
+
+template <typename MatrixType>
+typename ReplicatedXCIntegrator<MatrixType>::exc_grad_type 
+  ReplicatedXCIntegrator<MatrixType>::eval_exc_grad_( const MatrixType& Ps,
+    const MatrixType& Pz, const MatrixType& Py, const MatrixType& Px, 
+    const IntegratorSettingsXC& settings ) {
+
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+
+  std::vector<value_type> EXC_GRAD( 3*pimpl_->load_balancer().molecule().natoms() );
+  pimpl_->eval_exc_grad( Ps.rows(), Ps.cols(), Ps.data(), Ps.rows(),
+                         Pz.data(), Pz.rows(), Py.data(), Py.rows(),
+                         Px.data(), Px.rows(), EXC_GRAD.data(), settings );
 
   return EXC_GRAD;
 
@@ -186,5 +290,53 @@ typename ReplicatedXCIntegrator<MatrixType>::exx_type
 
 }
 
+template <typename MatrixType>
+typename ReplicatedXCIntegrator<MatrixType>::exx_type_multi 
+  ReplicatedXCIntegrator<MatrixType>::eval_exx_( const std::vector<MatrixType>& P, 
+    const IntegratorSettingsEXX& settings ) {
+
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  if( P.empty() ) return exx_type_multi{};
+
+  const size_t nmat = P.size();
+  const int64_t n   = P[0].rows();
+  const size_t n2   = n * n;
+
+  // Pack the density matrices contiguously
+  std::vector<value_type> P_pack( nmat * n2 ), K_pack( nmat * n2 );
+  for( size_t i = 0; i < nmat; ++i ) {
+    if( P[i].rows() != n or P[i].cols() != n )
+      GAUXC_GENERIC_EXCEPTION("Inconsistent Density Matrix Dimensions");
+    std::copy_n( P[i].data(), n2, P_pack.data() + i * n2 );
+  }
+
+  pimpl_->eval_exx( n, n, nmat, P_pack.data(), n, K_pack.data(), n, settings );
+
+  exx_type_multi K( nmat, matrix_type( n, n ) );
+  for( size_t i = 0; i < nmat; ++i ) 
+    std::copy_n( K_pack.data() + i * n2, n2, K[i].data() );
+
+  return K;
+
+}
+
+template <typename MatrixType>
+typename ReplicatedXCIntegrator<MatrixType>::exc_vxc_exx_type_rks 
+  ReplicatedXCIntegrator<MatrixType>::eval_exc_vxc_exx_( const MatrixType& P, 
+    const IntegratorSettingsXC& ks_settings, const IntegratorSettingsEXX& exx_settings ) {
+
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  matrix_type VXC( P.rows(), P.cols() );
+  matrix_type K  ( P.rows(), P.cols() );
+  value_type  EXC;
+
+  pimpl_->eval_exc_vxc_exx( P.rows(), P.cols(), P.data(), P.rows(),
+                            VXC.data(), VXC.rows(), K.data(), K.rows(), &EXC, 
+                            ks_settings, exx_settings );
+
+  return std::make_tuple( EXC, VXC, K );
+
+}
+
 }
 }
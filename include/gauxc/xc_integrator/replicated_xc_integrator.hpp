@@ -33,6 +33,10 @@ public:
   using exc_vxc_type_gks   = typename XCIntegratorImpl<MatrixType>::exc_vxc_type_gks;
   using exc_grad_type  = typename XCIntegratorImpl<MatrixType>::exc_grad_type;
   using exx_type       = typename XCIntegratorImpl<MatrixType>::exx_type;
+  using exx_type_multi = typename XCIntegratorImpl<MatrixType>::exx_type_multi;
+  using exc_vxc_exx_type_rks = typename XCIntegratorImpl<MatrixType>::exc_vxc_exx_type_rks;
+  using fxc_type_rks   = typename XCIntegratorImpl<MatrixType>::fxc_type_rks;
+  using fxc_type_uks   = typename XCIntegratorImpl<MatrixType>::fxc_type_uks;
 
 private:
 
@@ -46,8 +50,19 @@ private:
   exc_vxc_type_rks  eval_exc_vxc_ ( const MatrixType&, const IntegratorSettingsXC& ) override;
   exc_vxc_type_uks  eval_exc_vxc_ ( const MatrixType&, const MatrixType&, const IntegratorSettingsXC&) override;
   exc_vxc_type_gks  eval_exc_vxc_ ( const MatrixType&, const MatrixType&, const MatrixType&, const MatrixType&, const IntegratorSettingsXC& ) override;
-  exc_grad_type eval_exc_grad_( const MatrixType& ) override;
+  fxc_type_rks  eval_fxc_contraction_( const MatrixType&, const std::vector<MatrixType>&, 
+                                      const IntegratorSettingsXC& ) override;
+  fxc_type_uks  eval_fxc_contraction_( const MatrixType&, const MatrixType&, 
+                                      const std::vector<MatrixType>&, const std::vector<MatrixType>&,
+                                      const IntegratorSettingsXC& ) override;
+  exc_grad_type eval_exc_grad_( const MatrixType&, const IntegratorSettingsXC& ) override;
+  exc_grad_type eval_exc_grad_( const MatrixType&, const MatrixType&, const IntegratorSettingsXC& ) override;
+  exc_grad_type eval_exc_grad_( const MatrixType&, const MatrixType&, const MatrixType&, const MatrixType&, 
+                                const IntegratorSettingsXC& ) override;
   exx_type      eval_exx_     ( const MatrixType&, const IntegratorSettingsEXX& ) override;
+  exx_type_multi eval_exx_    ( const std::vector<MatrixType>&, const IntegratorSettingsEXX& ) override;
+  exc_vxc_exx_type_rks eval_exc_vxc_exx_( const MatrixType&, const IntegratorSettingsXC&,
+                                          const IntegratorSettingsEXX& ) override;
   const util::Timer& get_timings_() const override;
   const LoadBalancer& get_load_balancer_() const override;
   LoadBalancer& get_load_balancer_() override;
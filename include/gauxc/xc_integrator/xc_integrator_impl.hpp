@@ -25,6 +25,10 @@ public:
   using exc_vxc_type_gks   = typename XCIntegrator<MatrixType>::exc_vxc_type_gks;
   using exc_grad_type  = typename XCIntegrator<MatrixType>::exc_grad_type;
   using exx_type       = typename XCIntegrator<MatrixType>::exx_type;
+  using exx_type_multi = typename XCIntegrator<MatrixType>::exx_type_multi;
+  using exc_vxc_exx_type_rks = typename XCIntegrator<MatrixType>::exc_vxc_exx_type_rks;
+  using fxc_type_rks   = typename XCIntegrator<MatrixType>::fxc_type_rks;
+  using fxc_type_uks   = typename XCIntegrator<MatrixType>::fxc_type_uks;
 
 protected:
 
@@ -38,9 +42,26 @@ protected:
   virtual exc_vxc_type_uks  eval_exc_vxc_ ( const MatrixType& Ps, const MatrixType& Pz, const IntegratorSettingsXC& ks_settings ) = 0;
   virtual exc_vxc_type_gks  eval_exc_vxc_ ( const MatrixType& Ps, const MatrixType& Pz, const MatrixType& Py, const MatrixType& Px, 
                                             const IntegratorSettingsXC& ks_settings ) = 0;
-  virtual exc_grad_type eval_exc_grad_( const MatrixType& P ) = 0;
+  virtual fxc_type_rks  eval_fxc_contraction_( const MatrixType& P, 
+                                               const std::vector<MatrixType>& tP,
+                                               const IntegratorSettingsXC& ks_settings ) = 0;
+  virtual fxc_type_uks  eval_fxc_contraction_( const MatrixType& Ps, const MatrixType& Pz,
+                                               const std::vector<MatrixType>& tPs,
+                                               const std::vector<MatrixType>& tPz,
+                                               const IntegratorSettingsXC& ks_settings ) = 0;
+  virtual exc_grad_type eval_exc_grad_( const MatrixType& P, const IntegratorSettingsXC& settings ) = 0;
+  virtual exc_grad_type eval_exc_grad_( const MatrixType& Ps, const MatrixType& Pz, 
+                                        const IntegratorSettingsXC& settings ) = 0;
+  virtual exc_grad_type eval_exc_grad_( const MatrixType& Ps, const MatrixType& Pz, 
+                                        const MatrixType& Py, const MatrixType& Px,
+                                        const IntegratorSettingsXC& settings ) = 0;
   virtual exx_type      eval_exx_     ( const MatrixType&     P, 
                                         const IntegratorSettingsEXX& settings ) = 0;
+  virtual exx_type_multi eval_exx_    ( const std::vector<MatrixType>& P, 
+                                        const IntegratorSettingsEXX& settings ) = 0;
+  virtual exc_vxc_exx_type_rks eval_exc_vxc_exx_( const MatrixType& P,
+                                                  const IntegratorSettingsXC&  ks_settings,
+                                                  const IntegratorSettingsEXX& exx_settings ) = 0;
   virtual const util::Timer& get_timings_() const = 0;
   virtual const LoadBalancer& get_load_balancer_() const = 0;
   virtual LoadBalancer& get_load_balancer_() = 0;
@@ -107,15 +128,65 @@ public:
     return eval_exc_vxc_(Ps, Pz, Py, Px, ks_settings);
   }
 
+  /** Contract the XC kernel (FXC) with a set of trial densities for RKS
+   *
+   *  @param[in] P  The ground state density matrix
+   *  @param[in] tP The trial (transition) density matrices
+   *  @returns FXC contracted with each trial density, in the order of tP
+   */
+  fxc_type_rks eval_fxc_contraction( const MatrixType& P, 
+    const std::vector<MatrixType>& tP, const IntegratorSettingsXC& ks_settings ) {
+    return eval_fxc_contraction_(P, tP, ks_settings);
+  }
+
+  /** Contract the XC kernel (FXC) with a set of trial densities for UKS
+   *
+   *  @param[in] Ps  The ground state scalar density matrix
+   *  @param[in] Pz  The ground state Z density matrix
+   *  @param[in] tPs The scalar components of the trial densities
+   *  @param[in] tPz The Z components of the trial densities
+   *  @returns Scalar / Z components of FXC contracted with each trial density
+   */
+  fxc_type_uks eval_fxc_contraction( const MatrixType& Ps, const MatrixType& Pz,
+    const std::vector<MatrixType>& tPs, const std::vector<MatrixType>& tPz, 
+    const IntegratorSettingsXC& ks_settings ) {
+    return eval_fxc_contraction_(Ps, Pz, tPs, tPz, ks_settings);
+  }
+
   /** Integrate EXC gradient for RKS
-   * 
-   *   TODO: add API for UKS/GKS
+   *
+   *  Partition weight derivatives are included if requested through
+   *  IntegratorSettingsEXCGrad
    *
    *  @param[in] P The alpha density matrix
    *  @returns EXC gradient
    */
-  exc_grad_type eval_exc_grad( const MatrixType& P ) {
-    return eval_exc_grad_(P);
+  exc_grad_type eval_exc_grad( const MatrixType& P, const IntegratorSettingsXC& settings ) {
+    return eval_exc_grad_(P, settings);
+  }
+
+  /** Integrate EXC gradient for UKS
+   *
+   *  @param[in] Ps The scalar density matrix (alpha + beta)
+   *  @param[in] Pz The Z density matrix (alpha - beta)
+   *  @returns EXC gradient
+   */
+  exc_grad_type eval_exc_grad( const MatrixType& Ps, const MatrixType& Pz, 
+    const IntegratorSettingsXC& settings ) {
+    return eval_exc_grad_(Ps, Pz, settings);
+  }
+
+  /** Integrate EXC gradient for GKS
+   *
+   *  @param[in] Ps The scalar density matrix
+   *  @param[in] Pz The Z density matrix
+   *  @param[in] Py The Y density matrix
+   *  @param[in] Px The X density matrix
+   *  @returns EXC gradient
+   */
+  exc_grad_type eval_exc_grad( const MatrixType& Ps, const MatrixType& Pz, 
+    const MatrixType& Py, const MatrixType& Px, const IntegratorSettingsXC& settings ) {
+    return eval_exc_grad_(Ps, Pz, Py, Px, settings);
   }
 
   /** Integrate Exact Exchange for RHF
@@ -127,6 +198,34 @@ public:
     return eval_exx_(P,settings);
   }
 
+  /** Integrate Exact Exchange for several density matrices
+   *
+   *  The EK screening is performed once for all densities (e.g. alpha / beta
+   *  or a set of symmetrized response densities) and the grid integrals are
+   *  shared. The density matrices must be symmetric
+   *
+   *  @param[in] P The density matrices
+   *  @returns Exact Exchange Matrices, in the order of P
+   */
+  exx_type_multi eval_exx( const std::vector<MatrixType>& P, 
+    const IntegratorSettingsEXX& settings ) {
+    return eval_exx_(P,settings);
+  }
+
+  /** Integrate EXC / VXC and Exact Exchange for RKS in a single pass
+   *
+   *  Collocation and P*B are shared between the XC and sn-LinK
+   *  pipelines, and all results are reduced in one step.
+   *
+   *  @param[in] P The alpha density matrix
+   *  @returns EXC / VXC / K in a combined structure
+   */
+  exc_vxc_exx_type_rks eval_exc_vxc_exx( const MatrixType& P, 
+    const IntegratorSettingsXC& ks_settings, 
+    const IntegratorSettingsEXX& exx_settings ) {
+    return eval_exc_vxc_exx_(P, ks_settings, exx_settings);
+  }
+
   /** Get internal timers
    *
    *  @returns Timer instance for internal timings
@@ -7,6 +7,10 @@
  */
 #pragma once
 
+#include <gauxc/enums.hpp>
+#include <cstddef>
+#include <limits>
+
 namespace GauXC {
 
 struct IntegratorSettingsEXX { virtual ~IntegratorSettingsEXX() noexcept = default; };
@@ -14,11 +18,39 @@ struct IntegratorSettingsSNLinK : public IntegratorSettingsEXX {
   bool screen_ek = true;
   double energy_tol = 1e-10;
   double k_tol      = 1e-10;
+  TaskMergePolicy merge_policy = TaskMergePolicy::Hash; ///< Merge strategy for EK-screened tasks
+
+  /// Exchange operator, full_range_coeff / r + long_range_coeff * erf(omega r) / r
+  /// + short_range_coeff * erfc(omega r) / r. All terms are evaluated in a single pass
+  double omega             = 0.0; ///< Range-separation parameter (bohr^-1)
+  double full_range_coeff  = 1.0; ///< Coefficient of 1/r
+  double long_range_coeff  = 0.0; ///< Coefficient of erf(omega r) / r
+  double short_range_coeff = 0.0; ///< Coefficient of erfc(omega r) / r
 };
 
 struct IntegratorSettingsXC { virtual ~IntegratorSettingsXC() noexcept = default; };
 struct IntegratorSettingsKS : public IntegratorSettingsXC {
   double gks_dtol = 1e-12;
+
+  /// Evaluate the collocation, X and Z matrices in float32 with double 
+  /// accumulation of EXC / VXC (host RKS/UKS LDA/GGA, double otherwise)
+  bool   mixed_precision     = false;
+  double mixed_precision_tol = 0.0; ///< Revert to double once scf_error < mixed_precision_tol
+  double scf_error = std::numeric_limits<double>::infinity(); ///< Current SCF error, supplied by the caller
+
+  /// Host memory (bytes) available to the staged P / VXC submatrices of the
+  /// shell-batched integrators, determines the batch size. 0 selects half of
+  /// the available physical memory, shared evenly by the ranks on the node
+  size_t host_memory_budget = 0;
+};
+struct IntegratorSettingsFXC : public IntegratorSettingsKS {
+  double fd_step = 1e-4; ///< Relative step for the pointwise differentiation of VXC
+  size_t ground_state_cache_bytes = 1ul << 30;
+    ///< Bound on the ground state data (host) retained for subsequent 
+    ///< contractions with the same density, 0 disables and releases the cache
+};
+struct IntegratorSettingsEXCGrad : public IntegratorSettingsKS {
+  bool include_weight_derivatives = false; ///< Include the derivatives of the partition weights
 };
 
 }
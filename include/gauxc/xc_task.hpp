@@ -15,6 +15,7 @@
 #include <gauxc/gauxc_config.hpp>
 #include <gauxc/shell.hpp>
 #include <gauxc/exceptions.hpp>
+#include <gauxc/util/aligned_allocator.hpp>
 
 namespace GauXC {
 
@@ -28,6 +29,15 @@ struct XCTask {
   double                               dist_nearest;
   double                               max_weight = std::numeric_limits<double>::infinity();
 
+  /**
+   *  Host-side structure-of-arrays copy of `points` stored as
+   *  [ x(npts) | y(npts) | z(npts) ] in a single 64-byte aligned buffer.
+   *
+   *  Derived data: not serialized and not communicated, populated on demand
+   *  by `generate_points_soa` and invalidated by task merges.
+   */
+  util::aligned_vector<double>         points_soa;
+
   struct screening_data {
     using pair_t = std::pair<int32_t,int32_t>;
     std::vector<int32_t>               shell_list;
@@ -63,6 +73,7 @@ struct XCTask {
     points.insert( points.end(), other.points.begin(), other.points.end() );
     weights.insert( weights.end(), other.weights.begin(), other.weights.end() );
     npts = points.size();
+    points_soa.clear();
   }
 
   template <typename TaskIt>
@@ -88,8 +99,32 @@ struct XCTask {
     }
 
     npts = points.size();
+    points_soa.clear();
+  }
+
+  /// Whether `points_soa` is consistent with `points`
+  inline bool has_points_soa() const {
+    return points_soa.size() == 3 * points.size();
   }
 
+  /// (Re)generate the SoA point storage from `points`
+  inline void generate_points_soa() {
+    const size_t np = points.size();
+    points_soa.resize( 3 * np );
+    double* x = points_soa.data();
+    double* y = x + np;
+    double* z = y + np;
+    for( size_t i = 0; i < np; ++i ) {
+      x[i] = points[i][0];
+      y[i] = points[i][1];
+      z[i] = points[i][2];
+    }
+  }
+
+  inline const double* points_x() const { return points_soa.data(); }
+  inline const double* points_y() const { return points_soa.data() + points.size(); }
+  inline const double* points_z() const { return points_soa.data() + 2*points.size(); }
+
 
   inline bool equiv_with( const XCTask& other ) const {
     return iParent == other.iParent and 
@@ -24,4 +24,11 @@ Grid::~Grid() noexcept = default;
 const batcher_type& Grid::batcher() const { return pimpl_->batcher(); }
       batcher_type& Grid::batcher()       { return pimpl_->batcher(); }
 
+grid_batch_type Grid::translated_batch( size_t ibatch, 
+  const std::array<double,3>& center ) const {
+  return pimpl_->translated_batch( ibatch, center );
+}
+
+size_t Grid::nbatches() const { return pimpl_->nbatches(); }
+
 }
@@ -12,7 +12,9 @@
 #include <integratorxx/quadratures/mhl.hpp>
 #include <integratorxx/quadratures/treutlerahlrichs.hpp>
 #include <integratorxx/composite_quadratures/spherical_quadrature.hpp>
+#include <gauxc/molgrid/defaults.hpp>
 #include <gauxc/exceptions.hpp>
+#include <cmath>
 
 namespace GauXC {
 
@@ -204,6 +206,142 @@ PrunedAtomicGridSpecification treutler_pruning_scheme(
 }
 
 
+namespace {
+
+/// Radial nodes and weights (including the r**2 Jacobian) of a radial quadrature
+std::tuple<std::vector<double>, std::vector<double>> radial_quadrature_nodes(
+  RadialQuad rq, RadialSize nrad, RadialScale rscal ) {
+
+  using mk_type  = IntegratorXX::MuraKnowles<double,double>;
+  using mhl_type = IntegratorXX::MurrayHandyLaming<double,double>;
+  using ta_type  = IntegratorXX::TreutlerAhlrichs<double,double>;
+
+  auto nodes = [](const auto& q) {
+    return std::make_tuple( 
+      std::vector<double>( q.points().begin(),  q.points().end()  ),
+      std::vector<double>( q.weights().begin(), q.weights().end() )
+    );
+  };
+
+  switch( rq ) {
+    case RadialQuad::MuraKnowles:
+      return nodes( mk_type(nrad.get(), rscal.get()) );
+    case RadialQuad::MurrayHandyLaming:
+      return nodes( mhl_type(nrad.get(), rscal.get()) );
+    case RadialQuad::TreutlerAldrichs:
+      return nodes( ta_type(nrad.get(), rscal.get()) );
+    default:
+      GAUXC_GENERIC_EXCEPTION("Unsupported Radial Quadrature");
+      abort();
+  }
+
+}
+
+}
+
+PrunedAtomicGridSpecification adaptive_pruning_scheme( AtomicNumber Z,
+  UnprunedAtomicGridSpecification unp, double target_error ) {
+
+  if( target_error <= 0. )
+    GAUXC_GENERIC_EXCEPTION("Adaptive Pruning Requires Positive Target Error");
+
+  // Look up order
+  // XXX: THIS ONLY WORKS FOR LEBEDEV
+  using namespace IntegratorXX::detail::lebedev;
+  using ll_type = IntegratorXX::LebedevLaikov<double>;
+  const auto asz = unp.angular_size.get();
+  const auto base_order = algebraic_order_by_npts(asz);
+  if( base_order < 0 ) GAUXC_GENERIC_EXCEPTION("Invalid Base Grid");
+
+  // Candidate angular quadratures, the last being the base quadrature
+  const int64_t low_order = 7;
+  std::vector<ll_type> ang_quads;
+  for( auto order = low_order; order < base_order; 
+       order = next_algebraic_order(order+1) ) {
+    ang_quads.emplace_back( npts_by_algebraic_order(order) );
+  }
+  ang_quads.emplace_back( asz );
+  const size_t nquad = ang_quads.size();
+
+  // Model integrand: Becke partitioned promolecular density of a homonuclear 
+  // diatomic, with the neighbour at twice the atomic radius (but no closer
+  // than the H2 bond length) along a direction of no particular symmetry
+  const double R = std::max( 2. * default_atomic_radius(Z), 1.4 );
+  const double R_fac = R / std::sqrt(14.);
+  const std::array<double,3> B = { R_fac, 2. * R_fac, 3. * R_fac };
+  auto integrand = [&]( double x, double y, double z ) {
+    const double rA = std::sqrt( x*x + y*y + z*z );
+    const double rB = std::sqrt( (x-B[0])*(x-B[0]) + (y-B[1])*(y-B[1]) + 
+                                 (z-B[2])*(z-B[2]) );
+    double mu = (rA - rB) / R;
+    for( int i = 0; i < 3; ++i ) mu = 1.5 * mu - 0.5 * mu * mu * mu;
+    return 0.5 * (1. - mu) * 
+      ( promolecular_density(Z, rA) + promolecular_density(Z, rB) );
+  };
+
+  auto shell_integral = [&]( double r, const ll_type& q ) {
+    double res = 0.;
+    for( size_t i = 0; i < q.npts(); ++i ) {
+      const auto& p = q.points()[i];
+      res += q.weights()[i] * integrand( r * p[0], r * p[1], r * p[2] );
+    }
+    return res;
+  };
+
+  // Select the coarsest angular quadrature per radial shell
+  auto [rad_pts, rad_wgt] = radial_quadrature_nodes( unp.radial_quad,
+    unp.radial_size, unp.radial_scale );
+  const size_t rsz = rad_pts.size();
+  const double shell_tol = target_error / rsz;
+
+  std::vector<size_t> shell_quad( rsz, nquad - 1 );
+  for( size_t ir = 0; ir < rsz; ++ir ) {
+    const auto r   = rad_pts[ir];
+    const auto ref = shell_integral( r, ang_quads.back() );
+    for( size_t iq = 0; iq < nquad - 1; ++iq ) {
+      const auto err = rad_wgt[ir] * std::abs(shell_integral(r, ang_quads[iq]) - ref);
+      if( err <= shell_tol ) { shell_quad[ir] = iq; break; }
+    }
+  }
+
+  // Guard against accidentally small errors on isolated shells by taking 
+  // the maximum order over neighbouring shells
+  std::vector<size_t> smooth_quad( shell_quad );
+  for( size_t ir = 0; ir < rsz; ++ir ) {
+    if( ir > 0 )       smooth_quad[ir] = std::max( smooth_quad[ir], shell_quad[ir-1] );
+    if( ir < rsz - 1 ) smooth_quad[ir] = std::max( smooth_quad[ir], shell_quad[ir+1] );
+  }
+
+  // Create Pruning Regions
+  std::vector<PruningRegion> pruning_regions;
+  for( size_t ir = 0; ir < rsz; ++ir ) {
+    AngularSize ang_sz( ang_quads[smooth_quad[ir]].npts() );
+    if( pruning_regions.size() and 
+        pruning_regions.back().angular_size == ang_sz ) {
+      pruning_regions.back().idx_en = ir + 1;
+    } else {
+      pruning_regions.push_back({ ir, ir + 1, ang_sz });
+    }
+  }
+
+  return PrunedAtomicGridSpecification{
+    unp.radial_quad, unp.radial_size, unp.radial_scale, pruning_regions
+  };
+
+}
+
+
+PrunedAtomicGridSpecification create_pruned_spec(
+  PruningScheme scheme, AtomicNumber Z, UnprunedAtomicGridSpecification unp
+) {
+
+  if( scheme == PruningScheme::Adaptive ) 
+    return adaptive_pruning_scheme( Z, unp );
+  return create_pruned_spec( scheme, unp );
+
+}
+
+
 PrunedAtomicGridSpecification create_pruned_spec(
   PruningScheme scheme, UnprunedAtomicGridSpecification unp
 ) {
@@ -213,6 +351,9 @@ PrunedAtomicGridSpecification create_pruned_spec(
       return robust_psi4_pruning_scheme(unp);
     case PruningScheme::Treutler:
       return treutler_pruning_scheme(unp);
+    case PruningScheme::Adaptive:
+      GAUXC_GENERIC_EXCEPTION("Adaptive Pruning Requires AtomicNumber");
+      abort();
     
     // Default to Unpruned Grid
     case PruningScheme::Unpruned:
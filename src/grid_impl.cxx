@@ -6,6 +6,7 @@
  * See LICENSE.txt for details
  */
 #include "grid_impl.hpp"
+#include <iterator>
 
 namespace GauXC {
 namespace detail {
@@ -31,6 +32,51 @@ void GridImpl::generate_batcher(BatchSize max_batch_sz) {
     max_batch_sz.get(), quad_
   );
 
+  // Snapshot the reference quadrature after batching (which reorders the
+  // quadrature points) so that translated batches are unaffected by
+  // subsequent recentering of the shared quadrature
+  ref_points_  = quad_->points();
+  ref_weights_ = quad_->weights();
+
+  const auto*  pts_base = quad_->points().data();
+  const size_t nb       = batcher_->nbatches();
+  ref_batch_ranges_.resize( nb );
+  for( size_t i = 0; i < nb; ++i ) {
+    auto [ npts, pts_b, pts_en, w_b, w_en ] = (batcher_->begin() + i).range();
+    const size_t st = npts ? std::distance( pts_base, &(*pts_b) ) : 0;
+    ref_batch_ranges_[i] = { st, st + npts };
+  }
+
+}
+
+size_t GridImpl::nbatches() const { return ref_batch_ranges_.size(); }
+
+grid_batch_type GridImpl::translated_batch( size_t ibatch, 
+  const std::array<double,3>& center ) const {
+
+  const auto [st, en] = ref_batch_ranges_.at(ibatch);
+
+  quadrature_type::point_container points( 
+    ref_points_.begin() + st, ref_points_.begin() + en );
+  quadrature_type::weight_container weights( 
+    ref_weights_.begin() + st, ref_weights_.begin() + en );
+
+  for( auto& p : points ) {
+    p[0] += center[0];
+    p[1] += center[1];
+    p[2] += center[2];
+  }
+
+  std::array<double,3> lo = {0., 0., 0.}, up = {0., 0., 0.};
+  if( points.size() ) {
+    auto [_lo, _up] = 
+      IntegratorXX::detail::get_box_bounds_points( points.begin(), points.end() );
+    lo = { _lo[0], _lo[1], _lo[2] };
+    up = { _up[0], _up[1], _up[2] };
+  }
+
+  return grid_batch_type( lo, up, std::move(points), std::move(weights) );
+
 }
 
 }
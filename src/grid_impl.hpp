@@ -8,6 +8,7 @@
 #pragma once
 
 #include <gauxc/grid.hpp>
+#include <vector>
 
 namespace GauXC {
 namespace detail {
@@ -17,6 +18,11 @@ class GridImpl {
   std::shared_ptr< quadrature_type > quad_    = nullptr;
   std::shared_ptr< batcher_type    > batcher_ = nullptr;
 
+  // Immutable snapshot of the reference quadrature (in batch order)
+  quadrature_type::point_container  ref_points_;
+  quadrature_type::weight_container ref_weights_;
+  std::vector<std::pair<size_t,size_t>>      ref_batch_ranges_;
+
   void generate_batcher(BatchSize);
 
 public:
@@ -36,6 +42,10 @@ public:
   const batcher_type& batcher() const;
         batcher_type& batcher()      ;
 
+  grid_batch_type translated_batch( size_t ibatch, 
+    const std::array<double,3>& center ) const;
+  size_t nbatches() const;
+
 };
 
 }
@@ -0,0 +1,229 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "batch_partition.hpp"
+#include <gauxc/exceptions.hpp>
+#include <algorithm>
+#include <numeric>
+
+namespace GauXC  {
+namespace detail {
+
+std::string to_string( BatchPartitioner part ) {
+  switch( part ) {
+    case BatchPartitioner::Spherical: return "Spherical";
+    case BatchPartitioner::Octree:    return "Octree";
+    case BatchPartitioner::Bisection: return "Bisection";
+    default: GAUXC_GENERIC_EXCEPTION("Unknown BatchPartitioner");
+  }
+}
+
+namespace {
+
+using point_type = std::array<double,3>;
+
+/// A contiguous range of (permuted) points along with its screening data
+struct PartitionNode {
+  size_t begin, end;
+  point_type lo, up;
+  std::vector<int32_t> shell_list;
+  size_t nbe;
+
+  size_t npts() const { return end - begin; }
+
+  /// Modeled cost including a per-batch overhead (screening, submatrix
+  /// packing, dispatch) worth overhead_npts points
+  double cost( size_t overhead_npts ) const { 
+    return batch_cost_model( npts() + overhead_npts, nbe ); 
+  }
+};
+
+class SpatialPartitioner {
+
+  static constexpr int max_depth = 32;
+
+  const quadrature_type::point_container& points_;
+  std::vector<size_t> idx_;
+  size_t max_npts_, min_npts_;
+  const batch_screen_type& screen_;
+
+  std::vector<PartitionNode> leaves_;
+
+  PartitionNode make_node( size_t begin, size_t end ) const {
+    PartitionNode node{ begin, end, points_[idx_[begin]], points_[idx_[begin]], 
+      {}, 0ul };
+    for( auto i = begin + 1; i < end; ++i ) {
+      const auto& p = points_[idx_[i]];
+      for( int k = 0; k < 3; ++k ) {
+        node.lo[k] = std::min( node.lo[k], p[k] );
+        node.up[k] = std::max( node.up[k], p[k] );
+      }
+    }
+    std::tie( node.shell_list, node.nbe ) = screen_( node.lo, node.up );
+    return node;
+  }
+
+  /// Whether a node is small enough to never be split
+  bool is_terminal( const PartitionNode& node, int depth ) const {
+    return node.npts() <= 1 or depth >= max_depth or 
+      ( node.npts() <= max_npts_ and node.npts() < 2 * min_npts_ );
+  }
+
+  /// Whether the children of a node are to be retained in place of the node
+  bool accept_split( const PartitionNode& node, 
+    const std::vector<PartitionNode>& children ) const {
+    if( node.npts() > max_npts_ ) return true;
+    // Without the per-batch overhead, screening can only lower the cost of
+    // the children and nearly every split would be accepted
+    double child_cost = 0.;
+    for( const auto& c : children ) child_cost += c.cost( min_npts_ );
+    return child_cost < node.cost( min_npts_ );
+  }
+
+  void octree( PartitionNode&& node, point_type cell_lo, point_type cell_up, 
+    int depth ) {
+
+    if( is_terminal( node, depth ) ) { leaves_.emplace_back( std::move(node) ); return; }
+
+    point_type mid;
+    for( int k = 0; k < 3; ++k ) mid[k] = 0.5 * (cell_lo[k] + cell_up[k]);
+
+    // Partition the point range into octants (bit k set <=> upper half in k)
+    std::array<size_t,9> bounds; bounds[0] = node.begin; bounds[8] = node.end;
+    auto split_range = [&]( size_t b, size_t e, int k ) {
+      return std::distance( idx_.begin(), std::partition( idx_.begin() + b, 
+        idx_.begin() + e, [&]( auto i ){ return points_[i][k] < mid[k]; } ) );
+    };
+    bounds[4] = split_range( bounds[0], bounds[8], 2 );
+    bounds[2] = split_range( bounds[0], bounds[4], 1 );
+    bounds[6] = split_range( bounds[4], bounds[8], 1 );
+    for( int i = 0; i < 8; i += 2 )
+      bounds[i+1] = split_range( bounds[i], bounds[i+2], 0 );
+
+    std::vector<PartitionNode> children;
+    std::vector<std::pair<point_type,point_type>> child_cells;
+    for( int oct = 0; oct < 8; ++oct ) 
+    if( bounds[oct+1] > bounds[oct] ) {
+      children.emplace_back( make_node( bounds[oct], bounds[oct+1] ) );
+      point_type lo, up;
+      for( int k = 0; k < 3; ++k ) {
+        const bool upper = oct & (1 << k);
+        lo[k] = upper ? mid[k]     : cell_lo[k];
+        up[k] = upper ? cell_up[k] : mid[k];
+      }
+      child_cells.emplace_back( lo, up );
+    }
+
+    if( not accept_split( node, children ) ) {
+      leaves_.emplace_back( std::move(node) ); return;
+    }
+
+    for( size_t i = 0; i < children.size(); ++i )
+      octree( std::move(children[i]), child_cells[i].first, 
+        child_cells[i].second, depth + 1 );
+
+  }
+
+  void bisection( PartitionNode&& node, int depth ) {
+
+    if( is_terminal( node, depth ) ) { leaves_.emplace_back( std::move(node) ); return; }
+
+    // Median split along the longest extent of the node
+    int axis = 0;
+    for( int k = 1; k < 3; ++k )
+      if( node.up[k] - node.lo[k] > node.up[axis] - node.lo[axis] ) axis = k;
+    if( node.up[axis] == node.lo[axis] ) { 
+      leaves_.emplace_back( std::move(node) ); return;
+    }
+
+    const size_t mid = node.begin + node.npts() / 2;
+    std::nth_element( idx_.begin() + node.begin, idx_.begin() + mid, 
+      idx_.begin() + node.end, [&]( auto i, auto j ) {
+        return points_[i][axis] < points_[j][axis];
+      });
+
+    std::vector<PartitionNode> children;
+    children.emplace_back( make_node( node.begin, mid ) );
+    children.emplace_back( make_node( mid, node.end ) );
+
+    if( not accept_split( node, children ) ) {
+      leaves_.emplace_back( std::move(node) ); return;
+    }
+
+    for( auto& c : children ) bisection( std::move(c), depth + 1 );
+
+  }
+
+public:
+
+  SpatialPartitioner( const quadrature_type::point_container& points, 
+    size_t max_npts, size_t min_npts, const batch_screen_type& screen ) :
+    points_(points), idx_(points.size()), max_npts_(max_npts), 
+    min_npts_(min_npts), screen_(screen) {
+    std::iota( idx_.begin(), idx_.end(), 0ul );
+  }
+
+  void run( BatchPartitioner part, const point_type& root_lo, 
+    const point_type& root_up ) {
+
+    if( not points_.size() ) return;
+    auto root = make_node( 0, points_.size() );
+    switch( part ) {
+      case BatchPartitioner::Octree:
+        octree( std::move(root), root_lo, root_up, 0 ); break;
+      case BatchPartitioner::Bisection:
+        bisection( std::move(root), 0 ); break;
+      default:
+        GAUXC_GENERIC_EXCEPTION("Partitioner Not Supported: " + to_string(part));
+    }
+
+  }
+
+  const auto& leaves() const { return leaves_; }
+  const auto& permutation() const { return idx_; }
+
+};
+
+}
+
+std::vector<ScreenedBatch> partition_points( BatchPartitioner part,
+  quadrature_type::point_container&& points, 
+  quadrature_type::weight_container&& weights,
+  const std::array<double,3>& root_lo, const std::array<double,3>& root_up,
+  size_t max_npts, size_t min_npts, const batch_screen_type& screen ) {
+
+  if( points.size() != weights.size() ) 
+    GAUXC_GENERIC_EXCEPTION("Points / Weights Size Mismatch");
+  if( not max_npts ) GAUXC_GENERIC_EXCEPTION("Invalid max_npts");
+
+  SpatialPartitioner partitioner( points, max_npts, min_npts, screen );
+  partitioner.run( part, root_lo, root_up );
+
+  const auto& idx = partitioner.permutation();
+  std::vector<ScreenedBatch> batches;
+  for( const auto& leaf : partitioner.leaves() ) {
+
+    // Course grain screening
+    if( not leaf.shell_list.size() ) continue;
+
+    ScreenedBatch batch{ leaf.lo, leaf.up, {}, {}, leaf.shell_list, leaf.nbe };
+    batch.points.reserve( leaf.npts() );
+    batch.weights.reserve( leaf.npts() );
+    for( auto i = leaf.begin; i < leaf.end; ++i ) {
+      batch.points.emplace_back( points[idx[i]] );
+      batch.weights.emplace_back( weights[idx[i]] );
+    }
+    batches.emplace_back( std::move(batch) );
+
+  }
+
+  return batches;
+
+}
+
+}
+}
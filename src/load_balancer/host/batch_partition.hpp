@@ -0,0 +1,69 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/grid.hpp>
+#include <gauxc/enums.hpp>
+#include <functional>
+#include <vector>
+
+namespace GauXC  {
+namespace detail {
+
+/// Modeled cost of a quadrature batch (see XCTask::cost_exc_vxc)
+inline double batch_cost_model( size_t npts, size_t nbe, size_t n_deriv = 1 ) {
+  return double(nbe) * double(1 + nbe + n_deriv) * double(npts);
+}
+
+/// A screened quadrature batch generated by a spatial partitioner
+struct ScreenedBatch {
+  std::array<double,3> lo, up;               ///< Tight bounding box of the points
+  quadrature_type::point_container  points;  ///< Quadrature points
+  quadrature_type::weight_container weights; ///< Quadrature weights
+  std::vector<int32_t> shell_list;           ///< Shells which survive screening
+  size_t nbe;                                ///< Number of basis functions in shell_list
+};
+
+/// Screening callback: (box_lo, box_up) -> (shell_list, nbe)
+using batch_screen_type = std::function< 
+  std::pair<std::vector<int32_t>,size_t>( const std::array<double,3>&, 
+    const std::array<double,3>& ) >;
+
+/// Printable name for a BatchPartitioner
+std::string to_string( BatchPartitioner part );
+
+/**
+ *  @brief Partition a set of quadrature points into screened batches
+ *
+ *  Nodes are split while they either exceed `max_npts` points or the sum of
+ *  the modeled cost (batch_cost_model) of their children is lower than that
+ *  of the node itself. Each batch is charged an overhead of `min_npts` points
+ *  in the comparison, such that splits have to reduce the screened basis
+ *  dimension appreciably. Cost-driven splits are only attempted for nodes
+ *  with at least 2*`min_npts` points. Batches without any surviving shells
+ *  are discarded.
+ *
+ *  @param[in] part     Partitioning scheme (Octree or Bisection)
+ *  @param[in] points   Quadrature points to partition (consumed)
+ *  @param[in] weights  Quadrature weights to partition (consumed)
+ *  @param[in] root_lo  Lower bound of the octree root cell (Octree only)
+ *  @param[in] root_up  Upper bound of the octree root cell (Octree only)
+ *  @param[in] max_npts Maximum number of points per batch
+ *  @param[in] min_npts Target minimum number of points per batch
+ *  @param[in] screen   Basis screening for a bounding box
+ *
+ *  @returns Screened batches, in a deterministic order
+ */
+std::vector<ScreenedBatch> partition_points( BatchPartitioner part,
+  quadrature_type::point_container&& points, 
+  quadrature_type::weight_container&& weights,
+  const std::array<double,3>& root_lo, const std::array<double,3>& root_up,
+  size_t max_npts, size_t min_npts, const batch_screen_type& screen );
+
+}
+}
@@ -6,6 +6,12 @@
  * See LICENSE.txt for details
  */
 #include "replicated_host_load_balancer.hpp"
+#include "batch_partition.hpp"
+#include "symmetry_unique_points.hpp"
+#include <utility>
+#include <map>
+#include <limits>
+#include <optional>
 
 namespace GauXC {
 namespace detail {
@@ -25,33 +31,174 @@ std::vector< XCTask > HostReplicatedLoadBalancer::create_local_tasks_() const  {
   std::vector< XCTask > local_work;
   std::vector<size_t> global_workload( world_size, 0 );   
 
-  const auto natoms = this->mol_->natoms();
-  int32_t iCurrent  = 0;
-  int32_t atBatchSz = 1;
+  const auto  natoms = this->mol_->natoms();
+  const auto& mg     = std::as_const(*this->mg_);
 
-  const size_t max_nbatches = mg_->max_nbatches();
-  std::vector< std::pair<size_t, XCTask> > temp_tasks;
-  temp_tasks.reserve( max_nbatches );
+  // Flattened (atom, batch) index space in deterministic (serial) order
+  std::vector<size_t> atom_batch_offsets( natoms + 1, 0 );
+  for( size_t iAtom = 0; iAtom < natoms; ++iAtom ) {
+    const auto& atom = (*this->mol_)[iAtom];
+    atom_batch_offsets[iAtom+1] = atom_batch_offsets[iAtom] + 
+      mg.get_grid(atom.Z).nbatches();
+  }
+
+  // Assign tasks to MPI ranks in generation order for deterministic assignment
+  auto assign_task = [&]( XCTask&& task ) {
+
+    // Get rank with minimum work
+    auto min_rank_it = 
+      std::min_element( global_workload.begin(), global_workload.end() );
+    int64_t min_rank = std::distance( global_workload.begin(), min_rank_it );
+
+    // Compute cost heuristic and increment total work
+    global_workload[ min_rank ] += task.cost( n_deriv, natoms );
 
-  // For batching of multiple atom screening
-  size_t batch_idx_offset = 0;
+    if( world_rank == min_rank ) 
+      local_work.push_back( std::move(task) );
 
-  // Loop over Atoms
-  for( const auto& atom : *this->mol_ ) {
+  };
+
+  // Only generate the symmetry-unique points if a point group is exploited
+  std::optional<SymmetryUniquePoints> sym_points;
+  if( not state_.point_group.is_trivial() )
+    sym_points.emplace( state_.point_group, *this->mol_, mg );
 
+  auto translated_batch = [&]( size_t iAtom, size_t ibatch ) {
+    const auto& atom = (*this->mol_)[iAtom];
     const std::array<double,3> center = { atom.x, atom.y, atom.z };
+    const auto& grid = mg.get_grid(atom.Z);
+    return sym_points ? sym_points->translated_batch( grid, iAtom, ibatch, center )
+                      : grid.translated_batch( ibatch, center );
+  };
 
-    auto& batcher = mg_->get_grid(atom.Z).batcher();
-    batcher.quadrature().recenter( center );
-    const size_t nbatches = batcher.nbatches();
+  const auto partitioner = state_.batch_partitioner;
+  const bool spherical_batches = partitioner == BatchPartitioner::Spherical;
+
+  // Root cell for cost-driven partitioners: cube enclosing all atomic grids
+  std::array<double,3> root_lo = {0., 0., 0.}, root_up = {0., 0., 0.};
+  if( not spherical_batches ) {
+
+    std::map< int64_t, std::pair<std::array<double,3>,std::array<double,3>> > 
+      ref_bounds;
+    for( size_t iAtom = 0; iAtom < natoms; ++iAtom ) {
+      const auto& atom = (*this->mol_)[iAtom];
+      if( not ref_bounds.count(atom.Z.get()) ) {
+        const auto& grid = mg.get_grid(atom.Z);
+        std::array<double,3> lo, up;
+        lo.fill( std::numeric_limits<double>::infinity() );
+        up.fill( -std::numeric_limits<double>::infinity() );
+        for( size_t ib = 0; ib < grid.nbatches(); ++ib ) {
+          auto [blo, bup, pts, w] = grid.translated_batch( ib, {0., 0., 0.} );
+          if( not pts.size() ) continue;
+          for( int k = 0; k < 3; ++k ) {
+            lo[k] = std::min( lo[k], blo[k] );
+            up[k] = std::max( up[k], bup[k] );
+          }
+        }
+        ref_bounds[atom.Z.get()] = { lo, up };
+      }
 
-    #pragma omp parallel for
-    for( size_t ibatch = 0; ibatch < nbatches; ++ibatch ) {
-    
-      size_t batch_idx = ibatch + batch_idx_offset;
+      const auto& [lo, up] = ref_bounds.at(atom.Z.get());
+      const std::array<double,3> center = { atom.x, atom.y, atom.z };
+      for( int k = 0; k < 3; ++k ) {
+        root_lo[k] = iAtom ? std::min( root_lo[k], center[k] + lo[k] ) : center[k] + lo[k];
+        root_up[k] = iAtom ? std::max( root_up[k], center[k] + up[k] ) : center[k] + up[k];
+      }
+    }
+
+    double side = 0.;
+    for( int k = 0; k < 3; ++k ) side = std::max( side, root_up[k] - root_lo[k] );
+    for( int k = 0; k < 3; ++k ) root_up[k] = root_lo[k] + side;
+
+  }
+
+  // Generate batches for blocks of atoms at a time to bound the memory
+  // footprint while exposing enough parallelism across atoms
+  const size_t target_block_nbatches = 1024;
+
+  std::vector< XCTask > temp_tasks;
+  std::vector< char   > temp_valid;
+  std::vector< std::vector<XCTask> > temp_atom_tasks;
+
+  size_t atom_st = 0;
+  while( atom_st < natoms ) {
+
+    size_t atom_en = atom_st + 1;
+    while( atom_en < natoms and 
+      (atom_batch_offsets[atom_en] - atom_batch_offsets[atom_st]) < 
+        target_block_nbatches ) atom_en++;
+
+    if( not spherical_batches ) {
+
+      // Partition the complete atomic grid of each atom in the block
+      temp_atom_tasks.clear(); temp_atom_tasks.resize( atom_en - atom_st );
+
+      #pragma omp parallel for schedule(dynamic)
+      for( size_t iAtom = atom_st; iAtom < atom_en; ++iAtom ) {
+
+        const auto& atom = (*this->mol_)[iAtom];
+        const auto& grid = mg.get_grid(atom.Z);
+
+        // Gather the atomic grid, the batch size of the underlying grid
+        // bounds the size of the partitioned batches
+        quadrature_type::point_container  points;
+        quadrature_type::weight_container weights;
+        size_t max_npts = 0;
+        for( size_t ib = 0; ib < grid.nbatches(); ++ib ) {
+          auto [lo, up, pts, w] = translated_batch( iAtom, ib );
+          max_npts = std::max( max_npts, pts.size() );
+          points.insert( points.end(), pts.begin(), pts.end() );
+          weights.insert( weights.end(), w.begin(), w.end() );
+        }
+        if( points.empty() ) continue;
+
+        auto batches = partition_points( partitioner, std::move(points),
+          std::move(weights), root_lo, root_up, max_npts, 
+          state_.min_batch_size, [&]( const auto& lo, const auto& up ) {
+            return micro_batch_screen( (*this->basis_), lo, up );
+          });
+
+        auto& atom_tasks = temp_atom_tasks[iAtom - atom_st];
+        atom_tasks.reserve( batches.size() );
+        for( auto& batch : batches ) {
+          XCTask task;
+          task.iParent    = iAtom;
+          task.npts       = batch.points.size(); 
+          task.points     = std::move( batch.points );
+          task.weights    = std::move( batch.weights );
+          task.bfn_screening.shell_list = std::move( batch.shell_list );
+          task.bfn_screening.nbe        = batch.nbe;
+          task.dist_nearest = molmeta_->dist_nearest()[iAtom];
+          atom_tasks.emplace_back( std::move(task) );
+        }
+
+      } // omp parallel for over atoms
+
+      for( auto& atom_tasks : temp_atom_tasks )
+      for( auto& task : atom_tasks ) assign_task( std::move(task) );
+
+      atom_st = atom_en;
+      continue;
+
+    }
+
+    const size_t batch_st   = atom_batch_offsets[atom_st];
+    const size_t nbatch_blk = atom_batch_offsets[atom_en] - batch_st;
+
+    temp_tasks.clear(); temp_tasks.resize( nbatch_blk );
+    temp_valid.assign( nbatch_blk, 0 );
+
+    #pragma omp parallel for schedule(dynamic)
+    for( size_t iblk = 0; iblk < nbatch_blk; ++iblk ) {
+
+      // Locate parent atom (atom blocks are small, linear search suffices)
+      const size_t batch_idx = batch_st + iblk;
+      size_t iAtom = atom_st;
+      while( atom_batch_offsets[iAtom+1] <= batch_idx ) iAtom++;
+      const size_t ibatch = batch_idx - atom_batch_offsets[iAtom];
 
       // Generate the batch (non-negligible cost)
-      auto [lo, up, points, weights] = batcher.at(ibatch);
+      auto [lo, up, points, weights] = translated_batch( iAtom, ibatch );
 
       if( points.size() == 0 ) continue;
 
@@ -62,129 +209,27 @@ std::vector< XCTask > HostReplicatedLoadBalancer::create_local_tasks_() const  {
       if( not shell_list.size() ) continue; 
 
       // Copy task data
-      XCTask task;
-      task.iParent    = iCurrent;
+      XCTask& task = temp_tasks[iblk];
+      task.iParent    = iAtom;
       // This enables lazy assignment of points vector (see CUDA impl)
       task.npts       = points.size(); 
       task.points     = std::move( points );
       task.weights    = std::move( weights );
       task.bfn_screening.shell_list = std::move(shell_list);
       task.bfn_screening.nbe        = nbe;
-      task.dist_nearest = molmeta_->dist_nearest()[iCurrent];
-
-      #pragma omp critical
-      temp_tasks.push_back( 
-        std::pair(batch_idx,std::move( task )) 
-      );
+      task.dist_nearest = molmeta_->dist_nearest()[iAtom];
+      temp_valid[iblk] = 1;
 
     } // omp parallel for over batches
 
+    for( size_t iblk = 0; iblk < nbatch_blk; ++iblk ) 
+    if( temp_valid[iblk] ) assign_task( std::move(temp_tasks[iblk]) );
 
+    atom_st = atom_en;
 
+  } // Loop over atom blocks
 
-
-    // Assign Tasks to MPI ranks
-    if( (iCurrent+1) % atBatchSz == 0 or iCurrent == ((int32_t)natoms-1) ) {
-
-      // Sort based on task index for deterministic assignment
-      std::sort( temp_tasks.begin(), temp_tasks.end(), 
-        []( const auto& a, const auto& b ) {
-          return a.first < b.first;
-        } );
-
-      // Assign batches to MPI ranks
-      for( size_t ibatch = 0; ibatch < temp_tasks.size(); ++ibatch ) {
-
-        XCTask task = std::move(temp_tasks.at(ibatch).second);
-        //auto& points = task.points;
-        //auto  nbe    = task.nbe;
-
-        // Get rank with minimum work
-        auto min_rank_it = 
-          std::min_element( global_workload.begin(), global_workload.end() );
-        int64_t min_rank = std::distance( global_workload.begin(), min_rank_it );
-
-        // Compute cost heuristic and increment total work
-        global_workload[ min_rank ] += task.cost( n_deriv, natoms );
-
-        if( world_rank == min_rank ) 
-          local_work.push_back( std::move(task) );
-
-      }
-
-      temp_tasks.clear();
-
-    }
-
-
-    // Update counters and offsets
-    iCurrent++;
-    batch_idx_offset += nbatches;
-
-  } // Loop over Atoms
-
-//return local_work;
-
-  // Lexicographic ordering of tasks
-  auto task_order = []( const auto& a, const auto& b ) {
-
-    // Sort by iParent first
-    if( a.iParent < b.iParent )      return true;
-    else if( a.iParent > b.iParent ) return false;
-
-    // Equal iParent: lex sort on shell list
-    else return a.bfn_screening.shell_list < b.bfn_screening.shell_list;
-
-  };
-
-  std::sort( local_work.begin(), local_work.end(),
-    task_order ); 
-
-
-  // Get unique tasks
-  auto task_equiv = []( const auto& a, const auto& b ) {
-    return a.equiv_with(b);
-  };
-
-  auto local_work_unique = local_work;
-  auto last_unique = 
-    std::unique( local_work_unique.begin(),
-                 local_work_unique.end(),
-                 task_equiv );
-  local_work_unique.erase( last_unique, local_work_unique.end() );
-  
-
-  // Merge tasks
-  for( auto&& t : local_work_unique ) {
-    t.points.clear();
-    t.weights.clear();
-    t.npts = 0;
-  }
-
-  auto cur_lw_begin = local_work.begin();
-  auto cur_uniq_it  = local_work_unique.begin();
-
-  for( auto lw_it = local_work.begin(); lw_it != local_work.end(); ++lw_it ) 
-  if( not task_equiv( *lw_it, *cur_uniq_it ) ) {
-
-    if( cur_uniq_it == local_work_unique.end() )
-      GAUXC_GENERIC_EXCEPTION("Messed up in unique");
-
-    cur_uniq_it->merge_with( cur_lw_begin, lw_it );
-
-    cur_lw_begin = lw_it;
-    cur_uniq_it++;
-
-  }
-
-  // Merge the last set of batches
-  for( ; cur_lw_begin != local_work.end(); ++cur_lw_begin )
-    cur_uniq_it->merge_with( *cur_lw_begin );
-  cur_uniq_it++;
-  
-
-  local_work = std::move(local_work_unique);
-
+  // Equivalent tasks are merged by LoadBalancerImpl::get_tasks
   return local_work;
 }
 
@@ -0,0 +1,121 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "symmetry_unique_points.hpp"
+#include <gauxc/exceptions.hpp>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <set>
+#include <unordered_map>
+
+namespace GauXC  {
+namespace detail {
+
+namespace {
+
+using point_type = std::array<double,3>;
+
+inline point_type apply_op( const SymmetryOperation& R, const point_type& x ) {
+  return { R[0]*x[0] + R[1]*x[1] + R[2]*x[2],
+           R[3]*x[0] + R[4]*x[1] + R[5]*x[2],
+           R[6]*x[0] + R[7]*x[1] + R[8]*x[2] };
+}
+
+struct point_hash {
+  size_t operator()( const point_type& p ) const {
+    size_t seed = 0;
+    for( auto x : p ) {
+      x += 0.; // -0. -> +0.
+      uint64_t bits; std::memcpy( &bits, &x, sizeof(bits) );
+      seed ^= std::hash<uint64_t>{}(bits) + 0x9e3779b97f4a7c15ull +
+        (seed << 6) + (seed >> 2);
+    }
+    return seed;
+  }
+};
+
+}
+
+SymmetryUniquePoints::SymmetryUniquePoints( const PointGroup& pg,
+  const Molecule& mol, const MolGrid& mg ) : ops_(pg.operations()) {
+
+  const size_t nops = ops_.size();
+  atom_maps_.resize( nops );
+  for( size_t iop = 0; iop < nops; ++iop )
+    atom_maps_[iop] = pg.atom_map( mol, iop );
+
+  // Check that the atomic quadratures are invariant under the group
+  std::set<int64_t> checked_Z;
+  for( const auto& atom : mol ) {
+    if( not checked_Z.insert(atom.Z.get()).second ) continue;
+
+    const auto& grid = mg.get_grid(atom.Z);
+    std::unordered_map< point_type, double, point_hash > ref_grid;
+    for( size_t ib = 0; ib < grid.nbatches(); ++ib ) {
+      auto [lo, up, pts, w] = grid.translated_batch( ib, {0., 0., 0.} );
+      for( size_t i = 0; i < pts.size(); ++i ) ref_grid.emplace( pts[i], w[i] );
+    }
+
+    for( size_t iop = 1; iop < nops; ++iop )
+    for( const auto& [x, w] : ref_grid ) {
+      auto it = ref_grid.find( apply_op( ops_[iop], x ) );
+      if( it == ref_grid.end() or
+          std::abs(it->second - w) > 1e-12 * std::abs(w) )
+        GAUXC_GENERIC_EXCEPTION("Atomic Quadrature Not Invariant Under PointGroup");
+    }
+  }
+
+}
+
+grid_batch_type SymmetryUniquePoints::translated_batch( const Grid& grid,
+  size_t iAtom, size_t ibatch, const std::array<double,3>& center ) const {
+
+  const size_t nops = ops_.size();
+  const auto inf = std::numeric_limits<double>::infinity();
+
+  auto [ref_lo, ref_up, points, weights] =
+    grid.translated_batch( ibatch, {0., 0., 0.} );
+
+  std::array<double,3> lo = { inf, inf, inf}, up = {-inf, -inf, -inf};
+  size_t npts_unique = 0;
+  for( size_t i = 0; i < points.size(); ++i ) {
+
+    const auto& x = points[i];
+    bool   is_rep = true;
+    size_t nstab  = 0;
+    for( size_t iop = 0; iop < nops and is_rep; ++iop ) {
+      const auto jAtom = atom_maps_[iop][iAtom];
+      if( jAtom != int64_t(iAtom) ) { is_rep = jAtom > int64_t(iAtom); continue; }
+      const auto y = apply_op( ops_[iop], x );
+      if( y == x ) nstab++;
+      else         is_rep = y < x;
+    }
+    if( not is_rep ) continue;
+
+    point_type p = { x[0] + center[0], x[1] + center[1], x[2] + center[2] };
+    for( int k = 0; k < 3; ++k ) {
+      lo[k] = std::min( lo[k], p[k] );
+      up[k] = std::max( up[k], p[k] );
+    }
+
+    points [npts_unique] = p;
+    weights[npts_unique] = weights[i] * double(nops / nstab);
+    npts_unique++;
+
+  }
+
+  points.resize( npts_unique );
+  weights.resize( npts_unique );
+  if( not npts_unique ) { lo = {0., 0., 0.}; up = {0., 0., 0.}; }
+
+  return grid_batch_type( lo, up, std::move(points), std::move(weights) );
+
+}
+
+}
+}
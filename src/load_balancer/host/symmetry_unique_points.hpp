@@ -0,0 +1,63 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/molgrid.hpp>
+#include <gauxc/point_group.hpp>
+#include <vector>
+
+namespace GauXC  {
+namespace detail {
+
+/**
+ *  @brief Selection of the symmetry-unique points of a molecular grid
+ *
+ *  A molecular grid point (atom A, reference point x) is mapped by the
+ *  operation g onto (g(A), R_g x). The point is retained if it is the
+ *  representative of its orbit, i.e. the image with the smallest atom index
+ *  and, among those, the lexicographically largest reference coordinates.
+ *  The weight of a retained point is scaled by the size of its orbit.
+ *
+ *  As the operations are signed permutations, the images of the reference
+ *  points are exact, which makes the selection free of tolerances.
+ */
+class SymmetryUniquePoints {
+
+  std::vector<SymmetryOperation>    ops_;       ///< Group elements
+  std::vector<std::vector<int64_t>> atom_maps_; ///< Atom permutation per element
+
+public:
+
+  /**
+   *  @brief Construct the selection for a molecule / molecular grid
+   *
+   *  Throws if either the molecule or the atomic quadratures are not
+   *  invariant under the point group.
+   */
+  SymmetryUniquePoints( const PointGroup& pg, const Molecule& mol,
+    const MolGrid& mg );
+
+  /**
+   *  @brief Symmetry-unique subset of a translated atomic grid batch
+   *
+   *  Analogous to Grid::translated_batch, but only the orbit representatives
+   *  (with scaled weights) are returned. The bounding box is that of the
+   *  retained points.
+   *
+   *  @param[in] grid    Atomic grid of atom `iAtom`
+   *  @param[in] iAtom   Index of the parent atom
+   *  @param[in] ibatch  Index of the batch in `grid`
+   *  @param[in] center  Position of the parent atom
+   */
+  grid_batch_type translated_batch( const Grid& grid, size_t iAtom,
+    size_t ibatch, const std::array<double,3>& center ) const;
+
+};
+
+}
+}
@@ -31,6 +31,24 @@ std::vector<XCTask>& LoadBalancer::get_tasks() {
   return pimpl_->get_tasks();
 }
 
+void LoadBalancer::stream_tasks( 
+  const std::function<void(std::vector<XCTask>&)>& op ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->stream_tasks( op );
+}
+bool LoadBalancer::tasks_out_of_core() const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->tasks_out_of_core();
+}
+size_t LoadBalancer::task_generation() const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->task_generation();
+}
+const TaskStoreStatistics& LoadBalancer::task_store_statistics() const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->task_store_statistics();
+}
+
 void LoadBalancer::rebalance_weights() {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
   pimpl_->rebalance_weights();
@@ -63,6 +81,14 @@ size_t LoadBalancer::max_npts_x_nbe() const {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
   return pimpl_->max_npts_x_nbe();
 }
+double LoadBalancer::mean_nbe() const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->mean_nbe();
+}
+size_t LoadBalancer::total_exc_vxc_cost() const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->total_exc_vxc_cost();
+}
 
 
 
@@ -92,6 +118,10 @@ const LoadBalancer::shell_pair_type& LoadBalancer::shell_pairs() {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
   return pimpl_->shell_pairs();
 }
+bool LoadBalancer::has_shell_pairs() const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->has_shell_pairs();
+}
 
 LoadBalancerState& LoadBalancer::state() {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
@@ -6,6 +6,7 @@
  * See LICENSE.txt for details
  */
 #include "load_balancer_impl.hpp"
+#include "task_merge.hpp"
 
 namespace GauXC::detail {
 
@@ -35,25 +36,96 @@ LoadBalancerImpl::LoadBalancerImpl( LoadBalancerImpl&& ) noexcept = default;
 
 LoadBalancerImpl::~LoadBalancerImpl() noexcept = default;
 
+void LoadBalancerImpl::load_tasks_() const {
+  if( task_store_ and not local_tasks_.size() ) {
+    local_tasks_ = task_store_->read_all( task_store_stats_ );
+    ++task_generation_;
+  }
+}
+
 const std::vector<XCTask>& LoadBalancerImpl::get_tasks() const {
+  // The store remains valid, the resident copy is released by stream_tasks
+  load_tasks_();
   if( not local_tasks_.size() ) GAUXC_GENERIC_EXCEPTION("No Tasks Created");
   return local_tasks_;
 }
 
 std::vector<XCTask>& LoadBalancerImpl::get_tasks() {
 
+  // The tasks may be modified through the returned reference, the store
+  // is rewritten by the next stream_tasks
+  auto& tasks = resident_tasks_();
+  task_store_.reset();
+  ++task_generation_;
+  return tasks;
+
+}
+
+std::vector<XCTask>& LoadBalancerImpl::resident_tasks_() {
+
+  load_tasks_();
   if( not local_tasks_.size() ) {
     auto create_tasks_st = std::chrono::high_resolution_clock::now();
     local_tasks_ = create_local_tasks_();
     auto create_tasks_en = std::chrono::high_resolution_clock::now();
     std::chrono::duration<double> create_tasks_dr = create_tasks_en - create_tasks_st; 
     timer_.add_timing("LoadBalancer.CreateTasks", create_tasks_dr);
+
+    // Merge tasks with equivalent screening data
+    const auto policy = state_.task_merge_policy;
+    timer_.time_op("LoadBalancer.MergeTasks(" + to_string(policy) + ")", [&](){
+      local_tasks_ = merge_equivalent_tasks( std::move(local_tasks_), policy );
+    });
+    ++task_generation_;
   }
 
 
   return local_tasks_;
 }
 
+void LoadBalancerImpl::stream_tasks( 
+  const std::function<void(std::vector<XCTask>&)>& op ) {
+
+  // Move the finalized tasks out-of-core
+  const bool offload = not task_store_ and state_.task_scratch_dir.size() and
+    state_.modified_weights_are_stored;
+  if( offload ) {
+    const auto& tasks = get_tasks();
+    task_summary_.ntasks         = tasks.size();
+    task_summary_.max_npts       = max_npts();
+    task_summary_.max_nbe        = max_nbe();
+    task_summary_.max_npts_x_nbe = max_npts_x_nbe();
+    task_summary_.exc_vxc_cost   = total_exc_vxc_cost();
+    task_summary_.nbe_sum = std::accumulate( tasks.cbegin(), tasks.cend(), 0ul,
+      []( auto s, const auto& t ) { return s + t.bfn_screening.nbe; } );
+
+    timer_.time_op("LoadBalancer.TaskStore.Write", [&](){
+      task_store_ = std::make_shared<TaskStore>( state_.task_scratch_dir,
+        state_.task_chunk_size, tasks, task_store_stats_ );
+    });
+    std::vector<XCTask>().swap( local_tasks_ );
+  }
+
+  if( task_store_ ) {
+    // Release the resident copy of a previous (const) get_tasks
+    std::vector<XCTask>().swap( local_tasks_ );
+    task_store_->stream( state_.task_read_ahead, op, task_store_stats_ );
+  } else op( resident_tasks_() );
+
+}
+
+bool LoadBalancerImpl::tasks_out_of_core() const {
+  return task_store_ != nullptr;
+}
+
+size_t LoadBalancerImpl::task_generation() const {
+  return task_generation_;
+}
+
+const TaskStoreStatistics& LoadBalancerImpl::task_store_statistics() const {
+  return task_store_stats_;
+}
+
 const util::Timer& LoadBalancerImpl::get_timings() const {
   return timer_;
 }
@@ -61,6 +133,7 @@ const util::Timer& LoadBalancerImpl::get_timings() const {
 
 size_t LoadBalancerImpl::max_npts() const {
 
+  if( task_store_ ) return task_summary_.max_npts;
   if( not local_tasks_.size() ) return 0ul;
 
   return std::max_element( local_tasks_.cbegin(), local_tasks_.cend(),
@@ -71,6 +144,7 @@ size_t LoadBalancerImpl::max_npts() const {
 }
 size_t LoadBalancerImpl::max_nbe() const {
 
+  if( task_store_ ) return task_summary_.max_nbe;
   if( not local_tasks_.size() ) return 0ul;
 
   return std::max_element( local_tasks_.cbegin(), local_tasks_.cend(),
@@ -81,6 +155,7 @@ size_t LoadBalancerImpl::max_nbe() const {
 }
 size_t LoadBalancerImpl::max_npts_x_nbe() const {
 
+  if( task_store_ ) return task_summary_.max_npts_x_nbe;
   if( not local_tasks_.size() ) return 0ul;
 
   auto it = std::max_element( local_tasks_.cbegin(), local_tasks_.cend(),
@@ -91,6 +166,28 @@ size_t LoadBalancerImpl::max_npts_x_nbe() const {
   return it->bfn_screening.nbe * it->points.size();
 
 }
+double LoadBalancerImpl::mean_nbe() const {
+
+  if( task_store_ ) 
+    return task_summary_.ntasks ? 
+      double(task_summary_.nbe_sum) / task_summary_.ntasks : 0.;
+  if( not local_tasks_.size() ) return 0.;
+
+  const size_t nbe_sum = std::accumulate( local_tasks_.cbegin(), 
+    local_tasks_.cend(), 0ul, []( auto s, const auto& t ) {
+      return s + t.bfn_screening.nbe;
+    });
+  return double(nbe_sum) / local_tasks_.size();
+
+}
+size_t LoadBalancerImpl::total_exc_vxc_cost() const {
+
+  if( task_store_ ) return task_summary_.exc_vxc_cost;
+
+  return std::accumulate( local_tasks_.cbegin(), local_tasks_.cend(), 0ul,
+    []( auto s, const auto& t ) { return s + t.cost_exc_vxc(1); } );
+
+}
 
 
 
@@ -119,6 +216,9 @@ const LoadBalancerImpl::shell_pair_type& LoadBalancerImpl::shell_pairs() {
   }
   return *shell_pairs_;
 }
+bool LoadBalancerImpl::has_shell_pairs() const {
+  return shell_pairs_ != nullptr;
+}
 
 const RuntimeEnvironment& LoadBalancerImpl::runtime() const {
   return runtime_;
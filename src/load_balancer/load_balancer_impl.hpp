@@ -8,6 +8,7 @@
 #pragma once
 
 #include <gauxc/load_balancer.hpp>
+#include "task_store.hpp"
 
 namespace GauXC  {
 namespace detail {
@@ -30,14 +31,40 @@ protected:
   std::shared_ptr<basis_map_type> basis_map_;
   std::shared_ptr<shell_pair_type> shell_pairs_;
 
-  std::vector< XCTask >     local_tasks_;
+  // Tasks are loaded back from the out-of-core store on access. The store
+  // remains valid (and is not rewritten) until non-const access to the tasks
+  mutable std::vector< XCTask >      local_tasks_;
+  mutable std::shared_ptr<TaskStore> task_store_;
+  mutable size_t                     task_generation_ = 0;
+
+  /// Summary of the out-of-core tasks for the task queries
+  struct task_summary {
+    size_t ntasks         = 0;
+    size_t max_npts       = 0;
+    size_t max_nbe        = 0;
+    size_t max_npts_x_nbe = 0;
+    size_t nbe_sum        = 0;
+    size_t exc_vxc_cost   = 0;
+  };
+  task_summary task_summary_;
+
+  mutable TaskStoreStatistics task_store_stats_;
 
   LoadBalancerState         state_;
 
   util::Timer               timer_;
 
+  /// Generate the (unmerged) local tasks for this process. Equivalent tasks
+  /// are merged by get_tasks according to LoadBalancerState::task_merge_policy
   virtual std::vector< XCTask > create_local_tasks_() const = 0;
 
+  /// Load the out-of-core tasks (if any and not resident) back into memory
+  void load_tasks_() const;
+
+  /// Resident tasks (created if required) without invalidating the
+  /// out-of-core store or advancing the task generation
+  std::vector< XCTask >& resident_tasks_();
+
 public:
 
   LoadBalancerImpl() = delete;
@@ -57,6 +84,11 @@ public:
   const std::vector< XCTask >& get_tasks() const;
         std::vector< XCTask >& get_tasks()      ;
 
+  void stream_tasks( const std::function<void(std::vector<XCTask>&)>& op );
+  bool tasks_out_of_core() const;
+  size_t task_generation() const;
+  const TaskStoreStatistics& task_store_statistics() const;
+
   void rebalance_weights();
   void rebalance_exc_vxc();
   void rebalance_exx();
@@ -66,6 +98,8 @@ public:
   size_t max_npts()       const;
   size_t max_nbe()        const;
   size_t max_npts_x_nbe() const;
+  double mean_nbe() const;
+  size_t total_exc_vxc_cost() const;
 
   const Molecule& molecule() const;
   const MolMeta&  molmeta()  const;
@@ -74,6 +108,7 @@ public:
   const basis_map_type& basis_map() const;
   const shell_pair_type& shell_pairs() const;
   const shell_pair_type& shell_pairs();
+  bool has_shell_pairs() const;
 
   LoadBalancerState& state();
 
@@ -8,6 +8,9 @@
 #include "load_balancer_impl.hpp"
 #include <gauxc/util/mpi.hpp>
 #include <gauxc/util/div_ceil.hpp>
+#include <gauxc/exceptions.hpp>
+#include "threaded_communicator.hpp"
+#include <algorithm>
 #include <fstream>
 
 namespace GauXC::detail {
@@ -357,31 +360,83 @@ auto rebalance(TaskIterator begin, TaskIterator end, const CostFunctor& cost, MP
 }
 #endif
 
+/**
+ *  @brief Rebalance tasks between the virtual ranks of a 
+ *  ThreadedRuntimeEnvironment
+ *
+ *  Same distribution as the MPI implementation: the tasks of all ranks are
+ *  concatenated in rank order and split into contiguous ranges of (roughly)
+ *  equal cost. Tasks are copied out of the (shared) task lists of the other
+ *  ranks.
+ */
+template <typename CostFunctor>
+std::vector<XCTask> threaded_rebalance( std::vector<XCTask>& tasks, 
+  const CostFunctor& cost, ThreadedCommunicator& comm, int world_rank ) {
+
+  const int world_size = comm.size();
+  auto rank_tasks = comm.allgather( world_rank, &tasks );
+
+  // Every rank computes the same global prefix sum
+  std::vector<std::vector<size_t>> prefix_sum(world_size);
+  size_t total_task_sum = 0;
+  for( int r = 0; r < world_size; ++r )
+  for( const auto& task : *static_cast<std::vector<XCTask>*>(rank_tasks[r]) )
+    prefix_sum[r].emplace_back( total_task_sum += cost(task) );
+  const size_t task_avg = 
+    std::max( util::div_ceil(total_task_sum, world_size), size_t(1) );
+
+  std::vector<XCTask> local_work;
+  for( int r = 0; r < world_size; ++r ) {
+    const auto& src = *static_cast<std::vector<XCTask>*>(rank_tasks[r]);
+    for( size_t i = 0; i < src.size(); ++i ) {
+      const int dst = std::min<size_t>( prefix_sum[r][i] / task_avg, 
+        world_size - 1 );
+      if( dst == world_rank ) local_work.emplace_back( src[i] );
+    }
+  }
+
+  // The task lists of the other ranks may only be replaced once all ranks
+  // are done copying
+  comm.barrier();
+  return local_work;
+
+}
 
 void LoadBalancerImpl::rebalance_weights() {
-#ifdef GAUXC_HAS_MPI
   auto& tasks = get_tasks();
   const size_t natoms = molecule().natoms();
   auto cost = [=](const auto& task){ return task.cost(1,natoms); };
+  if( auto comm = threaded_communicator(runtime_) ) {
+    tasks = threaded_rebalance( tasks, cost, *comm, runtime_.comm_rank() );
+    return;
+  }
+#ifdef GAUXC_HAS_MPI
   auto new_tasks = rebalance( tasks.begin(), tasks.end(), cost, runtime_.comm());
   tasks = std::move(new_tasks);
 #endif
 }
 
 void LoadBalancerImpl::rebalance_exc_vxc() {
-#ifdef GAUXC_HAS_MPI
   auto& tasks = get_tasks();
-  const size_t natoms = molecule().natoms();
   auto cost = [=](const auto& task){ return task.cost_exc_vxc(1); };
+  if( auto comm = threaded_communicator(runtime_) ) {
+    tasks = threaded_rebalance( tasks, cost, *comm, runtime_.comm_rank() );
+    return;
+  }
+#ifdef GAUXC_HAS_MPI
   auto new_tasks = rebalance( tasks.begin(), tasks.end(), cost, runtime_.comm());
   tasks = std::move(new_tasks);
 #endif
 }
 
 void LoadBalancerImpl::rebalance_exx() {
-#ifdef GAUXC_HAS_MPI
   auto& tasks = get_tasks();
   auto cost = [=](const auto& task){ return task.cost_exx(); };
+  if( auto comm = threaded_communicator(runtime_) ) {
+    tasks = threaded_rebalance( tasks, cost, *comm, runtime_.comm_rank() );
+    return;
+  }
+#ifdef GAUXC_HAS_MPI
   auto new_tasks = rebalance( tasks.begin(), tasks.end(), cost, runtime_.comm());
   local_tasks_ = std::move(new_tasks);
   MPI_Barrier(MPI_COMM_WORLD);
@@ -0,0 +1,208 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "task_merge.hpp"
+#include <unordered_map>
+#include <numeric>
+
+namespace GauXC  {
+namespace detail {
+
+std::string to_string( TaskMergePolicy policy ) {
+  switch( policy ) {
+    case TaskMergePolicy::Sort: return "Sort";
+    case TaskMergePolicy::Hash: return "Hash";
+    default: GAUXC_GENERIC_EXCEPTION("Unknown TaskMergePolicy");
+  }
+}
+
+namespace {
+
+// Lexicographic ordering of tasks
+bool task_order( const XCTask& a, const XCTask& b, bool include_cou ) {
+
+  // Sort by iParent first
+  if( a.iParent < b.iParent )      return true;
+  else if( a.iParent > b.iParent ) return false;
+
+  // Equal iParent: lex sort on bfn shell list
+  else if(a.bfn_screening.shell_list < b.bfn_screening.shell_list) return true;
+  else if(a.bfn_screening.shell_list > b.bfn_screening.shell_list) return false;
+
+  // Equal iParent and bfn shell list: lex sort on cou shell list
+  else return include_cou and
+    a.cou_screening.shell_list < b.cou_screening.shell_list;
+
+}
+
+bool task_equiv( const XCTask& a, const XCTask& b, bool include_cou ) {
+  return a.equiv_with(b) and
+    (not include_cou or a.cou_screening.equiv_with(b.cou_screening));
+}
+
+inline uint64_t hash_combine( uint64_t seed, uint64_t v ) {
+  // splitmix64 finalizer applied to the boost-style combination
+  uint64_t x = seed ^ (v + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return x ^ (x >> 31);
+}
+
+inline uint64_t hash_screening( uint64_t seed,
+  const XCTask::screening_data& scr ) {
+  seed = hash_combine( seed, scr.shell_list.size() );
+  for( auto sh : scr.shell_list ) seed = hash_combine( seed, sh );
+  seed = hash_combine( seed, scr.shell_pair_list.size() );
+  for( auto [i,j] : scr.shell_pair_list ) {
+    seed = hash_combine( seed, i );
+    seed = hash_combine( seed, j );
+  }
+  return seed;
+}
+
+/// 64-bit signature of the data compared by task_equiv
+uint64_t task_signature( const XCTask& t, bool include_cou ) {
+  uint64_t h = hash_combine( 0, t.iParent );
+  h = hash_screening( h, t.bfn_screening );
+  if( include_cou ) h = hash_screening( h, t.cou_screening );
+  return h;
+}
+
+
+std::vector<XCTask> sort_merge( std::vector<XCTask>&& local_work,
+  bool include_cou ) {
+
+  std::sort( local_work.begin(), local_work.end(),
+    [=]( const auto& a, const auto& b ){ return task_order(a,b,include_cou); } );
+
+  // Get unique tasks
+  auto equiv = [=]( const auto& a, const auto& b ) {
+    return task_equiv( a, b, include_cou );
+  };
+
+  auto local_work_unique = local_work;
+  auto last_unique =
+    std::unique( local_work_unique.begin(),
+                 local_work_unique.end(),
+                 equiv );
+  local_work_unique.erase( last_unique, local_work_unique.end() );
+
+
+  // Merge tasks
+  for( auto&& t : local_work_unique ) {
+    t.points.clear();
+    t.weights.clear();
+    t.npts = 0;
+  }
+
+  auto cur_lw_begin = local_work.begin();
+  auto cur_uniq_it  = local_work_unique.begin();
+
+  for( auto lw_it = local_work.begin(); lw_it != local_work.end(); ++lw_it )
+  if( not equiv( *lw_it, *cur_uniq_it ) ) {
+
+    if( cur_uniq_it == local_work_unique.end() )
+      GAUXC_GENERIC_EXCEPTION("Messed up in unique");
+
+    cur_uniq_it->merge_with( cur_lw_begin, lw_it );
+
+    cur_lw_begin = lw_it;
+    cur_uniq_it++;
+
+  }
+
+  // Merge the last set of batches
+  for( ; cur_lw_begin != local_work.end(); ++cur_lw_begin )
+    cur_uniq_it->merge_with( *cur_lw_begin );
+  cur_uniq_it++;
+
+  return local_work_unique;
+
+}
+
+
+std::vector<XCTask> hash_merge( std::vector<XCTask>&& local_work,
+  bool include_cou ) {
+
+  const size_t ntasks = local_work.size();
+
+  // Compute screening signatures
+  std::vector<uint64_t> signatures( ntasks );
+  #pragma omp parallel for
+  for( size_t i = 0; i < ntasks; ++i )
+    signatures[i] = task_signature( local_work[i], include_cou );
+
+  // Group tasks on signature. Signature collisions are resolved by a full
+  // comparison against the leading task of each candidate group
+  std::unordered_map< uint64_t, std::vector<size_t> > signature_groups;
+  std::vector< std::vector<size_t> > groups;
+  signature_groups.reserve( ntasks );
+
+  for( size_t i = 0; i < ntasks; ++i ) {
+    auto& candidates = signature_groups[ signatures[i] ];
+    auto grp_it = std::find_if( candidates.begin(), candidates.end(),
+      [&]( auto ig ) {
+        return task_equiv( local_work[groups[ig].front()], local_work[i],
+          include_cou );
+      });
+
+    if( grp_it == candidates.end() ) {
+      candidates.push_back( groups.size() );
+      groups.emplace_back( 1, i );
+    } else groups[*grp_it].push_back(i);
+  }
+
+  // Order the (few) unique tasks as the sort-based merge would
+  const size_t ngroups = groups.size();
+  std::vector<size_t> group_order( ngroups );
+  std::iota( group_order.begin(), group_order.end(), 0 );
+  std::sort( group_order.begin(), group_order.end(),
+    [&]( auto a, auto b ) {
+      return task_order( local_work[groups[a].front()],
+        local_work[groups[b].front()], include_cou );
+    });
+
+  // Merge tasks. Points are concatenated in input order
+  std::vector<XCTask> local_work_unique( ngroups );
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t ig = 0; ig < ngroups; ++ig ) {
+
+    const auto& members = groups[ group_order[ig] ];
+    size_t npts_total = 0;
+    for( auto i : members ) npts_total += local_work[i].points.size();
+
+    auto& task = local_work_unique[ig];
+    task = std::move( local_work[members.front()] );
+    task.points.reserve( npts_total );
+    task.weights.reserve( npts_total );
+    for( auto it = members.begin() + 1; it != members.end(); ++it )
+      task.merge_with( local_work[*it] );
+    task.npts = task.points.size();
+
+  }
+
+  return local_work_unique;
+
+}
+
+}
+
+std::vector<XCTask> merge_equivalent_tasks( std::vector<XCTask>&& tasks,
+  TaskMergePolicy policy, bool include_cou ) {
+
+  if( tasks.empty() ) return std::vector<XCTask>{};
+
+  switch( policy ) {
+    case TaskMergePolicy::Sort: return sort_merge( std::move(tasks), include_cou );
+    case TaskMergePolicy::Hash: return hash_merge( std::move(tasks), include_cou );
+    default: GAUXC_GENERIC_EXCEPTION("Unknown TaskMergePolicy");
+  }
+
+}
+
+}
+}
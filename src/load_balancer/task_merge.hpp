@@ -0,0 +1,39 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/xc_task.hpp>
+#include <gauxc/enums.hpp>
+#include <string>
+
+namespace GauXC  {
+namespace detail {
+
+/// Return a printable name for a TaskMergePolicy (used in timing keys)
+std::string to_string( TaskMergePolicy policy );
+
+/**
+ *  @brief Merge tasks which share the same screening signature
+ *
+ *  Two tasks are merged if they share the same iParent and basis function
+ *  screening data (and, optionally, the same EK screening data).
+ *
+ *  Regardless of the policy, the resulting unique tasks are ordered
+ *  lexicographically on (iParent, bfn shell list[, cou shell list]).
+ *
+ *  @param[in] tasks        Tasks to merge (consumed)
+ *  @param[in] policy       Grouping strategy
+ *  @param[in] include_cou  Whether the EK screening data is part of the signature
+ *
+ *  @returns The merged tasks
+ */
+std::vector<XCTask> merge_equivalent_tasks( std::vector<XCTask>&& tasks,
+  TaskMergePolicy policy, bool include_cou = false );
+
+}
+}
@@ -0,0 +1,275 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "task_store.hpp"
+#include <gauxc/exceptions.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <future>
+#include <type_traits>
+#include <unistd.h>
+
+namespace GauXC::detail {
+
+namespace {
+
+using hrt_t = std::chrono::high_resolution_clock;
+using dur_t = std::chrono::duration<double>;
+
+/// Flat byte buffer (de)serialization of trivially copyable data and vectors
+/// thereof
+struct task_buffer {
+
+  std::vector<char> data;
+  size_t            cursor = 0;
+
+  template <typename T>
+  void pack( const T& val ) {
+    static_assert( std::is_trivially_copyable_v<T> );
+    const auto* p = reinterpret_cast<const char*>(&val);
+    data.insert( data.end(), p, p + sizeof(T) );
+  }
+
+  template <typename T, typename Alloc>
+  void pack( const std::vector<T,Alloc>& vec ) {
+    static_assert( std::is_trivially_copyable_v<T> );
+    pack( vec.size() );
+    const auto* p = reinterpret_cast<const char*>(vec.data());
+    data.insert( data.end(), p, p + vec.size() * sizeof(T) );
+  }
+
+  template <typename T>
+  void unpack( T& val ) {
+    static_assert( std::is_trivially_copyable_v<T> );
+    if( cursor + sizeof(T) > data.size() )
+      GAUXC_GENERIC_EXCEPTION("Corrupted Task Scratch Chunk");
+    std::memcpy( &val, data.data() + cursor, sizeof(T) );
+    cursor += sizeof(T);
+  }
+
+  template <typename T, typename Alloc>
+  void unpack( std::vector<T,Alloc>& vec ) {
+    size_t sz; unpack( sz );
+    if( cursor + sz * sizeof(T) > data.size() )
+      GAUXC_GENERIC_EXCEPTION("Corrupted Task Scratch Chunk");
+    vec.resize( sz );
+    std::memcpy( vec.data(), data.data() + cursor, sz * sizeof(T) );
+    cursor += sz * sizeof(T);
+  }
+
+  // std::pair is not trivially copyable
+  template <typename T, typename U>
+  void pack( const std::vector<std::pair<T,U>>& vec ) {
+    pack( vec.size() );
+    for( const auto& [a,b] : vec ) { pack(a); pack(b); }
+  }
+
+  template <typename T, typename U>
+  void unpack( std::vector<std::pair<T,U>>& vec ) {
+    size_t sz; unpack( sz );
+    if( cursor + sz * (sizeof(T) + sizeof(U)) > data.size() )
+      GAUXC_GENERIC_EXCEPTION("Corrupted Task Scratch Chunk");
+    vec.resize( sz );
+    for( auto& [a,b] : vec ) { unpack(a); unpack(b); }
+  }
+
+  void pack( const XCTask::screening_data& scr ) {
+    pack( scr.shell_list          );
+    pack( scr.shell_pair_list     );
+    pack( scr.shell_pair_idx_list );
+    pack( scr.submat_block        );
+    pack( scr.submat_map          );
+    pack( scr.nbe                 );
+  }
+
+  void unpack( XCTask::screening_data& scr ) {
+    unpack( scr.shell_list          );
+    unpack( scr.shell_pair_list     );
+    unpack( scr.shell_pair_idx_list );
+    unpack( scr.submat_block        );
+    unpack( scr.submat_map          );
+    unpack( scr.nbe                 );
+  }
+
+  void pack( const XCTask& task ) {
+    pack( task.iParent       );
+    pack( task.npts          );
+    pack( task.dist_nearest  );
+    pack( task.max_weight    );
+    pack( task.points        );
+    pack( task.weights       );
+    pack( task.bfn_screening );
+    pack( task.cou_screening );
+  }
+
+  void unpack( XCTask& task ) {
+    unpack( task.iParent       );
+    unpack( task.npts          );
+    unpack( task.dist_nearest  );
+    unpack( task.max_weight    );
+    unpack( task.points        );
+    unpack( task.weights       );
+    unpack( task.bfn_screening );
+    unpack( task.cou_screening );
+  }
+
+};
+
+/// Unique scratch file name for this process
+std::string scratch_file_name( const std::string& scratch_dir ) {
+  static std::atomic<size_t> counter{0};
+  return scratch_dir + "/gauxc_tasks." + std::to_string(::getpid()) + "." +
+    std::to_string(counter++) + ".bin";
+}
+
+}
+
+TaskStore::TaskStore( const std::string& scratch_dir, size_t chunk_bytes,
+  const std::vector<XCTask>& tasks, TaskStoreStatistics& stats ) :
+  path_( scratch_file_name(scratch_dir) ), ntasks_( tasks.size() ) {
+
+  auto write_st = hrt_t::now();
+
+  std::ofstream file( path_, std::ios::binary | std::ios::trunc );
+  if( not file )
+    GAUXC_GENERIC_EXCEPTION("Could Not Create Task Scratch File " + path_);
+
+  // Serialize tasks into chunks of at least chunk_bytes (except the last)
+  task_buffer buffer;
+  size_t chunk_ntasks = 0;
+  auto flush = [&]() {
+    if( not chunk_ntasks ) return;
+    file.write( buffer.data.data(), buffer.data.size() );
+    if( not file )
+      GAUXC_GENERIC_EXCEPTION("Failed to Write Task Scratch File " + path_);
+    chunks_.push_back({ file_bytes_, buffer.data.size(), chunk_ntasks });
+    file_bytes_ += buffer.data.size();
+    buffer.data.clear();
+    chunk_ntasks = 0;
+  };
+
+  for( const auto& task : tasks ) {
+    buffer.pack( task );
+    ++chunk_ntasks;
+    if( buffer.data.size() >= chunk_bytes ) flush();
+  }
+  flush();
+  file.close();
+
+  auto write_en = hrt_t::now();
+  stats.nchunks        = chunks_.size();
+  stats.file_bytes     = file_bytes_;
+  stats.bytes_written += file_bytes_;
+  stats.write_time    += dur_t( write_en - write_st ).count();
+
+}
+
+TaskStore::~TaskStore() noexcept {
+  std::remove( path_.c_str() );
+}
+
+std::vector<XCTask> TaskStore::read_chunk( size_t ichunk ) const {
+
+  const auto& rec = chunks_.at(ichunk);
+
+  task_buffer buffer;
+  buffer.data.resize( rec.bytes );
+
+  std::ifstream file( path_, std::ios::binary );
+  file.seekg( rec.offset );
+  file.read( buffer.data.data(), rec.bytes );
+  if( not file )
+    GAUXC_GENERIC_EXCEPTION("Failed to Read Task Scratch File " + path_);
+
+  std::vector<XCTask> tasks( rec.ntasks );
+  for( auto& task : tasks ) buffer.unpack( task );
+  return tasks;
+
+}
+
+std::vector<XCTask> TaskStore::read_all( TaskStoreStatistics& stats ) const {
+
+  auto read_st = hrt_t::now();
+
+  std::vector<XCTask> tasks;
+  tasks.reserve( ntasks_ );
+  for( size_t i = 0; i < chunks_.size(); ++i ) {
+    auto chunk = read_chunk( i );
+    std::move( chunk.begin(), chunk.end(), std::back_inserter(tasks) );
+  }
+
+  auto read_en = hrt_t::now();
+  stats.bytes_read += file_bytes_;
+  stats.read_time  += dur_t( read_en - read_st ).count();
+
+  return tasks;
+
+}
+
+void TaskStore::stream( size_t read_ahead, const chunk_op& op,
+  TaskStoreStatistics& stats ) const {
+
+  if( chunks_.empty() ) {
+    std::vector<XCTask> empty;
+    op( empty );
+    return;
+  }
+
+  // Each read reports its own duration, the reads overlap with op
+  using chunk_read = std::pair<std::vector<XCTask>, double>;
+  auto read = [this]( size_t i ) {
+    auto st = hrt_t::now();
+    auto tasks = read_chunk( i );
+    auto en = hrt_t::now();
+    return chunk_read( std::move(tasks), dur_t( en - st ).count() );
+  };
+
+  std::deque<std::future<chunk_read>> pending;
+  size_t next_chunk = 0, resident_bytes = 0;
+  auto issue = [&]() {
+    resident_bytes += chunks_[next_chunk].bytes;
+    stats.peak_resident_bytes =
+      std::max( stats.peak_resident_bytes, resident_bytes );
+    pending.emplace_back( std::async( std::launch::async, read, next_chunk++ ) );
+  };
+
+  try {
+
+    for( size_t i = 0; i < chunks_.size(); ++i ) {
+
+      // Keep up to read_ahead chunks in flight beyond the current one
+      while( next_chunk < chunks_.size() and next_chunk <= i + read_ahead )
+        issue();
+
+      auto wait_st = hrt_t::now();
+      auto [tasks, read_dur] = pending.front().get();
+      pending.pop_front();
+      auto wait_en = hrt_t::now();
+
+      stats.bytes_read     += chunks_[i].bytes;
+      stats.read_time      += read_dur;
+      stats.read_wait_time += dur_t( wait_en - wait_st ).count();
+
+      op( tasks );
+      resident_bytes -= chunks_[i].bytes;
+
+    }
+
+  } catch(...) {
+    // Drain outstanding reads before propagating
+    for( auto& f : pending ) if( f.valid() ) f.wait();
+    throw;
+  }
+
+}
+
+}
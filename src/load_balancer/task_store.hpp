@@ -0,0 +1,89 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/load_balancer.hpp>
+#include <functional>
+#include <string>
+
+namespace GauXC::detail {
+
+/**
+ *  @brief Out-of-core storage of quadrature tasks
+ *
+ *  Tasks are serialized in chunks of (approximately) a target size to a
+ *  scratch file which is removed upon destruction. Derived task data
+ *  (points_soa) is not stored. Chunks are read back independently, which
+ *  allows streaming the tasks with read-ahead.
+ */
+class TaskStore {
+
+public:
+
+  /// Location of a chunk in the scratch file
+  struct chunk_record {
+    size_t offset; ///< Byte offset of the chunk
+    size_t bytes;  ///< Serialized size of the chunk
+    size_t ntasks; ///< Number of tasks in the chunk
+  };
+
+  /// Chunk streaming callback
+  using chunk_op = std::function<void(std::vector<XCTask>&)>;
+
+  /**
+   *  @brief Write tasks to a new scratch file
+   *
+   *  @param[in]  scratch_dir  Directory in which to create the scratch file
+   *  @param[in]  chunk_bytes  Target serialized size of a chunk
+   *  @param[in]  tasks        Tasks to store
+   *  @param[out] stats        Write statistics are accumulated here
+   */
+  TaskStore( const std::string& scratch_dir, size_t chunk_bytes,
+    const std::vector<XCTask>& tasks, TaskStoreStatistics& stats );
+
+  /// Remove the scratch file
+  ~TaskStore() noexcept;
+
+  TaskStore( const TaskStore& ) = delete;
+  TaskStore& operator=( const TaskStore& ) = delete;
+
+  /// Read a chunk of tasks from the scratch file
+  std::vector<XCTask> read_chunk( size_t ichunk ) const;
+
+  /// Read all of the tasks from the scratch file
+  std::vector<XCTask> read_all( TaskStoreStatistics& stats ) const;
+
+  /**
+   *  @brief Stream the tasks through op chunk by chunk
+   *
+   *  Up to read_ahead chunks are read asynchronously while op executes on
+   *  the current chunk. op is always invoked at least once (with no tasks
+   *  if the store is empty).
+   *
+   *  @param[in]  read_ahead  Number of chunks to prefetch (0 reads synchronously)
+   *  @param[in]  op          Operation to execute on each chunk
+   *  @param[out] stats       Read statistics are accumulated here
+   */
+  void stream( size_t read_ahead, const chunk_op& op,
+    TaskStoreStatistics& stats ) const;
+
+  size_t nchunks()    const { return chunks_.size(); }
+  size_t ntasks()     const { return ntasks_;        }
+  size_t file_bytes() const { return file_bytes_;    }
+  const std::string& path() const { return path_; }
+
+private:
+
+  std::string               path_;
+  std::vector<chunk_record> chunks_;
+  size_t                    ntasks_     = 0;
+  size_t                    file_bytes_ = 0;
+
+};
+
+}
@@ -79,6 +79,7 @@ void DeviceMolecularWeights::modify_weights( LoadBalancer& lb ) const {
   rt.device_backend()->master_queue_synchronize();
  
   lb.state().modified_weights_are_stored = true;
+  lb.state().weight_alg = this->settings_.weight_alg;
 
 }
 
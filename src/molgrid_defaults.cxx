@@ -71,8 +71,19 @@ RadialScale default_ta_radial_scaling_factor( AtomicNumber _Z ) {
     case 34: return RadialScale(0.9); // Se
     case 35: return RadialScale(0.9); // Br
     case 36: return RadialScale(0.9); // Kr
+
+    // No values are given beyond Kr, use those of the 4th period element
+    // of the same group (La - Lu map onto Sc)
     default:
-      GAUXC_GENERIC_EXCEPTION("Z > 36 Not Supported for TA Quadrature");
+      if( Z >= 37 and Z <= 54 ) 
+        return default_ta_radial_scaling_factor( AtomicNumber(Z - 18) );
+      if( Z == 55 or Z == 56 )
+        return default_ta_radial_scaling_factor( AtomicNumber(Z - 36) );
+      if( Z >= 57 and Z <= 71 )
+        return default_ta_radial_scaling_factor( AtomicNumber(21) );
+      if( Z >= 72 and Z <= 86 )
+        return default_ta_radial_scaling_factor( AtomicNumber(Z - 50) );
+      GAUXC_GENERIC_EXCEPTION("Z > 86 Not Supported for TA Quadrature");
       abort();
   }
 }
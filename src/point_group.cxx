@@ -0,0 +1,203 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include <gauxc/point_group.hpp>
+#include <gauxc/exceptions.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace GauXC {
+
+namespace {
+
+constexpr SymmetryOperation identity_op = { 1., 0., 0., 0., 1., 0., 0., 0., 1. };
+
+bool is_signed_permutation( const SymmetryOperation& R ) {
+  for( int i = 0; i < 3; ++i ) {
+    int nnz_row = 0, nnz_col = 0;
+    for( int j = 0; j < 3; ++j ) {
+      const auto r = R[3*i + j], c = R[3*j + i];
+      if( r != 0. and std::abs(r) != 1. ) return false;
+      nnz_row += r != 0.;
+      nnz_col += c != 0.;
+    }
+    if( nnz_row != 1 or nnz_col != 1 ) return false;
+  }
+  return true;
+}
+
+// Signed permutation entries are exact, as is their product
+SymmetryOperation multiply( const SymmetryOperation& A,
+  const SymmetryOperation& B ) {
+  SymmetryOperation C;
+  for( int i = 0; i < 3; ++i )
+  for( int j = 0; j < 3; ++j ) {
+    double tmp = 0.;
+    for( int k = 0; k < 3; ++k ) tmp += A[3*i + k] * B[3*k + j];
+    C[3*i + j] = tmp;
+  }
+  return C;
+}
+
+double determinant( const SymmetryOperation& R ) {
+  return R[0] * (R[4]*R[8] - R[5]*R[7]) -
+         R[1] * (R[3]*R[8] - R[5]*R[6]) +
+         R[2] * (R[3]*R[7] - R[4]*R[6]);
+}
+
+bool try_atom_map( const Molecule& mol, const std::array<double,3>& center,
+  const SymmetryOperation& R, double tol, std::vector<int64_t>& map ) {
+
+  const size_t natoms = mol.natoms();
+  map.assign( natoms, -1 );
+  std::vector<char> hit( natoms, 0 );
+
+  for( size_t i = 0; i < natoms; ++i ) {
+    const std::array<double,3> d = { mol[i].x - center[0], mol[i].y - center[1],
+                                     mol[i].z - center[2] };
+    std::array<double,3> img;
+    for( int k = 0; k < 3; ++k )
+      img[k] = center[k] + R[3*k]*d[0] + R[3*k+1]*d[1] + R[3*k+2]*d[2];
+
+    for( size_t j = 0; j < natoms; ++j ) {
+      if( hit[j] or mol[j].Z != mol[i].Z ) continue;
+      const double dx = mol[j].x - img[0];
+      const double dy = mol[j].y - img[1];
+      const double dz = mol[j].z - img[2];
+      if( std::sqrt(dx*dx + dy*dy + dz*dz) < tol ) {
+        map[i] = j; hit[j] = 1;
+        break;
+      }
+    }
+    if( map[i] < 0 ) return false;
+  }
+
+  return true;
+}
+
+}
+
+PointGroup::PointGroup() : center_({0., 0., 0.}), operations_({identity_op}) { }
+
+PointGroup::PointGroup( std::vector<SymmetryOperation> ops,
+  std::array<double,3> center ) : center_(center), operations_(std::move(ops)) {
+
+  for( const auto& R : operations_ )
+  if( not is_signed_permutation(R) )
+    GAUXC_GENERIC_EXCEPTION("PointGroup Operations Must Be Signed Permutations");
+
+  auto find_op = [&]( const SymmetryOperation& R ) {
+    return std::find( operations_.begin(), operations_.end(), R );
+  };
+
+  // Identity first
+  auto id_it = find_op( identity_op );
+  if( id_it == operations_.end() )
+    GAUXC_GENERIC_EXCEPTION("PointGroup Must Contain The Identity");
+  std::iter_swap( operations_.begin(), id_it );
+
+  // Check closure (and uniqueness of the elements)
+  for( auto it = operations_.begin(); it != operations_.end(); ++it )
+  if( std::find( it+1, operations_.end(), *it ) != operations_.end() )
+    GAUXC_GENERIC_EXCEPTION("PointGroup Operations Must Be Unique");
+
+  for( const auto& A : operations_ )
+  for( const auto& B : operations_ )
+  if( find_op( multiply(A,B) ) == operations_.end() )
+    GAUXC_GENERIC_EXCEPTION("PointGroup Operations Are Not Closed");
+
+}
+
+PointGroup::PointGroup( const PointGroup& )                = default;
+PointGroup::PointGroup( PointGroup&& ) noexcept            = default;
+PointGroup& PointGroup::operator=( const PointGroup& )     = default;
+PointGroup& PointGroup::operator=( PointGroup&& ) noexcept = default;
+PointGroup::~PointGroup() noexcept                         = default;
+
+std::string PointGroup::name() const {
+
+  // Classify elements on (det, trace)
+  size_t nC4 = 0, nS4 = 0, nsigma = 0;
+  bool   has_i = false;
+  for( const auto& R : operations_ ) {
+    const auto det   = determinant(R);
+    const auto trace = R[0] + R[4] + R[8];
+    if( det > 0. ) {
+      if( trace ==  1. ) nC4++;
+    } else {
+      if( trace == -3. ) has_i = true;
+      if( trace ==  1. ) nsigma++;
+      if( trace == -1. ) nS4++;
+    }
+  }
+
+  switch( order() ) {
+    case 1:  return "C1";
+    case 2:  return has_i ? "Ci" : (nsigma ? "Cs" : "C2");
+    case 3:  return "C3";
+    case 4:
+      if( nC4 )    return "C4";
+      if( nS4 )    return "S4";
+      if( has_i )  return "C2h";
+      return nsigma ? "C2v" : "D2";
+    case 6:  return has_i ? "S6" : (nsigma ? "C3v" : "D3");
+    case 8:
+      if( has_i )  return nC4 ? "C4h" : "D2h";
+      if( nC4 )    return nsigma ? "C4v" : "D4";
+      return "D2d";
+    case 12: return has_i ? "D3d" : "T";
+    case 16: return "D4h";
+    case 24:
+      if( has_i )  return "Th";
+      return nsigma ? "Td" : "O";
+    case 48: return "Oh";
+    default: return "G" + std::to_string(order());
+  }
+
+}
+
+std::vector<int64_t> PointGroup::atom_map( const Molecule& mol, size_t iop,
+  double tol ) const {
+
+  std::vector<int64_t> map;
+  if( not try_atom_map( mol, center_, operations_.at(iop), tol, map ) )
+    GAUXC_GENERIC_EXCEPTION("Molecule Is Not Invariant Under PointGroup Operation");
+  return map;
+
+}
+
+PointGroup detect_point_group( const Molecule& mol, double tol ) {
+
+  // Center of nuclear charge
+  std::array<double,3> center = {0., 0., 0.};
+  double Ztot = 0.;
+  for( const auto& atom : mol ) {
+    const double Z = atom.Z.get();
+    center[0] += Z * atom.x; center[1] += Z * atom.y; center[2] += Z * atom.z;
+    Ztot += Z;
+  }
+  if( Ztot > 0. ) for( auto& c : center ) c /= Ztot;
+
+  // Enumerate the 48 signed permutations (O_h), the subset leaving the
+  // molecule invariant is its stabilizer and hence a group
+  std::vector<SymmetryOperation> ops;
+  std::vector<int64_t> map;
+  std::array<int,3> perm = {0, 1, 2};
+  do {
+    for( int signs = 0; signs < 8; ++signs ) {
+      SymmetryOperation R = {0., 0., 0., 0., 0., 0., 0., 0., 0.};
+      for( int i = 0; i < 3; ++i )
+        R[3*i + perm[i]] = (signs >> i) & 1 ? -1. : 1.;
+      if( try_atom_map( mol, center, R, tol, map ) ) ops.emplace_back( R );
+    }
+  } while( std::next_permutation( perm.begin(), perm.end() ) );
+
+  return PointGroup( std::move(ops), center );
+
+}
+
+}
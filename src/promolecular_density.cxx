@@ -0,0 +1,110 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include <gauxc/molgrid/defaults.hpp>
+#include <gauxc/exceptions.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace GauXC {
+
+namespace {
+
+/// Occupied Slater group: number of electrons, effective n and exponent
+struct slater_group {
+  double nocc;
+  double n_eff;
+  double zeta;
+};
+
+constexpr int64_t max_promolecular_Z = 118;
+
+/// Slater, J.C.
+/// Phys. Rev. 36, 57, 1930
+/// https://doi.org/10.1103/PhysRev.36.57
+std::vector<slater_group> make_slater_groups( int64_t Z ) {
+
+  // Madelung (aufbau) filling order as (n, l)
+  constexpr int aufbau[][2] = {
+    {1,0}, {2,0}, {2,1}, {3,0}, {3,1}, {4,0}, {3,2}, {4,1}, {5,0}, {4,2},
+    {5,1}, {6,0}, {4,3}, {5,2}, {6,1}, {7,0}, {5,3}, {6,2}, {7,1}
+  };
+  constexpr double n_eff[] = { 0., 1., 2., 3., 3.7, 4.0, 4.2, 4.2 };
+
+  // Slater groups keyed on (n, t) with t = 0 for (ns,np), t = l otherwise.
+  // Ordering the keys lexicographically gives Slater's group ordering
+  // 1s | 2sp | 3sp | 3d | 4sp | 4d | 4f | 5sp | ...
+  struct group { int n, t; double nocc; };
+  std::vector<group> groups;
+  int64_t nleft = Z;
+  for( const auto& [n, l] : aufbau ) {
+    if( nleft <= 0 ) break;
+    const int64_t nocc = std::min<int64_t>( nleft, 2*(2*l+1) );
+    nleft -= nocc;
+
+    const int t = l < 2 ? 0 : l;
+    auto it = std::find_if( groups.begin(), groups.end(),
+      [&](const auto& g){ return g.n == n and g.t == t; } );
+    if( it == groups.end() ) groups.push_back({ n, t, double(nocc) });
+    else                     it->nocc += nocc;
+  }
+
+  std::vector<slater_group> res;
+  for( const auto& g : groups ) {
+    double s = 0.;
+    for( const auto& o : groups ) {
+      if( o.n == g.n and o.t == g.t )
+        s += (o.nocc - 1.) * (g.n == 1 ? 0.30 : 0.35);
+      else if( g.t == 0 ) {
+        // (ns,np): 0.85 from shell n-1, 1.00 from deeper shells
+        if( o.n == g.n - 1 )    s += 0.85 * o.nocc;
+        else if( o.n < g.n - 1 ) s += o.nocc;
+      } else {
+        // (nd) / (nf): 1.00 from all groups to the left
+        if( std::make_pair(o.n, o.t) < std::make_pair(g.n, g.t) ) s += o.nocc;
+      }
+    }
+    const double ns = n_eff[g.n];
+    res.push_back({ g.nocc, ns, (Z - s) / ns });
+  }
+
+  return res;
+
+}
+
+}
+
+double promolecular_density( AtomicNumber _Z, double r ) {
+
+  static const std::vector<std::vector<slater_group>> slater_groups = [](){
+    std::vector<std::vector<slater_group>> groups( max_promolecular_Z + 1 );
+    for( int64_t Z = 1; Z <= max_promolecular_Z; ++Z )
+      groups[Z] = make_slater_groups(Z);
+    return groups;
+  }();
+
+  const auto Z = _Z.get();
+  if( Z < 0 or Z > max_promolecular_Z )
+    GAUXC_GENERIC_EXCEPTION("Promolecular Density Not Available For Z");
+
+  // rho(r) = sum_g N_g |R_g(r)|**2 / 4pi with normalized Slater-type radial
+  // functions R_g(r) ~ r**(n*-1) exp(-zeta * r)
+  double rho = 0.;
+  for( const auto& g : slater_groups[Z] ) {
+    const double two_n = 2. * g.n_eff;
+    const double log_norm = (two_n + 1.) * std::log(2. * g.zeta) -
+      std::lgamma(two_n + 1.);
+    rho += g.nocc * std::exp( log_norm - 2. * g.zeta * r ) *
+      std::pow( r, two_n - 2. );
+  }
+
+  return rho / (4. * M_PI);
+
+}
+
+}
@@ -37,15 +37,51 @@ MPI_Op get_mpi_op( ReductionOp op ) {
 }
 #endif
 
-size_t get_dtype_size( std::type_index idx ) {
+#ifdef GAUXC_HAS_MPI
+/// Outstanding MPI_Iallreduce on a packed buffer
+class BasicMPIReductionRequest : public detail::ReductionRequestImpl {
 
-  static std::map<std::type_index, size_t> map {
-    {std::type_index(typeid(double)), sizeof(double)}, 
-    {std::type_index(typeid(float)),  sizeof(float)}
-  };
+  detail::PackedReduction packed_;
+  MPI_Request             request_;
+  bool                    complete_ = false;
 
-  return map.at(idx);
-}
+public:
+
+  BasicMPIReductionRequest( const std::vector<ReductionBuffer>& buffers,
+    ReductionOp op, std::type_index idx, MPI_Comm comm ) :
+    packed_(buffers, idx) {
+    packed_.pack();
+    MPI_Iallreduce( MPI_IN_PLACE, packed_.data(), packed_.count(), 
+      get_mpi_datatype(idx), get_mpi_op(op), comm, &request_ );
+  }
+
+  ~BasicMPIReductionRequest() noexcept {
+    if( not complete_ ) {
+      MPI_Wait( &request_, MPI_STATUS_IGNORE );
+      packed_.unpack();
+    }
+  }
+
+  void wait() override {
+    if( complete_ ) return;
+    MPI_Wait( &request_, MPI_STATUS_IGNORE );
+    packed_.unpack();
+    complete_ = true;
+  }
+
+  bool test() override {
+    if( complete_ ) return true;
+    int flag;
+    MPI_Test( &request_, &flag, MPI_STATUS_IGNORE );
+    if( flag ) {
+      packed_.unpack();
+      complete_ = true;
+    }
+    return complete_;
+  }
+
+};
+#endif
 
 
 BasicMPIReductionDriver::BasicMPIReductionDriver(const RuntimeEnvironment& rt) :
@@ -104,6 +140,34 @@ void BasicMPIReductionDriver::allreduce_inplace_typeerased( void* data, size_t s
   }
 }
 
+ReductionRequest BasicMPIReductionDriver::iallreduce_packed_typeerased( 
+  const std::vector<ReductionBuffer>& buffers, ReductionOp op, 
+  std::type_index idx, std::any optional_args ) {
+
+  if( optional_args.has_value() )
+    std::cout << "** Warning: Optional Args Are Not Used in BasiMPIReductionDriver::iallreduce_packed" << std::endl;
+
+  int world_size = runtime_.comm_size();
+  if( world_size == 1 ) {
+    detail::PackedReduction::symmetrize( buffers, idx );
+    return ReductionRequest();
+  }
+
+  #ifdef GAUXC_HAS_MPI
+  // Non-blocking in-place reductions are not possible on inter-communicators
+  int inter_flag;
+  MPI_Comm_test_inter( runtime_.comm(), &inter_flag );
+  if( not inter_flag ) {
+    return ReductionRequest( std::make_shared<BasicMPIReductionRequest>(
+      buffers, op, idx, runtime_.comm() ) );
+  }
+  #endif
+
+  allreduce_packed_typeerased( buffers, op, idx, optional_args );
+  return ReductionRequest();
+
+}
+
 std::unique_ptr<detail::ReductionDriverImpl> BasicMPIReductionDriver::clone() {
   return std::make_unique<BasicMPIReductionDriver>(*this);
 }
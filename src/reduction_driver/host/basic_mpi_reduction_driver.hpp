@@ -10,6 +10,11 @@
 
 namespace GauXC {
 
+#ifdef GAUXC_HAS_MPI
+MPI_Datatype get_mpi_datatype( std::type_index idx );
+MPI_Op       get_mpi_op( ReductionOp op );
+#endif
+
 struct BasicMPIReductionDriver : public HostReductionDriver {
 
   BasicMPIReductionDriver(const RuntimeEnvironment& rt);
@@ -18,6 +23,7 @@ struct BasicMPIReductionDriver : public HostReductionDriver {
 
   void allreduce_typeerased( const void*, void*, size_t, ReductionOp, std::type_index, std::any ) override;
   void allreduce_inplace_typeerased( void*, size_t, ReductionOp, std::type_index, std::any ) override;
+  ReductionRequest iallreduce_packed_typeerased( const std::vector<ReductionBuffer>&, ReductionOp, std::type_index, std::any ) override;
   
   std::unique_ptr<detail::ReductionDriverImpl> clone() override;
 
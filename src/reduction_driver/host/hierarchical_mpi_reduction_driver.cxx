@@ -0,0 +1,386 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "hierarchical_mpi_reduction_driver.hpp"
+#include "host_placement.hpp"
+#include <gauxc/exceptions.hpp>
+#include <cstring>
+#include <cstddef>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+
+#ifdef GAUXC_HAS_MPI
+namespace GauXC {
+
+namespace detail {
+
+template <typename T>
+void accumulate( std::byte* dst, const std::byte* src, size_t st, size_t en ) {
+  auto*       d = reinterpret_cast<T*>( dst );
+  const auto* s = reinterpret_cast<const T*>( src );
+  for( size_t i = st; i < en; ++i ) d[i] += s[i];
+}
+
+/// MPI resources shared between copies of a HierarchicalMPIReductionDriver
+struct NodeSharedContext {
+
+  MPI_Comm node_comm   = MPI_COMM_NULL; ///< Ranks which share memory
+  MPI_Comm leader_comm = MPI_COMM_NULL; ///< Node leaders (node_rank == 0)
+  int      node_rank   = 0;
+  int      node_size   = 1;
+  int      nleaders    = 0;             ///< Number of nodes (leaders only)
+
+  MPI_Win    win      = MPI_WIN_NULL;
+  size_t     capacity = 0;       ///< Bytes of the node buffer
+  std::byte* buffer   = nullptr; ///< Node buffer (allocated by the node leader)
+  bool interleaved     = false;   ///< Pages of buffer are interleaved over NUMA nodes
+
+  /// Outstanding non-blocking reduction which uses the node buffer
+  ReductionRequestImpl* pending = nullptr;
+
+  NodeSharedContext( MPI_Comm comm ) {
+    int world_rank;
+    MPI_Comm_rank( comm, &world_rank );
+    MPI_Comm_split_type( comm, MPI_COMM_TYPE_SHARED, world_rank, 
+      MPI_INFO_NULL, &node_comm );
+    MPI_Comm_rank( node_comm, &node_rank );
+    MPI_Comm_size( node_comm, &node_size );
+    MPI_Comm_split( comm, node_rank == 0 ? 0 : MPI_UNDEFINED, world_rank, 
+      &leader_comm );
+    if( leader_comm != MPI_COMM_NULL ) MPI_Comm_size( leader_comm, &nleaders );
+  }
+
+  ~NodeSharedContext() noexcept {
+    int finalized;
+    MPI_Finalized( &finalized );
+    if( finalized ) return;
+    free_window();
+    if( leader_comm != MPI_COMM_NULL ) MPI_Comm_free( &leader_comm );
+    if( node_comm   != MPI_COMM_NULL ) MPI_Comm_free( &node_comm   );
+  }
+
+  void free_window() {
+    if( win == MPI_WIN_NULL ) return;
+    MPI_Win_unlock_all( win );
+    MPI_Win_free( &win );
+    capacity    = 0;
+    buffer      = nullptr;
+    interleaved = false;
+  }
+
+  /// Ensure the node buffer holds at least `bytes` (collective over node_comm)
+  void reserve( size_t bytes ) {
+
+    // Guard against ranks requesting different sizes
+    unsigned long long req = bytes, max_req;
+    MPI_Allreduce( &req, &max_req, 1, MPI_UNSIGNED_LONG_LONG, MPI_MAX, 
+      node_comm );
+    if( max_req <= capacity and win != MPI_WIN_NULL ) return;
+    free_window();
+
+    // Round up to a multiple of the cache line size
+    bytes = std::max<size_t>( 64, ((max_req + 63) / 64) * 64 );
+
+    // Only the leader contributes memory, one buffer per node
+    std::byte* base = nullptr;
+    MPI_Win_allocate_shared( node_rank == 0 ? bytes : 0, 1, MPI_INFO_NULL, 
+      node_comm, &base, &win );
+    MPI_Win_lock_all( MPI_MODE_NOCHECK, win );
+    capacity = bytes;
+
+    MPI_Aint sz; int disp;
+    MPI_Win_shared_query( win, 0, &sz, &disp, &buffer );
+
+  }
+
+  /// Make shared window updates visible to all ranks on the node
+  void sync() {
+    MPI_Win_sync( win );
+    MPI_Barrier( node_comm );
+    MPI_Win_sync( win );
+  }
+
+  /// Complete the outstanding non-blocking reduction (collective over node_comm)
+  void complete_pending() {
+    if( pending ) pending->wait();
+  }
+
+  /// Sum `size` elements of `data` over the ranks of the node into the node
+  /// buffer (collective over node_comm)
+  void reduce( const void* data, size_t size, std::type_index idx ) {
+
+    const auto dtype_size = get_dtype_size(idx);
+    reserve( size * dtype_size );
+
+    // In pass p, rank r owns chunk (r + p) % node_size
+    const auto*  src   = static_cast<const std::byte*>( data );
+    const size_t chunk = (size + node_size - 1) / node_size;
+    for( int p = 0; p < node_size; ++p ) {
+      const size_t c  = (node_rank + p) % node_size;
+      const size_t st = std::min( size, c * chunk );
+      const size_t en = std::min( size, st + chunk );
+      if( p == 0 ) 
+        std::memcpy( buffer + st * dtype_size, src + st * dtype_size, 
+          (en - st) * dtype_size );
+      else if( idx == std::type_index(typeid(double)) )
+        accumulate<double>( buffer, src, st, en );
+      else if( idx == std::type_index(typeid(float)) )
+        accumulate<float>( buffer, src, st, en );
+      else GAUXC_GENERIC_EXCEPTION("Unsupported Reduction Type");
+      sync();
+    }
+
+  }
+
+  /// Zeroed node buffer of at least `bytes`, each rank zeroes a different
+  /// chunk. The buffer is owned by GauXC, its pages may be interleaved over
+  /// the NUMA nodes (collective over node_comm)
+  std::byte* zeroed( size_t bytes, bool interleave ) {
+    reserve( bytes );
+
+    // The pages are placed by the memset below, the policy has to be in
+    // place on all ranks beforehand
+    if( interleave and not interleaved ) {
+      if( node_rank == 0 ) detail::interleave_host_pages( buffer, capacity );
+      MPI_Barrier( node_comm );
+      interleaved = true;
+    }
+
+    const size_t chunk = (bytes + node_size - 1) / node_size;
+    const size_t st    = std::min( bytes, node_rank * chunk );
+    const size_t en    = std::min( bytes, st + chunk );
+    std::memset( buffer + st, 0, en - st );
+    sync();
+    return buffer;
+  }
+
+  /// Copy the (fully reduced) node buffer into `data` (collective over 
+  /// node_comm)
+  void read( void* data, size_t bytes ) {
+    sync();
+    std::memcpy( data, buffer, bytes );
+    // Ensure the buffer is not overwritten before all ranks have read it
+    sync();
+  }
+
+};
+
+}
+
+/// Outstanding hierarchical reduction on a packed buffer
+class HierarchicalMPIReductionRequest : public detail::ReductionRequestImpl {
+
+  std::shared_ptr<detail::NodeSharedContext> ctx_;
+  detail::PackedReduction                    packed_;
+  size_t                                     bytes_;
+  MPI_Request                                request_  = MPI_REQUEST_NULL;
+  bool                                       complete_ = false;
+
+  void finalize() {
+    ctx_->read( packed_.data(), bytes_ );
+    packed_.unpack();
+    ctx_->pending = nullptr;
+    complete_ = true;
+  }
+
+public:
+
+  HierarchicalMPIReductionRequest( 
+    std::shared_ptr<detail::NodeSharedContext> ctx,
+    const std::vector<ReductionBuffer>& buffers, ReductionOp op, 
+    std::type_index idx ) :
+    ctx_(ctx), packed_(buffers, idx), 
+    bytes_(packed_.count() * get_dtype_size(idx)) {
+
+    // The node buffer is in use until the previous request completes
+    ctx_->complete_pending();
+
+    packed_.pack();
+    ctx_->reduce( packed_.data(), packed_.count(), idx );
+    if( ctx_->nleaders > 1 )
+      MPI_Iallreduce( MPI_IN_PLACE, ctx_->buffer, packed_.count(), 
+        get_mpi_datatype(idx), get_mpi_op(op), ctx_->leader_comm, &request_ );
+    ctx_->pending = this;
+
+  }
+
+  ~HierarchicalMPIReductionRequest() noexcept {
+    if( not complete_ ) {
+      MPI_Wait( &request_, MPI_STATUS_IGNORE );
+      finalize();
+    }
+  }
+
+  void wait() override {
+    if( complete_ ) return;
+    MPI_Wait( &request_, MPI_STATUS_IGNORE );
+    finalize();
+  }
+
+  bool test() override {
+    if( complete_ ) return true;
+    // Only the leader knows whether the inter-node stage has completed
+    int flag;
+    MPI_Test( &request_, &flag, MPI_STATUS_IGNORE );
+    MPI_Bcast( &flag, 1, MPI_INT, 0, ctx_->node_comm );
+    if( flag ) finalize();
+    return complete_;
+  }
+
+};
+
+HierarchicalMPIReductionDriver::HierarchicalMPIReductionDriver(
+  const RuntimeEnvironment& rt ) : BasicMPIReductionDriver(rt) { 
+
+  // Shared memory communicators cannot be constructed from 
+  // inter-communicators, fall back to the basic reduction in that case
+  int inter_flag;
+  MPI_Comm_test_inter( runtime_.comm(), &inter_flag );
+  if( not inter_flag )
+    ctx_ = std::make_shared<detail::NodeSharedContext>( runtime_.comm() );
+
+}
+
+HierarchicalMPIReductionDriver::~HierarchicalMPIReductionDriver() noexcept = default;
+HierarchicalMPIReductionDriver::HierarchicalMPIReductionDriver(
+  const HierarchicalMPIReductionDriver&) = default;
+
+int HierarchicalMPIReductionDriver::node_rank() const { 
+  return ctx_ ? ctx_->node_rank : 0; 
+}
+int HierarchicalMPIReductionDriver::node_size() const { 
+  return ctx_ ? ctx_->node_size : 1; 
+}
+
+
+void HierarchicalMPIReductionDriver::allreduce_typeerased( const void* src, 
+  void* dest, size_t size, ReductionOp op, std::type_index idx, 
+  std::any optional_args )  {
+
+  if( src != dest ) std::memcpy( dest, src, size * get_dtype_size(idx) );
+  allreduce_inplace_typeerased( dest, size, op, idx, optional_args );
+
+}
+
+void HierarchicalMPIReductionDriver::allreduce_inplace_typeerased( void* data, 
+  size_t size, ReductionOp op, std::type_index idx, std::any optional_args ) {
+
+  if( runtime_.comm_size() == 1 ) return;
+  if( not ctx_ ) {
+    BasicMPIReductionDriver::allreduce_inplace_typeerased( data, size, op, idx, 
+      optional_args );
+    return;
+  }
+
+  if( optional_args.has_value() )
+    std::cout << "** Warning: Optional Args Are Not Used in HierarchicalMPIReductionDriver::allreduce" << std::endl;
+  if( op != ReductionOp::Sum )
+    GAUXC_GENERIC_EXCEPTION("Unsupported Reduction Operation");
+
+  auto& ctx = *ctx_;
+  ctx.complete_pending();
+  ctx.reduce( data, size, idx );
+  if( ctx.nleaders > 1 )
+    MPI_Allreduce( MPI_IN_PLACE, ctx.buffer, size, get_mpi_datatype(idx),
+      get_mpi_op(op), ctx.leader_comm );
+  ctx.read( data, size * get_dtype_size(idx) );
+
+}
+
+ReductionRequest HierarchicalMPIReductionDriver::iallreduce_packed_typeerased( 
+  const std::vector<ReductionBuffer>& buffers, ReductionOp op, 
+  std::type_index idx, std::any optional_args ) {
+
+  if( runtime_.comm_size() == 1 or not ctx_ )
+    return BasicMPIReductionDriver::iallreduce_packed_typeerased( buffers, op, 
+      idx, optional_args );
+
+  if( optional_args.has_value() )
+    std::cout << "** Warning: Optional Args Are Not Used in HierarchicalMPIReductionDriver::iallreduce_packed" << std::endl;
+  if( op != ReductionOp::Sum )
+    GAUXC_GENERIC_EXCEPTION("Unsupported Reduction Operation");
+
+  return ReductionRequest( std::make_shared<HierarchicalMPIReductionRequest>(
+    ctx_, buffers, op, idx ) );
+
+}
+
+bool HierarchicalMPIReductionDriver::supports_node_shared() const {
+  return ctx_ and runtime_.comm_size() > 1;
+}
+
+void* HierarchicalMPIReductionDriver::node_shared_buffer( size_t bytes ) {
+
+  if( not supports_node_shared() )
+    GAUXC_GENERIC_EXCEPTION("Node-Shared Accumulation Requires a Multi-Rank Intra-Communicator");
+
+  // The node buffer is in use until the previous request completes
+  ctx_->complete_pending();
+  return ctx_->zeroed( bytes, 
+    runtime_.host_placement_policy().placement == MemoryPlacement::Interleave );
+
+}
+
+void HierarchicalMPIReductionDriver::reduce_node_shared( 
+  const std::vector<ReductionBuffer>& buffers, ReductionOp op, 
+  std::type_index idx ) {
+
+  if( not supports_node_shared() )
+    GAUXC_GENERIC_EXCEPTION("Node-Shared Accumulation Requires a Multi-Rank Intra-Communicator");
+  if( op != ReductionOp::Sum )
+    GAUXC_GENERIC_EXCEPTION("Unsupported Reduction Operation");
+
+  const auto dtype_size = get_dtype_size(idx);
+  auto& ctx = *ctx_;
+
+  // Dense blocks of the node buffer which correspond to the user buffers
+  std::vector<ReductionBuffer> node_buffers;
+  size_t bytes = 0;
+  for( const auto& buf : buffers ) {
+    node_buffers.push_back( ReductionBuffer{ ctx.buffer + bytes, buf.m, buf.n,
+      buf.m, buf.symmetric } );
+    bytes += buf.m * buf.n * dtype_size;
+  }
+  if( bytes > ctx.capacity )
+    GAUXC_GENERIC_EXCEPTION("Node-Shared Buffer Too Small For Reduction");
+
+  // All contributions of the node must be present before the inter-node
+  // stage, which only communicates the lower triangles of symmetric blocks
+  ctx.sync();
+  if( ctx.nleaders > 1 ) {
+    detail::PackedReduction packed( node_buffers, idx );
+    packed.pack();
+    MPI_Allreduce( MPI_IN_PLACE, packed.data(), packed.count(), 
+      get_mpi_datatype(idx), get_mpi_op(op), ctx.leader_comm );
+    packed.unpack();
+  }
+  ctx.sync();
+
+  // Every rank reads the result
+  for( size_t i = 0; i < buffers.size(); ++i ) {
+    const auto& buf = buffers[i];
+    const auto  ld  = buf.leading_dim();
+    auto*       dst = static_cast<std::byte*>( buf.data );
+    const auto* src = static_cast<const std::byte*>( node_buffers[i].data );
+    for( size_t j = 0; j < buf.n; ++j )
+      std::memcpy( dst + j*ld*dtype_size, src + j*buf.m*dtype_size, 
+        buf.m * dtype_size );
+  }
+  detail::PackedReduction::symmetrize( buffers, idx );
+
+  // Ensure the buffer is not overwritten before all ranks have read it
+  ctx.sync();
+
+}
+
+std::unique_ptr<detail::ReductionDriverImpl> HierarchicalMPIReductionDriver::clone() {
+  return std::make_unique<HierarchicalMPIReductionDriver>(*this);
+}
+
+}
+#endif
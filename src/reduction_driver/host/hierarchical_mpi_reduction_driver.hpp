@@ -0,0 +1,64 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include "basic_mpi_reduction_driver.hpp"
+
+#ifdef GAUXC_HAS_MPI
+namespace GauXC {
+
+namespace detail {
+  struct NodeSharedContext;
+}
+
+/**
+ *  Node-aware reduction driver
+ *
+ *  Reductions are performed in three stages:
+ *    1. Ranks on the same node sum their data into a single MPI-3 shared
+ *       memory buffer owned by the node leader. The buffer is split into 
+ *       node_size chunks and in each of node_size passes every rank 
+ *       accumulates a different chunk
+ *    2. Node leaders allreduce the node-local result
+ *    3. All ranks on the node read the result from the shared buffer
+ *
+ *  Only node leaders participate in inter-node communication. For 
+ *  non-blocking reductions, stage 1 completes on issue and only stage 2 
+ *  is overlapped; completing (wait/test) such a request is collective over
+ *  the ranks of a node.
+ *
+ *  Alternatively, ranks may accumulate directly into the node buffer 
+ *  (node_shared_buffer), which removes both the per-rank copies of the 
+ *  result and stage 1. reduce_node_shared then performs stages 2 and 3.
+ */
+struct HierarchicalMPIReductionDriver : public BasicMPIReductionDriver {
+
+  HierarchicalMPIReductionDriver(const RuntimeEnvironment& rt);
+  virtual ~HierarchicalMPIReductionDriver() noexcept;
+  HierarchicalMPIReductionDriver(const HierarchicalMPIReductionDriver& );
+
+  void allreduce_typeerased( const void*, void*, size_t, ReductionOp, std::type_index, std::any ) override;
+  void allreduce_inplace_typeerased( void*, size_t, ReductionOp, std::type_index, std::any ) override;
+  ReductionRequest iallreduce_packed_typeerased( const std::vector<ReductionBuffer>&, ReductionOp, std::type_index, std::any ) override;
+
+  bool  supports_node_shared() const override;
+  void* node_shared_buffer( size_t bytes ) override;
+  void  reduce_node_shared( const std::vector<ReductionBuffer>&, ReductionOp, std::type_index ) override;
+
+  std::unique_ptr<detail::ReductionDriverImpl> clone() override;
+
+  int node_rank() const;
+  int node_size() const;
+
+private:
+
+  std::shared_ptr<detail::NodeSharedContext> ctx_;
+
+};
+
+}
+#endif
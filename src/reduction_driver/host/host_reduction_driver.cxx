@@ -17,6 +17,24 @@ HostReductionDriver::~HostReductionDriver() noexcept = default;
 
 
 
+void HostReductionDriver::allreduce_packed_typeerased( 
+  const std::vector<ReductionBuffer>& buffers, ReductionOp op, 
+  std::type_index idx, std::any optional_args ) {
+
+  // Nothing to communicate, but the result must still be symmetric
+  if( runtime_.comm_size() == 1 ) {
+    detail::PackedReduction::symmetrize( buffers, idx );
+    return;
+  }
+
+  detail::PackedReduction packed( buffers, idx );
+  packed.pack();
+  allreduce_inplace_typeerased( packed.data(), packed.count(), op, idx,
+    optional_args );
+  packed.unpack();
+
+}
+
 bool HostReductionDriver::takes_host_memory() const {return true;}; 
 bool HostReductionDriver::takes_device_memory() const {return false;};
 
@@ -18,6 +18,9 @@ struct HostReductionDriver : public detail::ReductionDriverImpl {
 
   virtual ~HostReductionDriver() noexcept;
 
+  // Pack all buffers into a single host buffer and reduce in one collective
+  void allreduce_packed_typeerased( const std::vector<ReductionBuffer>&, ReductionOp, std::type_index, std::any ) override;
+
   HostReductionDriver(const RuntimeEnvironment& rt);
 
 };
@@ -0,0 +1,50 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "threaded_reduction_driver.hpp"
+#include "threaded_communicator.hpp"
+#include <gauxc/exceptions.hpp>
+#include <cstring>
+#include <iostream>
+
+namespace GauXC {
+
+ThreadedReductionDriver::ThreadedReductionDriver(const RuntimeEnvironment& rt) :
+  HostReductionDriver(rt), comm_( detail::threaded_communicator(rt) ) { 
+  if( not comm_ ) 
+    GAUXC_GENERIC_EXCEPTION("ThreadedReductionDriver Requires a ThreadedRuntimeEnvironment");
+}
+
+ThreadedReductionDriver::~ThreadedReductionDriver() noexcept = default;
+ThreadedReductionDriver::ThreadedReductionDriver(const ThreadedReductionDriver&) = default;
+
+
+void ThreadedReductionDriver::allreduce_typeerased( const void* src, void* dest, 
+  size_t size, ReductionOp op, std::type_index idx, std::any optional_args )  {
+
+  if( src != dest ) std::memcpy( dest, src, size * get_dtype_size(idx) );
+  allreduce_inplace_typeerased( dest, size, op, idx, optional_args );
+
+}
+
+void ThreadedReductionDriver::allreduce_inplace_typeerased( void* data, size_t size,
+  ReductionOp op, std::type_index idx, std::any optional_args ) {
+
+  if( optional_args.has_value() )
+    std::cout << "** Warning: Optional Args Are Not Used in ThreadedReductionDriver::allreduce" << std::endl;
+  if( op != ReductionOp::Sum )
+    GAUXC_GENERIC_EXCEPTION("Unsupported Reduction Operation");
+
+  comm_->allreduce_inplace( runtime_.comm_rank(), data, size, idx );
+
+}
+
+std::unique_ptr<detail::ReductionDriverImpl> ThreadedReductionDriver::clone() {
+  return std::make_unique<ThreadedReductionDriver>(*this);
+}
+
+}
@@ -0,0 +1,32 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include "host_reduction_driver.hpp"
+
+namespace GauXC {
+
+/// Shared-memory reductions between the virtual ranks of a 
+/// ThreadedRuntimeEnvironment
+struct ThreadedReductionDriver : public HostReductionDriver {
+
+  ThreadedReductionDriver(const RuntimeEnvironment& rt);
+  virtual ~ThreadedReductionDriver() noexcept;
+  ThreadedReductionDriver(const ThreadedReductionDriver& );
+
+  void allreduce_typeerased( const void*, void*, size_t, ReductionOp, std::type_index, std::any ) override;
+  void allreduce_inplace_typeerased( void*, size_t, ReductionOp, std::type_index, std::any ) override;
+  
+  std::unique_ptr<detail::ReductionDriverImpl> clone() override;
+
+private:
+
+  std::shared_ptr<detail::ThreadedCommunicator> comm_;
+
+};
+
+}
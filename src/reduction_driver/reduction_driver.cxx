@@ -34,6 +34,31 @@ void ReductionDriver::allreduce_inplace_typeerased( void* data, size_t size, Red
   pimpl_->allreduce_inplace_typeerased(data, size, op, idx, optional_args);
 }
 
+void ReductionDriver::allreduce_packed_typeerased( const std::vector<ReductionBuffer>& buffers, ReductionOp op, std::type_index idx, std::any optional_args ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->allreduce_packed_typeerased(buffers, op, idx, optional_args);
+}
+
+ReductionRequest ReductionDriver::iallreduce_packed_typeerased( const std::vector<ReductionBuffer>& buffers, ReductionOp op, std::type_index idx, std::any optional_args ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->iallreduce_packed_typeerased(buffers, op, idx, optional_args);
+}
+
+bool ReductionDriver::supports_node_shared() const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->supports_node_shared();
+}
+
+void* ReductionDriver::node_shared_buffer_typeerased( size_t bytes ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->node_shared_buffer(bytes);
+}
+
+void ReductionDriver::reduce_node_shared_typeerased( const std::vector<ReductionBuffer>& buffers, ReductionOp op, std::type_index idx ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->reduce_node_shared(buffers, op, idx);
+}
+
 bool ReductionDriver::takes_host_memory() const {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
   return pimpl_->takes_host_memory();
@@ -45,5 +70,24 @@ bool ReductionDriver::takes_device_memory() const {
 
 
 
+ReductionRequest::ReductionRequest( std::shared_ptr<pimpl_type> pimpl ) :
+  pimpl_( std::move(pimpl) ) { }
+
+ReductionRequest::ReductionRequest() : ReductionRequest( nullptr ) { }
+
+ReductionRequest::ReductionRequest( const ReductionRequest& ) = default;
+ReductionRequest::ReductionRequest( ReductionRequest&& ) noexcept = default;
+ReductionRequest& ReductionRequest::operator=( const ReductionRequest& ) = default;
+ReductionRequest& ReductionRequest::operator=( ReductionRequest&& ) noexcept = default;
+
+ReductionRequest::~ReductionRequest() noexcept = default;
+
+void ReductionRequest::wait() {
+  if( pimpl_ ) pimpl_->wait();
+}
+
+bool ReductionRequest::test() {
+  return pimpl_ ? pimpl_->test() : true;
+}
 
 }
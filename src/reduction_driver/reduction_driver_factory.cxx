@@ -7,6 +7,8 @@
  */
 #include "reduction_driver_impl.hpp"
 #include "host/basic_mpi_reduction_driver.hpp"
+#include "host/hierarchical_mpi_reduction_driver.hpp"
+#include "host/threaded_reduction_driver.hpp"
 
 #ifdef GAUXC_HAS_NCCL
 #include "device/nccl_reduction_driver.hpp"
@@ -27,11 +29,24 @@ std::shared_ptr<ReductionDriver> ReductionDriverFactory::get_shared_instance(
 
   std::unique_ptr<detail::ReductionDriverImpl> ptr = nullptr;
 
-  if( kernel_name == "DEFAULT" ) kernel_name = "BASICMPI";
+  // Virtual ranks can only communicate through shared memory
+  const bool is_threaded = detail::threaded_communicator(rt) != nullptr;
+  if( kernel_name == "DEFAULT" ) 
+    kernel_name = is_threaded ? "THREADED" : "BASICMPI";
+  if( is_threaded and kernel_name != "THREADED" )
+    GAUXC_GENERIC_EXCEPTION("ThreadedRuntimeEnvironment Requires the THREADED Reduction Driver");
+
+  if( kernel_name == "THREADED" )
+    ptr = std::make_unique<ThreadedReductionDriver>(rt);
 
   if( kernel_name == "BASICMPI" )
     ptr = std::make_unique<BasicMPIReductionDriver>(rt);
 
+  #ifdef GAUXC_HAS_MPI
+    if( kernel_name == "HIERARCHICAL" )
+      ptr = std::make_unique<HierarchicalMPIReductionDriver>(rt);
+  #endif
+
   #ifdef GAUXC_HAS_NCCL
     if( kernel_name == "NCCL" )
       ptr = std::make_unique<NCCLReductionDriver>(rt);
@@ -6,6 +6,23 @@
  * See LICENSE.txt for details
  */
 #include "reduction_driver_impl.hpp"
+#include <gauxc/exceptions.hpp>
+#include <cstring>
+#include <map>
+
+namespace GauXC {
+
+size_t get_dtype_size( std::type_index idx ) {
+
+  static std::map<std::type_index, size_t> map {
+    {std::type_index(typeid(double)), sizeof(double)}, 
+    {std::type_index(typeid(float)),  sizeof(float)}
+  };
+
+  return map.at(idx);
+}
+
+}
 
 namespace GauXC::detail {
 
@@ -16,4 +33,127 @@ ReductionDriverImpl::ReductionDriverImpl( const RuntimeEnvironment& rt )
 ReductionDriverImpl::~ReductionDriverImpl() noexcept = default;
 ReductionDriverImpl::ReductionDriverImpl(const ReductionDriverImpl& ) = default;
 
+void ReductionDriverImpl::allreduce_packed_typeerased( 
+  const std::vector<ReductionBuffer>& buffers, ReductionOp op, 
+  std::type_index idx, std::any optional_args ) {
+
+  const auto dtype_size = get_dtype_size(idx);
+  for( const auto& buf : buffers ) {
+    const auto ld = buf.leading_dim();
+    if( ld == buf.m or buf.n == 1 ) {
+      allreduce_inplace_typeerased( buf.data, buf.m * buf.n, op, idx, 
+        optional_args );
+    } else {
+      auto* data = static_cast<std::byte*>(buf.data);
+      for( size_t j = 0; j < buf.n; ++j )
+        allreduce_inplace_typeerased( data + j*ld*dtype_size, buf.m, op, idx,
+          optional_args );
+    }
+  }
+
+}
+
+ReductionRequest ReductionDriverImpl::iallreduce_packed_typeerased( 
+  const std::vector<ReductionBuffer>& buffers, ReductionOp op, 
+  std::type_index idx, std::any optional_args ) {
+
+  allreduce_packed_typeerased( buffers, op, idx, optional_args );
+  return ReductionRequest();
+
+}
+
+bool ReductionDriverImpl::supports_node_shared() const { return false; }
+
+void* ReductionDriverImpl::node_shared_buffer( size_t ) {
+  GAUXC_GENERIC_EXCEPTION("Node-Shared Accumulation Not Supported by this ReductionDriver");
+}
+
+void ReductionDriverImpl::reduce_node_shared( 
+  const std::vector<ReductionBuffer>&, ReductionOp, std::type_index ) {
+  GAUXC_GENERIC_EXCEPTION("Node-Shared Accumulation Not Supported by this ReductionDriver");
+}
+
+
+
+ReductionRequestImpl::~ReductionRequestImpl() noexcept = default;
+
+
+
+PackedReduction::PackedReduction( std::vector<ReductionBuffer> buffers, 
+  std::type_index idx ) : 
+  buffers_(std::move(buffers)), dtype_size_(get_dtype_size(idx)), count_(0) {
+
+  for( const auto& buf : buffers_ ) {
+    if( buf.symmetric ) {
+      if( buf.m != buf.n ) 
+        GAUXC_GENERIC_EXCEPTION("Symmetric Reduction Buffers Must Be Square");
+      count_ += (buf.n * (buf.n+1)) / 2;
+    } else count_ += buf.m * buf.n;
+  }
+
+  packed_.resize( count_ * dtype_size_ );
+
+}
+
+namespace {
+
+void restore_upper( const std::vector<ReductionBuffer>& buffers, 
+  size_t dtype_size ) {
+
+  for( const auto& buf : buffers ) 
+  if( buf.symmetric ) {
+    const auto ld   = buf.leading_dim();
+    auto*      data = static_cast<std::byte*>(buf.data);
+    for( size_t j = 0;   j < buf.n; ++j )
+    for( size_t i = j+1; i < buf.n; ++i ) {
+      std::memcpy( data + (j + i*ld)*dtype_size, 
+        data + (i + j*ld)*dtype_size, dtype_size );
+    }
+  }
+
+}
+
+}
+
+void PackedReduction::pack() {
+
+  auto* pack_ptr = packed_.data();
+  for( const auto& buf : buffers_ ) {
+    const auto  ld   = buf.leading_dim();
+    const auto* data = static_cast<const std::byte*>(buf.data);
+    for( size_t j = 0; j < buf.n; ++j ) {
+      const size_t i_st = buf.symmetric ? j : 0;
+      const size_t len  = (buf.m - i_st) * dtype_size_;
+      std::memcpy( pack_ptr, data + (i_st + j*ld)*dtype_size_, len );
+      pack_ptr += len;
+    }
+  }
+
+}
+
+void PackedReduction::unpack() {
+
+  const auto* pack_ptr = packed_.data();
+  for( const auto& buf : buffers_ ) {
+    const auto ld   = buf.leading_dim();
+    auto*      data = static_cast<std::byte*>(buf.data);
+    for( size_t j = 0; j < buf.n; ++j ) {
+      const size_t i_st = buf.symmetric ? j : 0;
+      const size_t len  = (buf.m - i_st) * dtype_size_;
+      std::memcpy( data + (i_st + j*ld)*dtype_size_, pack_ptr, len );
+      pack_ptr += len;
+    }
+  }
+
+  restore_upper( buffers_, dtype_size_ );
+
+}
+
+void PackedReduction::symmetrize( const std::vector<ReductionBuffer>& buffers,
+  std::type_index idx ) {
+
+  restore_upper( buffers, get_dtype_size(idx) );
+
+}
+
 }
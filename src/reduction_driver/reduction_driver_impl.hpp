@@ -7,10 +7,51 @@
  */
 #pragma once
 #include <gauxc/reduction_driver.hpp>
+#include <cstddef>
 
 namespace GauXC  {
+
+size_t get_dtype_size( std::type_index idx );
+
 namespace detail {
 
+/// Packs a collection of ReductionBuffers into a single contiguous
+/// buffer (lower triangles only for symmetric buffers) and unpacks
+/// the reduced result back into the user buffers.
+class PackedReduction {
+
+  std::vector<ReductionBuffer> buffers_;
+  size_t                       dtype_size_;
+  size_t                       count_;
+  std::vector<std::byte>       packed_;
+
+public:
+
+  PackedReduction( std::vector<ReductionBuffer> buffers, std::type_index idx );
+
+  void pack();
+  void unpack();
+
+  /// Restore the upper triangle of symmetric buffers from the lower triangle
+  static void symmetrize( const std::vector<ReductionBuffer>& buffers,
+    std::type_index idx );
+
+  inline void*  data()        { return packed_.data(); }
+  inline size_t count() const { return count_; }
+
+};
+
+class ReductionRequestImpl {
+
+public:
+
+  virtual ~ReductionRequestImpl() noexcept;
+
+  virtual void wait() = 0;
+  virtual bool test() = 0;
+
+};
+
 class ReductionDriverImpl {
 
 protected: 
@@ -28,6 +69,15 @@ public:
   virtual void allreduce_typeerased( const void*, void*, size_t, ReductionOp, std::type_index, std::any ) = 0;
   virtual void allreduce_inplace_typeerased( void*, size_t, ReductionOp, std::type_index, std::any ) = 0;
 
+  // Default implementations reduce each buffer separately, blocking
+  virtual void allreduce_packed_typeerased( const std::vector<ReductionBuffer>&, ReductionOp, std::type_index, std::any );
+  virtual ReductionRequest iallreduce_packed_typeerased( const std::vector<ReductionBuffer>&, ReductionOp, std::type_index, std::any );
+
+  // Default implementations do not support node-shared accumulation
+  virtual bool  supports_node_shared() const;
+  virtual void* node_shared_buffer( size_t );
+  virtual void  reduce_node_shared( const std::vector<ReductionBuffer>&, ReductionOp, std::type_index );
+
   virtual bool takes_host_memory() const = 0;
   virtual bool takes_device_memory() const = 0;
 
@@ -0,0 +1,228 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "host_placement.hpp"
+#include <gauxc/exceptions.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef __linux__
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+namespace GauXC::detail {
+
+namespace {
+
+/// Parse a sysfs CPU / node list, e.g. "0-3,8-11"
+std::vector<int> parse_sysfs_list( const std::string& str ) {
+  std::vector<int> res;
+  std::stringstream ss(str);
+  std::string range;
+  while( std::getline(ss, range, ',') ) {
+    if( range.empty() or range == "\n" ) continue;
+    const auto dash = range.find('-');
+    const int st = std::stoi( range.substr(0, dash) );
+    const int en = dash == std::string::npos ? st : std::stoi( range.substr(dash+1) );
+    for( int i = st; i <= en; ++i ) res.push_back(i);
+  }
+  return res;
+}
+
+std::string read_sysfs( const std::string& fname ) {
+  std::ifstream file( fname );
+  std::string str;
+  if( file.good() ) std::getline( file, str );
+  return str;
+}
+
+/// NUMA topology: node index of each logical CPU (-1 if unknown)
+struct numa_topology {
+  std::vector<int> nodes;
+  std::vector<int> cpu_to_node;
+
+  numa_topology() {
+    nodes = parse_sysfs_list( read_sysfs("/sys/devices/system/node/online") );
+    for( auto n : nodes ) {
+      auto cpus = parse_sysfs_list( read_sysfs(
+        "/sys/devices/system/node/node" + std::to_string(n) + "/cpulist" ) );
+      for( auto c : cpus ) {
+        if( c >= (int)cpu_to_node.size() ) cpu_to_node.resize( c+1, -1 );
+        cpu_to_node[c] = n;
+      }
+    }
+    if( nodes.empty() ) nodes = {0};
+  }
+
+  int node( int cpu ) const {
+    if( cpu < 0 ) return -1;
+    if( cpu >= (int)cpu_to_node.size() ) return nodes.size() == 1 ? nodes[0] : -1;
+    return cpu_to_node[cpu];
+  }
+};
+
+const numa_topology& topology() {
+  static const numa_topology topo;
+  return topo;
+}
+
+/// Logical CPUs of the process affinity mask prior to any binding
+const std::vector<int>& process_cpus() {
+  static const std::vector<int> cpus = [](){
+    std::vector<int> c;
+  #ifdef __linux__
+    cpu_set_t mask;
+    CPU_ZERO( &mask );
+    if( not sched_getaffinity( 0, sizeof(mask), &mask ) )
+      for( int i = 0; i < CPU_SETSIZE; ++i ) if( CPU_ISSET(i, &mask) ) c.push_back(i);
+  #endif
+    return c;
+  }();
+  return cpus;
+}
+
+int current_cpu() {
+#ifdef __linux__
+  return sched_getcpu();
+#else
+  return -1;
+#endif
+}
+
+int current_thread() {
+#ifdef _OPENMP
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+
+}
+
+void apply_host_placement_policy( const HostPlacementPolicy& policy ) {
+
+  if( policy.nthreads < 0 )
+    GAUXC_GENERIC_EXCEPTION("Invalid Number of Host Threads");
+
+#ifdef _OPENMP
+  if( policy.nthreads ) omp_set_num_threads( policy.nthreads );
+#endif
+
+  if( policy.binding == ThreadBinding::Inherit ) return;
+
+#ifdef __linux__
+  const auto& cpus = process_cpus();
+  if( cpus.empty() ) return;
+  const auto& topo = topology();
+
+  // Order the available CPUs by NUMA node
+  std::vector<std::vector<int>> node_cpus( topo.nodes.size() );
+  for( auto c : cpus ) {
+    const auto n  = topo.node(c);
+    const auto it = std::find( topo.nodes.begin(), topo.nodes.end(), n );
+    node_cpus[ it == topo.nodes.end() ? 0 : std::distance(topo.nodes.begin(), it) ]
+      .push_back(c);
+  }
+  node_cpus.erase( std::remove_if( node_cpus.begin(), node_cpus.end(),
+    [](const auto& v){ return v.empty(); }), node_cpus.end() );
+
+  std::vector<int> cpu_order;
+  if( policy.binding == ThreadBinding::Compact ) {
+    for( const auto& nc : node_cpus )
+      cpu_order.insert( cpu_order.end(), nc.begin(), nc.end() );
+  } else {
+    // Scatter: i-th CPU of each node in turn
+    for( size_t i = 0; cpu_order.size() < cpus.size(); ++i )
+    for( const auto& nc : node_cpus )
+      if( i < nc.size() ) cpu_order.push_back( nc[i] );
+  }
+
+  #pragma omp parallel
+  {
+    const int cpu = cpu_order[ current_thread() % cpu_order.size() ];
+    cpu_set_t mask;
+    CPU_ZERO( &mask );
+    CPU_SET( cpu, &mask );
+    sched_setaffinity( 0, sizeof(mask), &mask );
+  }
+#endif
+
+}
+
+HostPlacement query_host_placement( const HostPlacementPolicy& policy ) {
+
+  HostPlacement placement;
+  placement.policy = policy;
+
+  const auto& topo = topology();
+  placement.nnuma_nodes = topo.nodes.size();
+
+#ifdef _OPENMP
+  placement.nthreads = omp_get_max_threads();
+#endif
+  placement.thread_cpus.assign( placement.nthreads, -1 );
+  placement.thread_nodes.assign( placement.nthreads, -1 );
+
+  #pragma omp parallel
+  {
+    const int tid = current_thread();
+    if( tid < placement.nthreads ) {
+      placement.thread_cpus[tid]  = current_cpu();
+      placement.thread_nodes[tid] = topo.node( placement.thread_cpus[tid] );
+    }
+  }
+
+  placement.threads_per_node.assign( placement.nnuma_nodes, 0 );
+  for( auto n : placement.thread_nodes ) {
+    const auto it = std::find( topo.nodes.begin(), topo.nodes.end(), n );
+    if( it != topo.nodes.end() )
+      placement.threads_per_node[ std::distance(topo.nodes.begin(), it) ]++;
+  }
+
+  return placement;
+
+}
+
+bool interleave_host_pages( void* ptr, size_t bytes ) {
+
+#if defined(__linux__) && defined(SYS_mbind)
+  const auto& topo = topology();
+  if( topo.nodes.size() < 2 ) return false;
+
+  constexpr int mpol_interleave = 3; // MPOL_INTERLEAVE
+  constexpr int mpol_mf_move    = 2; // MPOL_MF_MOVE
+
+  const uintptr_t page = sysconf( _SC_PAGESIZE );
+  const uintptr_t st = ( reinterpret_cast<uintptr_t>(ptr) + page - 1 ) & ~(page - 1);
+  const uintptr_t en = ( reinterpret_cast<uintptr_t>(ptr) + bytes ) & ~(page - 1);
+  if( en <= st ) return false;
+
+  constexpr size_t nbits = 1024;
+  unsigned long nodemask[ nbits / (8 * sizeof(unsigned long)) ] = {};
+  constexpr size_t word_bits = 8 * sizeof(unsigned long);
+  for( auto n : topo.nodes )
+  if( n >= 0 and size_t(n) < nbits ) nodemask[n / word_bits] |= 1ul << (n % word_bits);
+
+  return not syscall( SYS_mbind, st, en - st, mpol_interleave, nodemask,
+    nbits, mpol_mf_move );
+#else
+  (void)ptr; (void)bytes;
+  return false;
+#endif
+
+}
+
+}
@@ -0,0 +1,36 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include <gauxc/runtime_environment.hpp>
+#include <cstddef>
+
+namespace GauXC::detail {
+
+/**
+ *  @brief Apply a host placement policy to the OpenMP threads of the process
+ *
+ *  Sets the number of threads and binds each thread of the OpenMP team to
+ *  a logical CPU of the (initial) process affinity mask. Binding is only
+ *  supported on Linux, it is silently skipped elsewhere.
+ */
+void apply_host_placement_policy( const HostPlacementPolicy& policy );
+
+/// Snapshot of the thread placement of the OpenMP team
+HostPlacement query_host_placement( const HostPlacementPolicy& policy );
+
+/**
+ *  @brief Interleave the pages of a host buffer over the NUMA nodes
+ *
+ *  Only whole pages within [ptr, ptr + bytes) are affected. Pages which
+ *  have already been touched are migrated.
+ *
+ *  @returns true if the pages were (re)placed
+ */
+bool interleave_host_pages( void* ptr, size_t bytes );
+
+}
@@ -16,6 +16,17 @@ RuntimeEnvironment::RuntimeEnvironment( pimpl_ptr_type ptr ) :
 RuntimeEnvironment::RuntimeEnvironment(GAUXC_MPI_CODE(MPI_Comm c)) :
   RuntimeEnvironment( std::make_unique<detail::RuntimeEnvironmentImpl>(GAUXC_MPI_CODE(c)) ) {}
 
+RuntimeEnvironment::RuntimeEnvironment(GAUXC_MPI_CODE(MPI_Comm c,) 
+  HostPlacementPolicy policy) :
+  RuntimeEnvironment( std::make_unique<detail::RuntimeEnvironmentImpl>(
+    GAUXC_MPI_CODE(c,) policy) ) {
+
+  // Only applied on explicit request, copies and derived runtimes (e.g.
+  // threaded virtual ranks) leave the threading environment untouched
+  detail::apply_host_placement_policy( policy );
+
+}
+
 RuntimeEnvironment::~RuntimeEnvironment() noexcept = default;
 
 RuntimeEnvironment::RuntimeEnvironment(const RuntimeEnvironment& other) :
@@ -37,8 +48,20 @@ int RuntimeEnvironment::comm_size() const {
   return pimpl_->comm_size();
 }
 
+int RuntimeEnvironment::node_size() const {
+  return pimpl_->node_size();
+}
+
 int RuntimeEnvironment::shared_usage_count() const {
   return pimpl_.use_count();
 }
 
+const HostPlacementPolicy& RuntimeEnvironment::host_placement_policy() const {
+  return pimpl_->host_placement_policy();
+}
+
+HostPlacement RuntimeEnvironment::host_placement() const {
+  return pimpl_->host_placement();
+}
+
 }
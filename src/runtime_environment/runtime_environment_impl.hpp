@@ -7,6 +7,7 @@
  */
 #pragma once
 #include <gauxc/runtime_environment.hpp>
+#include "host_placement.hpp"
 
 namespace GauXC::detail {
 
@@ -16,16 +17,33 @@ protected:
   GAUXC_MPI_CODE(MPI_Comm comm_;)
   int comm_rank_;
   int comm_size_;
+  int node_size_; ///< Ranks of comm_ which share the host memory
+  HostPlacementPolicy host_policy_;
+
+  /// Ranks which are not backed by comm (e.g. threaded virtual ranks), no
+  /// MPI calls are made
+  RuntimeEnvironmentImpl(GAUXC_MPI_CODE(MPI_Comm c,) int rank, int size,
+    int node_size, HostPlacementPolicy policy = HostPlacementPolicy{}) :
+    GAUXC_MPI_CODE(comm_(c),)
+    comm_rank_(rank), comm_size_(size), node_size_(node_size), 
+    host_policy_(policy) { }
 
 public:
 
-  explicit RuntimeEnvironmentImpl(GAUXC_MPI_CODE(MPI_Comm c)) : 
+  explicit RuntimeEnvironmentImpl(GAUXC_MPI_CODE(MPI_Comm c,)
+    HostPlacementPolicy policy = HostPlacementPolicy{}) : 
     GAUXC_MPI_CODE(comm_(c),)
-    comm_rank_(0), comm_size_(1) {
+    comm_rank_(0), comm_size_(1), node_size_(1), host_policy_(policy) {
 
   #ifdef GAUXC_HAS_MPI
     MPI_Comm_rank( comm_, &comm_rank_ );
     MPI_Comm_size( comm_, &comm_size_ );
+
+    MPI_Comm node_comm;
+    MPI_Comm_split_type( comm_, MPI_COMM_TYPE_SHARED, comm_rank_, 
+      MPI_INFO_NULL, &node_comm );
+    MPI_Comm_size( node_comm, &node_size_ );
+    MPI_Comm_free( &node_comm );
   #endif
 
   }
@@ -38,6 +56,15 @@ public:
 
   inline int comm_rank() const { return comm_rank_; }
   inline int comm_size() const { return comm_size_; }
+  inline int node_size() const { return node_size_; }
+
+  inline const HostPlacementPolicy& host_placement_policy() const {
+    return host_policy_;
+  }
+
+  inline HostPlacement host_placement() const { 
+    return query_host_placement( host_policy_ );
+  }
 
 };
 
@@ -0,0 +1,81 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include "runtime_environment_impl.hpp"
+#include <mutex>
+#include <condition_variable>
+#include <typeindex>
+#include <vector>
+
+namespace GauXC::detail {
+
+/// Shared-memory collectives between the threads of a 
+/// ThreadedRuntimeEnvironment
+class ThreadedCommunicator {
+
+  int size_;
+
+  std::mutex              mtx_;
+  std::condition_variable cv_;
+  int                     arrived_    = 0;
+  size_t                  generation_ = 0;
+  int                     abort_rank_ = -1; ///< First rank to abort
+
+  std::vector<void*> slots_; ///< Buffers published by each rank
+
+public:
+
+  explicit ThreadedCommunicator( int size );
+
+  inline int size() const { return size_; }
+
+  /// Block until all ranks have arrived. Throws if the communicator has 
+  /// been aborted
+  void barrier();
+
+  /// Abort all pending and future collectives, e.g. after `rank` failed
+  /// outside of a collective. Ranks blocked in (or entering) a collective 
+  /// throw instead of waiting for `rank` indefinitely
+  void abort( int rank );
+
+  /// First rank which aborted the communicator (-1 if none)
+  int abort_rank();
+
+  /// Gather a pointer from each rank. The pointees have to remain valid
+  /// until the next collective
+  std::vector<void*> allgather( int rank, void* ptr );
+
+  /// In-place sum over all ranks. Contributions are accumulated in rank 
+  /// order, so results are bitwise reproducible and identical on all ranks
+  void allreduce_inplace( int rank, void* data, size_t count, 
+    std::type_index idx );
+
+  /// Broadcast `bytes` from `root` to all ranks
+  void broadcast( int rank, void* data, size_t bytes, int root );
+
+};
+
+class ThreadedRuntimeEnvironmentImpl : public RuntimeEnvironmentImpl {
+
+  std::shared_ptr<ThreadedCommunicator> thread_comm_;
+
+public:
+
+  ThreadedRuntimeEnvironmentImpl( std::shared_ptr<ThreadedCommunicator> comm,
+    int rank ) : 
+    // Virtual ranks share the process, no MPI calls are made s.t. the ranks
+    // may be constructed concurrently
+    RuntimeEnvironmentImpl(GAUXC_MPI_CODE(MPI_COMM_SELF,) rank, comm->size(),
+      comm->size()), 
+    thread_comm_(comm) { }
+
+  inline auto thread_comm() const { return thread_comm_; }
+
+};
+
+}
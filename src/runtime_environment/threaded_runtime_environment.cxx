@@ -0,0 +1,166 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include <gauxc/runtime_environment.hpp>
+#include <gauxc/exceptions.hpp>
+#include "threaded_communicator.hpp"
+#include <thread>
+#include <exception>
+#include <cstring>
+#include <string>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+namespace GauXC {
+
+namespace detail {
+
+ThreadedCommunicator::ThreadedCommunicator( int size ) :
+  size_(size), slots_(size, nullptr) {
+  if( size < 1 ) GAUXC_GENERIC_EXCEPTION("Invalid Number of Virtual Ranks");
+}
+
+void ThreadedCommunicator::barrier() {
+  std::unique_lock<std::mutex> lock(mtx_);
+  if( abort_rank_ >= 0 ) 
+    GAUXC_GENERIC_EXCEPTION("Threaded Collective Aborted by Rank " + 
+      std::to_string(abort_rank_));
+  const auto gen = generation_;
+  if( ++arrived_ == size_ ) {
+    arrived_ = 0;
+    ++generation_;
+    cv_.notify_all();
+  } else {
+    cv_.wait( lock, [&](){ return gen != generation_ or abort_rank_ >= 0; } );
+    if( gen == generation_ ) 
+      GAUXC_GENERIC_EXCEPTION("Threaded Collective Aborted by Rank " + 
+        std::to_string(abort_rank_));
+  }
+}
+
+void ThreadedCommunicator::abort( int rank ) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  if( abort_rank_ < 0 ) abort_rank_ = rank;
+  cv_.notify_all();
+}
+
+int ThreadedCommunicator::abort_rank() {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return abort_rank_;
+}
+
+std::vector<void*> ThreadedCommunicator::allgather( int rank, void* ptr ) {
+  slots_[rank] = ptr;
+  barrier();
+  auto ptrs = slots_;
+  barrier();
+  return ptrs;
+}
+
+void ThreadedCommunicator::allreduce_inplace( int rank, void* data, 
+  size_t count, std::type_index idx ) {
+
+  if( size_ == 1 ) return;
+
+  const size_t dtype_size = 
+    idx == std::type_index(typeid(double)) ? sizeof(double) :
+    idx == std::type_index(typeid(float))  ? sizeof(float)  : 0;
+  if( not dtype_size ) GAUXC_GENERIC_EXCEPTION("Unsupported Reduction Type");
+
+  // Only the barriers may throw once the buffer is published, the buffers
+  // of the other ranks are accessed in between
+  const size_t chunk = (count + size_ - 1) / size_;
+  const size_t st    = std::min( count, rank * chunk );
+  const size_t en    = std::min( count, st + chunk );
+  std::vector<std::byte> local( (en - st) * dtype_size );
+
+  // Publish buffer
+  slots_[rank] = data;
+  barrier();
+
+  // Reduce local chunk in rank order
+  auto reduce_chunk = [&]( auto* local_ptr ) {
+    using T = std::remove_pointer_t<decltype(local_ptr)>;
+    for( size_t i = st; i < en; ++i ) 
+      local_ptr[i-st] = static_cast<const T*>(slots_[0])[i];
+    for( int r = 1; r < size_; ++r ) {
+      const auto* src = static_cast<const T*>(slots_[r]);
+      for( size_t i = st; i < en; ++i ) local_ptr[i-st] += src[i];
+    }
+  };
+  if( dtype_size == sizeof(double) ) 
+    reduce_chunk( reinterpret_cast<double*>(local.data()) );
+  else
+    reduce_chunk( reinterpret_cast<float*>(local.data()) );
+
+  // Wait for all ranks to finish reading before scattering results
+  barrier();
+  for( int r = 0; r < size_; ++r ) 
+    std::memcpy( static_cast<std::byte*>(slots_[r]) + st * dtype_size, 
+      local.data(), local.size() );
+  barrier();
+
+}
+
+void ThreadedCommunicator::broadcast( int rank, void* data, size_t bytes, 
+  int root ) {
+
+  if( size_ == 1 ) return;
+  if( rank == root ) slots_[root] = data;
+  barrier();
+  if( rank != root ) std::memcpy( data, slots_[root], bytes );
+  barrier();
+
+}
+
+std::shared_ptr<ThreadedCommunicator> 
+  threaded_communicator( const RuntimeEnvironment& rt ) {
+  auto ptr = std::dynamic_pointer_cast<ThreadedRuntimeEnvironmentImpl>(rt.pimpl_);
+  return ptr ? ptr->thread_comm() : nullptr;
+}
+
+}
+
+ThreadedRuntimeEnvironment::ThreadedRuntimeEnvironment( 
+  std::shared_ptr<detail::ThreadedCommunicator> comm, int rank ) :
+  RuntimeEnvironment( 
+    std::make_shared<detail::ThreadedRuntimeEnvironmentImpl>(comm, rank) ) {}
+
+ThreadedRuntimeEnvironment::~ThreadedRuntimeEnvironment() noexcept = default;
+ThreadedRuntimeEnvironment::ThreadedRuntimeEnvironment( 
+  const ThreadedRuntimeEnvironment& ) = default;
+ThreadedRuntimeEnvironment::ThreadedRuntimeEnvironment( 
+  ThreadedRuntimeEnvironment&& ) noexcept = default;
+
+void ThreadedRuntimeEnvironment::launch( int nranks, 
+  const std::function<void(const RuntimeEnvironment&)>& func ) {
+
+  auto comm = std::make_shared<detail::ThreadedCommunicator>(nranks);
+
+  std::vector<std::exception_ptr> errors(nranks);
+  std::vector<std::thread> threads; threads.reserve(nranks);
+  for( int r = 0; r < nranks; ++r ) {
+    threads.emplace_back( [&, r]() {
+      try {
+        ThreadedRuntimeEnvironment rt(comm, r);
+        func(rt);
+      } catch(...) {
+        // Release the ranks waiting on this one in a collective
+        errors[r] = std::current_exception();
+        comm->abort(r);
+      }
+    });
+  }
+
+  // Propagate the original failure rather than the aborted collectives
+  for( auto& t : threads ) t.join();
+  if( comm->abort_rank() >= 0 ) std::rethrow_exception(errors[comm->abort_rank()]);
+
+}
+
+}
@@ -7,7 +7,11 @@
  */
 #include "exx_screening.hpp"
 #include "host/blas.hpp"
+#include "integrator_common.hpp"
 #include <gauxc/util/div_ceil.hpp>
+#include <gauxc/exceptions.hpp>
+#include <algorithm>
+#include <cmath>
 #include <chrono>
 //#include <mpi.h>
 //#include <fstream>
@@ -25,6 +29,27 @@ ostream& operator<<( ostream& out, const vector<T>& v ) {
 
 namespace GauXC {
 
+LocalHostWorkDriver::exx_operator exx_operator( 
+  const IntegratorSettingsSNLinK& settings ) {
+
+  // erfc(omega r) = 1 - erf(omega r)
+  LocalHostWorkDriver::exx_operator op;
+  op.coulomb_coeff = settings.full_range_coeff + settings.short_range_coeff;
+  op.erf_coeff     = settings.long_range_coeff - settings.short_range_coeff;
+  op.omega         = settings.omega;
+
+  if( op.erf_coeff != 0. and op.omega <= 0. )
+    GAUXC_GENERIC_EXCEPTION("Range-Separated sn-LinK Requires omega > 0");
+
+  return op;
+}
+
+double exx_operator_bound( const LocalHostWorkDriver::exx_operator& op ) {
+  // 0 <= erf(omega r) <= 1
+  return std::max( std::abs(op.coulomb_coeff), 
+    std::abs(op.coulomb_coeff + op.erf_coeff) );
+}
+
 void exx_ek_screening( 
   const BasisSet<double>& basis, const BasisSetMap& basis_map,
   const ShellPairCollection<double>& shpairs,
@@ -41,6 +66,9 @@ void exx_ek_screening(
   std::vector<double> task_max_bf_sum(ntasks);
   std::vector<double> task_max_bfn(nbf * ntasks);
 
+  // Host collocation consumes SoA points
+  generate_points_soa( task_begin, task_end );
+
   //using hrt_t = std::chrono::high_resolution_clock;
   //using dur_t = std::chrono::duration<double>;
 
@@ -57,7 +85,7 @@ void exx_ek_screening(
     const auto& task = *(task_begin + i_task);
     const auto npts = task.points.size();
 
-    const auto* points      = task.points.data()->data();
+    const auto* points      = task.points_soa.data();
     const auto* weights     = task.weights.data();
 
     // Basis function shell list
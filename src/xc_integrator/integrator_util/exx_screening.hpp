@@ -7,6 +7,7 @@
  */
 #pragma once
 #include <gauxc/xc_task.hpp>
+#include <gauxc/xc_integrator_settings.hpp>
 #include <host/local_host_work_driver.hpp>
 #ifdef GAUXC_HAS_DEVICE
 #include <device/local_device_work_driver.hpp>
@@ -18,6 +19,13 @@ namespace exx_detail {
   using host_task_iterator  = typename host_task_container::iterator;
 }
 
+/// Two-electron operator of sn-LinK as specified by the settings
+LocalHostWorkDriver::exx_operator exx_operator( 
+  const IntegratorSettingsSNLinK& settings );
+
+/// Factor bounding |op(r)| / (1/r), used to scale the Coulomb integral bounds
+double exx_operator_bound( const LocalHostWorkDriver::exx_operator& op );
+
 void exx_ek_screening( 
   const BasisSet<double>& basis, const BasisSetMap& basis_map,
   const ShellPairCollection<double>& shpairs,
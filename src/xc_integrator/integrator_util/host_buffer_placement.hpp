@@ -0,0 +1,38 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include <gauxc/runtime_environment.hpp>
+#include <cstdint>
+
+namespace GauXC::detail {
+
+/**
+ *  Zero an (m x n) shared host matrix according to a MemoryPlacement policy.
+ *  For FirstTouch / Interleave, the matrix is zeroed by the full OpenMP team,
+ *  which places its pages only if they have not been touched before. The
+ *  matrix is owned by the caller, its memory policy is never modified.
+ *  No-op for null matrices.
+ */
+template <typename T>
+void zero_host_matrix( MemoryPlacement placement, int64_t m, int64_t n, 
+  T* A, int64_t lda ) {
+
+  if( not A or not m or not n ) return;
+
+  if( placement == MemoryPlacement::Inherit ) {
+    for( int64_t j = 0; j < n; ++j )
+    for( int64_t i = 0; i < m; ++i ) A[i + j*lda] = 0.;
+  } else {
+    #pragma omp parallel for schedule(static)
+    for( int64_t j = 0; j < n; ++j )
+    for( int64_t i = 0; i < m; ++i ) A[i + j*lda] = 0.;
+  }
+
+}
+
+}
@@ -11,6 +11,11 @@
 #include <array>
 #include <vector>
 #include <cstdint>
+#include <iterator>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
 
 namespace GauXC      {
 
@@ -141,4 +146,155 @@ std::tuple< std::vector< std::array<int32_t, 3> > , std::vector< int32_t > >
 
 
 
+void populate_submat_maps( size_t nbf, std::vector<XCTask>::iterator begin,
+                           std::vector<XCTask>::iterator end,
+                           const BasisSetMap& basis_map ) {
+
+  auto populate = [&]( XCTask::screening_data& scr ) {
+    if( scr.shell_list.size() and scr.submat_map.empty() )
+      std::tie( scr.submat_map, scr.submat_block ) = 
+        gen_compressed_submat_map( basis_map, scr.shell_list, nbf, nbf );
+  };
+
+  const int64_t ntasks = std::distance( begin, end );
+  #pragma omp parallel for schedule(dynamic)
+  for( int64_t i = 0; i < ntasks; ++i ) {
+    auto& task = *(begin + i);
+    populate( task.bfn_screening );
+    populate( task.cou_screening );
+  }
+
+}
+
+void generate_points_soa( std::vector<XCTask>::iterator begin, 
+                          std::vector<XCTask>::iterator end ) {
+
+  const int64_t ntasks = std::distance( begin, end );
+  #pragma omp parallel for schedule(dynamic)
+  for( int64_t i = 0; i < ntasks; ++i ) {
+    auto& task = *(begin + i);
+    if( not task.has_points_soa() ) task.generate_points_soa();
+  }
+
+}
+
+
+namespace {
+
+constexpr int sfc_bits = 21;
+
+/// Spread the lower 21 bits of x such that bit i lands on bit 3i
+inline uint64_t spread_bits_3d( uint64_t x ) {
+  x &= 0x1fffff;
+  x = (x | (x << 32)) & 0x001f00000000ffffull;
+  x = (x | (x << 16)) & 0x001f0000ff0000ffull;
+  x = (x | (x <<  8)) & 0x100f00f00f00f00full;
+  x = (x | (x <<  4)) & 0x10c30c30c30c30c3ull;
+  x = (x | (x <<  2)) & 0x1249249249249249ull;
+  return x;
+}
+
+}
+
+uint64_t morton_index( uint32_t x, uint32_t y, uint32_t z ) {
+  return (spread_bits_3d(x) << 2) | (spread_bits_3d(y) << 1) | spread_bits_3d(z);
+}
+
+uint64_t hilbert_index( uint32_t x, uint32_t y, uint32_t z ) {
+
+  // Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707, 381 (2004)
+  std::array<uint32_t,3> X = { x, y, z };
+  const uint32_t M = 1u << (sfc_bits - 1);
+
+  // Inverse undo
+  for( uint32_t Q = M; Q > 1; Q >>= 1 ) {
+    const uint32_t P = Q - 1;
+    for( int i = 0; i < 3; ++i ) {
+      if( X[i] & Q ) X[0] ^= P;
+      else {
+        const uint32_t t = (X[0] ^ X[i]) & P;
+        X[0] ^= t; X[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for( int i = 1; i < 3; ++i ) X[i] ^= X[i-1];
+  uint32_t t = 0;
+  for( uint32_t Q = M; Q > 1; Q >>= 1 ) if( X[2] & Q ) t ^= Q - 1;
+  for( int i = 0; i < 3; ++i ) X[i] ^= t;
+
+  // The transposed index interleaves with X[0] as the most significant bit
+  return morton_index( X[0], X[1], X[2] );
+
+}
+
+void order_tasks( TaskOrdering ordering, std::vector<XCTask>::iterator begin,
+                  std::vector<XCTask>::iterator end,
+                  const std::function<double(const XCTask&)>& cost ) {
+
+  if( ordering == TaskOrdering::Cost ) {
+    std::sort( begin, end, [&]( const XCTask& a, const XCTask& b ) {
+      return cost(a) > cost(b);
+    });
+    return;
+  }
+
+  const size_t ntasks = std::distance( begin, end );
+  if( not ntasks ) return;
+
+  // Cost chunk (power of two) and bounding box center of each task
+  std::vector<int> chunk( ntasks );
+  std::vector<std::array<double,3>> centers( ntasks );
+  #pragma omp parallel for
+  for( size_t i = 0; i < ntasks; ++i ) {
+    const auto& task = *(begin + i);
+    const double c = cost(task);
+    chunk[i] = c > 0. ? std::ilogb(c) : std::numeric_limits<int>::min();
+
+    std::array<double,3> lo = { 0., 0., 0. }, up = { 0., 0., 0. };
+    if( task.points.size() ) { lo = task.points[0]; up = task.points[0]; }
+    for( const auto& p : task.points ) 
+    for( int k = 0; k < 3; ++k ) {
+      lo[k] = std::min( lo[k], p[k] );
+      up[k] = std::max( up[k], p[k] );
+    }
+    for( int k = 0; k < 3; ++k ) centers[i][k] = 0.5 * (lo[k] + up[k]);
+  }
+
+  // Quantize centers onto the curve lattice
+  std::array<double,3> lo = centers[0], up = centers[0];
+  for( const auto& c : centers )
+  for( int k = 0; k < 3; ++k ) {
+    lo[k] = std::min( lo[k], c[k] );
+    up[k] = std::max( up[k], c[k] );
+  }
+
+  const double nlat = double( (1u << sfc_bits) - 1 );
+  std::vector<uint64_t> key( ntasks );
+  for( size_t i = 0; i < ntasks; ++i ) {
+    std::array<uint32_t,3> q;
+    for( int k = 0; k < 3; ++k ) {
+      const double ext = up[k] - lo[k];
+      q[k] = ext > 0. ? uint32_t( (centers[i][k] - lo[k]) / ext * nlat ) : 0u;
+    }
+    key[i] = ordering == TaskOrdering::Hilbert ? 
+      hilbert_index( q[0], q[1], q[2] ) : morton_index( q[0], q[1], q[2] );
+  }
+
+  // Cost-descending chunks, curve order within each chunk
+  std::vector<size_t> perm( ntasks );
+  std::iota( perm.begin(), perm.end(), 0ul );
+  std::sort( perm.begin(), perm.end(), [&]( auto i, auto j ) {
+    if( chunk[i] != chunk[j] ) return chunk[i] > chunk[j];
+    if( key[i]   != key[j]   ) return key[i] < key[j];
+    return i < j;
+  });
+
+  std::vector<XCTask> ordered; ordered.reserve( ntasks );
+  for( auto i : perm ) ordered.emplace_back( std::move( *(begin + i) ) );
+  std::move( ordered.begin(), ordered.end(), begin );
+
+}
+
 }
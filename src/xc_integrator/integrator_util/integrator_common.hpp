@@ -8,6 +8,9 @@
 #pragma once
 
 #include <gauxc/basisset_map.hpp>
+#include <gauxc/xc_task.hpp>
+#include <gauxc/enums.hpp>
+#include <functional>
 
 namespace GauXC      {
 
@@ -16,5 +19,28 @@ std::tuple< std::vector< std::array<int32_t, 3> >, std::vector< int32_t > >
                              const std::vector< int32_t >& shell_mask,
 		             const int32_t LDA, const int32_t block_size ); 
 
+/// Generate (if not already present) the compressed submatrix maps of the
+/// bfn and EK screening data of every task in [begin,end). Maps persist on 
+/// the tasks across integrator invocations
+void populate_submat_maps( size_t nbf, std::vector<XCTask>::iterator begin,
+                           std::vector<XCTask>::iterator end,
+                           const BasisSetMap& basis_map );
+
+/// Ensure every task in [begin,end) carries up-to-date SoA point storage
+void generate_points_soa( std::vector<XCTask>::iterator begin, 
+                          std::vector<XCTask>::iterator end );
+
+/// Morton (Z-order) index of a point on a 2**21 x 2**21 x 2**21 lattice
+uint64_t morton_index( uint32_t x, uint32_t y, uint32_t z );
+
+/// Hilbert curve index of a point on a 2**21 x 2**21 x 2**21 lattice
+uint64_t hilbert_index( uint32_t x, uint32_t y, uint32_t z );
+
+/// Reorder tasks in [begin,end) for execution according to `ordering`.
+/// `cost` returns the modeled cost of a task (larger tasks execute first)
+void order_tasks( TaskOrdering ordering, std::vector<XCTask>::iterator begin,
+                  std::vector<XCTask>::iterator end,
+                  const std::function<double(const XCTask&)>& cost );
+
 
 }
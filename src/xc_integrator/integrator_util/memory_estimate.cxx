@@ -0,0 +1,313 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include <gauxc/xc_integrator/memory_estimate.hpp>
+#include <gauxc/exceptions.hpp>
+#include <gauxc/shell_pair.hpp>
+#include <gauxc/util/mpi.hpp>
+#include "threaded_communicator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <map>
+
+namespace GauXC {
+
+namespace {
+
+/// Capacity of a std::vector after n successive push_back (geometric growth)
+size_t grown_capacity( size_t n ) {
+  if( not n ) return 0;
+  size_t cap = 1;
+  while( cap < n ) cap *= 2;
+  return cap;
+}
+
+/// Number of entries of the compressed submatrix map of a (sorted) shell list
+/// w.r.t. the full basis, i.e. the number of contiguous runs of shells
+size_t submat_map_size( const std::vector<int32_t>& shell_list ) {
+  if( shell_list.empty() ) return 0;
+  size_t nrun = 1;
+  for( size_t i = 1; i < shell_list.size(); ++i )
+    if( shell_list[i] - shell_list[i-1] != 1 ) ++nrun;
+  return nrun;
+}
+
+/// Storage held by a set of screening data
+size_t screening_bytes( const XCTask::screening_data& scr ) {
+  return scr.shell_list.capacity()          * sizeof(int32_t) +
+         scr.shell_pair_list.capacity()     * sizeof(XCTask::screening_data::pair_t) +
+         scr.shell_pair_idx_list.capacity() * sizeof(int32_t) +
+         scr.submat_block.capacity()        * sizeof(int32_t) +
+         scr.submat_map.capacity()          * sizeof(std::array<int32_t,3>);
+}
+
+/// Persistent components + largest phase of the selected components
+size_t phase_peak( const std::vector<MemoryComponent>& components,
+  int nthreads, bool per_thread_only, bool exclude_allocated ) {
+
+  std::map<int,size_t> phase_bytes;
+  for( const auto& c : components ) {
+    if( per_thread_only and not c.per_thread ) continue;
+    if( exclude_allocated and c.allocated ) continue;
+    const size_t mult = (c.per_thread and not per_thread_only) ? nthreads : 1;
+    phase_bytes[c.phase] += mult * c.bytes;
+  }
+
+  size_t max_phase = 0;
+  for( const auto& [phase, bytes] : phase_bytes )
+    if( phase ) max_phase = std::max( max_phase, bytes );
+  return phase_bytes[0] + max_phase;
+
+}
+
+}
+
+size_t MemoryEstimate::per_thread_bytes() const {
+  return phase_peak( components, nthreads, true, false );
+}
+
+size_t MemoryEstimate::peak_bytes() const {
+  return phase_peak( components, nthreads, false, false );
+}
+
+size_t MemoryEstimate::call_bytes() const {
+  return phase_peak( components, nthreads, false, true );
+}
+
+MemoryEstimate estimate_memory( const LoadBalancer& lb,
+  const MemoryEstimateSettings& settings ) {
+
+  const auto& tasks = lb.get_tasks();
+  const auto& basis = lb.basis();
+
+  const size_t nbf     = basis.nbf();
+  const size_t nshells = basis.nshells();
+  const size_t natoms  = lb.molecule().size();
+  constexpr size_t dsz = sizeof(double);
+
+  // Sanity check the invocation
+  const auto   integrand = settings.integrand;
+  const size_t nspin     = settings.nspin;
+  const size_t nmat      = settings.nmat;
+  const size_t ntrial    = settings.ntrial;
+  if( nspin != 1 and nspin != 2 and nspin != 4 )
+    GAUXC_GENERIC_EXCEPTION("NSPIN Must Be 1 (RKS), 2 (UKS) or 4 (GKS)");
+  if( settings.nmat < 1 or settings.ntrial < 1 )
+    GAUXC_GENERIC_EXCEPTION("NMAT / NTRIAL Must Be Positive");
+
+  const bool is_rks = nspin == 1;
+  const bool is_gks = nspin == 4;
+
+  const auto func_class  = settings.func_class;
+  const bool is_lda      = func_class == XCFunctionalClass::LDA;
+  const bool is_gga      = func_class == XCFunctionalClass::GGA;
+  const bool needs_lapl  = func_class == XCFunctionalClass::MGGA_Laplacian;
+  const bool is_mgga     = func_class == XCFunctionalClass::MGGA or needs_lapl;
+
+  const bool is_exx = integrand == XCIntegrand::EXX or
+                      integrand == XCIntegrand::EXC_VXC_EXX;
+
+  if( integrand == XCIntegrand::EXC_Grad and is_mgga )
+    GAUXC_GENERIC_EXCEPTION("MGGA Gradients Not Yet Implemented");
+  if( integrand == XCIntegrand::FXC and is_gks )
+    GAUXC_GENERIC_EXCEPTION("GKS FXC Contraction Not Yet Implemented");
+  if( integrand == XCIntegrand::EXC_VXC_EXX and not is_rks )
+    GAUXC_GENERIC_EXCEPTION("EXC/VXC + EXX Only Implemented for RKS");
+
+  MemoryEstimate est;
+  est.nthreads  = settings.nthreads > 0 ? settings.nthreads :
+    std::max( 1, lb.runtime().host_placement().nthreads );
+  est.ntasks    = tasks.size();
+  est.task_cost = lb.total_exc_vxc_cost();
+
+  auto add = [&]( std::string name, size_t bytes, bool per_thread,
+    bool allocated = false, int phase = 0 ) {
+    if( bytes ) est.components.push_back(
+      MemoryComponent{ name, bytes, per_thread, allocated, phase } );
+  };
+
+  // Task extents and the task data generated on first use
+  size_t max_npts = 0, max_nbe = 0, max_npts_x_nbe = 0;
+  size_t task_bytes = tasks.capacity() * sizeof(XCTask);
+  size_t soa_bytes = 0, submat_bytes = 0;
+  for( const auto& task : tasks ) {
+    const size_t npts = task.points.size();
+    const size_t nbe  = task.bfn_screening.nbe;
+    max_npts       = std::max( max_npts, npts );
+    max_nbe        = std::max( max_nbe,  nbe  );
+    max_npts_x_nbe = std::max( max_npts_x_nbe, npts * nbe );
+
+    task_bytes += task.points.capacity()     * sizeof(std::array<double,3>) +
+                  task.weights.capacity()    * dsz +
+                  task.points_soa.capacity() * dsz +
+                  screening_bytes( task.bfn_screening ) +
+                  screening_bytes( task.cou_screening );
+
+    if( not task.has_points_soa() ) soa_bytes += 3 * npts * dsz;
+
+    const auto& shell_list = task.bfn_screening.shell_list;
+    if( shell_list.size() and task.bfn_screening.submat_map.empty() )
+      submat_bytes +=
+        grown_capacity( submat_map_size(shell_list) ) * sizeof(std::array<int32_t,3>) +
+        grown_capacity( 2 ) * sizeof(int32_t);
+  }
+
+  add( "LoadBalancer.Tasks",      task_bytes,   false, true );
+  add( "LoadBalancer.PointsSoA",  soa_bytes,    false );
+  add( "LoadBalancer.SubmatMaps", submat_bytes, false );
+
+  // sn-LinK screening and integration are separate phases of the call
+  const int screen_phase = is_exx ? 1 : 0;
+  const int work_phase   = is_exx ? 2 : 0;
+
+  // Replicated outputs
+  size_t nout = 0;
+  switch( integrand ) {
+    case XCIntegrand::EXC_VXC:     nout = nspin;          break;
+    case XCIntegrand::FXC:         nout = nspin * ntrial; break;
+    case XCIntegrand::EXX:         nout = nmat;           break;
+    case XCIntegrand::EXC_VXC_EXX: nout = 2;              break;
+    default:                       nout = 0;
+  }
+  add( "XCIntegrator.Output", nout * nbf * nbf * dsz, false );
+  if( integrand == XCIntegrand::EXC_Grad )
+    add( "XCIntegrator.Output", 3 * natoms * dsz, false );
+
+  // Per thread XCHostData (+ integrand specific scratch), the buffers only
+  // grow, each is bounded by the largest task of its dimension
+  const size_t p  = max_npts;
+  const size_t pn = max_npts_x_nbe;
+  const size_t nn = max_nbe * max_nbe;
+
+  const size_t m = is_mgga ? 4 : 1;        // basis (+ grad)
+  const size_t g = is_rks  ? 1 : 3;        // gamma components
+  const size_t nbasis_eval = is_lda ? 1 : (needs_lapl ? 5 : 4);
+
+  size_t host_data = 0; // doubles
+  switch( integrand ) {
+
+    case XCIntegrand::Density:
+      host_data = nn + 2 * pn + p;
+      break;
+
+    case XCIntegrand::EXC:
+    case XCIntegrand::EXC_VXC: {
+      const size_t s = nspin;
+      host_data = nn + pn * s * m + (is_gks ? 6 * p : 0) + p + p * s +
+                  nbasis_eval * pn + (is_lda ? 1 : 4) * s * p;
+      if( not is_lda ) host_data += 2 * g * p;           // gamma / vgamma
+      if( is_mgga    ) host_data += 2 * s * p;           // tau / vtau
+      if( needs_lapl ) host_data += 2 * s * p;           // lapl / vlapl
+      break;
+    }
+
+    case XCIntegrand::FXC: {
+      const size_t s  = is_rks ? 1 : 2;
+      const size_t dd = is_lda ? 1 : 4;
+      host_data = nn + 4 * pn * s * m + 2 * p + p * s + 3 * p * s * dd +
+                  nbasis_eval * pn;
+      if( not is_lda ) host_data += 4 * g * p;           // gamma / vgamma / pert / scr
+      if( is_mgga    ) host_data += 4 * s * p;           // tau / vtau / trial / pert
+      if( needs_lapl ) host_data += 4 * s * p;           // lapl / vlapl / trial / pert
+      break;
+    }
+
+    case XCIntegrand::EXC_Grad: {
+      const size_t sds  = is_rks ? 1 : 2;
+      const size_t xdim = is_gga ? 4 : 1;
+      host_data = nn + p + sds * p + 4 * nspin * p + nspin * xdim * pn +
+                  (4 * nspin + (is_gks ? 6 : 0)) * p + 3 * natoms;
+      host_data += is_gga ? 10 * pn + 2 * g * p : 4 * pn;
+      break;
+    }
+
+    case XCIntegrand::EXX:
+      // basis_eval, nbe_scr, F / G (nbe_ek <= nbf) and the thread local K
+      host_data = pn + nmat * max_nbe * nbf + 2 * nmat * p * nbf + nbf * nbf;
+      break;
+
+    case XCIntegrand::EXC_VXC_EXX:
+      // nbe_scr, X, eps / vrho, F over the union (nbe_union <= nbf), F / G (EK)
+      host_data = max_nbe * nbf + pn * m + 2 * p + p * nbf * m + 2 * p * nbf +
+                  nbasis_eval * pn + (is_lda ? 1 : 4) * p;
+      if( not is_lda ) host_data += 2 * p;
+      if( is_mgga    ) host_data += 2 * p;
+      if( needs_lapl ) host_data += 2 * p;
+      break;
+
+  }
+  add( "XCIntegrator.HostData", host_data * dsz, true, false, work_phase );
+
+  if( is_exx ) {
+
+    // ShellPairCollection, persists on the LoadBalancer
+    if( lb.has_shell_pairs() ) {
+      const auto& shpairs = lb.shell_pairs();
+      size_t sp_bytes = (shpairs.row_ptr().capacity() +
+        shpairs.col_ind().capacity()) * sizeof(size_t) +
+        shpairs.npairs() * sizeof(ShellPair<double>) +
+        shpairs.nprim_pair_total() * sizeof(PrimitivePair<double>);
+      add( "LoadBalancer.ShellPairs", sp_bytes, false, true );
+    } else {
+      size_t npairs = 0, nprim_pairs = 0;
+      for( size_t i = 0; i < nshells; ++i )
+      for( size_t j = 0; j <= i;      ++j ) {
+        ShellPair<double> sp( basis[i], basis[j] );
+        if( sp.nprim_pairs() ) { ++npairs; nprim_pairs += sp.nprim_pairs(); }
+      }
+      const size_t cap = grown_capacity( npairs );
+      add( "LoadBalancer.ShellPairs", (nshells + 1 + cap) * sizeof(size_t) +
+        cap * sizeof(ShellPair<double>) +
+        nprim_pairs * sizeof(PrimitivePair<double>), false );
+    }
+
+    // EK screening: V / |P| bounds and the dense nbf x ntasks arrays
+    const size_t ntasks = tasks.size();
+    add( "EXX.ScreeningBounds", (nshells * nshells + nbf * nbf) * dsz, false,
+      false, screen_phase );
+    add( "EXX.ScreeningArrays", (2 * nbf + 1) * ntasks * dsz, false, false,
+      screen_phase );
+    add( "EXX.ScreeningHostData", (pn + nbf) * dsz, true, false, screen_phase );
+
+  }
+
+  // Per rank summary
+  const uint64_t local[3] = { est.peak_bytes(), est.ntasks, est.task_cost };
+  const auto& rt   = lb.runtime();
+  const int nranks = rt.comm_size();
+  std::vector<uint64_t> all( local, local + 3 );
+  if( auto comm = detail::threaded_communicator(rt) ) {
+    // Virtual ranks of a ThreadedRuntimeEnvironment gather through their
+    // shared-memory communicator, local has to remain valid until the
+    // next collective
+    auto ptrs = comm->allgather( rt.comm_rank(), 
+      const_cast<uint64_t*>(local) );
+    all.resize( 3 * nranks );
+    for( int i = 0; i < nranks; ++i ) 
+      std::copy_n( static_cast<const uint64_t*>(ptrs[i]), 3, 
+        all.data() + 3*i );
+    comm->barrier();
+  }
+#ifdef GAUXC_HAS_MPI
+  else if( nranks > 1 ) {
+    all.resize( 3 * nranks );
+    MPI_Allgather( local, 3, MPI_UINT64_T, all.data(), 3, MPI_UINT64_T,
+      rt.comm() );
+  }
+#endif
+  for( size_t i = 0; i < all.size() / 3; ++i ) {
+    est.rank_peak_bytes.emplace_back( all[3*i + 0] );
+    est.rank_ntasks    .emplace_back( all[3*i + 1] );
+    est.rank_task_cost .emplace_back( all[3*i + 2] );
+  }
+
+  return est;
+
+}
+
+}
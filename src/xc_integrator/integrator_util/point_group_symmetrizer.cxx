@@ -0,0 +1,244 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "point_group_symmetrizer.hpp"
+#include <gauxc/basisset_map.hpp>
+#include <gauxc/exceptions.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <gauxc/util/real_solid_harmonics.hpp>
+
+namespace GauXC {
+namespace detail {
+
+namespace {
+
+/// Cartesian exponents of a shell in CCA order
+std::vector<std::array<int,3>> cartesian_exponents( int l ) {
+  std::vector<std::array<int,3>> e;
+  for( int ix = l; ix >= 0; --ix )
+  for( int iy = l-ix; iy >= 0; --iy ) e.push_back({ ix, iy, l - ix - iy });
+  return e;
+}
+
+/// Solve S X = M in place (M <- X) for small, dense, column-major S
+void small_solve( int n, std::vector<double> S, std::vector<double>& M ) {
+  for( int k = 0; k < n; ++k ) {
+    int piv = k;
+    for( int i = k+1; i < n; ++i )
+    if( std::abs(S[i + k*n]) > std::abs(S[piv + k*n]) ) piv = i;
+    for( int j = 0; j < n; ++j ) {
+      std::swap( S[k + j*n], S[piv + j*n] );
+      std::swap( M[k + j*n], M[piv + j*n] );
+    }
+    const double inv = 1. / S[k + k*n];
+    for( int i = 0; i < n; ++i ) if( i != k ) {
+      const double f = S[i + k*n] * inv;
+      if( f == 0. ) continue;
+      for( int j = 0; j < n; ++j ) {
+        S[i + j*n] -= f * S[k + j*n];
+        M[i + j*n] -= f * M[k + j*n];
+      }
+    }
+  }
+  for( int i = 0; i < n; ++i ) {
+    const double inv = 1. / S[i + i*n];
+    for( int j = 0; j < n; ++j ) M[i + j*n] *= inv;
+  }
+}
+
+/**
+ *  Representation D(g) (column-major, D[image fn + fn * n]) of a signed
+ *  permutation on a shell of angular momentum l: phi(R^T x) = phi(x) D
+ */
+std::vector<double> shell_representation( const SymmetryOperation& R, int l,
+  bool pure ) {
+
+  // R x = ( s_i x_{p(i)} )
+  std::array<int,3> p, s;
+  for( int i = 0; i < 3; ++i )
+  for( int j = 0; j < 3; ++j )
+  if( R[3*i + j] != 0. ) { p[i] = j; s[i] = R[3*i + j] > 0. ? 1 : -1; }
+
+  // Cartesian monomials map onto signed monomials: x^e(R^T x) = sign x^e'
+  // with e'_i = e_{p(i)} and sign = prod_i s_i^{e_{p(i)}}
+  const auto cart = cartesian_exponents(l);
+  const int ncart = cart.size();
+  std::vector<double> Dc( ncart * ncart, 0. );
+  for( int c = 0; c < ncart; ++c ) {
+    std::array<int,3> ep;
+    int sign = 1;
+    for( int i = 0; i < 3; ++i ) {
+      ep[i] = cart[c][p[i]];
+      if( s[i] < 0 and ep[i] % 2 ) sign = -sign;
+    }
+    const int cp = std::distance( cart.begin(),
+      std::find( cart.begin(), cart.end(), ep ) );
+    Dc[cp + c*ncart] = sign;
+  }
+  if( not pure ) return Dc;
+
+  // Y = T C -> (T T**T) D = T Dc T**T
+  const int nsph = 2*l + 1;
+  std::vector<double> T( nsph * ncart );
+  for( int m = -l; m <= l; ++m )
+  for( int c = 0; c < ncart; ++c )
+    T[(m+l) + c*nsph] = util::real_solid_harmonic_coeff( l, m, cart[c][0],
+      cart[c][1], cart[c][2] );
+
+  std::vector<double> DcTt( ncart * nsph, 0. ), S( nsph * nsph, 0. ),
+    Ds( nsph * nsph, 0. );
+  for( int j = 0; j < nsph;  ++j )
+  for( int i = 0; i < ncart; ++i )
+  for( int k = 0; k < ncart; ++k )
+    DcTt[i + j*ncart] += Dc[i + k*ncart] * T[j + k*nsph];
+
+  for( int j = 0; j < nsph; ++j )
+  for( int i = 0; i < nsph; ++i )
+  for( int k = 0; k < ncart; ++k ) {
+    S [i + j*nsph] += T[i + k*nsph] * T[j + k*nsph];
+    Ds[i + j*nsph] += T[i + k*nsph] * DcTt[k + j*ncart];
+  }
+
+  small_solve( nsph, S, Ds );
+  return Ds;
+
+}
+
+bool equivalent_shells( const Shell<double>& a, const Shell<double>& b ) {
+  if( a.l() != b.l() or a.pure() != b.pure() or a.nprim() != b.nprim() )
+    return false;
+  for( int i = 0; i < a.nprim(); ++i ) {
+    const auto da = a.alpha_data()[i], db = b.alpha_data()[i];
+    const auto ca = a.coeff_data()[i], cb = b.coeff_data()[i];
+    if( std::abs(da - db) > 1e-10 * std::abs(da) or
+        std::abs(ca - cb) > 1e-10 * std::abs(ca) ) return false;
+  }
+  return true;
+}
+
+}
+
+PointGroupSymmetrizer::PointGroupSymmetrizer( const PointGroup& pg,
+  const Molecule& mol, const BasisSet<double>& basis ) :
+  nbf_(basis.nbf()), natoms_(mol.natoms()) {
+
+  const size_t nshells = basis.nshells();
+  BasisSetMap basis_map( basis, mol );
+
+  // Shells of each atom, in basis order
+  std::vector<std::vector<int32_t>> atom_shells( natoms_ );
+  int32_t max_l = 0;
+  for( size_t i = 0; i < nshells; ++i ) {
+    const auto iAt = basis_map.shell_to_center(i);
+    if( iAt < 0 )
+      GAUXC_GENERIC_EXCEPTION("PointGroup Symmetry Requires Atom Centered Shells");
+    atom_shells[iAt].push_back(i);
+    shell_offsets_.push_back( basis_map.shell_to_first_ao(i) );
+    shell_sizes_.push_back( basis[i].size() );
+    shell_blocks_.push_back( 2*basis[i].l() + !!basis[i].pure() );
+    max_l = std::max( max_l, basis[i].l() );
+  }
+
+  const size_t nops = pg.order();
+  ops_.resize( nops );
+  for( size_t iop = 0; iop < nops; ++iop ) {
+    auto& op = ops_[iop];
+    op.R        = pg.operations()[iop];
+    op.atom_map = pg.atom_map( mol, iop );
+
+    op.shell_map.resize( nshells );
+    for( size_t iAt = 0; iAt < natoms_; ++iAt ) {
+      const auto& sh_a = atom_shells[iAt];
+      const auto& sh_b = atom_shells[op.atom_map[iAt]];
+      if( sh_a.size() != sh_b.size() )
+        GAUXC_GENERIC_EXCEPTION("BasisSet Not Invariant Under PointGroup");
+      for( size_t k = 0; k < sh_a.size(); ++k ) {
+        if( not equivalent_shells( basis[sh_a[k]], basis[sh_b[k]] ) )
+          GAUXC_GENERIC_EXCEPTION("BasisSet Not Invariant Under PointGroup");
+        op.shell_map[sh_a[k]] = sh_b[k];
+      }
+    }
+
+    op.l_blocks.resize( 2*(max_l+1) );
+    for( int l = 0; l <= max_l; ++l )
+    for( int pure = 0; pure < 2; ++pure )
+      op.l_blocks[2*l + pure] = shell_representation( op.R, l, pure );
+  }
+
+}
+
+void PointGroupSymmetrizer::symmetrize_matrix( double* A, int64_t lda ) const {
+
+  const size_t nshells = shell_sizes_.size();
+  const double fac = 1. / ops_.size();
+  std::vector<double> B( nbf_ * nbf_, 0. );
+
+  #pragma omp parallel
+  {
+  std::vector<double> tmp;
+
+  #pragma omp for schedule(dynamic)
+  for( size_t s = 0; s < nshells; ++s )
+  for( const auto& op : ops_ ) {
+    const int ns = shell_sizes_[s];
+    const auto& Ds = op.l_blocks[shell_blocks_[s]];
+    const auto  A_s = shell_offsets_[op.shell_map[s]];
+    const auto  B_s = shell_offsets_[s];
+
+    for( size_t t = 0; t < nshells; ++t ) {
+      const int nt = shell_sizes_[t];
+      const auto& Dt = op.l_blocks[shell_blocks_[t]];
+      const auto  A_t = shell_offsets_[op.shell_map[t]];
+      const auto  B_t = shell_offsets_[t];
+
+      // tmp = A(s',t') * D_t
+      tmp.assign( ns * nt, 0. );
+      for( int j = 0; j < nt; ++j )
+      for( int k = 0; k < nt; ++k ) {
+        const auto d = Dt[k + j*nt];
+        if( d == 0. ) continue;
+        for( int i = 0; i < ns; ++i )
+          tmp[i + j*ns] += A[(A_s + i) + (A_t + k)*lda] * d;
+      }
+
+      // B(s,t) += D_s**T * tmp
+      for( int j = 0; j < nt; ++j )
+      for( int a = 0; a < ns; ++a ) {
+        double val = 0.;
+        for( int i = 0; i < ns; ++i ) val += Ds[i + a*ns] * tmp[i + j*ns];
+        B[(B_s + a) + (B_t + j)*nbf_] += fac * val;
+      }
+    }
+  }
+  }
+
+  for( size_t j = 0; j < nbf_; ++j )
+  for( size_t i = 0; i < nbf_; ++i )
+    A[i + j*lda] = B[i + j*nbf_];
+
+}
+
+void PointGroupSymmetrizer::symmetrize_gradient( double* G ) const {
+
+  const double fac = 1. / ops_.size();
+  std::vector<double> G_sym( 3 * natoms_, 0. );
+  for( const auto& op : ops_ )
+  for( size_t iAt = 0; iAt < natoms_; ++iAt ) {
+    const auto* g = G + 3*iAt;
+    auto* g_img = G_sym.data() + 3*op.atom_map[iAt];
+    for( int i = 0; i < 3; ++i )
+      g_img[i] += fac * (op.R[3*i]*g[0] + op.R[3*i+1]*g[1] + op.R[3*i+2]*g[2]);
+  }
+  std::copy( G_sym.begin(), G_sym.end(), G );
+
+}
+
+}
+}
@@ -0,0 +1,67 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/point_group.hpp>
+#include <gauxc/basisset.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace GauXC {
+namespace detail {
+
+/**
+ *  @brief Symmetrization of quantities integrated over symmetry-unique points
+ *
+ *  For each group element g, the basis functions transform as
+ *  phi(g^-1 r) = phi'(r) D(g), where D(g) maps the shells of atom A onto the
+ *  equivalent shells of atom g(A). Quantities integrated over the
+ *  symmetry-unique points (with orbit-scaled weights) are mapped onto their
+ *  full-grid values by averaging over the group
+ *
+ *    A   <- 1/|G| sum_g D(g)**T A D(g)
+ *    G_A <- 1/|G| sum_g R_g G_{g^-1(A)}
+ *
+ *  which is exact if the density is totally symmetric.
+ */
+class PointGroupSymmetrizer {
+
+  struct op_data {
+    SymmetryOperation    R;         ///< Cartesian representation
+    std::vector<int64_t> atom_map;  ///< g(A)
+    std::vector<int32_t> shell_map; ///< Image of each shell under g
+    std::vector<std::vector<double>> l_blocks; ///< D(g) blocks per (l, pure)
+  };
+
+  size_t                 nbf_;
+  size_t                 natoms_;
+  std::vector<int32_t>   shell_offsets_; ///< First basis function of each shell
+  std::vector<int32_t>   shell_sizes_;   ///< Number of basis functions per shell
+  std::vector<int32_t>   shell_blocks_;  ///< Index of the (l, pure) block per shell
+  std::vector<op_data>   ops_;
+
+public:
+
+  /**
+   *  @brief Construct the AO representation of a point group
+   *
+   *  Throws if the molecule or basis set is not invariant under the group
+   */
+  PointGroupSymmetrizer( const PointGroup& pg, const Molecule& mol,
+    const BasisSet<double>& basis );
+
+  /// Symmetrize an (nbf x nbf) matrix in place
+  void symmetrize_matrix( double* A, int64_t lda ) const;
+
+  /// Symmetrize a nuclear gradient (natoms x 3, row major) in place
+  void symmetrize_gradient( double* G ) const;
+
+};
+
+}
+}
@@ -0,0 +1,35 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/load_balancer.hpp>
+#include <vector>
+
+namespace GauXC::detail {
+
+/**
+ *  @brief Execute op( task_begin, task_end, accumulate ) over the local tasks
+ *  of lb
+ *
+ *  Out-of-core tasks (see LoadBalancerState::task_scratch_dir) are streamed
+ *  through op chunk by chunk. op overwrites its outputs for the first chunk
+ *  (accumulate == false) and increments them for all subsequent chunks.
+ *  Modifications of the tasks by op are not persisted for out-of-core tasks.
+ */
+template <typename Op>
+void stream_local_work( LoadBalancer& lb, Op&& op ) {
+
+  bool accumulate = false;
+  lb.stream_tasks( [&]( std::vector<XCTask>& tasks ) {
+    op( tasks.begin(), tasks.end(), accumulate );
+    accumulate = true;
+  });
+
+}
+
+}
@@ -16,20 +16,24 @@ namespace GauXC {
 
 LocalWorkDriverFactory::ptr_return_t
   LocalWorkDriverFactory::make_local_work_driver( ExecutionSpace ex, 
-    std::string name, LocalWorkSettings settings ) {
+    std::string name, const LocalWorkSettings& settings ) {
 
   std::transform( name.begin(), name.end(), name.begin(), ::toupper );
-  (void)(settings);
 
   switch(ex) {
 
   case ExecutionSpace::Host:
     if( name == "DEFAULT" ) name = "REFERENCE";
 
-    if( name == "REFERENCE" )
+    if( name == "REFERENCE" or name == "NATIVE" ) {
+      auto* host_settings = dynamic_cast<const LocalHostWorkSettings*>(&settings);
+      auto lwd_settings = host_settings ? *host_settings : LocalHostWorkSettings();
+      if( name == "NATIVE" ) 
+        lwd_settings.collocation_backend = HostCollocation::Native;
       return std::make_unique<LocalHostWorkDriver>(
-        std::make_unique<ReferenceLocalHostWorkDriver>()
+        std::make_unique<ReferenceLocalHostWorkDriver>( lwd_settings )
       );
+    }
     else
       GAUXC_GENERIC_EXCEPTION("LWD Not Recognized: " + name);
 
@@ -37,6 +37,16 @@ void LocalHostWorkDriver::partition_weights( XCWeightAlg weight_alg,
 
 }
 
+void LocalHostWorkDriver::eval_weight_1st_deriv_contracted( XCWeightAlg weight_alg,
+  const Molecule& mol, const MolMeta& meta, const XCTask& task, 
+  const double* w_times_f, double* exc_grad_w ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_weight_1st_deriv_contracted(weight_alg, mol, meta, task, 
+    w_times_f, exc_grad_w);
+
+}
+
 
 // Collocation
 void LocalHostWorkDriver::eval_collocation( size_t npts, size_t nshells, size_t nbe, 
@@ -77,6 +87,18 @@ void LocalHostWorkDriver::eval_collocation_hessian( size_t npts, size_t nshells,
 
 }
 
+// Collocation Laplacian
+void LocalHostWorkDriver::eval_collocation_laplacian( size_t npts, size_t nshells, 
+    size_t nbe, const double* pts, const BasisSet<double>& basis, 
+    const int32_t* shell_list, double* basis_eval, double* dbasis_x_eval, 
+    double* dbasis_y_eval, double* dbasis_z_eval, double* lbasis_eval ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_collocation_laplacian(npts, nshells, nbe, pts, basis, shell_list, 
+    basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval, lbasis_eval);
+
+}
+
 // Collocation 3rd
 void LocalHostWorkDriver::eval_collocation_der3( size_t npts, size_t nshells, size_t nbe, 
     const double* pts, const BasisSet<double>& basis, const int32_t* shell_list, 
@@ -118,7 +140,19 @@ void LocalHostWorkDriver::eval_exx_fmat( size_t npts, size_t nbf, size_t nbe_bra
 
   throw_if_invalid_pimpl(pimpl_);
   pimpl_->eval_exx_fmat(npts, nbf, nbe_bra, nbe_ket, submat_map_bra,
-    submat_map_ket, P, ldp, basis_eval, ldb, F, ldf, scr ); 
+    submat_map_ket, 1, P, ldp, basis_eval, ldb, F, ldf, scr ); 
+
+}
+
+void LocalHostWorkDriver::eval_exx_fmat( size_t npts, size_t nbf, size_t nbe_bra,
+  size_t nbe_ket, const submat_map_t& submat_map_bra,
+  const submat_map_t& submat_map_ket, size_t nmat, const double* P, size_t ldp,
+  const double* basis_eval, size_t ldb, double* F, size_t ldf,
+  double* scr ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_exx_fmat(npts, nbf, nbe_bra, nbe_ket, submat_map_bra,
+    submat_map_ket, nmat, P, ldp, basis_eval, ldb, F, ldf, scr ); 
 
 }
 
@@ -133,7 +167,22 @@ void LocalHostWorkDriver::eval_exx_gmat( size_t npts, size_t nshells,
 
   throw_if_invalid_pimpl(pimpl_);
   pimpl_->eval_exx_gmat(npts, nshells, nshell_pairs, nbe, points, weights, 
-    basis, shpairs, basis_map, shell_list, shell_pair_list, X, ldx, G, ldg );
+    basis, shpairs, basis_map, shell_list, shell_pair_list, 1, X, ldx, G, ldg,
+    exx_operator{} );
+
+}
+
+void LocalHostWorkDriver::eval_exx_gmat( size_t npts, size_t nshells, 
+  size_t nshell_pairs, size_t nbe, const double* points, const double* weights, 
+  const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
+  const BasisSetMap& basis_map, const int32_t* shell_list, 
+  const std::pair<int32_t,int32_t>* shell_pair_list, size_t nmat,
+  const double* X, size_t ldx, double* G, size_t ldg, const exx_operator& op ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_exx_gmat(npts, nshells, nshell_pairs, nbe, points, weights, 
+    basis, shpairs, basis_map, shell_list, shell_pair_list, nmat, X, ldx, G, 
+    ldg, op );
 
 }
 
@@ -144,7 +193,17 @@ void LocalHostWorkDriver::inc_exx_k( size_t npts, size_t nbf, size_t nbe_bra,
 
   throw_if_invalid_pimpl(pimpl_);
   pimpl_->inc_exx_k(npts, nbf, nbe_bra, nbe_ket, basis_eval, submat_map_bra,
-    submat_map_ket, G, ldg, K, ldk, scr );
+    submat_map_ket, 1, G, ldg, K, ldk, scr );
+}
+
+void LocalHostWorkDriver::inc_exx_k( size_t npts, size_t nbf, size_t nbe_bra, 
+  size_t nbe_ket, const double* basis_eval, const submat_map_t& submat_map_bra, 
+  const submat_map_t& submat_map_ket, size_t nmat, const double* G, size_t ldg, 
+  double* K, size_t ldk, double* scr ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->inc_exx_k(npts, nbf, nbe_bra, nbe_ket, basis_eval, submat_map_bra,
+    submat_map_ket, nmat, G, ldg, K, ldk, scr );
 }
 
 
@@ -255,6 +314,28 @@ void LocalHostWorkDriver::eval_uvvar_mgga_uks( size_t npts, size_t nbe,
   
 }
 
+void LocalHostWorkDriver::eval_uvvar_mgga_gks( size_t npts, size_t nbe,
+  const double* basis_eval, const double* dbasis_x_eval, 
+  const double* dbasis_y_eval, const double* dbasis_z_eval, const double* lbasis_eval,
+  const double* Xs, size_t ldxs, const double* Xz, size_t ldxz, 
+  const double* Xx, size_t ldxx, const double* Xy, size_t ldxy, 
+  const double* mmat_xs, const double* mmat_ys, const double* mmat_zs, size_t ldms,
+  const double* mmat_xz, const double* mmat_yz, const double* mmat_zz, size_t ldmz,
+  const double* mmat_xx, const double* mmat_yx, const double* mmat_zx, size_t ldmx,
+  const double* mmat_xy, const double* mmat_yy, const double* mmat_zy, size_t ldmy,
+  double* den_eval, double* dden_x_eval, double* dden_y_eval,
+  double* dden_z_eval, double* gamma, double* tau, double* lapl, double* K,
+  double* H, const double dtol ) {
+  
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_uvvar_mgga_gks(npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+    dbasis_z_eval, lbasis_eval, Xs, ldxs, Xz, ldxz, Xx, ldxx, Xy, ldxy, 
+    mmat_xs, mmat_ys, mmat_zs, ldms, mmat_xz, mmat_yz, mmat_zz, ldmz, 
+    mmat_xx, mmat_yx, mmat_zx, ldmx, mmat_xy, mmat_yy, mmat_zy, ldmy, 
+    den_eval, dden_x_eval, dden_y_eval, dden_z_eval, gamma, tau, lapl, K, H, dtol);
+  
+}
+
 // Eval Z Matrix LDA VXC
 void LocalHostWorkDriver::eval_zmat_lda_vxc_rks( size_t npts, size_t nbe, 
   const double* vrho, const double* basis_eval, double* Z, size_t ldz ) {
@@ -361,6 +442,22 @@ void LocalHostWorkDriver::eval_zmat_mgga_vxc_uks( size_t npts, size_t nbe,
 
 }
 
+void LocalHostWorkDriver::eval_zmat_mgga_vxc_gks( size_t npts, size_t nbe, 
+  const double* vrho, const double* vgamma, const double* vlapl,
+  const double* basis_eval, 
+  const double* dbasis_x_eval, const double* dbasis_y_eval, const double* dbasis_z_eval,
+  const double* lbasis_eval, const double* dden_x_eval, 
+  const double* dden_y_eval, const double* dden_z_eval, double* Zs, size_t ldzs,
+  double* Zz, size_t ldzz, double* Zx, size_t ldzx, double* Zy, size_t ldzy,
+  double* K, double* H ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_zmat_mgga_vxc_gks(npts, nbe, vrho, vgamma, vlapl, basis_eval, dbasis_x_eval,
+    dbasis_y_eval, dbasis_z_eval, lbasis_eval, dden_x_eval, dden_y_eval, dden_z_eval,
+    Zs, ldzs, Zz, ldzz, Zx, ldzx, Zy, ldzy, K, H);
+
+}
+
 
 // Eval M Matrix MGGA VXC
 void LocalHostWorkDriver::eval_mmat_mgga_vxc_rks( size_t npts, size_t nbe, 
@@ -389,6 +486,21 @@ void LocalHostWorkDriver::eval_mmat_mgga_vxc_uks( size_t npts, size_t nbe,
 
 }
 
+void LocalHostWorkDriver::eval_mmat_mgga_vxc_gks( size_t npts, size_t nbe, 
+  const double* vtau, const double* vlapl,
+  const double* dbasis_x_eval, const double* dbasis_y_eval, 
+  const double* dbasis_z_eval, double* mmat_xs, double* mmat_ys, double* mmat_zs, size_t ldms,
+  double* mmat_xz, double* mmat_yz, double* mmat_zz, size_t ldmz,
+  double* mmat_xx, double* mmat_yx, double* mmat_zx, size_t ldmx,
+  double* mmat_xy, double* mmat_yy, double* mmat_zy, size_t ldmy, double* K ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_mmat_mgga_vxc_gks(npts, nbe, vtau, vlapl, dbasis_x_eval,
+    dbasis_y_eval, dbasis_z_eval, mmat_xs, mmat_ys, mmat_zs, ldms, mmat_xz, mmat_yz,
+    mmat_zz, ldmz, mmat_xx, mmat_yx, mmat_zx, ldmx, mmat_xy, mmat_yy, mmat_zy, ldmy, K );
+
+}
+
 // Increment VXC by Z
 void LocalHostWorkDriver::inc_vxc( size_t npts, size_t nbf, size_t nbe, 
   const double* basis_eval, const submat_map_t& submat_map, const double* Z, 
@@ -399,6 +511,113 @@ void LocalHostWorkDriver::inc_vxc( size_t npts, size_t nbf, size_t nbe,
 
 }
 
+// Mixed precision variants
+
+void LocalHostWorkDriver::eval_xmat( size_t npts, size_t nbf, size_t nbe, 
+    const submat_map_t& submat_map, double fac, const double* P, size_t ldp,
+    const float* basis_eval, size_t ldb, float* X, size_t ldx, float* scr ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_xmat(npts, nbf, nbe, submat_map, fac, P, ldp, basis_eval, ldb, X,
+    ldx, scr);
+
+}
+
+void LocalHostWorkDriver::eval_uvvar_lda_rks( size_t npts, size_t nbe, const float* basis_eval,
+    const float* X, size_t ldx, double* den_eval ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_uvvar_lda_rks(npts, nbe, basis_eval, X, ldx, den_eval);
+
+}
+
+void LocalHostWorkDriver::eval_uvvar_lda_uks( size_t npts, size_t nbe, const float* basis_eval,
+    const float* Xs, size_t ldxs, const float* Xz, size_t ldxz, 
+    double* den_eval ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_uvvar_lda_uks(npts, nbe, basis_eval, Xs, ldxs, Xz, ldxz, den_eval);
+
+}
+
+void LocalHostWorkDriver::eval_uvvar_gga_rks( size_t npts, size_t nbe, const float* basis_eval,
+    const float* dbasis_x_eval, const float *dbasis_y_eval, 
+    const float* dbasis_z_eval, const float* X, size_t ldx, double* den_eval, 
+    double* dden_x_eval, double* dden_y_eval, double* dden_z_eval, 
+    double* gamma ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_uvvar_gga_rks(npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+    dbasis_z_eval, X, ldx, den_eval, dden_x_eval, dden_y_eval, dden_z_eval,
+    gamma);
+
+}
+
+void LocalHostWorkDriver::eval_uvvar_gga_uks( size_t npts, size_t nbe, const float* basis_eval,
+    const float* dbasis_x_eval, const float *dbasis_y_eval,
+    const float* dbasis_z_eval, const float* Xs, size_t ldxs, 
+    const float* Xz, size_t ldxz, double* den_eval, double* dden_x_eval, 
+    double* dden_y_eval, double* dden_z_eval, double* gamma ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_uvvar_gga_uks(npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+    dbasis_z_eval, Xs, ldxs, Xz, ldxz, den_eval, dden_x_eval, dden_y_eval,
+    dden_z_eval, gamma);
+
+}
+
+void LocalHostWorkDriver::eval_zmat_lda_vxc_rks( size_t npts, size_t nbe, const double* vrho, 
+    const float* basis_eval, float* Z, size_t ldz ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_zmat_lda_vxc_rks(npts, nbe, vrho, basis_eval, Z, ldz);
+
+}
+
+void LocalHostWorkDriver::eval_zmat_lda_vxc_uks( size_t npts, size_t nbe, const double* vrho, 
+    const float* basis_eval, float* Zs, size_t ldzs, float* Zz, size_t ldzz ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_zmat_lda_vxc_uks(npts, nbe, vrho, basis_eval, Zs, ldzs, Zz, ldzz);
+
+}
+
+void LocalHostWorkDriver::eval_zmat_gga_vxc_rks( size_t npts, size_t nbe, const double* vrho,
+    const double* vgamma, const float* basis_eval, const float* dbasis_x_eval,
+    const float* dbasis_y_eval, const float* dbasis_z_eval, 
+    const double* dden_x_eval, const double* dden_y_eval, 
+    const double* dden_z_eval, float* Z, size_t ldz ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_zmat_gga_vxc_rks(npts, nbe, vrho, vgamma, basis_eval,
+    dbasis_x_eval, dbasis_y_eval, dbasis_z_eval, dden_x_eval, dden_y_eval,
+    dden_z_eval, Z, ldz);
+
+}
+
+void LocalHostWorkDriver::eval_zmat_gga_vxc_uks( size_t npts, size_t nbe, const double* vrho,
+    const double* vgamma, const float* basis_eval, const float* dbasis_x_eval,
+    const float* dbasis_y_eval, const float* dbasis_z_eval, 
+    const double* dden_x_eval, const double* dden_y_eval, 
+    const double* dden_z_eval, float* Zs, size_t ldzs, float* Zz, size_t ldzz ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_zmat_gga_vxc_uks(npts, nbe, vrho, vgamma, basis_eval,
+    dbasis_x_eval, dbasis_y_eval, dbasis_z_eval, dden_x_eval, dden_y_eval,
+    dden_z_eval, Zs, ldzs, Zz, ldzz);
+
+}
+
+void LocalHostWorkDriver::inc_vxc( size_t npts, size_t nbf, size_t nbe, const float* basis_eval,
+    const submat_map_t& submat_map, const float* Z, size_t ldz, 
+    double* VXC, size_t ldvxc, float* scr ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->inc_vxc(npts, nbf, nbe, basis_eval, submat_map, Z, ldz, VXC, ldvxc,
+    scr);
+
+}
+
 
 
 }
@@ -23,6 +23,13 @@ struct LocalHostWorkDriverPIMPL;
 
 }
 
+/// Two-electron operator of sn-LinK, coulomb_coeff / r + erf_coeff * erf(omega r) / r
+struct EXXOperator {
+  double coulomb_coeff = 1.0;
+  double erf_coeff     = 0.0;
+  double omega         = 0.0;
+};
+
 /// Base class for local work drivers in Host execution spaces 
 class LocalHostWorkDriver : public LocalWorkDriver {
 
@@ -33,6 +40,7 @@ public:
   using submat_map_t = std::vector< std::array<int32_t,3> >;
   using task_container = std::vector<XCTask>;
   using task_iterator  = typename task_container::iterator;
+  using exx_operator   = EXXOperator;
 
   /// Construct LocalHostWorkDriver instance in invalid state
   LocalHostWorkDriver();
@@ -72,12 +80,31 @@ public:
     const MolMeta& meta, task_iterator task_begin, task_iterator task_end );
 
 
+  /** Contract the 1st derivatives of the molecular partition weights
+   *
+   *  Increments exc_grad_w(3*iA + k) by sum_i f_i * d w_i / d R_{iA,k} 
+   *  over the points of a task, where w_i are the (partitioned) quadrature 
+   *  weights. The points are taken to move with the parent atom of the task.
+   *
+   *  @param[in] weight_alg Molecular partitioning scheme (Becke or SSF)
+   *  @param[in] mol        Molecule being partitioned
+   *  @param[in] molmeta    Metadata associated with mol
+   *  @param[in] task       XC Task (partitioned weights + SoA points)
+   *  @param[in] w_times_f  Partitioned weights times the integrand (npts)
+   *
+   *  @param[in/out] exc_grad_w Contracted weight derivatives (3*natoms)
+   */
+  void eval_weight_1st_deriv_contracted( XCWeightAlg weight_alg, 
+    const Molecule& mol, const MolMeta& meta, const XCTask& task, 
+    const double* w_times_f, double* exc_grad_w );
+
+
   /** Evaluation the collocation matrix
    *
    *  @param[in] npts     Number of points on which to evaluate the basis
    *  @param[in] nshells  Number of shells to evaluate (length of shell_list)
    *  @param[in] nbe      Total number of basis functions to evaluate (sum over shell_list)
-   *  @param[in] pts      Grid points (AoS)
+   *  @param[in] pts      Grid points (SoA: x(npts), y(npts), z(npts), see XCTask::points_soa)
    *  @param[in] basis    Full basis set
    *  @param[in] shell_list List of indices (0-based) to evaulate from basis
    *
@@ -136,6 +163,30 @@ public:
     double* d2basis_xz_eval, double* d2basis_yy_eval, double* d2basis_yz_eval,
     double* d2basis_zz_eval );
 
+  /** Evaluation the collocation matrix + gradient + Laplacian
+   *
+   *  Equivalent to (but cheaper than) `eval_collocation_hessian` followed by
+   *  lbasis = d2basis_xx + d2basis_yy + d2basis_zz, the individual second
+   *  derivatives are never stored.
+   *
+   *  @param[in] npts     Same as `eval_collocation`
+   *  @param[in] nshells  Same as `eval_collocation`
+   *  @param[in] nbe      Same as `eval_collocation`
+   *  @param[in] pts      Same as `eval_collocation`
+   *  @param[in] basis    Same as `eval_collocation`
+   *  @param[in] shell_list Same as `eval_collocation`
+   *
+   *  @param[out] basis_eval    Same as `eval_collocation`
+   *  @param[out] dbasis_x_eval Same as `eval_collocation_gradient`
+   *  @param[out] dbasis_y_eval Same as `eval_collocation_gradient`
+   *  @param[out] dbasis_z_eval Same as `eval_collocation_gradient`
+   *  @param[out] lbasis_eval   Laplacian of `basis_eval` (same dimensions)
+   */
+  void eval_collocation_laplacian( size_t npts, size_t nshells, size_t nbe, 
+    const double* pts, const BasisSet<double>& basis, const int32_t* shell_list, 
+    double* basis_eval, double* dbasis_x_eval, double* dbasis_y_eval, 
+    double* dbasis_z_eval, double* lbasis_eval );
+
   /** Evaluation the collocation matrix + gradient + hessian + 3rd derivatives
    *
    *  @param[in] npts     Same as `eval_collocation`
@@ -213,6 +264,50 @@ public:
     const double* basis_eval, const submat_map_t& submat_map_bra, 
     const submat_map_t& submat_map_ket, const double* G, size_t ldg, double* K, 
     size_t ldk, double* scr );
+
+  /** Evaluate F(mu,i) = P(mu,nu) * B(nu,i) for several density matrices
+   *
+   *  The F matrices of all densities are formed with a single GEMM. The
+   *  i-th density occupies the rows [i*nbe_bra, (i+1)*nbe_bra) of F.
+   *
+   *  @param[in]  nmat  The number of density matrices
+   *  @param[in]  P     The density matrices, the i-th is P + i*ldp*nbf
+   *  @param[in]  ldf   The leading dimension of F (>= nmat*nbe_bra)
+   *  @param[in/out] scr Scratch space of at least nmat*nbe_bra*nbe_ket
+   */
+  void eval_exx_fmat( size_t npts, size_t nbf, size_t nbe_bra,
+    size_t nbe_ket, const submat_map_t& submat_map_bra,
+    const submat_map_t& submat_map_ket, size_t nmat, const double* P, 
+    size_t ldp, const double* basis_eval, size_t ldb, double* F, size_t ldf,
+    double* scr );
+
+  /** Evaluate G(mu,i) = w(i) * A(mu,nu,i) * X(nu,i) for several X matrices
+   *
+   *  The integrals A(mu,nu,i) are evaluated once per shell pair and 
+   *  contracted with all X. The i-th X (G) matrix occupies the rows 
+   *  [i*nbe, (i+1)*nbe) of X (G), see eval_exx_fmat.
+   *
+   *  @param[in] op  The two-electron operator of A (default 1/r)
+   */
+  void eval_exx_gmat( size_t npts, size_t nshells, size_t nshell_pairs,
+    size_t nbe, const double* points, const double* weights, 
+    const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
+    const BasisSetMap& basis_map, const int32_t* shell_list, 
+    const std::pair<int32_t,int32_t>* shell_pair_list, size_t nmat,
+    const double* X, size_t ldx, double* G, size_t ldg,
+    const exx_operator& op = exx_operator{} );
+
+  /** Increment K(mu,nu) += B(mu,i) * G(nu,i) for several G matrices
+   *
+   *  @param[in]  nmat  The number of G / K matrices
+   *  @param[in]  G     The G matrices, stacked as in eval_exx_gmat
+   *  @param[out] K     The K matrices, the i-th is K + i*ldk*nbf
+   *  @param[in/out] scr Scratch space of at least nmat*nbe_bra*nbe_ket
+   */
+  void inc_exx_k( size_t npts, size_t nbf, size_t nbe_bra, size_t nbe_ket, 
+    const double* basis_eval, const submat_map_t& submat_map_bra, 
+    const submat_map_t& submat_map_ket, size_t nmat, const double* G, size_t ldg, 
+    double* K, size_t ldk, double* scr );
     
   /** Evaluate the U and V variavles for RKS LDA
    *
@@ -333,6 +428,34 @@ public:
     double* den_eval, double* dden_x_eval, double* dden_y_eval, double* dden_z_eval, 
     double* gamma, double* tau, double* lapl);
 
+  /** Evaluate the U and V variables for GKS MGGA
+   *
+   *  Density, gradient and magnetization direction (K, H) are as in
+   *  `eval_uvvar_gga_gks`. The kinetic energy density (and Laplacian) of
+   *  the magnetization is projected onto K to form tau (lapl) +/-.
+   *
+   *  @param[in]  Xx, Xy       X matrices of the x/y magnetization (as in `eval_uvvar_gga_gks`)
+   *  @param[in]  mmat_*{s,z,x,y} Gradient components of the X matrices of each density
+   *  @param[out] tau          Spin-up/down kinetic energy density (2*npts)
+   *  @param[out] lapl         Spin-up/down density Laplacian (2*npts, nullptr if not needed)
+   *  @param[out] K            Magnetization direction (3*npts)
+   *  @param[out] H            Magnetization gradient direction (3*npts)
+   *  @param[in]  dtol         Magnetization norm below which the direction is degenerate
+   *
+   *  Remaining parameters are the same as `eval_uvvar_mgga_uks`
+   */
+  void eval_uvvar_mgga_gks( size_t npts, size_t nbe, const double* basis_eval,
+    const double* dbasis_x_eavl, const double* dbasis_y_eval, 
+    const double* dbasis_z_eval, const double* lbasis_eval,
+    const double* Xs, size_t ldxs, const double* Xz, size_t ldxz, 
+    const double* Xx, size_t ldxx, const double* Xy, size_t ldxy, 
+    const double* mmat_xs, const double* mmat_ys, const double* mmat_zs, size_t ldms, 
+    const double* mmat_xz, const double* mmat_yz, const double* mmat_zz, size_t ldmz, 
+    const double* mmat_xx, const double* mmat_yx, const double* mmat_zx, size_t ldmx, 
+    const double* mmat_xy, const double* mmat_yy, const double* mmat_zy, size_t ldmy, 
+    double* den_eval, double* dden_x_eval, double* dden_y_eval, double* dden_z_eval, 
+    double* gamma, double* tau, double* lapl, double* K, double* H, const double dtol );
+
   /** Evaluate the VXC Z Matrix for RKS LDA
    *
    *  Z(mu,i) = 0.5 * vrho(i) * B(mu, i)
@@ -435,6 +558,20 @@ public:
     const double* lbasis_eval,
     const double* dden_x_eval, const double* dden_y_eval, const double* dden_z_eval,
     double* Zs, size_t ldzs, double* Zz, size_t ldzz );
+
+  /** Evaluate the VXC Z Matrix for GKS MGGA
+   *
+   *  GKS GGA Z matrices (`eval_zmat_gga_vxc_gks`) plus the Laplacian term,
+   *  whose magnetization part is distributed over the components along K.
+   *  The derivatives of K / H wrt the density are neglected.
+   */
+  void eval_zmat_mgga_vxc_gks( size_t npts, size_t nbe, const double* vrho, 
+    const double* vgamma, const double* vlapl, const double* basis_eval, 
+    const double* dbasis_x_eval, const double* dbasis_y_eval, const double* dbasis_z_eval, 
+    const double* lbasis_eval,
+    const double* dden_x_eval, const double* dden_y_eval, const double* dden_z_eval,
+    double* Zs, size_t ldzs, double* Zz, size_t ldzz, double* Zx, size_t ldzx,
+    double* Zy, size_t ldzy, double* K, double* H );
   void eval_mmat_mgga_vxc_rks( size_t npts, size_t nbe, const double* vtau,
       const double* vlapl, const double* dbasis_x_eval, const double* dbasis_y_eval,
       const double* dbasis_z_eval, double* mmat_x, double* mmat_y, double* mmat_z,
@@ -444,6 +581,18 @@ public:
       const double* dbasis_z_eval, double* mmat_xs, double* mmat_ys, double* mmat_zs,
       size_t ldms, double* mmat_xz, double* mmat_yz, double* mmat_zz, size_t ldmz);
 
+  /** Evaluate the VXC M Matrices (tau / Laplacian) for GKS MGGA
+   *
+   *  Scalar part as in `eval_mmat_mgga_vxc_uks`, the magnetization part is
+   *  distributed over the (z,x,y) components along K.
+   */
+  void eval_mmat_mgga_vxc_gks( size_t npts, size_t nbe, const double* vtau,
+      const double* vlapl, const double* dbasis_x_eval, const double* dbasis_y_eval,
+      const double* dbasis_z_eval, double* mmat_xs, double* mmat_ys, double* mmat_zs,
+      size_t ldms, double* mmat_xz, double* mmat_yz, double* mmat_zz, size_t ldmz,
+      double* mmat_xx, double* mmat_yx, double* mmat_zx, size_t ldmx,
+      double* mmat_xy, double* mmat_yy, double* mmat_zy, size_t ldmy, double* K );
+
 
 
   /** Increment VXC integrand given Z / Collocation (RKS LDA+GGA)
@@ -469,6 +618,50 @@ public:
     const submat_map_t& submat_map, const double* Z, size_t ldz, 
     double* VXC, size_t ldvxc, double* scr );
 
+  /** Mixed precision variants of eval_xmat, the RKS/UKS LDA/GGA U/V variable
+   *  and Z matrix evaluations and inc_vxc
+   *
+   *  The collocation, X and Z matrices (and scratch) are float32 and the 
+   *  GEMMs are performed in single precision. P, the U/V variables and VXC 
+   *  are double, the dot products forming the U/V variables are accumulated
+   *  in double.
+   */
+void eval_xmat( size_t npts, size_t nbf, size_t nbe, 
+    const submat_map_t& submat_map, double fac, const double* P, size_t ldp,
+    const float* basis_eval, size_t ldb, float* X, size_t ldx, float* scr );
+void eval_uvvar_lda_rks( size_t npts, size_t nbe, const float* basis_eval,
+    const float* X, size_t ldx, double* den_eval );
+void eval_uvvar_lda_uks( size_t npts, size_t nbe, const float* basis_eval,
+    const float* Xs, size_t ldxs, const float* Xz, size_t ldxz, 
+    double* den_eval );
+void eval_uvvar_gga_rks( size_t npts, size_t nbe, const float* basis_eval,
+    const float* dbasis_x_eval, const float *dbasis_y_eval, 
+    const float* dbasis_z_eval, const float* X, size_t ldx, double* den_eval, 
+    double* dden_x_eval, double* dden_y_eval, double* dden_z_eval, 
+    double* gamma );
+void eval_uvvar_gga_uks( size_t npts, size_t nbe, const float* basis_eval,
+    const float* dbasis_x_eval, const float *dbasis_y_eval,
+    const float* dbasis_z_eval, const float* Xs, size_t ldxs, 
+    const float* Xz, size_t ldxz, double* den_eval, double* dden_x_eval, 
+    double* dden_y_eval, double* dden_z_eval, double* gamma );
+void eval_zmat_lda_vxc_rks( size_t npts, size_t nbe, const double* vrho, 
+    const float* basis_eval, float* Z, size_t ldz );
+void eval_zmat_lda_vxc_uks( size_t npts, size_t nbe, const double* vrho, 
+    const float* basis_eval, float* Zs, size_t ldzs, float* Zz, size_t ldzz );
+void eval_zmat_gga_vxc_rks( size_t npts, size_t nbe, const double* vrho,
+    const double* vgamma, const float* basis_eval, const float* dbasis_x_eval,
+    const float* dbasis_y_eval, const float* dbasis_z_eval, 
+    const double* dden_x_eval, const double* dden_y_eval, 
+    const double* dden_z_eval, float* Z, size_t ldz );
+void eval_zmat_gga_vxc_uks( size_t npts, size_t nbe, const double* vrho,
+    const double* vgamma, const float* basis_eval, const float* dbasis_x_eval,
+    const float* dbasis_y_eval, const float* dbasis_z_eval, 
+    const double* dden_x_eval, const double* dden_y_eval, 
+    const double* dden_z_eval, float* Zs, size_t ldzs, float* Zz, size_t ldzz );
+void inc_vxc( size_t npts, size_t nbf, size_t nbe, const float* basis_eval,
+    const submat_map_t& submat_map, const float* Z, size_t ldz, 
+    double* VXC, size_t ldvxc, float* scr );
+
 private: 
 
   pimpl_type pimpl_; ///< Implementation
@@ -16,6 +16,7 @@ struct LocalHostWorkDriverPIMPL {
   using submat_map_t   = LocalHostWorkDriver::submat_map_t;
   using task_container = LocalHostWorkDriver::task_container;
   using task_iterator  = LocalHostWorkDriver::task_iterator;
+  using exx_operator   = LocalHostWorkDriver::exx_operator;
 
   LocalHostWorkDriverPIMPL();
 
@@ -29,6 +30,9 @@ struct LocalHostWorkDriverPIMPL {
 
   virtual void partition_weights( XCWeightAlg weight_alg, const Molecule& mol, 
     const MolMeta& meta, task_iterator task_begin, task_iterator task_end ) = 0;
+  virtual void eval_weight_1st_deriv_contracted( XCWeightAlg weight_alg, 
+    const Molecule& mol, const MolMeta& meta, const XCTask& task, 
+    const double* w_times_f, double* exc_grad_w ) = 0;
 
   virtual void eval_collocation( size_t npts, size_t nshells, size_t nbe, 
     const double* pts, const BasisSet<double>& basis, const int32_t* shell_list, 
@@ -43,6 +47,10 @@ struct LocalHostWorkDriverPIMPL {
     double* dbasis_z_eval, double* d2basis_xx_eval, double* d2basis_xy_eval,
     double* d2basis_xz_eval, double* d2basis_yy_eval, double* d2basis_yz_eval,
     double* d2basis_zz_eval ) = 0;
+  virtual void eval_collocation_laplacian( size_t npts, size_t nshells, size_t nbe, 
+    const double* pts, const BasisSet<double>& basis, const int32_t* shell_list, 
+    double* basis_eval, double* dbasis_x_eval, double* dbasis_y_eval, 
+    double* dbasis_z_eval, double* lbasis_eval ) = 0;
   virtual void eval_collocation_der3( size_t npts, size_t nshells, size_t nbe,
     const double* pts, const BasisSet<double>& basis, const int32_t* shell_list, 
     double* basis_eval, double* dbasis_x_eval, double* dbasis_y_eval, 
@@ -59,21 +67,22 @@ struct LocalHostWorkDriverPIMPL {
 
   virtual void eval_exx_fmat( size_t npts, size_t nbf, size_t nbe_bra,
     size_t nbe_ket, const submat_map_t& submat_map_bra,
-    const submat_map_t& submat_map_ket, const double* P, size_t ldp,
-    const double* basis_eval, size_t ldb, double* F, size_t ldf,
+    const submat_map_t& submat_map_ket, size_t nmat, const double* P, 
+    size_t ldp, const double* basis_eval, size_t ldb, double* F, size_t ldf,
     double* scr ) = 0;
 
   virtual void eval_exx_gmat( size_t npts, size_t nshells, size_t nshell_pairs,
     size_t nbe, const double* points, const double* weights, 
     const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
     const BasisSetMap& basis_map, const int32_t* shell_list, 
-    const std::pair<int32_t,int32_t>* shell_pair_list, 
-    const double* X, size_t ldx, double* G, size_t ldg ) = 0;
+    const std::pair<int32_t,int32_t>* shell_pair_list, size_t nmat,
+    const double* X, size_t ldx, double* G, size_t ldg, 
+    const exx_operator& op ) = 0;
 
   virtual void inc_exx_k( size_t npts, size_t nbf, size_t nbe_bra, size_t nbe_ket, 
     const double* basis_eval, const submat_map_t& submat_map_bra, 
-    const submat_map_t& submat_map_ket, const double* G, size_t ldg, double* K, 
-    size_t ldk, double* scr ) = 0;
+    const submat_map_t& submat_map_ket, size_t nmat, const double* G, size_t ldg, 
+    double* K, size_t ldk, double* scr ) = 0;
     
   virtual void eval_uvvar_lda_rks( size_t npts, size_t nbe, const double* basis_eval,
     const double* X, size_t ldx, double* den_eval) = 0;
@@ -118,6 +127,18 @@ struct LocalHostWorkDriverPIMPL {
       size_t ldms, const double* mmat_xz, const double* mmat_yz, const double* mmat_zz,
       size_t ldmz, double* den_eval, double* dden_x_eval, double* dden_y_eval,
       double* dden_z_eval, double* gamma, double* tau, double* lapl) = 0;
+  virtual void eval_uvvar_mgga_gks( size_t npts, size_t nbe, const double* basis_eval,
+      const double* dbasis_x_eval, const double* dbasis_y_eval,
+      const double* dbasis_z_eval, const double* lbasis_eval, 
+      const double* Xs, size_t ldxs, const double* Xz, size_t ldxz,
+      const double* Xx, size_t ldxx, const double* Xy, size_t ldxy,
+      const double* mmat_xs, const double* mmat_ys, const double* mmat_zs, size_t ldms, 
+      const double* mmat_xz, const double* mmat_yz, const double* mmat_zz, size_t ldmz,
+      const double* mmat_xx, const double* mmat_yx, const double* mmat_zx, size_t ldmx,
+      const double* mmat_xy, const double* mmat_yy, const double* mmat_zy, size_t ldmy,
+      double* den_eval, double* dden_x_eval, double* dden_y_eval,
+      double* dden_z_eval, double* gamma, double* tau, double* lapl, double* K,
+      double* H, const double dtol) = 0;
 
 
   virtual void eval_zmat_lda_vxc_rks( size_t npts, size_t nbe, const double* vrho, 
@@ -157,6 +178,13 @@ struct LocalHostWorkDriverPIMPL {
       const double* lbasis_eval,
       const double* dden_x_eval, const double* dden_y_eval, const double* dden_z_eval,
       double* Zs, size_t ldzs, double* Zz, size_t ldzz ) = 0;
+  virtual void eval_zmat_mgga_vxc_gks( size_t npts, size_t nbe, const double* vrho,
+      const double* vgamma, const double* vlapl, const double* basis_eval,
+      const double* dbasis_x_eval, const double* dbasis_y_eval, const double* dbasis_z_eval,
+      const double* lbasis_eval,
+      const double* dden_x_eval, const double* dden_y_eval, const double* dden_z_eval,
+      double* Zs, size_t ldzs, double* Zz, size_t ldzz, double* Zx, size_t ldzx,
+      double* Zy, size_t ldzy, double* K, double* H ) = 0;
   virtual void eval_mmat_mgga_vxc_rks( size_t npts, size_t nbe, const double* vtau,
       const double* vlapl, const double* dbasis_x_eval, const double* dbasis_y_eval,
       const double* dbasis_z_eval, double* mmat_x, double* mmat_y, double* mmat_z,
@@ -165,11 +193,54 @@ struct LocalHostWorkDriverPIMPL {
       const double* vlapl, const double* dbasis_x_eval, const double* dbasis_y_eval,
       const double* dbasis_z_eval, double* mmat_xs, double* mmat_ys, double* mmat_zs,
       size_t ldms, double* mmat_xz, double* mmat_yz, double* mmat_zz, size_t ldmz ) = 0;
+  virtual void eval_mmat_mgga_vxc_gks( size_t npts, size_t nbe, const double* vtau,
+      const double* vlapl, const double* dbasis_x_eval, const double* dbasis_y_eval,
+      const double* dbasis_z_eval, double* mmat_xs, double* mmat_ys, double* mmat_zs,
+      size_t ldms, double* mmat_xz, double* mmat_yz, double* mmat_zz, size_t ldmz,
+      double* mmat_xx, double* mmat_yx, double* mmat_zx, size_t ldmx,
+      double* mmat_xy, double* mmat_yy, double* mmat_zy, size_t ldmy, double* K ) = 0;
 
   virtual void inc_vxc( size_t npts, size_t nbf, size_t nbe, 
     const double* basis_eval, const submat_map_t& submat_map, const double* Z, 
     size_t ldz, double* VXC, size_t ldvxc, double* scr ) = 0;
 
+  // Mixed precision (float32 collocation / X / Z) variants
+  virtual void eval_xmat( size_t npts, size_t nbf, size_t nbe, 
+    const submat_map_t& submat_map, double fac, const double* P, size_t ldp,
+    const float* basis_eval, size_t ldb, float* X, size_t ldx, float* scr ) = 0;
+  virtual void eval_uvvar_lda_rks( size_t npts, size_t nbe, const float* basis_eval,
+    const float* X, size_t ldx, double* den_eval ) = 0;
+  virtual void eval_uvvar_lda_uks( size_t npts, size_t nbe, const float* basis_eval,
+    const float* Xs, size_t ldxs, const float* Xz, size_t ldxz, 
+    double* den_eval ) = 0;
+  virtual void eval_uvvar_gga_rks( size_t npts, size_t nbe, const float* basis_eval,
+    const float* dbasis_x_eval, const float *dbasis_y_eval, 
+    const float* dbasis_z_eval, const float* X, size_t ldx, double* den_eval, 
+    double* dden_x_eval, double* dden_y_eval, double* dden_z_eval, 
+    double* gamma ) = 0;
+  virtual void eval_uvvar_gga_uks( size_t npts, size_t nbe, const float* basis_eval,
+    const float* dbasis_x_eval, const float *dbasis_y_eval,
+    const float* dbasis_z_eval, const float* Xs, size_t ldxs, 
+    const float* Xz, size_t ldxz, double* den_eval, double* dden_x_eval, 
+    double* dden_y_eval, double* dden_z_eval, double* gamma ) = 0;
+  virtual void eval_zmat_lda_vxc_rks( size_t npts, size_t nbe, const double* vrho, 
+    const float* basis_eval, float* Z, size_t ldz ) = 0;
+  virtual void eval_zmat_lda_vxc_uks( size_t npts, size_t nbe, const double* vrho, 
+    const float* basis_eval, float* Zs, size_t ldzs, float* Zz, size_t ldzz ) = 0;
+  virtual void eval_zmat_gga_vxc_rks( size_t npts, size_t nbe, const double* vrho,
+    const double* vgamma, const float* basis_eval, const float* dbasis_x_eval,
+    const float* dbasis_y_eval, const float* dbasis_z_eval, 
+    const double* dden_x_eval, const double* dden_y_eval, 
+    const double* dden_z_eval, float* Z, size_t ldz ) = 0;
+  virtual void eval_zmat_gga_vxc_uks( size_t npts, size_t nbe, const double* vrho,
+    const double* vgamma, const float* basis_eval, const float* dbasis_x_eval,
+    const float* dbasis_y_eval, const float* dbasis_z_eval, 
+    const double* dden_x_eval, const double* dden_y_eval, 
+    const double* dden_z_eval, float* Zs, size_t ldzs, float* Zz, size_t ldzz ) = 0;
+  virtual void inc_vxc( size_t npts, size_t nbf, size_t nbe, const float* basis_eval,
+    const submat_map_t& submat_map, const float* Z, size_t ldz, 
+    double* VXC, size_t ldvxc, float* scr ) = 0;
+
 };
 
 
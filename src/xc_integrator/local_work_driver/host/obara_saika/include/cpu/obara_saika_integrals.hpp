@@ -25,5 +25,9 @@ void compute_integral_shell_pair(int is_diag,
                   double *Gj,
                   int ldG, 
                   double *weights, 
-                  double *boys_table);
+                  double *boys_table,
+                  int nmat = 1,
+                  size_t strideX = 0,
+                  size_t strideG = 0,
+                  double omega = 0.);
 }
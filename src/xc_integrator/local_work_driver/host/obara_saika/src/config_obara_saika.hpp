@@ -22,6 +22,14 @@ namespace XCPU {
 
   constexpr double shpair_screen_tol = 1e-12;
 
+  /// Attenuation factor t^2 = omega^2 / (omega^2 + rho) of the erf(omega r) / r
+  /// operator for a primitive pair of exponent rho (omega <= 0 -> 1 / r)
+  inline double attenuation_factor( double omega, double rho ) {
+    if( omega <= 0. ) return 1.0;
+    const double omega2 = omega * omega;
+    return omega2 / (omega2 + rho);
+  }
+
   template <int M>
   inline void boys_element(double *T, double *T_inv_e, double *eval, double *boys_table) {
     if((*T) < DEFAULT_MAX_T) {
@@ -116,6 +124,29 @@ namespace XCPU {
   }
 
 
+  /// Boys function of the erf(omega r) / r operator, t^(2M+1) F_M(t^2 T). The
+  /// boundary term of the downward recursion is t^(2m+1) exp(-t^2 T) / 2, it is
+  /// returned for m = M-1 and rescaled by 1/t^2 for each lower m by the kernels
+  template <int M>
+  inline void boys_elements(size_t npts, double* T, double *T_inv_e, double* eval, double *boys_table, double t2) {
+    if( t2 == 1.0 ) {
+      boys_elements<M>(npts, T, T_inv_e, eval, boys_table);
+      return;
+    }
+
+    const double t = std::sqrt(t2);
+    double t_m = t / t2; // t^(2M-1)
+    for(int j = 0; j < M; ++j) t_m *= t2;
+    const double t_p = t_m * t2; // t^(2M+1)
+
+    for(size_t i = 0; i < npts; ++i) {
+      double T_att = t2 * T[i];
+      boys_element<M>(&T_att, T_inv_e + i, eval + i, boys_table);
+      T_inv_e[i] *= t_m;
+      eval[i]    *= t_p;
+    }
+  }
+
   inline double boys_element_0( double T ) {
     if( T > 26.0 ) {
       return 0.88622692545275801364 * GauXC::rsqrt(T);
@@ -173,6 +204,15 @@ namespace XCPU {
   inline void boys_elements_0( int npts, const double* T, double* FmT ) {
     for(int i = 0; i < npts; ++i) FmT[i] = boys_element_0(T[i]);
   }
+  inline void boys_elements_0( int npts, const double* T, double* FmT, double t2 ) {
+    if( t2 == 1.0 ) {
+      boys_elements_0(npts, T, FmT);
+      return;
+    }
+
+    const double t = std::sqrt(t2);
+    for(int i = 0; i < npts; ++i) FmT[i] = t * boys_element_0(t2 * T[i]);
+  }
 
 }
 
@@ -25,7 +25,11 @@ void integral_0(size_t npts,
                double *Gi,
                int ldG, 
                double *weights,
-               double *boys_table) {
+               double *boys_table,
+                  int nmat,
+                  size_t strideX,
+                  size_t strideG,
+                  double omega) {
    __attribute__((__aligned__(64))) double buffer[1 * NPTS_LOCAL + 3 * NPTS_LOCAL];
 
    double *temp       = (buffer + 0);
@@ -46,6 +50,7 @@ void integral_0(size_t npts,
 
       for(int ij = 0; ij < nprim_pairs; ++ij) {
          double RHO = prim_pairs[ij].gamma;
+         double T2 = attenuation_factor(omega, RHO);
 
          double eval = prim_pairs[ij].K_coeff_prod;
 
@@ -67,7 +72,7 @@ void integral_0(size_t npts,
          }
 
          // Evaluate Boys function
-         boys_elements<0>(NPTS_LOCAL, Tval, Tval_inv_e, FmT, boys_table);
+         boys_elements<0>(NPTS_LOCAL, Tval, Tval_inv_e, FmT, boys_table, T2);
 
          // Evaluate VRR Buffer
          for(size_t p_inner = 0; p_inner < NPTS_LOCAL; p_inner += SIMD_LENGTH) {
@@ -82,9 +87,10 @@ void integral_0(size_t npts,
          }
       }
 
-      for(size_t p_inner = 0; p_inner < NPTS_LOCAL; p_inner += SIMD_LENGTH) {
-         double *Xik = (Xi + p_outer + p_inner);
-         double *Gik = (Gi + p_outer + p_inner);
+      for(size_t ip = 0; ip < size_t(nmat) * NPTS_LOCAL; ip += SIMD_LENGTH) {
+         const size_t imat = ip / NPTS_LOCAL, p_inner = ip % NPTS_LOCAL;
+         double *Xik = (Xi + imat * strideX + p_outer + p_inner);
+         double *Gik = (Gi + imat * strideG + p_outer + p_inner);
 
          SIMD_TYPE tx, wg, xik, gik;
          tx  = SIMD_ALIGNED_LOAD((temp + 0 * NPTS_LOCAL + p_inner));
@@ -112,6 +118,7 @@ void integral_0(size_t npts,
 
       for(int ij = 0; ij < nprim_pairs; ++ij) {
          double RHO = prim_pairs[ij].gamma;
+         double T2 = attenuation_factor(omega, RHO);
 
          double eval = prim_pairs[ij].K_coeff_prod;
 
@@ -151,7 +158,7 @@ void integral_0(size_t npts,
          }
 
          // Evaluate Boys function
-         boys_elements<0>(npts_inner, Tval, Tval_inv_e, FmT, boys_table);
+         boys_elements<0>(npts_inner, Tval, Tval_inv_e, FmT, boys_table, T2);
 
          // Evaluate VRR Buffer
          p_inner = 0;
@@ -179,10 +186,10 @@ void integral_0(size_t npts,
       }
 
       size_t npts_inner_upper = SIMD_LENGTH * (npts_inner / SIMD_LENGTH);
-      size_t p_inner = 0;
-      for(p_inner = 0; p_inner < npts_inner_upper; p_inner += SIMD_LENGTH) {
-         double *Xik = (Xi + p_outer + p_inner);
-         double *Gik = (Gi + p_outer + p_inner);
+      for(size_t ip = 0; ip < nmat * npts_inner_upper; ip += SIMD_LENGTH) {
+         const size_t imat = ip / npts_inner_upper, p_inner = ip % npts_inner_upper;
+         double *Xik = (Xi + imat * strideX + p_outer + p_inner);
+         double *Gik = (Gi + imat * strideG + p_outer + p_inner);
 
          SIMD_TYPE tx, wg, xik, gik;
          tx  = SIMD_ALIGNED_LOAD((temp + 0 * NPTS_LOCAL + p_inner));
@@ -196,9 +203,11 @@ void integral_0(size_t npts,
          SIMD_UNALIGNED_STORE((Gik + 0 * ldG), gik);
       }
 
-      for(; p_inner < npts_inner; p_inner += SCALAR_LENGTH) {
-         double *Xik = (Xi + p_outer + p_inner);
-         double *Gik = (Gi + p_outer + p_inner);
+      const size_t npts_inner_rem = npts_inner - npts_inner_upper;
+      for(size_t ip = 0; ip < nmat * npts_inner_rem; ip += SCALAR_LENGTH) {
+         const size_t imat = ip / npts_inner_rem, p_inner = npts_inner_upper + ip % npts_inner_rem;
+         double *Xik = (Xi + imat * strideX + p_outer + p_inner);
+         double *Gik = (Gi + imat * strideG + p_outer + p_inner);
 
          SCALAR_TYPE tx, wg, xik, gik;
          tx  = SCALAR_LOAD((temp + 0 * NPTS_LOCAL + p_inner));
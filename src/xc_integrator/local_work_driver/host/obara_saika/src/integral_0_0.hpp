@@ -23,7 +23,11 @@ void integral_0_0(size_t npts,
                   double *Gj,
                   int ldG, 
                   double *weights, 
-                  double *boys_table);
+                  double *boys_table,
+                  int nmat,
+                  size_t strideX,
+                  size_t strideG,
+                  double omega);
 }
 
 #endif
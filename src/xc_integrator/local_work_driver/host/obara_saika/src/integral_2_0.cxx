@@ -27,7 +27,11 @@ void integral_2_0(size_t npts,
                   double *Gj,
                   int ldG, 
                   double *weights,
-                  double *boys_table) {
+                  double *boys_table,
+                  int nmat,
+                  size_t strideX,
+                  size_t strideG,
+                  double omega) {
    __attribute__((__aligned__(64))) double buffer[6 * NPTS_LOCAL + 3 * NPTS_LOCAL];
 
    double *temp       = (buffer + 0);
@@ -44,6 +48,8 @@ void integral_2_0(size_t npts,
 
       for(int ij = 0; ij < nprim_pairs; ++ij) {
          double RHO = prim_pairs[ij].gamma;
+         double T2 = attenuation_factor(omega, RHO);
+         double T2_INV = 1.0 / T2;
          double RHO_INV = prim_pairs[ij].gamma_inv;
          double X_PA = prim_pairs[ij].PA.x;
          double Y_PA = prim_pairs[ij].PA.y;
@@ -74,7 +80,7 @@ void integral_2_0(size_t npts,
          }
 
          // Evaluate Boys function
-         boys_elements<2>(NPTS_LOCAL, Tval, Tval_inv_e, FmT, boys_table);
+         boys_elements<2>(NPTS_LOCAL, Tval, Tval_inv_e, FmT, boys_table, T2);
 
          // Evaluate VRR Buffer
          for(size_t p_inner = 0; p_inner < NPTS_LOCAL; p_inner += SIMD_LENGTH) {
@@ -93,6 +99,7 @@ void integral_2_0(size_t npts,
 
             t02 = SIMD_ALIGNED_LOAD((FmT + p_inner));
             t01 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t02), tval_inv_e), SIMD_SET1(0.66666666666666662966));
+            tval_inv_e = SIMD_MUL(tval_inv_e, SIMD_DUPLICATE(&(T2_INV)));
             t00 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t01), tval_inv_e), SIMD_SET1(2.00000000000000000000));
 
             t00 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t00);
@@ -155,11 +162,12 @@ void integral_2_0(size_t npts,
          }
       }
 
-      for(size_t p_inner = 0; p_inner < NPTS_LOCAL; p_inner += SIMD_LENGTH) {
-         double *Xik = (Xi + p_outer + p_inner);
-         double *Xjk = (Xj + p_outer + p_inner);
-         double *Gik = (Gi + p_outer + p_inner);
-         double *Gjk = (Gj + p_outer + p_inner);
+      for(size_t ip = 0; ip < size_t(nmat) * NPTS_LOCAL; ip += SIMD_LENGTH) {
+         const size_t imat = ip / NPTS_LOCAL, p_inner = ip % NPTS_LOCAL;
+         double *Xik = (Xi + imat * strideX + p_outer + p_inner);
+         double *Xjk = (Xj + imat * strideX + p_outer + p_inner);
+         double *Gik = (Gi + imat * strideG + p_outer + p_inner);
+         double *Gjk = (Gj + imat * strideG + p_outer + p_inner);
 
          SIMD_TYPE const_value_v = SIMD_UNALIGNED_LOAD((weights + p_outer + p_inner));
 
@@ -243,6 +251,8 @@ void integral_2_0(size_t npts,
 
       for(int ij = 0; ij < nprim_pairs; ++ij) {
          double RHO = prim_pairs[ij].gamma;
+         double T2 = attenuation_factor(omega, RHO);
+         double T2_INV = 1.0 / T2;
          double RHO_INV = prim_pairs[ij].gamma_inv;
          double X_PA = prim_pairs[ij].PA.x;
          double Y_PA = prim_pairs[ij].PA.y;
@@ -291,7 +301,7 @@ void integral_2_0(size_t npts,
          }
 
          // Evaluate Boys function
-         boys_elements<2>(npts_inner, Tval, Tval_inv_e, FmT, boys_table);
+         boys_elements<2>(npts_inner, Tval, Tval_inv_e, FmT, boys_table, T2);
 
          // Evaluate VRR Buffer
          p_inner = 0;
@@ -311,6 +321,7 @@ void integral_2_0(size_t npts,
 
             t02 = SIMD_ALIGNED_LOAD((FmT + p_inner));
             t01 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t02), tval_inv_e), SIMD_SET1(0.66666666666666662966));
+            tval_inv_e = SIMD_MUL(tval_inv_e, SIMD_DUPLICATE(&(T2_INV)));
             t00 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t01), tval_inv_e), SIMD_SET1(2.00000000000000000000));
 
             t00 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t00);
@@ -388,6 +399,7 @@ void integral_2_0(size_t npts,
 
             t02 = SCALAR_LOAD((FmT + p_inner));
             t01 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t02), tval_inv_e), SCALAR_SET1(0.66666666666666662966));
+            tval_inv_e = SCALAR_MUL(tval_inv_e, SCALAR_DUPLICATE(&(T2_INV)));
             t00 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t01), tval_inv_e), SCALAR_SET1(2.00000000000000000000));
 
             t00 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t00);
@@ -451,12 +463,12 @@ void integral_2_0(size_t npts,
       }
 
       size_t npts_inner_upper = SIMD_LENGTH * (npts_inner / SIMD_LENGTH);
-      size_t p_inner = 0;
-      for(p_inner = 0; p_inner < npts_inner_upper; p_inner += SIMD_LENGTH) {
-         double *Xik = (Xi + p_outer + p_inner);
-         double *Xjk = (Xj + p_outer + p_inner);
-         double *Gik = (Gi + p_outer + p_inner);
-         double *Gjk = (Gj + p_outer + p_inner);
+      for(size_t ip = 0; ip < nmat * npts_inner_upper; ip += SIMD_LENGTH) {
+         const size_t imat = ip / npts_inner_upper, p_inner = ip % npts_inner_upper;
+         double *Xik = (Xi + imat * strideX + p_outer + p_inner);
+         double *Xjk = (Xj + imat * strideX + p_outer + p_inner);
+         double *Gik = (Gi + imat * strideG + p_outer + p_inner);
+         double *Gjk = (Gj + imat * strideG + p_outer + p_inner);
 
          SIMD_TYPE const_value_v = SIMD_UNALIGNED_LOAD((weights + p_outer + p_inner));
 
@@ -531,11 +543,13 @@ void integral_2_0(size_t npts,
          SIMD_UNALIGNED_STORE((Gjk + 0 * ldG), tw);
       }
 
-      for(; p_inner < npts_inner; p_inner += SCALAR_LENGTH) {
-         double *Xik = (Xi + p_outer + p_inner);
-         double *Xjk = (Xj + p_outer + p_inner);
-         double *Gik = (Gi + p_outer + p_inner);
-         double *Gjk = (Gj + p_outer + p_inner);
+      const size_t npts_inner_rem = npts_inner - npts_inner_upper;
+      for(size_t ip = 0; ip < nmat * npts_inner_rem; ip += SCALAR_LENGTH) {
+         const size_t imat = ip / npts_inner_rem, p_inner = npts_inner_upper + ip % npts_inner_rem;
+         double *Xik = (Xi + imat * strideX + p_outer + p_inner);
+         double *Xjk = (Xj + imat * strideX + p_outer + p_inner);
+         double *Gik = (Gi + imat * strideG + p_outer + p_inner);
+         double *Gjk = (Gj + imat * strideG + p_outer + p_inner);
 
          SCALAR_TYPE const_value_v = SCALAR_LOAD((weights + p_outer + p_inner));
 
@@ -21,7 +21,11 @@ void integral_3(size_t npts,
                double *Gi,
                int ldG, 
                double *weights, 
-               double *boys_table);
+               double *boys_table,
+                  int nmat,
+                  size_t strideX,
+                  size_t strideG,
+                  double omega);
 }
 
 #endif
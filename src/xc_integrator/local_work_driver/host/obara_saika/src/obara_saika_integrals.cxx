@@ -89,7 +89,11 @@ void compute_integral_shell_pair(int is_diag,
                   double *Gj,
                   int ldG, 
                   double *weights, 
-                  double *boys_table) {
+                  double *boys_table,
+                  int nmat,
+                  size_t strideX,
+                  size_t strideG,
+                  double omega) {
    if (is_diag) {
       if(lA == 0) {
          integral_0(npts,
@@ -103,7 +107,11 @@ void compute_integral_shell_pair(int is_diag,
                     Gi,
                     ldG, 
                     weights, 
-                    boys_table);
+                    boys_table,
+                    nmat,
+                    strideX,
+                    strideG,
+                    omega);
       } else if(lA == 1) {
         integral_1(npts,
                     points,
@@ -116,7 +124,11 @@ void compute_integral_shell_pair(int is_diag,
                    Gi,
                    ldG, 
                    weights, 
-                   boys_table);
+                   boys_table,
+                   nmat,
+                   strideX,
+                   strideG,
+                   omega);
       } else if(lA == 2) {
         integral_2(npts,
                     points,
@@ -129,7 +141,11 @@ void compute_integral_shell_pair(int is_diag,
                    Gi,
                    ldG, 
                    weights, 
-                   boys_table);
+                   boys_table,
+                   nmat,
+                   strideX,
+                   strideG,
+                   omega);
       } else if(lA == 3) {
         integral_3(npts,
                     points,
@@ -142,7 +158,11 @@ void compute_integral_shell_pair(int is_diag,
                    Gi,
                    ldG, 
                    weights, 
-                   boys_table);
+                   boys_table,
+                   nmat,
+                   strideX,
+                   strideG,
+                   omega);
       } else if(lA == 4) {
         integral_4(npts,
                     points,
@@ -155,7 +175,11 @@ void compute_integral_shell_pair(int is_diag,
                    Gi,
                    ldG, 
                    weights, 
-                   boys_table);
+                   boys_table,
+                   nmat,
+                   strideX,
+                   strideG,
+                   omega);
       } else {
          printf("Type not defined!\n");
       }
@@ -174,7 +198,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gj,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      nmat,
+                      strideX,
+                      strideG,
+                      omega);
       } else if((lA == 1) && (lB == 0)) {
             integral_1_0(npts,
                          points,
@@ -189,7 +217,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         nmat,
+                         strideX,
+                         strideG,
+                         omega);
       } else if((lA == 0) && (lB == 1)) {
          integral_1_0(npts,
                       points,
@@ -204,7 +236,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      nmat,
+                      strideX,
+                      strideG,
+                      omega);
       } else if((lA == 1) && (lB == 1)) {
         integral_1_1(npts,
                      points,
@@ -219,7 +255,11 @@ void compute_integral_shell_pair(int is_diag,
                      Gj,
                      ldG, 
                      weights, 
-                     boys_table);
+                     boys_table,
+                     nmat,
+                     strideX,
+                     strideG,
+                     omega);
       } else if((lA == 2) && (lB == 0)) {
             integral_2_0(npts,
                          points,
@@ -234,7 +274,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         nmat,
+                         strideX,
+                         strideG,
+                         omega);
       } else if((lA == 0) && (lB == 2)) {
          integral_2_0(npts,
                       points,
@@ -249,7 +293,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      nmat,
+                      strideX,
+                      strideG,
+                      omega);
       } else if((lA == 2) && (lB == 1)) {
             integral_2_1(npts,
                          points,
@@ -264,7 +312,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         nmat,
+                         strideX,
+                         strideG,
+                         omega);
       } else if((lA == 1) && (lB == 2)) {
          integral_2_1(npts,
                       points,
@@ -279,7 +331,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      nmat,
+                      strideX,
+                      strideG,
+                      omega);
       } else if((lA == 2) && (lB == 2)) {
         integral_2_2(npts,
                      points,
@@ -294,7 +350,11 @@ void compute_integral_shell_pair(int is_diag,
                      Gj,
                      ldG, 
                      weights, 
-                     boys_table);
+                     boys_table,
+                     nmat,
+                     strideX,
+                     strideG,
+                     omega);
       } else if((lA == 3) && (lB == 0)) {
             integral_3_0(npts,
                          points,
@@ -309,7 +369,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         nmat,
+                         strideX,
+                         strideG,
+                         omega);
       } else if((lA == 0) && (lB == 3)) {
          integral_3_0(npts,
                       points,
@@ -324,7 +388,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      nmat,
+                      strideX,
+                      strideG,
+                      omega);
       } else if((lA == 3) && (lB == 1)) {
             integral_3_1(npts,
                          points,
@@ -339,7 +407,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         nmat,
+                         strideX,
+                         strideG,
+                         omega);
       } else if((lA == 1) && (lB == 3)) {
          integral_3_1(npts,
                       points,
@@ -354,7 +426,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      nmat,
+                      strideX,
+                      strideG,
+                      omega);
       } else if((lA == 3) && (lB == 2)) {
             integral_3_2(npts,
                          points,
@@ -369,7 +445,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         nmat,
+                         strideX,
+                         strideG,
+                         omega);
       } else if((lA == 2) && (lB == 3)) {
          integral_3_2(npts,
                       points,
@@ -384,7 +464,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      nmat,
+                      strideX,
+                      strideG,
+                      omega);
       } else if((lA == 3) && (lB == 3)) {
         integral_3_3(npts,
                      points,
@@ -399,7 +483,11 @@ void compute_integral_shell_pair(int is_diag,
                      Gj,
                      ldG, 
                      weights, 
-                     boys_table);
+                     boys_table,
+                     nmat,
+                     strideX,
+                     strideG,
+                     omega);
       } else if((lA == 4) && (lB == 0)) {
             integral_4_0(npts,
                          points,
@@ -414,7 +502,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         nmat,
+                         strideX,
+                         strideG,
+                         omega);
       } else if((lA == 0) && (lB == 4)) {
          integral_4_0(npts,
                       points,
@@ -429,7 +521,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      nmat,
+                      strideX,
+                      strideG,
+                      omega);
       } else if((lA == 4) && (lB == 1)) {
             integral_4_1(npts,
                          points,
@@ -444,7 +540,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         nmat,
+                         strideX,
+                         strideG,
+                         omega);
       } else if((lA == 1) && (lB == 4)) {
          integral_4_1(npts,
                       points,
@@ -459,7 +559,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      nmat,
+                      strideX,
+                      strideG,
+                      omega);
       } else if((lA == 4) && (lB == 2)) {
             integral_4_2(npts,
                          points,
@@ -474,7 +578,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         nmat,
+                         strideX,
+                         strideG,
+                         omega);
       } else if((lA == 2) && (lB == 4)) {
          integral_4_2(npts,
                       points,
@@ -489,7 +597,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      nmat,
+                      strideX,
+                      strideG,
+                      omega);
       } else if((lA == 4) && (lB == 3)) {
             integral_4_3(npts,
                          points,
@@ -504,7 +616,11 @@ void compute_integral_shell_pair(int is_diag,
                          Gj,
                          ldG, 
                          weights, 
-                         boys_table);
+                         boys_table,
+                         nmat,
+                         strideX,
+                         strideG,
+                         omega);
       } else if((lA == 3) && (lB == 4)) {
          integral_4_3(npts,
                       points,
@@ -519,7 +635,11 @@ void compute_integral_shell_pair(int is_diag,
                       Gi,
                       ldG, 
                       weights, 
-                      boys_table);
+                      boys_table,
+                      nmat,
+                      strideX,
+                      strideG,
+                      omega);
       } else if((lA == 4) && (lB == 4)) {
         integral_4_4(npts,
                      points,
@@ -534,7 +654,11 @@ void compute_integral_shell_pair(int is_diag,
                      Gj,
                      ldG, 
                      weights, 
-                     boys_table);
+                     boys_table,
+                     nmat,
+                     strideX,
+                     strideG,
+                     omega);
       } else {
          printf("Type not defined!\n");
       }
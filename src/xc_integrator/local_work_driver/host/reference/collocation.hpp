@@ -8,16 +8,58 @@
 #pragma once
 
 #include <gauxc/basisset.hpp>
+#include <algorithm>
+#include <cmath>
 
 namespace GauXC {
 
+/**
+ *  @brief Screening parameters for host collocation
+ *
+ *  Points are processed in blocks of `block_size`. Primitives (and shells)
+ *  which are estimated to be smaller than `tol` on every point in a block
+ *  are skipped for that block. `tol <= 0` disables screening.
+ */
+struct CollocationScreening {
+  double tol        = 0.;
+  size_t block_size = 64;
+};
+
+/**
+ *  Estimate whether a primitive c * r**l * exp(-a*r**2) (and its first
+ *  `deriv` derivatives) is below `tol` everywhere beyond a distance `r`
+ *  from its center. Points inside of the radial maximum are never
+ *  considered negligible.
+ */
+inline bool primitive_negligible( double c, double a, int l, int deriv,
+  double r, double tol ) {
+
+  if( 2. * a * r * r < double(l + deriv) ) return false;
+  const double dfac = 1. + 2. * a * r + (l ? l / r : 0.);
+  return std::abs(c) * std::pow(r, l) * std::pow(dfac, deriv) * 
+    std::exp(-a * r * r) < tol;
+
+}
+
+/// Distance from a point to an axis-aligned bounding box
+inline double box_distance( const double* lo, const double* hi, 
+  const double* O ) {
+  double d2 = 0.;
+  for( int k = 0; k < 3; ++k ) {
+    const double d = std::max({ lo[k] - O[k], 0., O[k] - hi[k] });
+    d2 += d * d;
+  }
+  return std::sqrt(d2);
+}
+
 void gau2grid_collocation( size_t                  npts, 
                            size_t                  nshells,
                            size_t                  nbe,
                            const double*           points, 
                            const BasisSet<double>& basis,
                            const int32_t*          shell_mask,
-                           double*                 basis_eval );
+                           double*                 basis_eval,
+                           CollocationScreening    screen = CollocationScreening() );
 
 void gau2grid_collocation_gradient( size_t                  npts, 
                                     size_t                  nshells,
@@ -28,7 +70,8 @@ void gau2grid_collocation_gradient( size_t                  npts,
                                     double*                 basis_eval, 
                                     double*                 dbasis_x_eval, 
                                     double*                 dbasis_y_eval,
-                                    double*                 dbasis_z_eval );
+                                    double*                 dbasis_z_eval,
+                                    CollocationScreening    screen = CollocationScreening() );
 
 
 void gau2grid_collocation_hessian( size_t                  npts, 
@@ -46,7 +89,25 @@ void gau2grid_collocation_hessian( size_t                  npts,
                                    double*                 d2basis_xz_eval,
                                    double*                 d2basis_yy_eval,
                                    double*                 d2basis_yz_eval,
-                                   double*                 d2basis_zz_eval);
+                                   double*                 d2basis_zz_eval,
+                                   CollocationScreening    screen = CollocationScreening() );
+
+/**
+ *  Collocation, gradient and Laplacian. The second derivatives are only
+ *  formed per block of points and never written out.
+ */
+void gau2grid_collocation_laplacian( size_t                  npts, 
+                                     size_t                  nshells,
+                                     size_t                  nbe,
+                                     const double*           points, 
+                                     const BasisSet<double>& basis,
+                                     const int32_t*          shell_mask,
+                                     double*                 basis_eval, 
+                                     double*                 dbasis_x_eval, 
+                                     double*                 dbasis_y_eval,
+                                     double*                 dbasis_z_eval, 
+                                     double*                 lbasis_eval,
+                                     CollocationScreening    screen = CollocationScreening() );
 
 void gau2grid_collocation_der3(    size_t                  npts,
                                    size_t                  nshells,
@@ -73,6 +134,95 @@ void gau2grid_collocation_der3(    size_t                  npts,
 				   double*                 d3basis_yyy_eval,
 				   double*                 d3basis_yyz_eval,
 				   double*                 d3basis_yzz_eval,
-				   double*                 d3basis_zzz_eval);
+				   double*                 d3basis_zzz_eval,
+				   CollocationScreening    screen = CollocationScreening() );
+
+/**
+ *  Native host collocation (see LocalHostWorkSettings::collocation_backend)
+ *
+ *  Same interface and output layout as the gau2grid_collocation* variants.
+ *  The kernels are specialized per angular momentum (L <= 6) and Cartesian /
+ *  spherical type, vectorize over blocks of points and write directly into
+ *  the (nbe,npts) collocation matrices.
+ */
+void native_collocation( size_t                  npts,
+                         size_t                  nshells,
+                         size_t                  nbe,
+                         const double*           points,
+                         const BasisSet<double>& basis,
+                         const int32_t*          shell_mask,
+                         double*                 basis_eval,
+                         CollocationScreening    screen = CollocationScreening() );
+
+void native_collocation_gradient( size_t                  npts,
+                                  size_t                  nshells,
+                                  size_t                  nbe,
+                                  const double*           points,
+                                  const BasisSet<double>& basis,
+                                  const int32_t*          shell_mask,
+                                  double*                 basis_eval,
+                                  double*                 dbasis_x_eval,
+                                  double*                 dbasis_y_eval,
+                                  double*                 dbasis_z_eval,
+                                  CollocationScreening    screen = CollocationScreening() );
+
+void native_collocation_hessian( size_t                  npts,
+                                 size_t                  nshells,
+                                 size_t                  nbe,
+                                 const double*           points,
+                                 const BasisSet<double>& basis,
+                                 const int32_t*          shell_mask,
+                                 double*                 basis_eval,
+                                 double*                 dbasis_x_eval,
+                                 double*                 dbasis_y_eval,
+                                 double*                 dbasis_z_eval,
+                                 double*                 d2basis_xx_eval,
+                                 double*                 d2basis_xy_eval,
+                                 double*                 d2basis_xz_eval,
+                                 double*                 d2basis_yy_eval,
+                                 double*                 d2basis_yz_eval,
+                                 double*                 d2basis_zz_eval,
+                                 CollocationScreening    screen = CollocationScreening() );
+
+void native_collocation_laplacian( size_t                  npts,
+                                   size_t                  nshells,
+                                   size_t                  nbe,
+                                   const double*           points,
+                                   const BasisSet<double>& basis,
+                                   const int32_t*          shell_mask,
+                                   double*                 basis_eval,
+                                   double*                 dbasis_x_eval,
+                                   double*                 dbasis_y_eval,
+                                   double*                 dbasis_z_eval,
+                                   double*                 lbasis_eval,
+                                   CollocationScreening    screen = CollocationScreening() );
+
+void native_collocation_der3( size_t                  npts,
+                              size_t                  nshells,
+                              size_t                  nbe,
+                              const double*           points,
+                              const BasisSet<double>& basis,
+                              const int32_t*          shell_mask,
+                              double*                 basis_eval,
+                              double*                 dbasis_x_eval,
+                              double*                 dbasis_y_eval,
+                              double*                 dbasis_z_eval,
+                              double*                 d2basis_xx_eval,
+                              double*                 d2basis_xy_eval,
+                              double*                 d2basis_xz_eval,
+                              double*                 d2basis_yy_eval,
+                              double*                 d2basis_yz_eval,
+                              double*                 d2basis_zz_eval,
+                              double*                 d3basis_xxx_eval,
+                              double*                 d3basis_xxy_eval,
+                              double*                 d3basis_xxz_eval,
+                              double*                 d3basis_xyy_eval,
+                              double*                 d3basis_xyz_eval,
+                              double*                 d3basis_xzz_eval,
+                              double*                 d3basis_yyy_eval,
+                              double*                 d3basis_yyz_eval,
+                              double*                 d3basis_yzz_eval,
+                              double*                 d3basis_zzz_eval,
+                              CollocationScreening    screen = CollocationScreening() );
 
     }
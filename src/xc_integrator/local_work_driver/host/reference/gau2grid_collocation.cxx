@@ -6,6 +6,11 @@
  * See LICENSE.txt for details
  */
 #include "collocation.hpp"
+#include <gauxc/util/unused.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
 
 
 #ifdef GAUXC_HAS_GAU2GRID
@@ -18,45 +23,178 @@
 
 namespace GauXC {
 
+#ifdef GAUXC_HAS_GAU2GRID
+namespace {
+
+/// Number of collocation components through a given derivative order
+constexpr std::array<int,4> ncomp_deriv = {1, 4, 10, 20};
+
+template <int Deriv>
+void gg_shell_collocation( int l, size_t npts, const double* pts, int nprim, 
+  const double* coeff, const double* alpha, const double* O, int order, 
+  double* const* rv ) {
+
+  if constexpr (Deriv == 0)
+    gg_collocation( l, npts, pts, 1, nprim, coeff, alpha, O, order, rv[0] );
+  else if constexpr (Deriv == 1)
+    gg_collocation_deriv1( l, npts, pts, 1, nprim, coeff, alpha, O, order, 
+      rv[0], rv[1], rv[2], rv[3] );
+  else if constexpr (Deriv == 2)
+    gg_collocation_deriv2( l, npts, pts, 1, nprim, coeff, alpha, O, order, 
+      rv[0], rv[1], rv[2], rv[3], rv[4], rv[5], rv[6], rv[7], rv[8], rv[9] );
+  else
+    gg_collocation_deriv3( l, npts, pts, 1, nprim, coeff, alpha, O, order, 
+      rv[0], rv[1], rv[2], rv[3], rv[4], rv[5], rv[6], rv[7], rv[8], rv[9],
+      rv[10], rv[11], rv[12], rv[13], rv[14], rv[15], rv[16], rv[17], rv[18],
+      rv[19] );
+
+}
+
+/// Number of output arrays of a blocked collocation
+template <int Deriv, bool Laplacian>
+inline constexpr int ncomp_out = Laplacian ? 5 : ncomp_deriv[Deriv];
+
+/**
+ *  Blocked gau2grid collocation through derivative order `Deriv`.
+ *
+ *  Each block of points is evaluated into a component-major scratch buffer
+ *  (ncomp x nbe x nblock) and transposed into the point-major output. With
+ *  screening enabled, primitives which are negligible over the bounding box
+ *  of the block are dropped, and shells without surviving primitives are
+ *  zero filled for that block.
+ *
+ *  If `Laplacian` is set, the second derivatives are contracted to the
+ *  Laplacian within the (cache resident) block scratch, and only the value,
+ *  gradient and Laplacian are written out. The points are always blocked
+ *  in this case.
+ */
+template <int Deriv, bool Laplacian = false>
+void blocked_collocation( size_t npts, size_t nshells, size_t nbe,
+  const double* points, const BasisSet<double>& basis, 
+  const int32_t* shell_mask, 
+  const std::array<double*, ncomp_out<Deriv,Laplacian>>& basis_eval,
+  CollocationScreening screen ) {
+
+  static_assert( not Laplacian or Deriv == 2 );
+  constexpr int ncomp = ncomp_deriv[Deriv];
+  if( not npts ) return;
+
+  const bool   do_screen  = screen.tol > 0.;
+  const bool   do_block   = do_screen or Laplacian;
+  const size_t block_size = do_block ? 
+    std::min( std::max<size_t>(screen.block_size, 1), npts ) : npts;
+
+  std::allocator<double> a;
+  const size_t rv_sz = ncomp * nbe * block_size;
+  auto* rv = a.allocate( rv_sz );
+
+  std::vector<double> blk_pts( do_block ? 3 * block_size : 0 );
+  std::vector<double> coeff_scr, alpha_scr;
+
+  for( size_t p0 = 0; p0 < npts; p0 += block_size ) {
+
+    const size_t nb  = std::min( block_size, npts - p0 );
+    const double* pts = points;
+
+    // Gather block points (SoA) and their bounding box
+    double lo[3], hi[3];
+    if( do_block ) {
+      for( int k = 0; k < 3; ++k ) {
+        const auto* x = points + k*npts + p0;
+        std::copy( x, x + nb, blk_pts.data() + k*nb );
+        const auto [mn, mx] = std::minmax_element( x, x + nb );
+        lo[k] = *mn; hi[k] = *mx;
+      }
+      pts = blk_pts.data();
+    }
+
+    size_t ioff = 0;
+    for( size_t i = 0; i < nshells; ++i ) {
+
+      const auto& sh = basis.at(shell_mask[i]);
+      const auto shsz = sh.size();
+      int order = sh.pure() ? GG_SPHERICAL_CCA : GG_CARTESIAN_CCA; 
+
+      int nprim = sh.nprim();
+      const double* coeff = sh.coeff_data();
+      const double* alpha = sh.alpha_data();
+
+      if( do_screen ) {
+        const double r = box_distance( lo, hi, sh.O_data() );
+        coeff_scr.clear(); alpha_scr.clear();
+        for( int j = 0; j < nprim; ++j )
+        if( not primitive_negligible( coeff[j], alpha[j], sh.l(), Deriv, r,
+          screen.tol ) ) {
+          coeff_scr.push_back( coeff[j] );
+          alpha_scr.push_back( alpha[j] );
+        }
+        nprim = coeff_scr.size();
+        coeff = coeff_scr.data();
+        alpha = alpha_scr.data();
+      }
+
+      std::array<double*, ncomp> rv_sh;
+      for( int k = 0; k < ncomp; ++k ) rv_sh[k] = rv + (k*nbe + ioff) * nb;
+
+      if( nprim )
+        gg_shell_collocation<Deriv>( sh.l(), nb, pts, nprim, coeff, alpha, 
+          sh.O_data(), order, rv_sh.data() );
+      else
+        for( int k = 0; k < ncomp; ++k ) std::fill_n( rv_sh[k], shsz*nb, 0. );
+
+      ioff += shsz;
+
+    }
+
+    if constexpr (Laplacian) {
+      // xx <- xx + yy + zz
+      auto* lapl = rv + 4*nbe*nb;
+      const auto* yy = rv + 7*nbe*nb;
+      const auto* zz = rv + 9*nbe*nb;
+      for( size_t j = 0; j < ioff*nb; ++j ) { lapl[j] += yy[j]; lapl[j] += zz[j]; }
+      for( int k = 0; k < 5; ++k )
+        gg_fast_transpose( ioff, nb, rv + k*nbe*nb, basis_eval[k] + p0*nbe );
+    } else {
+      for( int k = 0; k < ncomp; ++k )
+        gg_fast_transpose( ioff, nb, rv + k*nbe*nb, basis_eval[k] + p0*nbe );
+    }
+
+  }
+
+  a.deallocate( rv, rv_sz );
+
+}
+
+}
+#endif
+
 void gau2grid_collocation( size_t                  npts, 
                            size_t                  nshells,
                            size_t                  nbe,
                            const double*           points, 
                            const BasisSet<double>& basis,
                            const int32_t*          shell_mask,
-                           double*                 basis_eval ) {
+                           double*                 basis_eval,
+                           CollocationScreening    screen ) {
 
 #ifdef GAUXC_HAS_GAU2GRID
 
-  std::allocator<double> a;
-  auto* rv = a.allocate( npts * nbe );
-
-  size_t ncomp = 0;
-  for( size_t i = 0; i < nshells; ++i ) {
-
-    const auto& sh = basis.at(shell_mask[i]);
-    int order = sh.pure() ? GG_SPHERICAL_CCA : GG_CARTESIAN_CCA; 
-    gg_collocation( sh.l(), npts, points, 3, sh.nprim(), sh.coeff_data(),
-      sh.alpha_data(), sh.O_data(), order, rv + ncomp*npts );
-
-    ncomp += sh.size();
-
-  }
-
-  gg_fast_transpose( ncomp, npts, rv, basis_eval );
-  a.deallocate( rv, npts*nbe );
+  blocked_collocation<0>( npts, nshells, nbe, points, basis, shell_mask,
+    { basis_eval }, screen );
 
 #else
-  
+
+  util::unused(screen);
   for( size_t ipt = 0; ipt < npts;  ++ipt )
   for( size_t i = 0;   i < nshells; ++i   ) {
     
     const auto ish = shell_mask[i];
     const auto& sh = basis.at(ish);
     auto* eval = basis_eval + ipt*nbe + basis.shell_to_first_ao( ish );
+    const double pt[3] = { points[ipt], points[ipt + npts], points[ipt + 2*npts] };
 
     double x,y,z, bf;
-    integrator::cuda::collocation_device_radial_eval( sh, points + 3*ipt, 
+    integrator::cuda::collocation_device_radial_eval( sh, pt, 
                                                       &x, &y, &z, &bf );
 
     if( sh.pure() )
@@ -81,38 +219,17 @@ void gau2grid_collocation_gradient( size_t                  npts,
                                     double*                 basis_eval, 
                                     double*                 dbasis_x_eval, 
                                     double*                 dbasis_y_eval,
-                                    double*                 dbasis_z_eval ) {
+                                    double*                 dbasis_z_eval,
+                                    CollocationScreening    screen ) {
 
 #ifdef GAUXC_HAS_GAU2GRID
 
-  std::allocator<double> a;
-  auto* rv = a.allocate( 4 * npts * nbe );
-  auto* rv_x = rv   + npts * nbe;
-  auto* rv_y = rv_x + npts * nbe;
-  auto* rv_z = rv_y + npts * nbe;
-
-  size_t ncomp = 0;
-  for( size_t i = 0; i < nshells; ++i ) {
-
-    const auto& sh = basis.at(shell_mask[i]);
-    int order = sh.pure() ? GG_SPHERICAL_CCA : GG_CARTESIAN_CCA; 
-    gg_collocation_deriv1( sh.l(), npts, points, 3, sh.nprim(), sh.coeff_data(),
-      sh.alpha_data(), sh.O_data(), order, rv + ncomp*npts, 
-      rv_x + ncomp*npts, rv_y + ncomp*npts, rv_z + ncomp*npts );
-
-    ncomp += sh.size();
-
-  }
-
-  gg_fast_transpose( ncomp, npts, rv,   basis_eval );
-  gg_fast_transpose( ncomp, npts, rv_x, dbasis_x_eval );
-  gg_fast_transpose( ncomp, npts, rv_y, dbasis_y_eval );
-  gg_fast_transpose( ncomp, npts, rv_z, dbasis_z_eval );
-
-  a.deallocate( rv, 4*npts*nbe );
+  blocked_collocation<1>( npts, nshells, nbe, points, basis, shell_mask,
+    { basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval }, screen );
 
 #else 
 
+  util::unused(screen);
   for( size_t ipt = 0; ipt < npts;  ++ipt )
   for( size_t i = 0;   i < nshells; ++i   ) {
     
@@ -123,8 +240,10 @@ void gau2grid_collocation_gradient( size_t                  npts,
     auto* deval_y = dbasis_y_eval + ipt*nbe + basis.shell_to_first_ao( ish );
     auto* deval_z = dbasis_z_eval + ipt*nbe + basis.shell_to_first_ao( ish );
 
+    const double pt[3] = { points[ipt], points[ipt + npts], points[ipt + 2*npts] };
+
     double x,y,z, bf, dbf_x, dbf_y, dbf_z;
-    integrator::cuda::collocation_device_radial_eval_deriv1( sh, points + 3*ipt, 
+    integrator::cuda::collocation_device_radial_eval_deriv1( sh, pt, 
                                                       &x, &y, &z, &bf, &dbf_x,
                                                       &dbf_y, &dbf_z);
 
@@ -157,48 +276,33 @@ void gau2grid_collocation_hessian( size_t                  npts,
                                    double*                 d2basis_xz_eval,
                                    double*                 d2basis_yy_eval,
                                    double*                 d2basis_yz_eval,
-                                   double*                 d2basis_zz_eval) {
+                                   double*                 d2basis_zz_eval,
+                                   CollocationScreening    screen ) {
 
-  std::allocator<double> a;
-  auto* rv = a.allocate( 10 * npts * nbe );
-  auto* rv_x = rv   + npts * nbe;
-  auto* rv_y = rv_x + npts * nbe;
-  auto* rv_z = rv_y + npts * nbe;
-  auto* rv_xx = rv_z  + npts * nbe;
-  auto* rv_xy = rv_xx + npts * nbe;
-  auto* rv_xz = rv_xy + npts * nbe;
-  auto* rv_yy = rv_xz + npts * nbe;
-  auto* rv_yz = rv_yy + npts * nbe;
-  auto* rv_zz = rv_yz + npts * nbe;
-
-  size_t ncomp = 0;
-  for( size_t i = 0; i < nshells; ++i ) {
-
-    const auto& sh = basis.at(shell_mask[i]);
-    int order = sh.pure() ? GG_SPHERICAL_CCA : GG_CARTESIAN_CCA; 
-
-    const auto ioff = ncomp*npts;
-    gg_collocation_deriv2( sh.l(), npts, points, 3, sh.nprim(), sh.coeff_data(),
-      sh.alpha_data(), sh.O_data(), order, rv + ioff, rv_x + ioff, rv_y + ioff, 
-      rv_z + ioff, rv_xx + ioff, rv_xy + ioff, rv_xz + ioff, rv_yy + ioff,
-      rv_yz + ioff, rv_zz + ioff);
-
-    ncomp += sh.size();
+  blocked_collocation<2>( npts, nshells, nbe, points, basis, shell_mask,
+    { basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval,
+      d2basis_xx_eval, d2basis_xy_eval, d2basis_xz_eval, d2basis_yy_eval,
+      d2basis_yz_eval, d2basis_zz_eval }, screen );
+
+}
 
-  }
 
-  gg_fast_transpose( ncomp, npts, rv,    basis_eval );
-  gg_fast_transpose( ncomp, npts, rv_x,  dbasis_x_eval );
-  gg_fast_transpose( ncomp, npts, rv_y,  dbasis_y_eval );
-  gg_fast_transpose( ncomp, npts, rv_z,  dbasis_z_eval );
-  gg_fast_transpose( ncomp, npts, rv_xx, d2basis_xx_eval );
-  gg_fast_transpose( ncomp, npts, rv_xy, d2basis_xy_eval );
-  gg_fast_transpose( ncomp, npts, rv_xz, d2basis_xz_eval );
-  gg_fast_transpose( ncomp, npts, rv_yy, d2basis_yy_eval );
-  gg_fast_transpose( ncomp, npts, rv_yz, d2basis_yz_eval );
-  gg_fast_transpose( ncomp, npts, rv_zz, d2basis_zz_eval );
+void gau2grid_collocation_laplacian( size_t                  npts, 
+                                     size_t                  nshells,
+                                     size_t                  nbe,
+                                     const double*           points, 
+                                     const BasisSet<double>& basis,
+                                     const int32_t*          shell_mask,
+                                     double*                 basis_eval, 
+                                     double*                 dbasis_x_eval, 
+                                     double*                 dbasis_y_eval,
+                                     double*                 dbasis_z_eval, 
+                                     double*                 lbasis_eval,
+                                     CollocationScreening    screen ) {
 
-  a.deallocate( rv, 10*npts*nbe );
+  blocked_collocation<2,true>( npts, nshells, nbe, points, basis, shell_mask,
+    { basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval, lbasis_eval },
+    screen );
 
 }
 
@@ -228,71 +332,16 @@ void gau2grid_collocation_der3(    size_t                  npts,
                                    double*                 d3basis_yyy_eval,
                                    double*                 d3basis_yyz_eval,
                                    double*                 d3basis_yzz_eval,
-                                   double*                 d3basis_zzz_eval) {
-
-  std::allocator<double> a;
-  auto* rv = a.allocate( 20 * npts * nbe );
-  auto* rv_x = rv   + npts * nbe;
-  auto* rv_y = rv_x + npts * nbe;
-  auto* rv_z = rv_y + npts * nbe;
-  auto* rv_xx = rv_z  + npts * nbe;
-  auto* rv_xy = rv_xx + npts * nbe;
-  auto* rv_xz = rv_xy + npts * nbe;
-  auto* rv_yy = rv_xz + npts * nbe;
-  auto* rv_yz = rv_yy + npts * nbe;
-  auto* rv_zz = rv_yz + npts * nbe;
-  auto* rv_xxx = rv_zz + npts * nbe;
-  auto* rv_xxy = rv_xxx + npts * nbe;
-  auto* rv_xxz = rv_xxy + npts * nbe;
-  auto* rv_xyy = rv_xxz + npts * nbe;
-  auto* rv_xyz = rv_xyy + npts * nbe;
-  auto* rv_xzz = rv_xyz + npts * nbe;
-  auto* rv_yyy = rv_xzz + npts * nbe;
-  auto* rv_yyz = rv_yyy + npts * nbe;
-  auto* rv_yzz = rv_yyz + npts * nbe;
-  auto* rv_zzz = rv_yzz + npts * nbe;
-
-
-  size_t ncomp = 0;
-  for( size_t i = 0; i < nshells; ++i ) {
-
-    const auto& sh = basis.at(shell_mask[i]);
-    int order = sh.pure() ? GG_SPHERICAL_CCA : GG_CARTESIAN_CCA; 
-
-    const auto ioff = ncomp*npts;
-    gg_collocation_deriv3( sh.l(), npts, points, 3, sh.nprim(), sh.coeff_data(),
-      sh.alpha_data(), sh.O_data(), order, rv + ioff, rv_x + ioff, rv_y + ioff, 
-      rv_z + ioff, rv_xx + ioff, rv_xy + ioff, rv_xz + ioff, rv_yy + ioff,
-      rv_yz + ioff, rv_zz + ioff, rv_xxx + ioff, rv_xxy + ioff, rv_xxz + ioff,
-      rv_xyy + ioff, rv_xyz + ioff, rv_xzz + ioff, rv_yyy + ioff, rv_yyz + ioff,
-      rv_yzz + ioff, rv_zzz + ioff);
-
-    ncomp += sh.size();
-
-  }
-
-  gg_fast_transpose( ncomp, npts, rv,    basis_eval );
-  gg_fast_transpose( ncomp, npts, rv_x,  dbasis_x_eval );
-  gg_fast_transpose( ncomp, npts, rv_y,  dbasis_y_eval );
-  gg_fast_transpose( ncomp, npts, rv_z,  dbasis_z_eval );
-  gg_fast_transpose( ncomp, npts, rv_xx, d2basis_xx_eval );
-  gg_fast_transpose( ncomp, npts, rv_xy, d2basis_xy_eval );
-  gg_fast_transpose( ncomp, npts, rv_xz, d2basis_xz_eval );
-  gg_fast_transpose( ncomp, npts, rv_yy, d2basis_yy_eval );
-  gg_fast_transpose( ncomp, npts, rv_yz, d2basis_yz_eval );
-  gg_fast_transpose( ncomp, npts, rv_zz, d2basis_zz_eval );
-  gg_fast_transpose( ncomp, npts, rv_xxx, d3basis_xxx_eval );
-  gg_fast_transpose( ncomp, npts, rv_xxy, d3basis_xxy_eval );
-  gg_fast_transpose( ncomp, npts, rv_xxz, d3basis_xxz_eval );
-  gg_fast_transpose( ncomp, npts, rv_xyy, d3basis_xyy_eval );
-  gg_fast_transpose( ncomp, npts, rv_xyz, d3basis_xyz_eval );
-  gg_fast_transpose( ncomp, npts, rv_xzz, d3basis_xzz_eval );
-  gg_fast_transpose( ncomp, npts, rv_yyy, d3basis_yyy_eval );
-  gg_fast_transpose( ncomp, npts, rv_yyz, d3basis_yyz_eval );
-  gg_fast_transpose( ncomp, npts, rv_yzz, d3basis_yzz_eval );
-  gg_fast_transpose( ncomp, npts, rv_zzz, d3basis_zzz_eval );
-
-  a.deallocate( rv, 20*npts*nbe );
+                                   double*                 d3basis_zzz_eval,
+                                   CollocationScreening    screen ) {
+
+  blocked_collocation<3>( npts, nshells, nbe, points, basis, shell_mask,
+    { basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval,
+      d2basis_xx_eval, d2basis_xy_eval, d2basis_xz_eval, d2basis_yy_eval,
+      d2basis_yz_eval, d2basis_zz_eval, d3basis_xxx_eval, d3basis_xxy_eval,
+      d3basis_xxz_eval, d3basis_xyy_eval, d3basis_xyz_eval, d3basis_xzz_eval,
+      d3basis_yyy_eval, d3basis_yyz_eval, d3basis_yzz_eval, d3basis_zzz_eval },
+    screen );
 
 }
 
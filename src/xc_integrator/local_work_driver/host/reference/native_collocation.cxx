@@ -0,0 +1,583 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "collocation.hpp"
+#include <gauxc/exceptions.hpp>
+#include <gauxc/util/aligned_allocator.hpp>
+#include <gauxc/util/real_solid_harmonics.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace GauXC {
+
+namespace {
+
+/// Maximum angular momentum supported by the native kernels
+constexpr int native_max_l = 6;
+
+/// Number of collocation components through a given derivative order
+constexpr std::array<int,4> ncomp_deriv = {1, 4, 10, 20};
+
+/// Derivative multi-indices in output order (val, x, .., xx, xy, .., zzz)
+constexpr std::array<std::array<int,3>,20> deriv_index = {{
+  {0,0,0},
+  {1,0,0}, {0,1,0}, {0,0,1},
+  {2,0,0}, {1,1,0}, {1,0,1}, {0,2,0}, {0,1,1}, {0,0,2},
+  {3,0,0}, {2,1,0}, {2,0,1}, {1,2,0}, {1,1,1}, {1,0,2}, {0,3,0}, {0,2,1},
+  {0,1,2}, {0,0,3}
+}};
+
+/// Number of output arrays of a native collocation
+template <int Deriv, bool Laplacian>
+inline constexpr int ncomp_out = Laplacian ? 5 : ncomp_deriv[Deriv];
+
+constexpr int ncart( int l ) { return (l+1)*(l+2)/2; }
+constexpr int nfunc( int l, bool pure ) { return pure ? 2*l+1 : ncart(l); }
+
+constexpr double binomial( int n, int k ) {
+  double r = 1.;
+  for( int i = 1; i <= k; ++i ) r = r * (n - k + i) / i;
+  return r;
+}
+
+/// n * (n-1) * ... * (n-k+1)
+constexpr double falling( int n, int k ) {
+  double r = 1.;
+  for( int i = 0; i < k; ++i ) r *= n - i;
+  return r;
+}
+
+/**
+ *  A single contribution coeff * x**ex * y**ey * z**ez * D^beta R(r) to
+ *  row `row` (output component x shell function) of a shell collocation,
+ *  where R(r) = sum_i c_i exp(-a_i r**2) is the contracted radial part.
+ */
+struct collocation_term {
+  int    row;
+  int    beta;
+  int    ex, ey, ez;
+  double coeff;
+};
+
+/**
+ *  Generate the (merged) collocation terms of a shell of angular momentum L
+ *  through derivative order Deriv by Leibniz' rule. For spherical shells,
+ *  the Cartesian -> (unnormalized, CCA ordered) real solid harmonic transform
+ *  is folded into the coefficients. For `Laplacian`, the xx, yy and zz rows
+ *  are merged into a single Laplacian row and xy, xz, yz are dropped.
+ */
+std::vector<collocation_term> generate_collocation_terms( int L, bool pure,
+  int deriv, bool laplacian ) {
+
+  const int nf    = nfunc(L, pure);
+  const int nbeta = ncomp_deriv[deriv];
+
+  std::vector<collocation_term> terms;
+  for( int a = 0; a < ncomp_deriv[deriv]; ++a ) {
+
+    const auto& al = deriv_index[a];
+    int out = a;
+    if( laplacian and a >= 4 ) {
+      if( al[0] != 2 and al[1] != 2 and al[2] != 2 ) continue;
+      out = 4;
+    }
+
+    for( int ix = L, ic = 0; ix >= 0; --ix           )
+    for( int iy = L - ix;    iy >= 0; --iy, ++ic     ) {
+      const int iz = L - ix - iy;
+      const std::array<int,3> ipow = {ix, iy, iz};
+
+      for( int b = 0; b < nbeta; ++b ) {
+        const auto& be = deriv_index[b];
+        bool valid = true;
+        double coeff = 1.;
+        std::array<int,3> e;
+        for( int k = 0; k < 3; ++k ) {
+          const int g = al[k] - be[k];
+          if( g < 0 or g > ipow[k] ) { valid = false; break; }
+          coeff *= binomial(al[k], be[k]) * falling(ipow[k], g);
+          e[k] = ipow[k] - g;
+        }
+        if( not valid ) continue;
+
+        if( pure ) {
+          for( int m = -L; m <= L; ++m ) {
+            const double t = util::real_solid_harmonic_coeff(L, m, ix, iy, iz);
+            if( t != 0. )
+              terms.push_back({ out*nf + m + L, b, e[0], e[1], e[2], t*coeff });
+          }
+        } else {
+          terms.push_back({ out*nf + ic, b, e[0], e[1], e[2], coeff });
+        }
+      }
+    }
+
+  }
+
+  // Merge equivalent terms and drop those which cancel
+  auto key = []( const auto& t ) {
+    return std::tie( t.row, t.beta, t.ex, t.ey, t.ez );
+  };
+  std::sort( terms.begin(), terms.end(),
+    [&]( const auto& a, const auto& b ){ return key(a) < key(b); } );
+
+  std::vector<collocation_term> merged;
+  for( const auto& t : terms ) {
+    if( merged.size() and key(merged.back()) == key(t) )
+      merged.back().coeff += t.coeff;
+    else merged.push_back(t);
+  }
+  merged.erase( std::remove_if( merged.begin(), merged.end(),
+    []( const auto& t ){ return std::abs(t.coeff) < 1e-12; } ), merged.end() );
+
+  return merged;
+
+}
+
+/**
+ *  Vectorizable exp(x) for the Gaussian radial part (x <= 0).
+ *
+ *  Range reduction x = k*ln2 + r, |r| <= ln2/2, followed by a degree 13
+ *  Taylor polynomial for exp(r) and an exponent shift by k. The relative
+ *  error is within a few ulp of std::exp; arguments below -700 (where the
+ *  Gaussian is negligible to machine precision) return 0.
+ */
+inline double native_exp( double x ) {
+
+  constexpr double log2e  = 1.4426950408889634;
+  constexpr double ln2_hi = 6.93147180369123816490e-01;
+  constexpr double ln2_lo = 1.90821492927058770002e-10;
+  constexpr double shift  = 6755399441055744.; // 1.5 * 2**52
+
+  const bool under = x < -700.;
+  x = under ? -700. : x;
+
+  // k = round(x / ln2), held in the low mantissa bits of t
+  const double t = x * log2e + shift;
+  const double k = t - shift;
+  const double r = (x - k * ln2_hi) - k * ln2_lo;
+
+  double p = 1. / 6227020800.;
+  p = p * r + 1. / 479001600.;
+  p = p * r + 1. / 39916800.;
+  p = p * r + 1. / 3628800.;
+  p = p * r + 1. / 362880.;
+  p = p * r + 1. / 40320.;
+  p = p * r + 1. / 5040.;
+  p = p * r + 1. / 720.;
+  p = p * r + 1. / 120.;
+  p = p * r + 1. / 24.;
+  p = p * r + 1. / 6.;
+  p = p * r + 0.5;
+  p = p * r + 1.;
+  p = p * r + 1.;
+
+  int64_t t_bits, s_bits, p_bits;
+  std::memcpy( &t_bits, &t,     sizeof(double) );
+  std::memcpy( &s_bits, &shift, sizeof(double) );
+  std::memcpy( &p_bits, &p,     sizeof(double) );
+  p_bits += (t_bits - s_bits) << 52;
+
+  double res;
+  std::memcpy( &res, &p_bits, sizeof(double) );
+  return under ? 0. : res;
+
+}
+
+template <int N>
+inline double ipow( double x ) {
+  if constexpr (N == 0) return 1.;
+  else return x * ipow<N-1>(x);
+}
+
+/// Coefficient of t**(B-1) (t = -2a) in exp(a*x**2) d^B/dx^B exp(-a*x**2)
+template <int B>
+inline double hermite_sub( double x ) {
+  if constexpr (B == 2) return 1.;
+  else if constexpr (B == 3) return 3. * x;
+  else return 0.;
+}
+
+/**
+ *  D^beta R for |beta| <= 3, where R = sum_i c_i exp(-a_i r**2), from the
+ *  radial sums S_n = sum_i c_i (-2a_i)**n exp(-a_i r**2):
+ *
+ *    D^beta R = x**bx y**by z**bz S_|beta| + sum_{b_k >= 2} h_k S_{|beta|-1}
+ *
+ *  where h_k is the t**(b_k-1) coefficient of the 1D Hermite factor times
+ *  the remaining monomials (at most one b_k >= 2 for |beta| <= 3).
+ */
+template <int BX, int BY, int BZ>
+void radial_derivative( size_t nb, const double* x, const double* y,
+  const double* z, const double* S, double* DR ) {
+
+  constexpr int n = BX + BY + BZ;
+  const double* Sn = S + n * nb;
+  const double* Sm = S + (n ? n-1 : 0) * nb;
+
+  #pragma omp simd
+  for( size_t p = 0; p < nb; ++p ) {
+    const double xp = x[p], yp = y[p], zp = z[p];
+    double r = ipow<BX>(xp) * ipow<BY>(yp) * ipow<BZ>(zp) * Sn[p];
+    if constexpr (BX >= 2) r += hermite_sub<BX>(xp) * ipow<BY>(yp) * ipow<BZ>(zp) * Sm[p];
+    if constexpr (BY >= 2) r += hermite_sub<BY>(yp) * ipow<BX>(xp) * ipow<BZ>(zp) * Sm[p];
+    if constexpr (BZ >= 2) r += hermite_sub<BZ>(zp) * ipow<BX>(xp) * ipow<BY>(yp) * Sm[p];
+    DR[p] = r;
+  }
+
+}
+
+template <size_t... B>
+void radial_derivatives( std::index_sequence<B...>, size_t nb,
+  const double* x, const double* y, const double* z, const double* S,
+  double* DR ) {
+  ( radial_derivative< deriv_index[B][0], deriv_index[B][1],
+      deriv_index[B][2] >( nb, x, y, z, S, DR + B*nb ), ... );
+}
+
+/// Per-block data shared by the shells of a collocation block
+struct native_block {
+  size_t        nb;   ///< Number of points in the block
+  const double* xp;   ///< Powers of x - Ox, (native_max_l+1) x nb
+  const double* yp;   ///< Powers of y - Oy, (native_max_l+1) x nb
+  const double* zp;   ///< Powers of z - Oz, (native_max_l+1) x nb
+  const double* S;    ///< Radial sums, (Deriv+1) x nb
+  double*       DR;   ///< Radial derivatives, ncomp_deriv[Deriv] x nb
+  double*       out;  ///< Shell collocation, (ncomp x nfunc) x nb
+};
+
+/**
+ *  Collocation of a single shell (angular momentum L, Cartesian / spherical
+ *  `Pure`) over a block of points. The output is component (row) major
+ *  within the block, (ncomp_out * nfunc(L,Pure)) x nb.
+ */
+template <int L, bool Pure, int Deriv, bool Laplacian>
+void native_shell_collocation( const native_block& blk ) {
+
+  constexpr int nrow  = ncomp_out<Deriv,Laplacian> * nfunc(L,Pure);
+  constexpr int nbeta = ncomp_deriv[Deriv];
+  static const auto terms =
+    generate_collocation_terms( L, Pure, Deriv, Laplacian );
+
+  const size_t nb = blk.nb;
+  radial_derivatives( std::make_index_sequence<nbeta>{}, nb, blk.xp + nb,
+    blk.yp + nb, blk.zp + nb, blk.S, blk.DR );
+
+  std::fill_n( blk.out, nrow * nb, 0. );
+  for( const auto& t : terms ) {
+    const auto* __restrict__ x  = blk.xp + t.ex * nb;
+    const auto* __restrict__ y  = blk.yp + t.ey * nb;
+    const auto* __restrict__ z  = blk.zp + t.ez * nb;
+    const auto* __restrict__ dr = blk.DR + t.beta * nb;
+    auto* __restrict__ o = blk.out + t.row * nb;
+    const double c = t.coeff;
+    #pragma omp simd
+    for( size_t p = 0; p < nb; ++p ) o[p] += c * x[p] * y[p] * z[p] * dr[p];
+  }
+
+}
+
+template <int Deriv, bool Laplacian>
+using native_shell_kernel = void(*)( const native_block& );
+
+template <int Deriv, bool Laplacian, int... L>
+constexpr std::array<std::array<native_shell_kernel<Deriv,Laplacian>,2>,
+  sizeof...(L)> make_kernel_table( std::integer_sequence<int,L...> ) {
+  return {{ { &native_shell_collocation<L,false,Deriv,Laplacian>,
+              &native_shell_collocation<L,true, Deriv,Laplacian> }... }};
+}
+
+/**
+ *  Blocked native collocation through derivative order `Deriv`.
+ *
+ *  Points are processed in blocks of `screen.block_size`. For each block,
+ *  the displacements (and their powers) are formed once per center and
+ *  reused by the consecutive shells of the shell list which share it, and
+ *  each shell is evaluated by the kernel specialized for its angular
+ *  momentum and type into a small (cache resident) scratch before being
+ *  written directly into the point-major (nbe,npts) output. Scratch is
+ *  thread local and persists between calls. Screening is identical to that
+ *  of the gau2grid collocation.
+ */
+template <int Deriv, bool Laplacian = false>
+void native_blocked_collocation( size_t npts, size_t nshells, size_t nbe,
+  const double* points, const BasisSet<double>& basis,
+  const int32_t* shell_mask,
+  const std::array<double*, ncomp_out<Deriv,Laplacian>>& basis_eval,
+  CollocationScreening screen ) {
+
+  static_assert( not Laplacian or Deriv == 2 );
+  constexpr int nout  = ncomp_out<Deriv,Laplacian>;
+  constexpr int nbeta = ncomp_deriv[Deriv];
+  constexpr int npow  = native_max_l + 1;
+  static constexpr auto kernels = make_kernel_table<Deriv,Laplacian>(
+    std::make_integer_sequence<int,native_max_l+1>{} );
+
+  if( not npts ) return;
+
+  const bool   do_screen  = screen.tol > 0.;
+  const size_t block_size =
+    std::min( std::max<size_t>(screen.block_size, 1), npts );
+
+  // Thread local scratch: powers, r**2, radial sums / derivatives and the
+  // collocation of a single shell
+  const size_t max_out = nout * ncart(native_max_l) * block_size;
+  thread_local util::aligned_vector<double> scr;
+  const size_t scr_sz = (3*npow + 1 + (Deriv+1) + nbeta) * block_size + max_out;
+  if( scr.size() < scr_sz ) scr.resize( scr_sz );
+  thread_local std::vector<double> coeff_scr, alpha_scr;
+
+  for( size_t p0 = 0; p0 < npts; p0 += block_size ) {
+
+    const size_t nb = std::min( block_size, npts - p0 );
+    double* xp  = scr.data();
+    double* yp  = xp + npow * nb;
+    double* zp  = yp + npow * nb;
+    double* r2  = zp + npow * nb;
+    double* S   = r2 + nb;
+    double* DR  = S  + (Deriv+1) * nb;
+    double* out = DR + nbeta * nb;
+    const native_block blk = { nb, xp, yp, zp, S, DR, out };
+
+    const double* X = points + p0;
+    const double* Y = points + npts + p0;
+    const double* Z = points + 2*npts + p0;
+
+    // Bounding box of the block
+    double lo[3], hi[3];
+    if( do_screen )
+    for( int k = 0; k < 3; ++k ) {
+      const auto* x = points + k*npts + p0;
+      const auto [mn, mx] = std::minmax_element( x, x + nb );
+      lo[k] = *mn; hi[k] = *mx;
+    }
+
+    const double* O_prev = nullptr;
+    int lpow = -1; // Highest power formed for the current center
+    double r_box = 0.;
+
+    size_t ioff = 0;
+    for( size_t i = 0; i < nshells; ++i ) {
+
+      const auto& sh = basis.at(shell_mask[i]);
+      const int  l    = sh.l();
+      const bool pure = sh.pure();
+      const size_t shsz = sh.size();
+      const double* O = sh.O_data();
+
+      if( l > native_max_l )
+        GAUXC_GENERIC_EXCEPTION("L Exceeds Native Collocation Max AM");
+
+      // Displacements are shared by consecutive shells on the same center
+      const bool new_center = not O_prev or not std::equal( O, O + 3, O_prev );
+      if( new_center ) {
+        std::fill_n( xp, nb, 1. );
+        std::fill_n( yp, nb, 1. );
+        std::fill_n( zp, nb, 1. );
+        #pragma omp simd
+        for( size_t p = 0; p < nb; ++p ) {
+          const double dx = X[p] - O[0];
+          const double dy = Y[p] - O[1];
+          const double dz = Z[p] - O[2];
+          xp[nb + p] = dx;
+          yp[nb + p] = dy;
+          zp[nb + p] = dz;
+          r2[p] = dx*dx + dy*dy + dz*dz;
+        }
+        lpow = 1;
+        if( do_screen ) r_box = box_distance( lo, hi, O );
+        O_prev = O;
+      }
+
+      // Powers through L, extended as needed by the shells of this center
+      for( ; lpow < l; ++lpow )
+      for( size_t p = 0; p < nb; ++p ) {
+        xp[(lpow+1)*nb + p] = xp[lpow*nb + p] * xp[nb + p];
+        yp[(lpow+1)*nb + p] = yp[lpow*nb + p] * yp[nb + p];
+        zp[(lpow+1)*nb + p] = zp[lpow*nb + p] * zp[nb + p];
+      }
+
+      int nprim = sh.nprim();
+      const double* coeff = sh.coeff_data();
+      const double* alpha = sh.alpha_data();
+
+      if( do_screen ) {
+        coeff_scr.clear(); alpha_scr.clear();
+        for( int j = 0; j < nprim; ++j )
+        if( not primitive_negligible( coeff[j], alpha[j], l, Deriv, r_box,
+          screen.tol ) ) {
+          coeff_scr.push_back( coeff[j] );
+          alpha_scr.push_back( alpha[j] );
+        }
+        nprim = coeff_scr.size();
+        coeff = coeff_scr.data();
+        alpha = alpha_scr.data();
+      }
+
+      if( nprim ) {
+
+        // S_n = sum_j c_j (-2 a_j)**n exp(-a_j r**2)
+        std::fill_n( S, (Deriv+1) * nb, 0. );
+        for( int j = 0; j < nprim; ++j ) {
+          const double a = alpha[j];
+          const double c = coeff[j];
+          const double t = -2. * a;
+          #pragma omp simd
+          for( size_t p = 0; p < nb; ++p ) {
+            double e = c * native_exp( -a * r2[p] );
+            S[p] += e;
+            for( int n = 1; n <= Deriv; ++n ) { e *= t; S[n*nb + p] += e; }
+          }
+        }
+
+        kernels[l][pure]( blk );
+
+        // Write (row major) shell block into the point-major output
+        for( int k = 0; k < nout; ++k ) {
+          const double* o = out + k * shsz * nb;
+          double* be = basis_eval[k] + p0*nbe + ioff;
+          for( size_t p = 0; p < nb; ++p )
+          for( size_t f = 0; f < shsz; ++f ) be[p*nbe + f] = o[f*nb + p];
+        }
+
+      } else {
+        for( int k = 0; k < nout; ++k )
+        for( size_t p = 0; p < nb; ++p )
+          std::fill_n( basis_eval[k] + (p0 + p)*nbe + ioff, shsz, 0. );
+      }
+
+      ioff += shsz;
+
+    }
+
+  }
+
+}
+
+}
+
+void native_collocation( size_t                  npts,
+                         size_t                  nshells,
+                         size_t                  nbe,
+                         const double*           points,
+                         const BasisSet<double>& basis,
+                         const int32_t*          shell_mask,
+                         double*                 basis_eval,
+                         CollocationScreening    screen ) {
+
+  native_blocked_collocation<0>( npts, nshells, nbe, points, basis,
+    shell_mask, { basis_eval }, screen );
+
+}
+
+void native_collocation_gradient( size_t                  npts,
+                                  size_t                  nshells,
+                                  size_t                  nbe,
+                                  const double*           points,
+                                  const BasisSet<double>& basis,
+                                  const int32_t*          shell_mask,
+                                  double*                 basis_eval,
+                                  double*                 dbasis_x_eval,
+                                  double*                 dbasis_y_eval,
+                                  double*                 dbasis_z_eval,
+                                  CollocationScreening    screen ) {
+
+  native_blocked_collocation<1>( npts, nshells, nbe, points, basis,
+    shell_mask, { basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval },
+    screen );
+
+}
+
+void native_collocation_hessian( size_t                  npts,
+                                 size_t                  nshells,
+                                 size_t                  nbe,
+                                 const double*           points,
+                                 const BasisSet<double>& basis,
+                                 const int32_t*          shell_mask,
+                                 double*                 basis_eval,
+                                 double*                 dbasis_x_eval,
+                                 double*                 dbasis_y_eval,
+                                 double*                 dbasis_z_eval,
+                                 double*                 d2basis_xx_eval,
+                                 double*                 d2basis_xy_eval,
+                                 double*                 d2basis_xz_eval,
+                                 double*                 d2basis_yy_eval,
+                                 double*                 d2basis_yz_eval,
+                                 double*                 d2basis_zz_eval,
+                                 CollocationScreening    screen ) {
+
+  native_blocked_collocation<2>( npts, nshells, nbe, points, basis,
+    shell_mask, { basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval,
+      d2basis_xx_eval, d2basis_xy_eval, d2basis_xz_eval, d2basis_yy_eval,
+      d2basis_yz_eval, d2basis_zz_eval }, screen );
+
+}
+
+void native_collocation_laplacian( size_t                  npts,
+                                   size_t                  nshells,
+                                   size_t                  nbe,
+                                   const double*           points,
+                                   const BasisSet<double>& basis,
+                                   const int32_t*          shell_mask,
+                                   double*                 basis_eval,
+                                   double*                 dbasis_x_eval,
+                                   double*                 dbasis_y_eval,
+                                   double*                 dbasis_z_eval,
+                                   double*                 lbasis_eval,
+                                   CollocationScreening    screen ) {
+
+  native_blocked_collocation<2,true>( npts, nshells, nbe, points, basis,
+    shell_mask, { basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval,
+      lbasis_eval }, screen );
+
+}
+
+void native_collocation_der3( size_t                  npts,
+                              size_t                  nshells,
+                              size_t                  nbe,
+                              const double*           points,
+                              const BasisSet<double>& basis,
+                              const int32_t*          shell_mask,
+                              double*                 basis_eval,
+                              double*                 dbasis_x_eval,
+                              double*                 dbasis_y_eval,
+                              double*                 dbasis_z_eval,
+                              double*                 d2basis_xx_eval,
+                              double*                 d2basis_xy_eval,
+                              double*                 d2basis_xz_eval,
+                              double*                 d2basis_yy_eval,
+                              double*                 d2basis_yz_eval,
+                              double*                 d2basis_zz_eval,
+                              double*                 d3basis_xxx_eval,
+                              double*                 d3basis_xxy_eval,
+                              double*                 d3basis_xxz_eval,
+                              double*                 d3basis_xyy_eval,
+                              double*                 d3basis_xyz_eval,
+                              double*                 d3basis_xzz_eval,
+                              double*                 d3basis_yyy_eval,
+                              double*                 d3basis_yyz_eval,
+                              double*                 d3basis_yzz_eval,
+                              double*                 d3basis_zzz_eval,
+                              CollocationScreening    screen ) {
+
+  native_blocked_collocation<3>( npts, nshells, nbe, points, basis,
+    shell_mask, { basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval,
+      d2basis_xx_eval, d2basis_xy_eval, d2basis_xz_eval, d2basis_yy_eval,
+      d2basis_yz_eval, d2basis_zz_eval, d3basis_xxx_eval, d3basis_xxy_eval,
+      d3basis_xxz_eval, d3basis_xyy_eval, d3basis_xyz_eval, d3basis_xzz_eval,
+      d3basis_yyy_eval, d3basis_yyz_eval, d3basis_yzz_eval, d3basis_zzz_eval },
+    screen );
+
+}
+
+}
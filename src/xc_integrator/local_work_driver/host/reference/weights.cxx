@@ -7,8 +7,10 @@
  */
 #include "host/reference/weights.hpp"
 #include "common/integrator_constants.hpp"
+#include "integrator_util/integrator_common.hpp"
 
 #include <gauxc/molgrid/defaults.hpp>
+#include <utility>
 
 namespace GauXC {
 
@@ -27,6 +29,9 @@ void reference_becke_weights_host(
   const size_t ntasks = std::distance(task_begin,task_end);
   const size_t natoms = mol.natoms();
 
+  // Weight kernels consume SoA points
+  generate_points_soa( task_begin, task_end );
+
   const auto&  RAB    = meta.rab();
 
   std::vector<double> slater_radii;
@@ -62,7 +67,8 @@ void reference_becke_weights_host(
 
     auto&       task   = *(task_begin+iT);
     auto&       weight = task.weights[i];
-    const auto& point  = task.points[i];
+    const double point[3] = 
+      { task.points_x()[i], task.points_y()[i], task.points_z()[i] };
 
     // Compute distances of each center to point
     for(size_t iA = 0; iA < natoms; iA++) {
@@ -128,6 +134,9 @@ void reference_ssf_weights_host(
   const size_t ntasks = std::distance(task_begin,task_end);
   const size_t natoms = mol.natoms();
 
+  // Weight kernels consume SoA points
+  generate_points_soa( task_begin, task_end );
+
   const auto&  RAB    = meta.rab();
 
   #pragma omp parallel 
@@ -142,7 +151,8 @@ void reference_ssf_weights_host(
 
     auto&       task   = *(task_begin+iT);
     auto&       weight = task.weights[i];
-    const auto& point  = task.points[i];
+    const double point[3] = 
+      { task.points_x()[i], task.points_y()[i], task.points_z()[i] };
 
     const auto dist_cutoff = 0.5 * (1-integrator::magic_ssf_factor<>) * task.dist_nearest;
 
@@ -211,6 +221,191 @@ void reference_ssf_weights_host(
 
 }
 
+namespace {
+
+/**
+ *  Contracted 1st derivatives of Becke-type (products of pairwise switching
+ *  functions) partition weights over the points of a single task
+ *
+ *  w_i = W_i * P_G(r_i) / Z(r_i), Z = sum_C P_C, P_C = prod_{D != C} s(mu_CD)
+ *
+ *  d w_i / d R_X = w_i * ( d ln P_G / d R_X - d ln Z / d R_X ), X != G
+ *
+ *  The points move with the parent atom G, such that (translational 
+ *  invariance) d w_i / d R_G = - sum_{X != G} d w_i / d R_X
+ *
+ *  @param[in] switch_func Returns s(mu) and d s / d mu
+ *  @param[in] dist_cutoff Points closer to the parent have P_G / Z == 1
+ */
+template <typename SwitchFunc>
+void weights_1st_derivative_contracted_host(
+  const Molecule&   mol,
+  const MolMeta&    meta,
+  const XCTask&     task,
+  const double*     w_times_f,
+  double*           exc_grad_w,
+  const SwitchFunc& switch_func,
+  const double      dist_cutoff
+) {
+
+  const size_t natoms = mol.natoms();
+  const size_t npts   = task.points.size();
+  const size_t iG     = task.iParent;
+  const auto&  RAB    = meta.rab();
+
+  const auto* points_x = task.points_x();
+  const auto* points_y = task.points_y();
+  const auto* points_z = task.points_z();
+
+  std::vector<double> atomDist( natoms ), atomUnit( 3*natoms );
+  std::vector<double> partitionScratch( natoms );
+  std::vector<double> switchScratch( natoms*natoms ), dswitchScratch( natoms*natoms );
+  std::vector<double> dZ( 3*natoms ), dPG( 3*natoms );
+
+  for( size_t i = 0; i < npts; ++i ) {
+
+    const double wf = w_times_f[i];
+    if( wf == 0. ) continue;
+
+    // Distances / unit vectors of each center to point
+    for( size_t iA = 0; iA < natoms; iA++ ) {
+      const double da_x = points_x[i] - mol[iA].x;
+      const double da_y = points_y[i] - mol[iA].y;
+      const double da_z = points_z[i] - mol[iA].z;
+
+      const double r = std::sqrt(da_x*da_x + da_y*da_y + da_z*da_z);
+      const double r_inv = r > 0. ? 1. / r : 0.;
+      atomDist[iA]       = r;
+      atomUnit[3*iA + 0] = da_x * r_inv;
+      atomUnit[3*iA + 1] = da_y * r_inv;
+      atomUnit[3*iA + 2] = da_z * r_inv;
+    }
+
+    if( atomDist[iG] < dist_cutoff ) continue; // Partition weight = 1
+
+    // Evaluate unnormalized partition functions 
+    std::fill(partitionScratch.begin(),partitionScratch.end(),1.);
+    for( size_t iA = 0; iA < natoms; iA++ ) 
+    for( size_t jA = 0; jA < iA;     jA++ ) {
+      const double mu = (atomDist[iA] - atomDist[jA]) / RAB[jA + iA*natoms];
+      const auto [s, ds] = switch_func(mu);
+      switchScratch [jA + iA*natoms] = s;
+      dswitchScratch[jA + iA*natoms] = ds;
+      partitionScratch[iA] *= s;
+      partitionScratch[jA] *= 1. - s;
+    }
+
+    double sum = 0.;
+    for( size_t iA = 0; iA < natoms; iA++ ) sum += partitionScratch[iA];
+    const double PG = partitionScratch[iG];
+    if( PG == 0. ) continue;
+
+    // Derivatives of P_G and Z wrt the atomic centers (fixed point)
+    std::fill( dZ.begin(),  dZ.end(),  0. );
+    std::fill( dPG.begin(), dPG.end(), 0. );
+    for( size_t iA = 0; iA < natoms; iA++ ) 
+    for( size_t jA = 0; jA < iA;     jA++ ) {
+
+      const double ds = dswitchScratch[jA + iA*natoms];
+      if( ds == 0. ) continue;
+      const double s  = switchScratch[jA + iA*natoms];
+
+      // d P_A / d mu_AB and d P_B / d mu_AB ( s(mu_BA) = 1 - s(mu_AB) )
+      const double dPA = s      > 0. ? partitionScratch[iA] *  ds / s        : 0.;
+      const double dPB = (1.-s) > 0. ? partitionScratch[jA] * -ds / (1. - s) : 0.;
+      const double dPG_mu = (iA == iG) ? dPA : (jA == iG) ? dPB : 0.;
+
+      // d mu_AB / d R_A = -(u_A + mu_AB e_AB) / R_AB 
+      // d mu_AB / d R_B =  (u_B + mu_AB e_AB) / R_AB
+      const double rab_inv = 1. / RAB[jA + iA*natoms];
+      const double mu = (atomDist[iA] - atomDist[jA]) * rab_inv;
+      const double e_ab[3] = { (mol[iA].x - mol[jA].x) * rab_inv,
+                               (mol[iA].y - mol[jA].y) * rab_inv,
+                               (mol[iA].z - mol[jA].z) * rab_inv };
+      for( int k = 0; k < 3; ++k ) {
+        const double dmu_A = -(atomUnit[3*iA + k] + mu * e_ab[k]) * rab_inv;
+        const double dmu_B =  (atomUnit[3*jA + k] + mu * e_ab[k]) * rab_inv;
+
+        dZ[3*iA + k] += (dPA + dPB) * dmu_A;
+        dZ[3*jA + k] += (dPA + dPB) * dmu_B;
+        dPG[3*iA + k] += dPG_mu * dmu_A;
+        dPG[3*jA + k] += dPG_mu * dmu_B;
+      }
+    }
+
+    // Contract with the integrand
+    const double PG_inv = 1. / PG, sum_inv = 1. / sum;
+    for( size_t iA = 0; iA < natoms; iA++ ) 
+    if( iA != iG ) {
+      for( int k = 0; k < 3; ++k ) {
+        const double g = wf * ( dPG[3*iA + k] * PG_inv - dZ[3*iA + k] * sum_inv );
+        exc_grad_w[3*iA + k] += g;
+        exc_grad_w[3*iG + k] -= g;
+      }
+    }
+
+  } // Loop over points
+
+}
+
+}
+
+void reference_becke_weights_1st_derivative_contracted_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  const XCTask&          task,
+  const double*          w_times_f,
+  double*                exc_grad_w
+) {
+
+  // Becke partition functions
+  auto hBecke  = [](double x) {return 1.5 * x - 0.5 * x * x * x;}; // Eq. 19
+  auto dhBecke = [](double x) {return 1.5 * (1. - x * x);};
+
+  auto sBecke = [&](double mu) {
+    const double f1 = hBecke(mu);
+    const double f2 = hBecke(f1);
+    const double f3 = hBecke(f2); // Eq. 20 f_3
+    return std::make_pair( 0.5 * (1. - f3), 
+      -0.5 * dhBecke(f2) * dhBecke(f1) * dhBecke(mu) );
+  };
+
+  weights_1st_derivative_contracted_host( mol, meta, task, w_times_f, exc_grad_w,
+    sBecke, 0. );
+
+}
+
+void reference_ssf_weights_1st_derivative_contracted_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  const XCTask&          task,
+  const double*          w_times_f,
+  double*                exc_grad_w
+) {
+
+  constexpr double a = integrator::magic_ssf_factor<>;
+  auto sFrisch = [&](double mu) {
+    if( mu <= -a ) return std::make_pair( 1., 0. );
+    if( mu >=  a ) return std::make_pair( 0., 0. );
+
+    const double s_x  = mu / a;
+    const double s_x2 = s_x  * s_x;
+    const double s_x3 = s_x  * s_x2;
+    const double s_x5 = s_x3 * s_x2;
+    const double s_x7 = s_x5 * s_x2;
+    const double t    = 1. - s_x2;
+
+    const double g  = (35.*(s_x - s_x3) + 21.*s_x5 - 5.*s_x7) / 16.;
+    const double dg = 35. * t * t * t / (16. * a);
+    return std::make_pair( 0.5 * (1. - g), -0.5 * dg );
+  };
+
+  const auto dist_cutoff = 0.5 * (1-a) * task.dist_nearest;
+  weights_1st_derivative_contracted_host( mol, meta, task, w_times_f, exc_grad_w,
+    sFrisch, dist_cutoff );
+
+}
+
 void reference_lko_weights_host(
   const Molecule&        mol,
   const MolMeta&         meta,
@@ -223,6 +418,9 @@ void reference_lko_weights_host(
   std::stable_sort( task_begin, task_end, 
     [](const auto& a, const auto&b ) { return a.iParent < b.iParent; } );
 
+  // Weight kernels consume SoA points
+  generate_points_soa( task_begin, task_end );
+
   // Becke partition functions
   auto hBecke = [](double x) {return 1.5 * x - 0.5 * x * x * x;}; // Eq. 19
   auto gBecke = [&](double x) {return hBecke(hBecke(hBecke(x)));}; // Eq. 20 f_3
@@ -256,14 +454,16 @@ void reference_lko_weights_host(
 
   for( auto task_it = atom_begin; task_it != atom_end; ++task_it ) {
 
-    auto& points  = task_it->points;
     auto& weights = task_it->weights;
-    const auto npts = points.size();
+    const auto npts = task_it->points.size();
+    const auto* points_x = task_it->points_x();
+    const auto* points_y = task_it->points_y();
+    const auto* points_z = task_it->points_z();
 
   for( auto ipt = 0ul; ipt < npts; ++ipt ) {
 
     auto& weight = weights[ipt];
-    const auto point = points[ipt];
+    const double point[3] = { points_x[ipt], points_y[ipt], points_z[ipt] };
 
     std::fill( atomDist.begin(), atomDist.end(), std::numeric_limits<double>::infinity() );
     // Parent distance
@@ -32,4 +32,20 @@ void reference_lko_weights_host(
   task_iterator          task_end
 );
 
+void reference_ssf_weights_1st_derivative_contracted_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  const XCTask&          task,
+  const double*          w_times_f,
+  double*                exc_grad_w
+);
+
+void reference_becke_weights_1st_derivative_contracted_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  const XCTask&          task,
+  const double*          w_times_f,
+  double*                exc_grad_w
+);
+
 }
@@ -25,7 +25,8 @@
 
 namespace GauXC {
 
-  ReferenceLocalHostWorkDriver::ReferenceLocalHostWorkDriver() {
+  ReferenceLocalHostWorkDriver::ReferenceLocalHostWorkDriver( 
+    LocalHostWorkSettings s ) : settings(s) {
     this->boys_table = XCPU::boys_init();
   }
   
@@ -52,12 +53,41 @@ namespace GauXC {
     }
   }
 
+  void ReferenceLocalHostWorkDriver::eval_weight_1st_deriv_contracted( 
+    XCWeightAlg weight_alg, const Molecule& mol, const MolMeta& meta, 
+    const XCTask& task, const double* w_times_f, double* exc_grad_w ) {
+    switch( weight_alg ) {
+      case XCWeightAlg::Becke:
+        reference_becke_weights_1st_derivative_contracted_host( mol, meta, task, 
+          w_times_f, exc_grad_w );
+        break;
+      case XCWeightAlg::SSF:
+        reference_ssf_weights_1st_derivative_contracted_host( mol, meta, task, 
+          w_times_f, exc_grad_w );
+        break;
+      default:
+        GAUXC_GENERIC_EXCEPTION("Weight Derivatives Not Supported for Weight Alg");
+    }
+  }
+
+
+  CollocationScreening ReferenceLocalHostWorkDriver::collocation_screening() const {
+    return CollocationScreening{ settings.collocation_tol, 
+                                 settings.collocation_block_size };
+  }
+
+  bool ReferenceLocalHostWorkDriver::use_native_collocation() const {
+    return settings.collocation_backend == HostCollocation::Native;
+  }
 
   // Collocation
   void ReferenceLocalHostWorkDriver::eval_collocation( size_t npts, size_t nshells, 
 						       size_t nbe, const double* pts, const BasisSet<double>& basis, 
 						       const int32_t* shell_list, double* basis_eval ) {
-    gau2grid_collocation( npts, nshells, nbe, pts, basis, shell_list, basis_eval );
+    auto* coll = use_native_collocation() ? native_collocation : 
+                                            gau2grid_collocation;
+    coll( npts, nshells, nbe, pts, basis, shell_list, basis_eval,
+      collocation_screening() );
   }
 
 
@@ -66,8 +96,11 @@ namespace GauXC {
 								size_t nshells, size_t nbe, const double* pts, const BasisSet<double>& basis, 
 								const int32_t* shell_list, double* basis_eval, double* dbasis_x_eval, 
 								double* dbasis_y_eval, double* dbasis_z_eval) {
-    gau2grid_collocation_gradient(npts, nshells, nbe, pts, basis, shell_list,
-				  basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval );
+    auto* coll = use_native_collocation() ? native_collocation_gradient : 
+                                            gau2grid_collocation_gradient;
+    coll(npts, nshells, nbe, pts, basis, shell_list,
+				  basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval,
+				  collocation_screening() );
   }
 
   void ReferenceLocalHostWorkDriver::eval_collocation_hessian( size_t npts, 
@@ -76,10 +109,23 @@ namespace GauXC {
 							       double* dbasis_y_eval, double* dbasis_z_eval, double* d2basis_xx_eval, 
 							       double* d2basis_xy_eval, double* d2basis_xz_eval, double* d2basis_yy_eval, 
 							       double* d2basis_yz_eval, double* d2basis_zz_eval ) {
-    gau2grid_collocation_hessian(npts, nshells, nbe, pts, basis, shell_list,
+    auto* coll = use_native_collocation() ? native_collocation_hessian : 
+                                            gau2grid_collocation_hessian;
+    coll(npts, nshells, nbe, pts, basis, shell_list,
 				 basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval, d2basis_xx_eval,
 				 d2basis_xy_eval, d2basis_xz_eval, d2basis_yy_eval, d2basis_yz_eval,
-				 d2basis_zz_eval);
+				 d2basis_zz_eval, collocation_screening());
+  }
+
+  void ReferenceLocalHostWorkDriver::eval_collocation_laplacian( size_t npts, 
+							       size_t nshells, size_t nbe, const double* pts, const BasisSet<double>& basis, 
+							       const int32_t* shell_list, double* basis_eval, double* dbasis_x_eval, 
+							       double* dbasis_y_eval, double* dbasis_z_eval, double* lbasis_eval ) {
+    auto* coll = use_native_collocation() ? native_collocation_laplacian : 
+                                            gau2grid_collocation_laplacian;
+    coll(npts, nshells, nbe, pts, basis, shell_list,
+				   basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval, lbasis_eval,
+				   collocation_screening());
   }
 
   void ReferenceLocalHostWorkDriver::eval_collocation_der3( size_t npts,
@@ -91,12 +137,287 @@ namespace GauXC {
 							     double* d3basis_xxy_eval, double* d3basis_xxz_eval, double* d3basis_xyy_eval,
 							     double* d3basis_xyz_eval, double* d3basis_xzz_eval, double* d3basis_yyy_eval,
 							     double* d3basis_yyz_eval, double* d3basis_yzz_eval, double* d3basis_zzz_eval) {
-    gau2grid_collocation_der3(npts, nshells, nbe, pts, basis, shell_list,
+    auto* coll = use_native_collocation() ? native_collocation_der3 : 
+                                            gau2grid_collocation_der3;
+    coll(npts, nshells, nbe, pts, basis, shell_list,
 				 basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval, d2basis_xx_eval,
 				 d2basis_xy_eval, d2basis_xz_eval, d2basis_yy_eval, d2basis_yz_eval,
 				 d2basis_zz_eval, d3basis_xxx_eval, d3basis_xxy_eval, d3basis_xxz_eval,
 				 d3basis_xyy_eval, d3basis_xyz_eval, d3basis_xzz_eval, d3basis_yyy_eval,
-				 d3basis_yyz_eval, d3basis_yzz_eval, d3basis_zzz_eval);
+				 d3basis_yyz_eval, d3basis_yzz_eval, d3basis_zzz_eval,
+				 collocation_screening());
+  }
+
+
+  namespace {
+
+  /// x**T y with double precision accumulation
+  template <typename F>
+  double dot_acc( size_t n, const F* x, const F* y ) {
+    if constexpr ( std::is_same_v<F,double> ) return blas::dot( n, x, 1, y, 1 );
+    else {
+      double res = 0.;
+      for( size_t i = 0; i < n; ++i ) res += double(x[i]) * double(y[i]);
+      return res;
+    }
+  }
+
+  // U/V variables and Z matrices, templated on the precision of the
+  // collocation / X / Z matrices (float in the mixed precision path).
+  // The U/V variables are always double
+  template <typename F>
+  void uvvar_lda_rks_kernel( size_t npts, size_t nbe, const F* basis_eval,
+    const F* X, size_t ldx, double* den_eval ) {
+
+
+    for( int32_t i = 0; i < (int32_t)npts; ++i ) {
+
+      const size_t ioff = size_t(i) * ldx;
+      const auto*   X_i = X + ioff;
+      den_eval[i] = dot_acc( nbe, basis_eval + ioff, X_i );
+
+    }    
+
+  }
+
+  template <typename F>
+  void uvvar_lda_uks_kernel( size_t npts, size_t nbe, const F* basis_eval,
+    const F* Xs, size_t ldxs, const F* Xz, size_t ldxz, double* den_eval ) {
+  
+    for( int32_t i = 0; i < (int32_t)npts; ++i ) {
+
+      const size_t ioffs = size_t(i) * ldxs;
+      const size_t ioffz = size_t(i) * ldxz;
+
+      const auto*   Xs_i = Xs + ioffs;
+      const auto*   Xz_i = Xz + ioffz;
+
+      const double rhos = dot_acc( nbe, basis_eval + ioffs, Xs_i );
+      const double rhoz = dot_acc( nbe, basis_eval + ioffz, Xz_i );
+      
+      den_eval[2*i]   = 0.5*(rhos + rhoz); // rho_+
+      den_eval[2*i+1] = 0.5*(rhos - rhoz); // rho_-
+
+    }
+ 
+  }
+
+  template <typename F>
+  void uvvar_gga_rks_kernel( size_t npts, size_t nbe, const F* basis_eval,
+    const F* dbasis_x_eval, const F* dbasis_y_eval, const F* dbasis_z_eval,
+    const F* X, size_t ldx, double* den_eval, double* dden_x_eval,
+    double* dden_y_eval, double* dden_z_eval, double* gamma ) {
+
+    for( int32_t i = 0; i < (int32_t)npts; ++i ) {
+
+      const size_t ioff = size_t(i) * ldx;
+      const auto*   X_i = X + ioff;
+
+      den_eval[i] = dot_acc( nbe, basis_eval + ioff, X_i );
+
+      const auto dx = 2. * dot_acc( nbe, dbasis_x_eval + ioff, X_i );
+      const auto dy = 2. * dot_acc( nbe, dbasis_y_eval + ioff, X_i );
+      const auto dz = 2. * dot_acc( nbe, dbasis_z_eval + ioff, X_i );
+
+      dden_x_eval[i] = dx;
+      dden_y_eval[i] = dy;
+      dden_z_eval[i] = dz;
+
+      gamma[i] = dx*dx + dy*dy + dz*dz;
+
+    }
+  }
+
+  template <typename F>
+  void uvvar_gga_uks_kernel( size_t npts, size_t nbe, const F* basis_eval,
+    const F* dbasis_x_eval, const F* dbasis_y_eval, const F* dbasis_z_eval,
+    const F* Xs, size_t ldxs, const F* Xz, size_t ldxz, double* den_eval,
+    double* dden_x_eval, double* dden_y_eval, double* dden_z_eval, double* gamma ) {
+
+   for( int32_t i = 0; i < (int32_t)npts; ++i ) {
+
+      const size_t ioffs = size_t(i) * ldxs;
+      const size_t ioffz = size_t(i) * ldxz;
+
+      const auto*   Xs_i = Xs + ioffs;
+      const auto*   Xz_i = Xz + ioffz;
+
+      double rhos = dot_acc( nbe, basis_eval + ioffs, Xs_i ); // S density
+      double rhoz = dot_acc( nbe, basis_eval + ioffz, Xz_i ); // Z density
+
+
+      den_eval[2*i]   = 0.5*(rhos + rhoz); // rho_+
+      den_eval[2*i+1] = 0.5*(rhos - rhoz); // rho_-
+
+      const auto dndx =
+        2. * dot_acc( nbe, dbasis_x_eval + ioffs, Xs_i );
+      const auto dndy =
+        2. * dot_acc( nbe, dbasis_y_eval + ioffs, Xs_i );
+      const auto dndz =
+        2. * dot_acc( nbe, dbasis_z_eval + ioffs, Xs_i );
+
+      const auto dMzdx =
+        2. * dot_acc( nbe, dbasis_x_eval + ioffz, Xz_i );
+      const auto dMzdy =
+        2. * dot_acc( nbe, dbasis_y_eval + ioffz, Xz_i );
+      const auto dMzdz =
+        2. * dot_acc( nbe, dbasis_z_eval + ioffz, Xz_i );
+
+      dden_x_eval[2*i] = dndx; // dn / dx
+      dden_y_eval[2*i] = dndy; // dn / dy
+      dden_z_eval[2*i] = dndz; // dn / dz
+
+      dden_x_eval[2*i+1] = dMzdx; // dMz / dx
+      dden_y_eval[2*i+1] = dMzdy; // dMz / dy
+      dden_z_eval[2*i+1] = dMzdz; // dMz / dz
+
+      // (del n).(del n)
+      const auto dn_sq  = dndx*dndx + dndy*dndy + dndz*dndz;
+      // (del Mz).(del Mz)
+      const auto dMz_sq = dMzdx*dMzdx + dMzdy*dMzdy + dMzdz*dMzdz;
+      // (del n).(del Mz)
+      const auto dn_dMz = dndx*dMzdx + dndy*dMzdy + dndz*dMzdz;
+
+      gamma[3*i  ] = 0.25*(dn_sq + dMz_sq) + 0.5*dn_dMz;
+      gamma[3*i+1] = 0.25*(dn_sq - dMz_sq);
+      gamma[3*i+2] = 0.25*(dn_sq + dMz_sq) - 0.5*dn_dMz;
+    }
+
+  }
+
+  template <typename F>
+  void zmat_lda_vxc_rks_kernel( size_t npts, size_t nbf, const double* vrho,
+    const F* basis_eval, F* Z, size_t ldz ) {
+
+
+    blas::lacpy( 'A', nbf, npts, basis_eval, nbf, Z, ldz );
+
+    for( int32_t i = 0; i < (int32_t)npts; ++i ) {
+
+      auto* z_col = Z + i*ldz;
+
+      const double fact = 0.5 * vrho[i];
+      GauXC::blas::scal<F>( nbf, fact, z_col, 1 );
+
+    }
+
+  }
+
+  template <typename F>
+  void zmat_lda_vxc_uks_kernel( size_t npts, size_t nbf, const double* vrho,
+    const F* basis_eval, F* Zs, size_t ldzs, F* Zz, size_t ldzz ) {
+
+
+    blas::lacpy( 'A', nbf, npts, basis_eval, nbf, Zs, ldzs);
+    blas::lacpy( 'A', nbf, npts, basis_eval, nbf, Zz, ldzz);
+
+    for( int32_t i = 0; i < (int32_t)npts; ++i ) {
+
+      auto* zs_col = Zs + i*ldzs;
+      auto* zz_col = Zz + i*ldzz;
+
+      const double factp = 0.5 * vrho[2*i];
+      const double factm = 0.5 * vrho[2*i+1];
+
+      //eq. 56 https://doi.org/10.1140/epjb/e2018-90170-1
+      GauXC::blas::scal<F>( nbf, 0.5*(factp + factm), zs_col, 1 );
+      GauXC::blas::scal<F>( nbf, 0.5*(factp - factm), zz_col, 1 );
+
+    }
+ 
+
+  }
+
+  template <typename F>
+  void zmat_gga_vxc_rks_kernel( size_t npts, size_t nbf, const double* vrho,
+    const double* vgamma, const F* basis_eval, const F* dbasis_x_eval,
+    const F* dbasis_y_eval, const F* dbasis_z_eval, const double* dden_x_eval,
+    const double* dden_y_eval, const double* dden_z_eval, F* Z, size_t ldz ) {
+
+    if( ldz != nbf ) GAUXC_GENERIC_EXCEPTION(std::string("Invalid Dims"));
+    blas::lacpy( 'A', nbf, npts, basis_eval, nbf, Z, nbf );
+
+    for( int32_t i = 0; i < (int32_t)npts; ++i ) {
+
+      const int32_t ioff = i * nbf;
+
+      auto* z_col    = Z + ioff;
+      auto* bf_x_col = dbasis_x_eval + ioff; 
+      auto* bf_y_col = dbasis_y_eval + ioff; 
+      auto* bf_z_col = dbasis_z_eval + ioff; 
+
+      const auto lda_fact = 0.5 * vrho[i];
+      blas::scal<F>( nbf, lda_fact, z_col, 1 );
+
+      const auto gga_fact = 2. * vgamma[i]; 
+      const auto x_fact = gga_fact * dden_x_eval[i];
+      const auto y_fact = gga_fact * dden_y_eval[i];
+      const auto z_fact = gga_fact * dden_z_eval[i];
+
+      blas::axpy<F>( nbf, x_fact, bf_x_col, 1, z_col, 1 );
+      blas::axpy<F>( nbf, y_fact, bf_y_col, 1, z_col, 1 );
+      blas::axpy<F>( nbf, z_fact, bf_z_col, 1, z_col, 1 );
+
+    }
+
+  }
+
+  template <typename F>
+  void zmat_gga_vxc_uks_kernel( size_t npts, size_t nbf, const double* vrho,
+    const double* vgamma, const F* basis_eval, const F* dbasis_x_eval,
+    const F* dbasis_y_eval, const F* dbasis_z_eval, const double* dden_x_eval,
+    const double* dden_y_eval, const double* dden_z_eval, F* Zs, size_t ldzs,
+    F* Zz, size_t ldzz ) {
+
+
+    if( ldzs != nbf ) GAUXC_GENERIC_EXCEPTION(std::string("Invalid Dims"));
+    if( ldzz != nbf ) GAUXC_GENERIC_EXCEPTION(std::string("Invalid Dims"));
+    blas::lacpy( 'A', nbf, npts, basis_eval, nbf, Zs, ldzs);
+    blas::lacpy( 'A', nbf, npts, basis_eval, nbf, Zz, ldzz);
+
+    for( int32_t i = 0; i < (int32_t)npts; ++i ) {
+
+      const int32_t ioff = i * nbf;
+
+      auto* zs_col = Zs + ioff;
+      auto* zz_col = Zz + ioff;
+      auto* bf_x_col = dbasis_x_eval + ioff;
+      auto* bf_y_col = dbasis_y_eval + ioff;
+      auto* bf_z_col = dbasis_z_eval + ioff;
+
+      const double factp = 0.5 * vrho[2*i];
+      const double factm = 0.5 * vrho[2*i+1];
+
+      GauXC::blas::scal<F>( nbf, 0.5*(factp + factm), zs_col, 1 ); //additional 0.5 is from eq 56 in petrone 2018 eur phys journal b "an efficent implementation of .. "
+      GauXC::blas::scal<F>( nbf, 0.5*(factp - factm), zz_col, 1 );
+
+      const auto gga_fact_pp = vgamma[3*i];
+      const auto gga_fact_pm = vgamma[3*i+1];
+      const auto gga_fact_mm = vgamma[3*i+2];
+
+      const auto gga_fact_1 = 0.5*(gga_fact_pp + gga_fact_pm + gga_fact_mm);
+      const auto gga_fact_2 = 0.5*(gga_fact_pp - gga_fact_mm);
+      const auto gga_fact_3 = 0.5*(gga_fact_pp - gga_fact_pm + gga_fact_mm);
+
+      const auto x_fact_s = gga_fact_1 * dden_x_eval[2*i] + gga_fact_2 * dden_x_eval[2*i+1];
+      const auto y_fact_s = gga_fact_1 * dden_y_eval[2*i] + gga_fact_2 * dden_y_eval[2*i+1];
+      const auto z_fact_s = gga_fact_1 * dden_z_eval[2*i] + gga_fact_2 * dden_z_eval[2*i+1];
+
+      const auto x_fact_z = gga_fact_3 * dden_x_eval[2*i+1] + gga_fact_2 * dden_x_eval[2*i];
+      const auto y_fact_z = gga_fact_3 * dden_y_eval[2*i+1] + gga_fact_2 * dden_y_eval[2*i];
+      const auto z_fact_z = gga_fact_3 * dden_z_eval[2*i+1] + gga_fact_2 * dden_z_eval[2*i];
+      
+      blas::axpy<F>( nbf, x_fact_s, bf_x_col, 1, zs_col, 1 );
+      blas::axpy<F>( nbf, y_fact_s, bf_y_col, 1, zs_col, 1 );
+      blas::axpy<F>( nbf, z_fact_s, bf_z_col, 1, zs_col, 1 );
+
+      blas::axpy<F>( nbf, x_fact_z, bf_x_col, 1, zz_col, 1 );
+      blas::axpy<F>( nbf, y_fact_z, bf_y_col, 1, zz_col, 1 );
+      blas::axpy<F>( nbf, z_fact_z, bf_z_col, 1, zz_col, 1 );
+
+    }
+  }
+
   }
 
 
@@ -125,14 +446,7 @@ namespace GauXC {
   void ReferenceLocalHostWorkDriver::eval_uvvar_lda_rks( size_t npts, size_t nbe, 
 						     const double* basis_eval, const double* X, size_t ldx, double* den_eval) {
 
-
-    for( int32_t i = 0; i < (int32_t)npts; ++i ) {
-
-      const size_t ioff = size_t(i) * ldx;
-      const auto*   X_i = X + ioff;
-      den_eval[i] = blas::dot( nbe, basis_eval + ioff, 1, X_i, 1 );
-
-    }    
+    uvvar_lda_rks_kernel( npts, nbe, basis_eval, X, ldx, den_eval );
 
   }
 
@@ -140,23 +454,9 @@ namespace GauXC {
   void ReferenceLocalHostWorkDriver::eval_uvvar_lda_uks( size_t npts, size_t nbe,
    const double* basis_eval, const double* Xs, size_t ldxs, 
    const double* Xz, size_t ldxz, double* den_eval) {
-  
-    for( int32_t i = 0; i < (int32_t)npts; ++i ) {
-
-      const size_t ioffs = size_t(i) * ldxs;
-      const size_t ioffz = size_t(i) * ldxz;
 
-      const auto*   Xs_i = Xs + ioffs;
-      const auto*   Xz_i = Xz + ioffz;
+    uvvar_lda_uks_kernel( npts, nbe, basis_eval, Xs, ldxs, Xz, ldxz, den_eval );
 
-      const double rhos = blas::dot( nbe, basis_eval + ioffs, 1, Xs_i, 1 );
-      const double rhoz = blas::dot( nbe, basis_eval + ioffz, 1, Xz_i, 1 );
-      
-      den_eval[2*i]   = 0.5*(rhos + rhoz); // rho_+
-      den_eval[2*i+1] = 0.5*(rhos - rhoz); // rho_-
-
-    }
- 
   }
   
   void ReferenceLocalHostWorkDriver::eval_uvvar_lda_gks( size_t npts, size_t nbe, const double* basis_eval,
@@ -207,90 +507,30 @@ namespace GauXC {
 
     }
 
-  }
-
-
-  void ReferenceLocalHostWorkDriver::eval_uvvar_gga_rks( size_t npts, size_t nbe, 
-						     const double* basis_eval, const double* dbasis_x_eval, 
-						     const double *dbasis_y_eval, const double* dbasis_z_eval, const double* X, 
-						     size_t ldx, double* den_eval, double* dden_x_eval, double* dden_y_eval, 
-						     double* dden_z_eval, double* gamma ) {
-
-    for( int32_t i = 0; i < (int32_t)npts; ++i ) {
-
-      const size_t ioff = size_t(i) * ldx;
-      const auto*   X_i = X + ioff;
-
-      den_eval[i] = blas::dot( nbe, basis_eval + ioff, 1, X_i, 1 );
-
-      const auto dx = 2. * blas::dot( nbe, dbasis_x_eval + ioff, 1, X_i, 1 );
-      const auto dy = 2. * blas::dot( nbe, dbasis_y_eval + ioff, 1, X_i, 1 );
-      const auto dz = 2. * blas::dot( nbe, dbasis_z_eval + ioff, 1, X_i, 1 );
-
-      dden_x_eval[i] = dx;
-      dden_y_eval[i] = dy;
-      dden_z_eval[i] = dz;
-
-      gamma[i] = dx*dx + dy*dy + dz*dz;
-
-    }
-  }
-
-void ReferenceLocalHostWorkDriver::eval_uvvar_gga_uks( size_t npts, size_t nbe,
-  const double* basis_eval, const double* dbasis_x_eval,
-  const double *dbasis_y_eval, const double* dbasis_z_eval, const double* Xs,
-  size_t ldxs, const double* Xz, size_t ldxz, 
-  double* den_eval, double* dden_x_eval, double* dden_y_eval,
-  double* dden_z_eval, double* gamma ) {
-
-   for( int32_t i = 0; i < (int32_t)npts; ++i ) {
-
-      const size_t ioffs = size_t(i) * ldxs;
-      const size_t ioffz = size_t(i) * ldxz;
-
-      const auto*   Xs_i = Xs + ioffs;
-      const auto*   Xz_i = Xz + ioffz;
-
-      double rhos = blas::dot( nbe, basis_eval + ioffs, 1, Xs_i, 1 ); // S density
-      double rhoz = blas::dot( nbe, basis_eval + ioffz, 1, Xz_i, 1 ); // Z density
-
-
-      den_eval[2*i]   = 0.5*(rhos + rhoz); // rho_+
-      den_eval[2*i+1] = 0.5*(rhos - rhoz); // rho_-
-
-      const auto dndx =
-        2. * blas::dot( nbe, dbasis_x_eval + ioffs, 1, Xs_i, 1 );
-      const auto dndy =
-        2. * blas::dot( nbe, dbasis_y_eval + ioffs, 1, Xs_i, 1 );
-      const auto dndz =
-        2. * blas::dot( nbe, dbasis_z_eval + ioffs, 1, Xs_i, 1 );
-
-      const auto dMzdx =
-        2. * blas::dot( nbe, dbasis_x_eval + ioffz, 1, Xz_i, 1 );
-      const auto dMzdy =
-        2. * blas::dot( nbe, dbasis_y_eval + ioffz, 1, Xz_i, 1 );
-      const auto dMzdz =
-        2. * blas::dot( nbe, dbasis_z_eval + ioffz, 1, Xz_i, 1 );
+  }
 
-      dden_x_eval[2*i] = dndx; // dn / dx
-      dden_y_eval[2*i] = dndy; // dn / dy
-      dden_z_eval[2*i] = dndz; // dn / dz
 
-      dden_x_eval[2*i+1] = dMzdx; // dMz / dx
-      dden_y_eval[2*i+1] = dMzdy; // dMz / dy
-      dden_z_eval[2*i+1] = dMzdz; // dMz / dz
+  void ReferenceLocalHostWorkDriver::eval_uvvar_gga_rks( size_t npts, size_t nbe, 
+						     const double* basis_eval, const double* dbasis_x_eval, 
+						     const double *dbasis_y_eval, const double* dbasis_z_eval, const double* X, 
+						     size_t ldx, double* den_eval, double* dden_x_eval, double* dden_y_eval, 
+						     double* dden_z_eval, double* gamma ) {
 
-      // (del n).(del n)
-      const auto dn_sq  = dndx*dndx + dndy*dndy + dndz*dndz;
-      // (del Mz).(del Mz)
-      const auto dMz_sq = dMzdx*dMzdx + dMzdy*dMzdy + dMzdz*dMzdz;
-      // (del n).(del Mz)
-      const auto dn_dMz = dndx*dMzdx + dndy*dMzdy + dndz*dMzdz;
+    uvvar_gga_rks_kernel( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+      dbasis_z_eval, X, ldx, den_eval, dden_x_eval, dden_y_eval, dden_z_eval, gamma );
 
-      gamma[3*i  ] = 0.25*(dn_sq + dMz_sq) + 0.5*dn_dMz;
-      gamma[3*i+1] = 0.25*(dn_sq - dMz_sq);
-      gamma[3*i+2] = 0.25*(dn_sq + dMz_sq) - 0.5*dn_dMz;
-    }
+  }
+
+void ReferenceLocalHostWorkDriver::eval_uvvar_gga_uks( size_t npts, size_t nbe,
+  const double* basis_eval, const double* dbasis_x_eval,
+  const double *dbasis_y_eval, const double* dbasis_z_eval, const double* Xs,
+  size_t ldxs, const double* Xz, size_t ldxz, 
+  double* den_eval, double* dden_x_eval, double* dden_y_eval,
+  double* dden_z_eval, double* gamma ) {
+
+    uvvar_gga_uks_kernel( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+      dbasis_z_eval, Xs, ldxs, Xz, ldxz, den_eval, dden_x_eval, dden_y_eval,
+      dden_z_eval, gamma );
 
 }
 
@@ -547,17 +787,7 @@ void ReferenceLocalHostWorkDriver::eval_uvvar_gga_gks( size_t npts, size_t nbe,
   void ReferenceLocalHostWorkDriver::eval_zmat_lda_vxc_rks( size_t npts, size_t nbf, 
 							const double* vrho, const double* basis_eval, double* Z, size_t ldz ) {
 
-
-    blas::lacpy( 'A', nbf, npts, basis_eval, nbf, Z, ldz );
-
-    for( int32_t i = 0; i < (int32_t)npts; ++i ) {
-
-      auto* z_col = Z + i*ldz;
-
-      const double fact = 0.5 * vrho[i];
-      GauXC::blas::scal( nbf, fact, z_col, 1 );
-
-    }
+    zmat_lda_vxc_rks_kernel( npts, nbf, vrho, basis_eval, Z, ldz );
 
   }
 
@@ -566,24 +796,7 @@ void ReferenceLocalHostWorkDriver::eval_uvvar_gga_gks( size_t npts, size_t nbe,
               const double* vrho, const double* basis_eval, double* Zs, size_t ldzs,
               double* Zz, size_t ldzz ) {
 
-
-    blas::lacpy( 'A', nbf, npts, basis_eval, nbf, Zs, ldzs);
-    blas::lacpy( 'A', nbf, npts, basis_eval, nbf, Zz, ldzz);
-
-    for( int32_t i = 0; i < (int32_t)npts; ++i ) {
-
-      auto* zs_col = Zs + i*ldzs;
-      auto* zz_col = Zz + i*ldzz;
-
-      const double factp = 0.5 * vrho[2*i];
-      const double factm = 0.5 * vrho[2*i+1];
-
-      //eq. 56 https://doi.org/10.1140/epjb/e2018-90170-1
-      GauXC::blas::scal( nbf, 0.5*(factp + factm), zs_col, 1 );
-      GauXC::blas::scal( nbf, 0.5*(factp - factm), zz_col, 1 );
-
-    }
- 
+    zmat_lda_vxc_uks_kernel( npts, nbf, vrho, basis_eval, Zs, ldzs, Zz, ldzz );
 
   }
 
@@ -628,31 +841,8 @@ void ReferenceLocalHostWorkDriver::eval_zmat_lda_vxc_gks( size_t npts, size_t nb
 							const double* dbasis_z_eval, const double* dden_x_eval, 
 							const double* dden_y_eval, const double* dden_z_eval, double* Z, size_t ldz ) {
 
-    if( ldz != nbf ) GAUXC_GENERIC_EXCEPTION(std::string("Invalid Dims"));
-    blas::lacpy( 'A', nbf, npts, basis_eval, nbf, Z, nbf );
-
-    for( int32_t i = 0; i < (int32_t)npts; ++i ) {
-
-      const int32_t ioff = i * nbf;
-
-      auto* z_col    = Z + ioff;
-      auto* bf_x_col = dbasis_x_eval + ioff; 
-      auto* bf_y_col = dbasis_y_eval + ioff; 
-      auto* bf_z_col = dbasis_z_eval + ioff; 
-
-      const auto lda_fact = 0.5 * vrho[i];
-      blas::scal( nbf, lda_fact, z_col, 1 );
-
-      const auto gga_fact = 2. * vgamma[i]; 
-      const auto x_fact = gga_fact * dden_x_eval[i];
-      const auto y_fact = gga_fact * dden_y_eval[i];
-      const auto z_fact = gga_fact * dden_z_eval[i];
-
-      blas::axpy( nbf, x_fact, bf_x_col, 1, z_col, 1 );
-      blas::axpy( nbf, y_fact, bf_y_col, 1, z_col, 1 );
-      blas::axpy( nbf, z_fact, bf_z_col, 1, z_col, 1 );
-
-    }
+    zmat_gga_vxc_rks_kernel( npts, nbf, vrho, vgamma, basis_eval, dbasis_x_eval,
+      dbasis_y_eval, dbasis_z_eval, dden_x_eval, dden_y_eval, dden_z_eval, Z, ldz );
 
   }
 
@@ -663,53 +853,10 @@ void ReferenceLocalHostWorkDriver::eval_zmat_lda_vxc_gks( size_t npts, size_t nb
               const double* dden_y_eval, const double* dden_z_eval, double* Zs, 
               size_t ldzs, double* Zz, size_t ldzz ) {
 
+    zmat_gga_vxc_uks_kernel( npts, nbf, vrho, vgamma, basis_eval, dbasis_x_eval,
+      dbasis_y_eval, dbasis_z_eval, dden_x_eval, dden_y_eval, dden_z_eval, Zs, ldzs,
+      Zz, ldzz );
 
-    if( ldzs != nbf ) GAUXC_GENERIC_EXCEPTION(std::string("Invalid Dims"));
-    if( ldzz != nbf ) GAUXC_GENERIC_EXCEPTION(std::string("Invalid Dims"));
-    blas::lacpy( 'A', nbf, npts, basis_eval, nbf, Zs, ldzs);
-    blas::lacpy( 'A', nbf, npts, basis_eval, nbf, Zz, ldzz);
-
-    for( int32_t i = 0; i < (int32_t)npts; ++i ) {
-
-      const int32_t ioff = i * nbf;
-
-      auto* zs_col = Zs + ioff;
-      auto* zz_col = Zz + ioff;
-      auto* bf_x_col = dbasis_x_eval + ioff;
-      auto* bf_y_col = dbasis_y_eval + ioff;
-      auto* bf_z_col = dbasis_z_eval + ioff;
-
-      const double factp = 0.5 * vrho[2*i];
-      const double factm = 0.5 * vrho[2*i+1];
-
-      GauXC::blas::scal( nbf, 0.5*(factp + factm), zs_col, 1 ); //additional 0.5 is from eq 56 in petrone 2018 eur phys journal b "an efficent implementation of .. "
-      GauXC::blas::scal( nbf, 0.5*(factp - factm), zz_col, 1 );
-
-      const auto gga_fact_pp = vgamma[3*i];
-      const auto gga_fact_pm = vgamma[3*i+1];
-      const auto gga_fact_mm = vgamma[3*i+2];
-
-      const auto gga_fact_1 = 0.5*(gga_fact_pp + gga_fact_pm + gga_fact_mm);
-      const auto gga_fact_2 = 0.5*(gga_fact_pp - gga_fact_mm);
-      const auto gga_fact_3 = 0.5*(gga_fact_pp - gga_fact_pm + gga_fact_mm);
-
-      const auto x_fact_s = gga_fact_1 * dden_x_eval[2*i] + gga_fact_2 * dden_x_eval[2*i+1];
-      const auto y_fact_s = gga_fact_1 * dden_y_eval[2*i] + gga_fact_2 * dden_y_eval[2*i+1];
-      const auto z_fact_s = gga_fact_1 * dden_z_eval[2*i] + gga_fact_2 * dden_z_eval[2*i+1];
-
-      const auto x_fact_z = gga_fact_3 * dden_x_eval[2*i+1] + gga_fact_2 * dden_x_eval[2*i];
-      const auto y_fact_z = gga_fact_3 * dden_y_eval[2*i+1] + gga_fact_2 * dden_y_eval[2*i];
-      const auto z_fact_z = gga_fact_3 * dden_z_eval[2*i+1] + gga_fact_2 * dden_z_eval[2*i];
-      
-      blas::axpy( nbf, x_fact_s, bf_x_col, 1, zs_col, 1 );
-      blas::axpy( nbf, y_fact_s, bf_y_col, 1, zs_col, 1 );
-      blas::axpy( nbf, z_fact_s, bf_z_col, 1, zs_col, 1 );
-
-      blas::axpy( nbf, x_fact_z, bf_x_col, 1, zz_col, 1 );
-      blas::axpy( nbf, y_fact_z, bf_y_col, 1, zz_col, 1 );
-      blas::axpy( nbf, z_fact_z, bf_z_col, 1, zz_col, 1 );
-
-    }
   }
 
   // Eval Z Matrix MGGA VXC
@@ -1028,6 +1175,170 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
 
 }
 
+
+void ReferenceLocalHostWorkDriver::eval_uvvar_mgga_gks( size_t npts, size_t nbe,
+  const double* basis_eval, const double* dbasis_x_eval,
+  const double *dbasis_y_eval, const double* dbasis_z_eval, const double* lbasis_eval,
+  const double* Xs, size_t ldxs, const double* Xz, size_t ldxz,
+  const double* Xx, size_t ldxx, const double* Xy, size_t ldxy,
+  const double* mmat_xs, const double* mmat_ys, const double* mmat_zs, size_t ldms,
+  const double* mmat_xz, const double* mmat_yz, const double* mmat_zz, size_t ldmz,
+  const double* mmat_xx, const double* mmat_yx, const double* mmat_zx, size_t ldmx,
+  const double* mmat_xy, const double* mmat_yy, const double* mmat_zy, size_t ldmy,
+  double* den_eval, double* dden_x_eval, double* dden_y_eval,
+  double* dden_z_eval, double* gamma, double* tau, double* lapl, double* K,
+  double* H, const double dtol ) {
+
+   // Density, gradient and magnetization direction (K/H) as in GGA
+   eval_uvvar_gga_gks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+     dbasis_z_eval, Xs, ldxs, Xz, ldxz, Xx, ldxx, Xy, ldxy, den_eval,
+     dden_x_eval, dden_y_eval, dden_z_eval, gamma, K, H, dtol );
+
+   const auto *KZ = K;
+   const auto *KY = KZ + npts;
+   const auto *KX = KY + npts;
+
+   auto eval_tau = [&]( size_t ioff, const double* mx, const double* my, 
+     const double* mz ) {
+     auto t  = 0.5*blas::dot( nbe, dbasis_x_eval + ioff, 1, mx + ioff, 1);
+          t += 0.5*blas::dot( nbe, dbasis_y_eval + ioff, 1, my + ioff, 1);
+          t += 0.5*blas::dot( nbe, dbasis_z_eval + ioff, 1, mz + ioff, 1);
+     return t;
+   };
+
+   for( int32_t i = 0; i < (int32_t)npts; ++i ) {
+
+      const size_t ioffs = size_t(i) * ldxs;
+      const size_t ioffz = size_t(i) * ldxz;
+      const size_t ioffx = size_t(i) * ldxx;
+      const size_t ioffy = size_t(i) * ldxy;
+
+      const auto taus = eval_tau( size_t(i) * ldms, mmat_xs, mmat_ys, mmat_zs );
+      const auto tauz = eval_tau( size_t(i) * ldmz, mmat_xz, mmat_yz, mmat_zz );
+      const auto taux = eval_tau( size_t(i) * ldmx, mmat_xx, mmat_yx, mmat_zx );
+      const auto tauy = eval_tau( size_t(i) * ldmy, mmat_xy, mmat_yy, mmat_zy );
+
+      // Project the kinetic magnetization onto the local spin axis
+      const auto taum = KZ[i]*tauz + KY[i]*tauy + KX[i]*taux;
+
+      tau[2*i]   = 0.5*(taus + taum);
+      tau[2*i+1] = 0.5*(taus - taum);
+
+      if (lapl != nullptr) {
+        auto lapls = 2. * blas::dot( nbe, lbasis_eval + ioffs, 1, Xs + ioffs, 1) + 4. * taus;
+        auto laplz = 2. * blas::dot( nbe, lbasis_eval + ioffz, 1, Xz + ioffz, 1) + 4. * tauz;
+        auto laplx = 2. * blas::dot( nbe, lbasis_eval + ioffx, 1, Xx + ioffx, 1) + 4. * taux;
+        auto laply = 2. * blas::dot( nbe, lbasis_eval + ioffy, 1, Xy + ioffy, 1) + 4. * tauy;
+        const auto laplm = KZ[i]*laplz + KY[i]*laply + KX[i]*laplx;
+
+        lapl[2*i]   = 0.5*(lapls + laplm);
+        lapl[2*i+1] = 0.5*(lapls - laplm);
+      }
+
+   }
+}
+
+void ReferenceLocalHostWorkDriver::eval_zmat_mgga_vxc_gks( size_t npts, size_t nbf,
+    const double* vrho, const double* vgamma, const double* vlapl,
+    const double* basis_eval, const double* dbasis_x_eval,
+    const double* dbasis_y_eval, const double* dbasis_z_eval, const double* lbasis_eval,
+    const double* dden_x_eval, const double* dden_y_eval, const double* dden_z_eval,
+    double* Zs, size_t ldzs, double* Zz, size_t ldzz, double* Zx, size_t ldzx,
+    double* Zy, size_t ldzy, double* K, double* H ) {
+
+    eval_zmat_gga_vxc_gks( npts, nbf, vrho, vgamma, basis_eval, dbasis_x_eval,
+      dbasis_y_eval, dbasis_z_eval, dden_x_eval, dden_y_eval, dden_z_eval,
+      Zs, ldzs, Zz, ldzz, Zx, ldzx, Zy, ldzy, K, H );
+
+    if( vlapl == nullptr ) return;
+
+    const auto *KZ = K;
+    const auto *KY = KZ + npts;
+    const auto *KX = KY + npts;
+
+    for( int32_t i = 0; i < (int32_t)npts; ++i ) {
+
+      const int32_t ioff = i * nbf;
+      auto* lbf_col = lbasis_eval + ioff;
+
+      const auto lfactp = vlapl[2*i];
+      const auto lfactm = vlapl[2*i+1];
+      const auto lfacts = 0.5*(lfactp + lfactm);
+      const auto lfactz = 0.5*(lfactp - lfactm);
+
+      blas::axpy( nbf, lfacts,       lbf_col, 1, Zs + ioff, 1);
+      blas::axpy( nbf, KZ[i]*lfactz, lbf_col, 1, Zz + ioff, 1);
+      blas::axpy( nbf, KX[i]*lfactz, lbf_col, 1, Zx + ioff, 1);
+      blas::axpy( nbf, KY[i]*lfactz, lbf_col, 1, Zy + ioff, 1);
+
+    }
+
+}
+
+void ReferenceLocalHostWorkDriver::eval_mmat_mgga_vxc_gks(size_t npts, size_t nbf, 
+              const double* vtau, const double* vlapl, 
+              const double* dbasis_x_eval, const double* dbasis_y_eval, 
+              const double* dbasis_z_eval,
+              double* mmat_xs, double* mmat_ys, double* mmat_zs, size_t ldms,
+              double* mmat_xz, double* mmat_yz, double* mmat_zz, size_t ldmz,
+              double* mmat_xx, double* mmat_yx, double* mmat_zx, size_t ldmx,
+              double* mmat_xy, double* mmat_yy, double* mmat_zy, size_t ldmy,
+              double* K ) {
+
+    if( ldms != nbf ) GAUXC_GENERIC_EXCEPTION(std::string("Invalid Dims"));
+    if( ldmz != nbf ) GAUXC_GENERIC_EXCEPTION(std::string("Invalid Dims"));
+    if( ldmx != nbf ) GAUXC_GENERIC_EXCEPTION(std::string("Invalid Dims"));
+    if( ldmy != nbf ) GAUXC_GENERIC_EXCEPTION(std::string("Invalid Dims"));
+
+    const auto *KZ = K;
+    const auto *KY = KZ + npts;
+    const auto *KX = KY + npts;
+
+    // Scalar and magnetization (z,x,y) M matrices, in that order
+    double* mmat[4][3] = { 
+      { mmat_xs, mmat_ys, mmat_zs }, { mmat_xz, mmat_yz, mmat_zz },
+      { mmat_xx, mmat_yx, mmat_zx }, { mmat_xy, mmat_yy, mmat_zy } 
+    };
+    const double* dbasis[3] = { dbasis_x_eval, dbasis_y_eval, dbasis_z_eval };
+
+    for( int c = 0; c < 4; ++c )
+    for( int d = 0; d < 3; ++d )
+      blas::lacpy( 'A', nbf, npts, dbasis[d], nbf, mmat[c][d], nbf );
+
+    for( int32_t i = 0; i < (int32_t)npts; ++i ) {
+
+      const int32_t ioff = i * nbf;
+
+      const auto tfactp = 0.25 * vtau[2*i];
+      const auto tfactm = 0.25 * vtau[2*i+1];
+      const auto tfacts = 0.5*(tfactp + tfactm);
+      const auto tfactz = 0.5*(tfactp - tfactm);
+      const double tfact[4] = 
+        { tfacts, KZ[i]*tfactz, KX[i]*tfactz, KY[i]*tfactz };
+
+      double lfact[4] = { 0., 0., 0., 0. };
+      if ( vlapl != nullptr ) {
+        const auto lfactp = vlapl[2*i];
+        const auto lfactm = vlapl[2*i+1];
+        const auto lfacts = 0.5*(lfactp + lfactm);
+        const auto lfactz = 0.5*(lfactp - lfactm);
+        lfact[0] = lfacts;
+        lfact[1] = KZ[i]*lfactz;
+        lfact[2] = KX[i]*lfactz;
+        lfact[3] = KY[i]*lfactz;
+      }
+
+      for( int c = 0; c < 4; ++c )
+      for( int d = 0; d < 3; ++d ) {
+        auto* col = mmat[c][d] + ioff;
+        blas::scal( nbf, tfact[c], col, 1 );
+        if( vlapl != nullptr ) 
+          blas::axpy( nbf, lfact[c], dbasis[d] + ioff, 1, col, 1 );
+      }
+
+    }
+  }
+
   // Increment VXC by Z
   void ReferenceLocalHostWorkDriver::inc_vxc( size_t npts, size_t nbf, size_t nbe, 
 					      const double* basis_eval, const submat_map_t& submat_map, const double* Z,
@@ -1039,17 +1350,104 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
 
   }
 
+
+  // Mixed precision: float32 collocation / X / Z, double U/V variables and VXC
+
+  void ReferenceLocalHostWorkDriver::eval_xmat( size_t npts, size_t nbf, size_t nbe, 
+    const submat_map_t& submat_map, double fac, const double* P, size_t ldp, 
+    const float* basis_eval, size_t ldb, float* X, size_t ldx, float* scr ) {
+
+    // P is always packed (and rounded) into scr
+    detail::submat_set( nbf, nbf, nbe, nbe, P, ldp, scr, nbe, submat_map );
+    blas::gemm( 'N', 'N', nbe, npts, nbe, float(fac), scr, nbe, basis_eval, ldb, 
+		0.f, X, ldx );
+
+  }
+
+  void ReferenceLocalHostWorkDriver::eval_uvvar_lda_rks( size_t npts, size_t nbe, 
+    const float* basis_eval, const float* X, size_t ldx, double* den_eval) {
+    uvvar_lda_rks_kernel( npts, nbe, basis_eval, X, ldx, den_eval );
+  }
+
+  void ReferenceLocalHostWorkDriver::eval_uvvar_lda_uks( size_t npts, size_t nbe,
+    const float* basis_eval, const float* Xs, size_t ldxs, const float* Xz, 
+    size_t ldxz, double* den_eval) {
+    uvvar_lda_uks_kernel( npts, nbe, basis_eval, Xs, ldxs, Xz, ldxz, den_eval );
+  }
+
+  void ReferenceLocalHostWorkDriver::eval_uvvar_gga_rks( size_t npts, size_t nbe, 
+    const float* basis_eval, const float* dbasis_x_eval, const float *dbasis_y_eval, 
+    const float* dbasis_z_eval, const float* X, size_t ldx, double* den_eval, 
+    double* dden_x_eval, double* dden_y_eval, double* dden_z_eval, double* gamma ) {
+    uvvar_gga_rks_kernel( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+      dbasis_z_eval, X, ldx, den_eval, dden_x_eval, dden_y_eval, dden_z_eval, gamma );
+  }
+
+  void ReferenceLocalHostWorkDriver::eval_uvvar_gga_uks( size_t npts, size_t nbe,
+    const float* basis_eval, const float* dbasis_x_eval, const float *dbasis_y_eval, 
+    const float* dbasis_z_eval, const float* Xs, size_t ldxs, const float* Xz, 
+    size_t ldxz, double* den_eval, double* dden_x_eval, double* dden_y_eval,
+    double* dden_z_eval, double* gamma ) {
+    uvvar_gga_uks_kernel( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+      dbasis_z_eval, Xs, ldxs, Xz, ldxz, den_eval, dden_x_eval, dden_y_eval,
+      dden_z_eval, gamma );
+  }
+
+  void ReferenceLocalHostWorkDriver::eval_zmat_lda_vxc_rks( size_t npts, size_t nbf, 
+    const double* vrho, const float* basis_eval, float* Z, size_t ldz ) {
+    zmat_lda_vxc_rks_kernel( npts, nbf, vrho, basis_eval, Z, ldz );
+  }
+
+  void ReferenceLocalHostWorkDriver::eval_zmat_lda_vxc_uks( size_t npts, size_t nbf,
+    const double* vrho, const float* basis_eval, float* Zs, size_t ldzs,
+    float* Zz, size_t ldzz ) {
+    zmat_lda_vxc_uks_kernel( npts, nbf, vrho, basis_eval, Zs, ldzs, Zz, ldzz );
+  }
+
+  void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_rks( size_t npts, size_t nbf, 
+    const double* vrho, const double* vgamma, const float* basis_eval, 
+    const float* dbasis_x_eval, const float* dbasis_y_eval, 
+    const float* dbasis_z_eval, const double* dden_x_eval, 
+    const double* dden_y_eval, const double* dden_z_eval, float* Z, size_t ldz ) {
+    zmat_gga_vxc_rks_kernel( npts, nbf, vrho, vgamma, basis_eval, dbasis_x_eval,
+      dbasis_y_eval, dbasis_z_eval, dden_x_eval, dden_y_eval, dden_z_eval, Z, ldz );
+  }
+
+  void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_uks( size_t npts, size_t nbf,
+    const double* vrho, const double* vgamma, const float* basis_eval,
+    const float* dbasis_x_eval, const float* dbasis_y_eval,
+    const float* dbasis_z_eval, const double* dden_x_eval,
+    const double* dden_y_eval, const double* dden_z_eval, float* Zs, 
+    size_t ldzs, float* Zz, size_t ldzz ) {
+    zmat_gga_vxc_uks_kernel( npts, nbf, vrho, vgamma, basis_eval, dbasis_x_eval,
+      dbasis_y_eval, dbasis_z_eval, dden_x_eval, dden_y_eval, dden_z_eval, Zs, ldzs,
+      Zz, ldzz );
+  }
+
+  // VXC is accumulated in double
+  void ReferenceLocalHostWorkDriver::inc_vxc( size_t npts, size_t nbf, size_t nbe, 
+    const float* basis_eval, const submat_map_t& submat_map, const float* Z,
+    size_t ldz, double* VXC, size_t ldvxc, float* scr ) {
+
+      blas::syr2k('L', 'N', nbe, npts, 1.f, basis_eval, nbe, Z, ldz, 0.f, scr, nbe );
+
+      detail::inc_by_submat_atomic( nbf, nbf, nbe, nbe, VXC, ldvxc, scr, nbe, submat_map );
+
+  }
+
   // Increment K by G
   void ReferenceLocalHostWorkDriver::inc_exx_k( size_t npts, size_t nbf, 
 						size_t nbe_bra, size_t nbe_ket, const double* basis_eval, 
 						const submat_map_t& submat_map_bra, const submat_map_t& submat_map_ket, 
-						const double* G, size_t ldg, double* K, size_t ldk, double* scr ) {
+						size_t nmat, const double* G, size_t ldg, double* K, size_t ldk, double* scr ) {
 
-      blas::gemm( 'N', 'T', nbe_bra, nbe_ket, npts, 1., basis_eval, nbe_bra,
+      // B * [G_0 ... G_(nmat-1)]**T in a single GEMM
+      blas::gemm( 'N', 'T', nbe_bra, nmat*nbe_ket, npts, 1., basis_eval, nbe_bra,
 		  G, ldg, 0., scr, nbe_bra );
 
-      detail::inc_by_submat_atomic( nbf, nbf, nbe_bra, nbe_ket, K, ldk, scr, nbe_bra, 
-			     submat_map_bra, submat_map_ket );
+      for( size_t imat = 0; imat < nmat; ++imat )
+      detail::inc_by_submat_atomic( nbf, nbf, nbe_bra, nbe_ket, K + imat*ldk*nbf, ldk, 
+			     scr + imat*nbe_bra*nbe_ket, nbe_bra, submat_map_bra, submat_map_ket );
 
   }
 
@@ -1057,14 +1455,21 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
   // Construct F = P * B (P non-square, TODO: should merge with XMAT)
   void ReferenceLocalHostWorkDriver::eval_exx_fmat( size_t npts, size_t nbf, 
 						    size_t nbe_bra, size_t nbe_ket, const submat_map_t& submat_map_bra,
-						    const submat_map_t& submat_map_ket, const double* P, size_t ldp,
-						    const double* basis_eval, size_t ldb, double* F, size_t ldf,
+						    const submat_map_t& submat_map_ket, size_t nmat, const double* P, 
+						    size_t ldp, const double* basis_eval, size_t ldb, double* F, size_t ldf,
 						    double* scr ) {
 
     const auto* P_use = P;
     size_t ldp_use = ldp;
 
-    if( submat_map_bra.size() > 1 or submat_map_ket.size() > 1 ) {
+    if( nmat > 1 ) {
+      // Stack the P submatrices to form all F in a single GEMM
+      for( size_t imat = 0; imat < nmat; ++imat )
+        detail::submat_set( nbf, nbf, nbe_bra, nbe_ket, P + imat*ldp*nbf, ldp,
+			    scr + imat*nbe_bra, nmat*nbe_bra, submat_map_bra, submat_map_ket );
+      P_use = scr;
+      ldp_use = nmat*nbe_bra;
+    } else if( submat_map_bra.size() > 1 or submat_map_ket.size() > 1 ) {
       detail::submat_set( nbf, nbf, nbe_bra, nbe_ket, P, ldp,
 			  scr, nbe_bra, submat_map_bra, submat_map_ket );
       P_use = scr;
@@ -1073,7 +1478,7 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
       P_use = P + submat_map_ket[0][0]*ldp + submat_map_bra[0][0];
     }
 
-    blas::gemm( 'N', 'N', nbe_bra, npts, nbe_ket, 1., P_use, ldp_use, basis_eval,
+    blas::gemm( 'N', 'N', nmat*nbe_bra, npts, nbe_ket, 1., P_use, ldp_use, basis_eval,
 		ldb, 0., F, ldf );
 
   }
@@ -1083,26 +1488,20 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
     size_t nshell_pairs, size_t nbe, const double* points, const double* weights, 
     const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
     const BasisSetMap& basis_map, const int32_t* shell_list, 
-    const std::pair<int32_t,int32_t>* shell_pair_list, 
-    const double* X, size_t ldx, double* G, size_t ldg ) {
+    const std::pair<int32_t,int32_t>* shell_pair_list, size_t nmat,
+    const double* X, size_t ldx, double* G, size_t ldg, 
+    const exx_operator& op ) {
 
     util::unused(basis_map);
 
-    // Cast points to Rys format (binary compatable)
-    XCPU::point* _points = 
-      reinterpret_cast<XCPU::point*>(const_cast<double*>(points));
-    std::vector<double> _points_transposed(3 * npts);
-
-    for(size_t i = 0; i < npts; ++i) {
-      _points_transposed[i + 0 * npts] = _points[i].x;
-      _points_transposed[i + 1 * npts] = _points[i].y;
-      _points_transposed[i + 2 * npts] = _points[i].z;
-    }
+    // Points are already stored SoA (x(npts), y(npts), z(npts)), which is
+    // the layout expected by the Obara-Saika kernels
+    double* _points_soa = const_cast<double*>(points);
 
   
     // Set G to zero
     for( size_t j = 0; j < npts; ++j )
-    for( size_t i = 0; i < nbe;  ++i ) {
+    for( size_t i = 0; i < nmat*nbe;  ++i ) {
 	    G[i + j*ldg] = 0.;
     }
 
@@ -1116,46 +1515,62 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
     const size_t nbe_cart = 
       basis.nbf_cart_subset( shell_list, shell_list + nshells );
 
+    // Row-major cartesian X / G, one (nbe_cart x npts) block per matrix
+    const size_t mat_stride = nbe_cart * npts;
     std::vector<double> X_cart, G_cart;
+    std::vector<double> X_cart_rm( nmat*mat_stride,0. ), 
+                        G_cart_rm( nmat*mat_stride,0. );
     if( any_pure ){
       X_cart.resize( nbe_cart * npts );
       G_cart.resize( nbe_cart * npts, 0. );
+    }
 
-      // Transform X into cartesian
-      int ioff = 0;
-      int ioff_cart = 0;
-      for( auto i = 0ul; i < nshells; ++i ) {
-        const auto ish = shell_list[i];
-        const auto& shell      = basis.at(ish);
-        const int shell_l       = shell.l();
-        const int shell_sz      = shell.size();
-        const int shell_cart_sz = shell.cart_size();
-        
-        if( shell.pure() and shell_l > 0 ) {
-          sph_trans.itform_bra_cm( shell_l, npts, X + ioff, ldx,
-        			   X_cart.data() + ioff_cart, nbe_cart );
-        } else {
-          blas::lacpy( 'A', shell_sz, npts, X + ioff, ldx,
-        	       X_cart.data() + ioff_cart, nbe_cart );
+    for( size_t imat = 0; imat < nmat; ++imat ) {
+      const auto* X_mat = X + imat*nbe;
+      if( any_pure ){
+        // Transform X into cartesian
+        int ioff = 0;
+        int ioff_cart = 0;
+        for( auto i = 0ul; i < nshells; ++i ) {
+          const auto ish = shell_list[i];
+          const auto& shell      = basis.at(ish);
+          const int shell_l       = shell.l();
+          const int shell_sz      = shell.size();
+          const int shell_cart_sz = shell.cart_size();
+          
+          if( shell.pure() and shell_l > 0 ) {
+            sph_trans.itform_bra_cm( shell_l, npts, X_mat + ioff, ldx,
+          			   X_cart.data() + ioff_cart, nbe_cart );
+          } else {
+            blas::lacpy( 'A', shell_sz, npts, X_mat + ioff, ldx,
+          	       X_cart.data() + ioff_cart, nbe_cart );
+          }
+          ioff += shell_sz;
+          ioff_cart += shell_cart_sz;
         }
-        ioff += shell_sz;
-        ioff_cart += shell_cart_sz;
+      }
+
+      const auto* X_use = any_pure ? X_cart.data() : X_mat;
+      const auto ldx_use = any_pure ? nbe_cart : ldx;
+      auto* X_rm = X_cart_rm.data() + imat*mat_stride;
+      for( auto i = 0ul; i < nbe_cart; ++i )
+      for( auto j = 0ul; j < npts;     ++j ) {
+        X_rm[i*npts + j] = X_use[i + j*ldx_use];
       }
     }
 
-    const auto* X_use = any_pure ? X_cart.data() : X;
-    auto*       G_use = any_pure ? G_cart.data() : G;
-    const auto ldx_use = any_pure ? nbe_cart : ldx;
-    const auto ldg_use = any_pure ? nbe_cart : ldg;
 
-    std::vector<double> X_cart_rm( nbe_cart*npts,0. ), 
-                        G_cart_rm( nbe_cart*npts,0. );
-    for( auto i = 0ul; i < nbe_cart; ++i )
-    for( auto j = 0ul; j < npts;     ++j ) {
-      X_cart_rm[i*npts + j] = X_use[i + j*ldx_use];
+    // Terms of the operator as (coefficient, omega), omega = 0 -> 1/r. The
+    // coefficients are folded into the quadrature weights of each term
+    std::vector<std::pair<double,double>> op_terms;
+    if( op.coulomb_coeff != 0. ) op_terms.emplace_back( op.coulomb_coeff, 0. );
+    if( op.erf_coeff     != 0. ) op_terms.emplace_back( op.erf_coeff, op.omega );
+    std::vector<std::vector<double>> op_weights;
+    for( const auto& term : op_terms ) {
+      op_weights.emplace_back( weights, weights + npts );
+      for( auto& w : op_weights.back() ) w *= term.first;
     }
 
-
     std::map<size_t,size_t> cou_offsets_map;
     std::vector<size_t> cou_cart_sizes(nshells);
     cou_cart_sizes[0] = 0;
@@ -1193,7 +1608,7 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
         auto nprim_pair     = sh_pair.nprim_pairs();
         
         XCPU::compute_integral_shell_pair( ish == jsh,
-        				   npts, _points_transposed.data(),
+        				   npts, _points_soa,
         				   bra.l(), ket.l(), bra_origin, ket_origin,
         				   nprim_pair, prim_pair_data,
         				   X_cart_rm.data()+ioff_cart, X_cart_rm.data()+joff_cart, npts,
@@ -1226,43 +1641,51 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
       auto nprim_pair     = sh_pair.nprim_pairs();
       
       ndo++;  
+      for( auto iop = 0ul; iop < op_terms.size(); ++iop )
       XCPU::compute_integral_shell_pair( ish == jsh,
-      				   npts, _points_transposed.data(),
+      				   npts, _points_soa,
       				   bra.l(), ket.l(), bra_origin, ket_origin,
       				   nprim_pair, prim_pair_data,
       				   X_cart_rm.data()+ioff_cart, X_cart_rm.data()+joff_cart, npts,
       				   G_cart_rm.data()+ioff_cart, G_cart_rm.data()+joff_cart, npts,
-      				   const_cast<double*>(weights), this->boys_table );
+      				   op_weights[iop].data(), this->boys_table,
+      				   nmat, mat_stride, mat_stride, op_terms[iop].second );
     }
 #endif
     }
     //std::cout << "NDO " << ndo << " " << ndo / double(nshells*(nshells+1)/2) << std::endl;
    
-    for( auto i = 0ul; i < nbe_cart; ++i )
-    for( auto j = 0ul; j < npts;     ++j ) {
-	    G_use[i + j*ldg_use] = G_cart_rm[i*npts + j];
-    }
-  
-    // Transform G back to spherical
-    if( any_pure ) {
-      size_t ioff = 0;
-      size_t ioff_cart = 0;
-      for( auto i = 0ul; i < nshells; ++i ) {
-        const auto ish = shell_list[i];
-        const auto& shell      = basis.at(ish);
-        const int shell_l       = shell.l();
-        const int shell_sz      = shell.size();
-        const int shell_cart_sz = shell.cart_size();
-        
-        if( shell.pure() and shell_l > 0 ) {
-          sph_trans.tform_bra_cm( shell_l, npts, G_cart.data() + ioff_cart, nbe_cart,
-        			  G + ioff, ldg );
-        } else {
-          blas::lacpy( 'A', shell_sz, npts, G_cart.data() + ioff_cart, nbe_cart,
-        	       G + ioff, ldg );
+    for( size_t imat = 0; imat < nmat; ++imat ) {
+      auto* G_mat = G + imat*nbe;
+      auto* G_use = any_pure ? G_cart.data() : G_mat;
+      const auto ldg_use = any_pure ? nbe_cart : ldg;
+      const auto* G_rm = G_cart_rm.data() + imat*mat_stride;
+      for( auto i = 0ul; i < nbe_cart; ++i )
+      for( auto j = 0ul; j < npts;     ++j ) {
+	      G_use[i + j*ldg_use] = G_rm[i*npts + j];
+      }
+    
+      // Transform G back to spherical
+      if( any_pure ) {
+        size_t ioff = 0;
+        size_t ioff_cart = 0;
+        for( auto i = 0ul; i < nshells; ++i ) {
+          const auto ish = shell_list[i];
+          const auto& shell      = basis.at(ish);
+          const int shell_l       = shell.l();
+          const int shell_sz      = shell.size();
+          const int shell_cart_sz = shell.cart_size();
+          
+          if( shell.pure() and shell_l > 0 ) {
+            sph_trans.tform_bra_cm( shell_l, npts, G_cart.data() + ioff_cart, nbe_cart,
+          			  G_mat + ioff, ldg );
+          } else {
+            blas::lacpy( 'A', shell_sz, npts, G_cart.data() + ioff_cart, nbe_cart,
+          	       G_mat + ioff, ldg );
+          }
+          ioff += shell_sz;
+          ioff_cart += shell_cart_sz;
         }
-        ioff += shell_sz;
-        ioff_cart += shell_cart_sz;
       }
     }
 
@@ -7,28 +7,39 @@
  */
 #pragma once
 #include "local_host_work_driver_pimpl.hpp"
+#include "reference/collocation.hpp"
 
 namespace GauXC {
 
 struct ReferenceLocalHostWorkDriver : public detail::LocalHostWorkDriverPIMPL {
 
   double *boys_table;
+  LocalHostWorkSettings settings;
   
   using submat_map_t   = LocalHostWorkDriverPIMPL::submat_map_t;
   using task_container = LocalHostWorkDriverPIMPL::task_container;
   using tast_iterator  = LocalHostWorkDriverPIMPL::task_iterator;
 
-  ReferenceLocalHostWorkDriver();
+  ReferenceLocalHostWorkDriver( LocalHostWorkSettings s = LocalHostWorkSettings() );
 
   virtual ~ReferenceLocalHostWorkDriver() noexcept;
 
   ReferenceLocalHostWorkDriver( const ReferenceLocalHostWorkDriver& )     = delete;
   ReferenceLocalHostWorkDriver( ReferenceLocalHostWorkDriver&& ) noexcept = delete;
 
+  /// Collocation screening parameters derived from the LWD settings
+  CollocationScreening collocation_screening() const;
+
+  /// Whether collocation is evaluated by the native (rather than gau2grid) kernels
+  bool use_native_collocation() const;
+
   // Public APIs
 
   void partition_weights( XCWeightAlg weight_alg, const Molecule& mol, 
     const MolMeta& meta, task_iterator task_begin, task_iterator task_end ) override;
+  void eval_weight_1st_deriv_contracted( XCWeightAlg weight_alg, 
+    const Molecule& mol, const MolMeta& meta, const XCTask& task, 
+    const double* w_times_f, double* exc_grad_w ) override;
 
   void eval_collocation( size_t npts, size_t nshells, size_t nbe, 
     const double* pts, const BasisSet<double>& basis, const int32_t* shell_list, 
@@ -43,6 +54,10 @@ struct ReferenceLocalHostWorkDriver : public detail::LocalHostWorkDriverPIMPL {
     double* dbasis_z_eval, double* d2basis_xx_eval, double* d2basis_xy_eval,
     double* d2basis_xz_eval, double* d2basis_yy_eval, double* d2basis_yz_eval,
     double* d2basis_zz_eval ) override;
+  void eval_collocation_laplacian( size_t npts, size_t nshells, size_t nbe, 
+    const double* pts, const BasisSet<double>& basis, const int32_t* shell_list, 
+    double* basis_eval, double* dbasis_x_eval, double* dbasis_y_eval, 
+    double* dbasis_z_eval, double* lbasis_eval ) override;
   void eval_collocation_der3( size_t npts, size_t nshells, size_t nbe,
     const double* pts, const BasisSet<double>& basis, const int32_t* shell_list, 
     double* basis_eval, double* dbasis_x_eval, double* dbasis_y_eval, 
@@ -63,19 +78,20 @@ struct ReferenceLocalHostWorkDriver : public detail::LocalHostWorkDriverPIMPL {
     size_t nbe, const double* points, const double* weights, 
     const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
     const BasisSetMap& basis_map, const int32_t* shell_list, 
-    const std::pair<int32_t,int32_t>* shell_pair_list, 
-    const double* X, size_t ldx, double* G, size_t ldg ) override ;
+    const std::pair<int32_t,int32_t>* shell_pair_list, size_t nmat,
+    const double* X, size_t ldx, double* G, size_t ldg, 
+    const exx_operator& op ) override ;
 
   void eval_exx_fmat( size_t npts, size_t nbf, size_t nbe_bra,
     size_t nbe_ket, const submat_map_t& submat_map_bra,
-    const submat_map_t& submat_map_ket, const double* P, size_t ldp,
-    const double* basis_eval, size_t ldb, double* F, size_t ldf,
+    const submat_map_t& submat_map_ket, size_t nmat, const double* P, 
+    size_t ldp, const double* basis_eval, size_t ldb, double* F, size_t ldf,
     double* scr ) override;
 
   void inc_exx_k( size_t npts, size_t nbf, size_t nbe_bra, size_t nbe_ket, 
     const double* basis_eval, const submat_map_t& submat_map_bra, 
-    const submat_map_t& submat_map_ket, const double* G, size_t ldg, double* K, 
-    size_t ldk, double* scr ) override;
+    const submat_map_t& submat_map_ket, size_t nmat, const double* G, size_t ldg, 
+    double* K, size_t ldk, double* scr ) override;
     
   void eval_uvvar_lda_rks( size_t npts, size_t nbe, const double* basis_eval,
     const double* X, size_t ldx, double* den_eval) override;
@@ -123,6 +139,19 @@ struct ReferenceLocalHostWorkDriver : public detail::LocalHostWorkDriverPIMPL {
     double* den_eval,
     double* dden_x_eval, double* dden_y_eval, double* dden_z_eval,
     double* gamma, double* tau, double* lapl ) override;
+  void eval_uvvar_mgga_gks( size_t npts, size_t nbe, const double* basis_eval,
+    const double* dbasis_x_eval, const double *dbasis_y_eval,
+    const double* dbasis_z_eval, const double *lbasis_eval, 
+    const double* Xs, size_t ldxs, const double* Xz, size_t ldxz, 
+    const double* Xx, size_t ldxx, const double* Xy, size_t ldxy, 
+    const double* mmat_xs, const double* mmat_ys, const double* mmat_zs, size_t ldms,
+    const double* mmat_xz, const double* mmat_yz, const double* mmat_zz, size_t ldmz,
+    const double* mmat_xx, const double* mmat_yx, const double* mmat_zx, size_t ldmx,
+    const double* mmat_xy, const double* mmat_yy, const double* mmat_zy, size_t ldmy,
+    double* den_eval,
+    double* dden_x_eval, double* dden_y_eval, double* dden_z_eval,
+    double* gamma, double* tau, double* lapl, double* K, double* H, 
+    const double dtol ) override;
 
   void eval_zmat_lda_vxc_rks( size_t npts, size_t nbe, const double* vrho, 
     const double* basis_eval, double* Z, size_t ldz ) override;
@@ -160,6 +189,12 @@ struct ReferenceLocalHostWorkDriver : public detail::LocalHostWorkDriverPIMPL {
     const double* dbasis_y_eval, const double* dbasis_z_eval, const double* lbasis_eval,
     const double* dden_x_eval, const double* dden_y_eval, const double* dden_z_eval,
     double* Zs, size_t ldzs, double* Zz, size_t ldzz ) override;
+  void eval_zmat_mgga_vxc_gks( size_t npts, size_t nbe, const double* vrho,
+    const double* vgamma, const double* vlapl, const double* basis_eval, const double* dbasis_x_eval,
+    const double* dbasis_y_eval, const double* dbasis_z_eval, const double* lbasis_eval,
+    const double* dden_x_eval, const double* dden_y_eval, const double* dden_z_eval,
+    double* Zs, size_t ldzs, double* Zz, size_t ldzz, double* Zx, size_t ldzx,
+    double* Zy, size_t ldzy, double* K, double* H ) override;
   void eval_mmat_mgga_vxc_rks( size_t npts, size_t nbe, const double* vtau,
     const double* vlapl, const double* dbasis_x_eval, const double* dbasis_y_eval, 
     const double* dbasis_z_eval, double* mmat_x, double* mmat_y, double* mmat_z,
@@ -168,12 +203,55 @@ struct ReferenceLocalHostWorkDriver : public detail::LocalHostWorkDriverPIMPL {
     const double* vlapl, const double* dbasis_x_eval, const double* dbasis_y_eval, 
     const double* dbasis_z_eval, double* mmat_xs, double* mmat_ys, double* mmat_zs,
     size_t ldms, double* mmat_xz, double* mmat_yz, double* mmat_zz, size_t ldmz ) override;
+  void eval_mmat_mgga_vxc_gks( size_t npts, size_t nbe, const double* vtau,
+    const double* vlapl, const double* dbasis_x_eval, const double* dbasis_y_eval, 
+    const double* dbasis_z_eval, double* mmat_xs, double* mmat_ys, double* mmat_zs,
+    size_t ldms, double* mmat_xz, double* mmat_yz, double* mmat_zz, size_t ldmz,
+    double* mmat_xx, double* mmat_yx, double* mmat_zx, size_t ldmx,
+    double* mmat_xy, double* mmat_yy, double* mmat_zy, size_t ldmy, 
+    double* K ) override;
 
 
   void inc_vxc( size_t npts, size_t nbf, size_t nbe, 
     const double* basis_eval, const submat_map_t& submat_map, const double* Z, 
     size_t ldz, double* VXC, size_t ldvxc, double* scr ) override;
 
+void eval_xmat( size_t npts, size_t nbf, size_t nbe, 
+    const submat_map_t& submat_map, double fac, const double* P, size_t ldp,
+    const float* basis_eval, size_t ldb, float* X, size_t ldx, float* scr ) override;
+void eval_uvvar_lda_rks( size_t npts, size_t nbe, const float* basis_eval,
+    const float* X, size_t ldx, double* den_eval ) override;
+void eval_uvvar_lda_uks( size_t npts, size_t nbe, const float* basis_eval,
+    const float* Xs, size_t ldxs, const float* Xz, size_t ldxz, 
+    double* den_eval ) override;
+void eval_uvvar_gga_rks( size_t npts, size_t nbe, const float* basis_eval,
+    const float* dbasis_x_eval, const float *dbasis_y_eval, 
+    const float* dbasis_z_eval, const float* X, size_t ldx, double* den_eval, 
+    double* dden_x_eval, double* dden_y_eval, double* dden_z_eval, 
+    double* gamma ) override;
+void eval_uvvar_gga_uks( size_t npts, size_t nbe, const float* basis_eval,
+    const float* dbasis_x_eval, const float *dbasis_y_eval,
+    const float* dbasis_z_eval, const float* Xs, size_t ldxs, 
+    const float* Xz, size_t ldxz, double* den_eval, double* dden_x_eval, 
+    double* dden_y_eval, double* dden_z_eval, double* gamma ) override;
+void eval_zmat_lda_vxc_rks( size_t npts, size_t nbe, const double* vrho, 
+    const float* basis_eval, float* Z, size_t ldz ) override;
+void eval_zmat_lda_vxc_uks( size_t npts, size_t nbe, const double* vrho, 
+    const float* basis_eval, float* Zs, size_t ldzs, float* Zz, size_t ldzz ) override;
+void eval_zmat_gga_vxc_rks( size_t npts, size_t nbe, const double* vrho,
+    const double* vgamma, const float* basis_eval, const float* dbasis_x_eval,
+    const float* dbasis_y_eval, const float* dbasis_z_eval, 
+    const double* dden_x_eval, const double* dden_y_eval, 
+    const double* dden_z_eval, float* Z, size_t ldz ) override;
+void eval_zmat_gga_vxc_uks( size_t npts, size_t nbe, const double* vrho,
+    const double* vgamma, const float* basis_eval, const float* dbasis_x_eval,
+    const float* dbasis_y_eval, const float* dbasis_z_eval, 
+    const double* dden_x_eval, const double* dden_y_eval, 
+    const double* dden_z_eval, float* Zs, size_t ldzs, float* Zz, size_t ldzz ) override;
+void inc_vxc( size_t npts, size_t nbf, size_t nbe, const float* basis_eval,
+    const submat_map_t& submat_map, const float* Z, size_t ldz, 
+    double* VXC, size_t ldvxc, float* scr ) override;
+
 };
 
 }
@@ -10,6 +10,7 @@
 #include <vector>
 #include <tuple>
 #include <cstdint>
+#include <type_traits>
 
 namespace GauXC  {
 namespace detail {
@@ -37,8 +38,13 @@ void submat_set(int32_t M, int32_t N, int32_t MSub,
     auto* ASmall_use = ASmall + i       + j       * LDAS;
 
 
-    GauXC::blas::lacpy( 'A', deltaI, deltaJ, ABig_use, LDAB, 
-                         ASmall_use, LDAS );
+    if constexpr ( std::is_same_v<std::remove_cv_t<_F1>, _F2> )
+      GauXC::blas::lacpy( 'A', deltaI, deltaJ, ABig_use, LDAB, 
+                           ASmall_use, LDAS );
+    else // Precision conversion (mixed precision X matrix)
+      for( int32_t jj = 0; jj < deltaJ; ++jj )
+      for( int32_t ii = 0; ii < deltaI; ++ii )
+        ASmall_use[ ii + jj * LDAS ] = ABig_use[ ii + jj * LDAB ];
 
   
     j += deltaJ;
@@ -9,6 +9,7 @@
 #include "incore_replicated_xc_device_integrator_exc.hpp"
 #include "incore_replicated_xc_device_integrator_exc_vxc.hpp"
 #include "incore_replicated_xc_device_integrator_exc_grad.hpp"
+#include "incore_replicated_xc_device_integrator_fxc_contraction.hpp"
 #include "incore_replicated_xc_device_integrator_exx.hpp"
 
 namespace GauXC  {
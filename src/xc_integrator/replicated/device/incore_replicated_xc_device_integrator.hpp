@@ -70,12 +70,45 @@ protected:
                       value_type* EXC, const IntegratorSettingsXC& settings ) override;
 
 
+  void eval_fxc_contraction_( int64_t m, int64_t n, const value_type* P, int64_t ldp,
+                              int64_t ntrial, const value_type* tP, int64_t ldtp,
+                              value_type* FXC, int64_t ldfxc,
+                              const IntegratorSettingsXC& ks_settings ) override;
+
+  void eval_fxc_contraction_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps,
+                              const value_type* Pz, int64_t ldpz, int64_t ntrial,
+                              const value_type* tPs, int64_t ldtps,
+                              const value_type* tPz, int64_t ldtpz,
+                              value_type* FXCs, int64_t ldfxcs,
+                              value_type* FXCz, int64_t ldfxcz,
+                              const IntegratorSettingsXC& ks_settings ) override;
+
   void eval_exc_grad_( int64_t m, int64_t n, const value_type* P,
-                       int64_t ldp, value_type* EXC_GRAD ) override;
+                       int64_t ldp, value_type* EXC_GRAD, 
+                       const IntegratorSettingsXC& settings ) override;
+
+  void eval_exc_grad_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps,
+                       const value_type* Pz, int64_t ldpz, value_type* EXC_GRAD, 
+                       const IntegratorSettingsXC& settings ) override;
+
+  void eval_exc_grad_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps,
+                       const value_type* Pz, int64_t ldpz,
+                       const value_type* Py, int64_t ldpy,
+                       const value_type* Px, int64_t ldpx, value_type* EXC_GRAD, 
+                       const IntegratorSettingsXC& settings ) override;
 
   void eval_exx_( int64_t m, int64_t n, const value_type* P,
                   int64_t ldp, value_type* K, int64_t ldk,
                   const IntegratorSettingsEXX& settings ) override;
+  void eval_exx_( int64_t m, int64_t n, int64_t nmat, const value_type* P,
+                  int64_t ldp, value_type* K, int64_t ldk,
+                  const IntegratorSettingsEXX& settings ) override;
+
+  void eval_exc_vxc_exx_( int64_t m, int64_t n, const value_type* P,
+                          int64_t ldp, value_type* VXC, int64_t ldvxc,
+                          value_type* K, int64_t ldk, value_type* EXC,
+                          const IntegratorSettingsXC&  ks_settings,
+                          const IntegratorSettingsEXX& exx_settings ) override;
 
 
   void integrate_den_local_work_( const basis_type& basis, const value_type* P, int64_t ldp, 
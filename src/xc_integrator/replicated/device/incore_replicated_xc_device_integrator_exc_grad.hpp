@@ -10,6 +10,7 @@
 #include <stdexcept>
 #include "device/xc_device_aos_data.hpp"
 #include <fstream>
+#include <gauxc/util/unused.hpp>
 
 namespace GauXC  {
 namespace detail {
@@ -17,8 +18,13 @@ namespace detail {
 template <typename ValueType>
 void IncoreReplicatedXCDeviceIntegrator<ValueType>::
   eval_exc_grad_( int64_t m, int64_t n, const value_type* P,
-                 int64_t ldp, value_type* EXC_GRAD ) { 
+                 int64_t ldp, value_type* EXC_GRAD, 
+                 const IntegratorSettingsXC& settings ) { 
                  
+  if( auto* tmp = dynamic_cast<const IntegratorSettingsEXCGrad*>(&settings) )
+  if( tmp->include_weight_derivatives )
+    GAUXC_GENERIC_EXCEPTION("Device EXC Grad + Weight Derivatives NYI");
+
   const auto& basis = this->load_balancer_->basis();
 
   // Check that P is sane
@@ -68,6 +74,30 @@ void IncoreReplicatedXCDeviceIntegrator<ValueType>::
 
 }
 
+template <typename ValueType>
+void IncoreReplicatedXCDeviceIntegrator<ValueType>::
+  eval_exc_grad_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps,
+                 const value_type* Pz, int64_t ldpz, value_type* EXC_GRAD, 
+                 const IntegratorSettingsXC& settings ) { 
+
+  GAUXC_GENERIC_EXCEPTION("Device UKS EXC Grad NYI");
+  util::unused(m,n,Ps,ldps,Pz,ldpz,EXC_GRAD,settings);
+
+}
+
+template <typename ValueType>
+void IncoreReplicatedXCDeviceIntegrator<ValueType>::
+  eval_exc_grad_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps,
+                 const value_type* Pz, int64_t ldpz, 
+                 const value_type* Py, int64_t ldpy, 
+                 const value_type* Px, int64_t ldpx, value_type* EXC_GRAD, 
+                 const IntegratorSettingsXC& settings ) { 
+
+  GAUXC_GENERIC_EXCEPTION("Device GKS EXC Grad NYI");
+  util::unused(m,n,Ps,ldps,Pz,ldpz,Py,ldpy,Px,ldpx,EXC_GRAD,settings);
+
+}
+
 template <typename ValueType>
 void IncoreReplicatedXCDeviceIntegrator<ValueType>::
   eval_exc_grad_local_work_( const basis_type& basis, 
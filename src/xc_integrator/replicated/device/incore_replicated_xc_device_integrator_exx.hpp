@@ -40,6 +40,13 @@ void IncoreReplicatedXCDeviceIntegrator<ValueType>::
   if( ldk < nbf )
     GAUXC_GENERIC_EXCEPTION("Invalid LDK");
 
+  // Only the bare 1/r operator is implemented in the device kernels
+  if( auto* tmp = dynamic_cast<const IntegratorSettingsSNLinK*>(&settings) ) {
+    const auto op = exx_operator( *tmp );
+    if( op.coulomb_coeff != 1. or op.erf_coeff != 0. )
+      GAUXC_GENERIC_EXCEPTION("Range-Separated sn-LinK NYI on Device");
+  }
+
   // Allocate Device memory
   auto* lwd = dynamic_cast<LocalDeviceWorkDriver*>(this->local_work_driver_.get() );
   auto rt  = detail::as_device_runtime(this->load_balancer_->runtime());
@@ -105,6 +112,36 @@ void IncoreReplicatedXCDeviceIntegrator<ValueType>::
   }
 }
 
+
+/// Multi-matrix sn-LinK is not yet specialized on device, fall back to
+/// separate passes over each density matrix
+template <typename ValueType>
+void IncoreReplicatedXCDeviceIntegrator<ValueType>::
+  eval_exx_( int64_t m, int64_t n, int64_t nmat, const value_type* P,
+             int64_t ldp, value_type* K, int64_t ldk, 
+             const IntegratorSettingsEXX& settings ) { 
+
+  for( int64_t imat = 0; imat < nmat; ++imat )
+    eval_exx_( m, n, P + imat*ldp*n, ldp, K + imat*ldk*n, ldk, settings );
+
+}
+
+
+/// Fused EXC/VXC + sn-LinK is not yet specialized on device, fall back to
+/// separate passes
+template <typename ValueType>
+void IncoreReplicatedXCDeviceIntegrator<ValueType>::
+  eval_exc_vxc_exx_( int64_t m, int64_t n, const value_type* P,
+                     int64_t ldp, value_type* VXC, int64_t ldvxc,
+                     value_type* K, int64_t ldk, value_type* EXC,
+                     const IntegratorSettingsXC&  ks_settings,
+                     const IntegratorSettingsEXX& exx_settings ) { 
+
+  eval_exc_vxc_( m, n, P, ldp, VXC, ldvxc, EXC, ks_settings );
+  eval_exx_( m, n, P, ldp, K, ldk, exx_settings );
+
+}
+
 template <typename ValueType>
 void IncoreReplicatedXCDeviceIntegrator<ValueType>::
   exx_ek_screening_local_work_( const basis_type& basis, const value_type* P, int64_t ldp, 
@@ -0,0 +1,40 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include "incore_replicated_xc_device_integrator.hpp"
+#include <gauxc/util/unused.hpp>
+
+namespace GauXC  {
+namespace detail {
+
+template <typename ValueType>
+void IncoreReplicatedXCDeviceIntegrator<ValueType>::
+  eval_fxc_contraction_( int64_t m, int64_t n, const value_type* P, int64_t ldp,
+                         int64_t ntrial, const value_type* tP, int64_t ldtp,
+                         value_type* FXC, int64_t ldfxc,
+                         const IntegratorSettingsXC& ks_settings ) {
+  GAUXC_GENERIC_EXCEPTION("Device FXC Contraction NYI");
+  util::unused(m,n,P,ldp,ntrial,tP,ldtp,FXC,ldfxc,ks_settings);
+}
+
+template <typename ValueType>
+void IncoreReplicatedXCDeviceIntegrator<ValueType>::
+  eval_fxc_contraction_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps,
+                         const value_type* Pz, int64_t ldpz, int64_t ntrial,
+                         const value_type* tPs, int64_t ldtps,
+                         const value_type* tPz, int64_t ldtpz,
+                         value_type* FXCs, int64_t ldfxcs,
+                         value_type* FXCz, int64_t ldfxcz,
+                         const IntegratorSettingsXC& ks_settings ) {
+  GAUXC_GENERIC_EXCEPTION("Device FXC Contraction NYI");
+  util::unused(m,n,Ps,ldps,Pz,ldpz,ntrial,tPs,ldtps,tPz,ldtpz,FXCs,ldfxcs,
+    FXCz,ldfxcz,ks_settings);
+}
+
+}
+}
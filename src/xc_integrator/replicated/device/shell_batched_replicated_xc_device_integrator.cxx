@@ -10,6 +10,7 @@
 #include "shell_batched_replicated_xc_integrator_exc.hpp"
 #include "shell_batched_replicated_xc_integrator_exc_vxc.hpp"
 #include "shell_batched_replicated_xc_integrator_exc_grad.hpp"
+#include "shell_batched_replicated_xc_integrator_fxc_contraction.hpp"
 #include "shell_batched_replicated_xc_integrator_exx.hpp"
 
 namespace GauXC  {
@@ -8,8 +8,10 @@
 #include "reference_replicated_xc_host_integrator_integrate_den.hpp"
 #include "reference_replicated_xc_host_integrator_exc.hpp"
 #include "reference_replicated_xc_host_integrator_exc_vxc.hpp"
+#include "reference_replicated_xc_host_integrator_fxc_contraction.hpp"
 #include "reference_replicated_xc_host_integrator_exc_grad.hpp"
 #include "reference_replicated_xc_host_integrator_exx.hpp"
+#include "reference_replicated_xc_host_integrator_exc_vxc_exx.hpp"
  
 namespace GauXC::detail {
 
@@ -8,6 +8,8 @@
 #pragma once
 #include <gauxc/xc_integrator/replicated/replicated_xc_host_integrator.hpp>
 #include "xc_host_data.hpp"
+#include "integrator_util/stream_local_work.hpp"
+#include <unordered_map>
 
 namespace GauXC::detail {
 
@@ -71,22 +73,68 @@ protected:
                       value_type* EXC, const IntegratorSettingsXC& ks_settings ) override;
 
 
+  /// RKS FXC Contraction
+  void eval_fxc_contraction_( int64_t m, int64_t n, const value_type* P, int64_t ldp,
+                              int64_t ntrial, const value_type* tP, int64_t ldtp,
+                              value_type* FXC, int64_t ldfxc,
+                              const IntegratorSettingsXC& ks_settings ) override;
+
+  /// UKS FXC Contraction
+  void eval_fxc_contraction_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps,
+                              const value_type* Pz, int64_t ldpz, int64_t ntrial,
+                              const value_type* tPs, int64_t ldtps,
+                              const value_type* tPz, int64_t ldtpz,
+                              value_type* FXCs, int64_t ldfxcs,
+                              value_type* FXCz, int64_t ldfxcz,
+                              const IntegratorSettingsXC& ks_settings ) override;
+
   /// RKS EXC Gradient
   void eval_exc_grad_( int64_t m, int64_t n, const value_type* P,
-                       int64_t ldp, value_type* EXC_GRAD ) override;
+                       int64_t ldp, value_type* EXC_GRAD, 
+                       const IntegratorSettingsXC& settings ) override;
+
+  /// UKS EXC Gradient
+  void eval_exc_grad_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps,
+                       const value_type* Pz, int64_t ldpz, value_type* EXC_GRAD, 
+                       const IntegratorSettingsXC& settings ) override;
+
+  /// GKS EXC Gradient - also serves as the generic implementation
+  void eval_exc_grad_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps,
+                       const value_type* Pz, int64_t ldpz,
+                       const value_type* Py, int64_t ldpy,
+                       const value_type* Px, int64_t ldpx, value_type* EXC_GRAD, 
+                       const IntegratorSettingsXC& settings ) override;
 
   /// sn-LinK
   void eval_exx_( int64_t m, int64_t n, const value_type* P,
                   int64_t ldp, value_type* K, int64_t ldk,
                   const IntegratorSettingsEXX& settings ) override;
 
+  /// sn-LinK for several density matrices
+  void eval_exx_( int64_t m, int64_t n, int64_t nmat, const value_type* P,
+                  int64_t ldp, value_type* K, int64_t ldk,
+                  const IntegratorSettingsEXX& settings ) override;
+
+  /// RKS EXC/VXC + sn-LinK
+  void eval_exc_vxc_exx_( int64_t m, int64_t n, const value_type* P,
+                          int64_t ldp, value_type* VXC, int64_t ldvxc,
+                          value_type* K, int64_t ldk, value_type* EXC,
+                          const IntegratorSettingsXC&  ks_settings,
+                          const IntegratorSettingsEXX& exx_settings ) override;
 
 
-  // Implementation details of integrate_den
-  void integrate_den_local_work_( const value_type* P, int64_t ldp, 
-                                   value_type *N_EL );
 
-  // Implementation details of exc_vxc (for RKS/UKS/GKS deduced from input character)
+  // Implementation details of integrate_den. 
+  // If accumulate is set, N_EL is incremented rather than overwritten
+  void integrate_den_local_work_( const value_type* P, int64_t ldp, 
+                                   value_type *N_EL, task_iterator task_begin,
+                                   task_iterator task_end, 
+                                   bool accumulate = false );
+
+  // Implementation details of exc_vxc (for RKS/UKS/GKS deduced from input character).
+  // If accumulate is set, the LT of VXC and EXC / N_EL are incremented rather
+  // than overwritten. Unless symmetrize is set, the UT of VXC is left to the
+  // caller
   void exc_vxc_local_work_( const basis_type& basis, const value_type* Ps, int64_t ldps,
                             const value_type* Pz, int64_t ldpz,
                             const value_type* Py, int64_t ldpy,
@@ -96,14 +144,81 @@ protected:
                             value_type* VXCy, int64_t ldvxcy,
                             value_type* VXCx, int64_t ldvxcx,
                             value_type* EXC, value_type *N_EL, const IntegratorSettingsXC& ks_settings,
-                            task_iterator task_begin, task_iterator task_end );
+                            task_iterator task_begin, task_iterator task_end,
+                            bool accumulate = false, bool symmetrize = true );
+
+  // Task loop of exc_vxc, collocation / X / Z in BasisType (float32 for mixed precision)
+  template <typename BasisType>
+  void exc_vxc_local_work_tasks_( const basis_type& basis, const value_type* Ps, int64_t ldps,
+                                  const value_type* Pz, int64_t ldpz,
+                                  const value_type* Py, int64_t ldpy,
+                                  const value_type* Px, int64_t ldpx,
+                                  value_type* VXCs, int64_t ldvxcs,
+                                  value_type* VXCz, int64_t ldvxcz,
+                                  value_type* VXCy, int64_t ldvxcy,
+                                  value_type* VXCx, int64_t ldvxcx,
+                                  double gks_dtol, value_type* EXC, value_type *N_EL,
+                                  task_iterator task_begin, task_iterator task_end );
                             
-  // Implemetation details of exc_grad
-  void exc_grad_local_work_( const value_type* P, int64_t ldp, value_type* EXC_GRAD );
+  // Implementation details of fxc_contraction (RKS/UKS deduced from input character).
+  // If accumulate is set, the LT of FXC is incremented rather than overwritten
+  void fxc_contraction_local_work_( const basis_type& basis, const value_type* Ps, int64_t ldps,
+                                    const value_type* Pz, int64_t ldpz, int64_t ntrial,
+                                    const value_type* tPs, int64_t ldtps,
+                                    const value_type* tPz, int64_t ldtpz,
+                                    value_type* FXCs, int64_t ldfxcs,
+                                    value_type* FXCz, int64_t ldfxcz,
+                                    const IntegratorSettingsXC& ks_settings,
+                                    task_iterator task_begin, task_iterator task_end,
+                                    bool accumulate = false );
+
+  // Implemetation details of exc_grad (for RKS/UKS/GKS deduced from input character).
+  // If accumulate is set, EXC_GRAD is incremented rather than overwritten
+  void exc_grad_local_work_( const value_type* Ps, int64_t ldps,
+                             const value_type* Pz, int64_t ldpz,
+                             const value_type* Py, int64_t ldpy,
+                             const value_type* Px, int64_t ldpx,
+                             value_type* EXC_GRAD, const IntegratorSettingsXC& settings,
+                             task_iterator task_begin, task_iterator task_end,
+                             bool accumulate = false );
 
   // Implementation details of sn-LinK
-  void exx_local_work_( const value_type* P, int64_t ldp, value_type* K, int64_t ldk,
-    const IntegratorSettingsEXX& settings );
+  std::vector<XCTask> exx_screen_tasks_( int64_t nmat, const value_type* P, 
+    int64_t ldp, const IntegratorSettingsEXX& settings );
+  void exx_local_work_( int64_t nmat, const value_type* P, int64_t ldp, 
+    value_type* K, int64_t ldk, const IntegratorSettingsEXX& settings );
+
+  // Implementation details of fused EXC/VXC + sn-LinK
+  void exc_vxc_exx_local_work_( const value_type* P, int64_t ldp, 
+    value_type* VXC, int64_t ldvxc, value_type* K, int64_t ldk,
+    value_type* EXC, value_type* N_EL, const IntegratorSettingsXC& ks_settings,
+    const IntegratorSettingsEXX& exx_settings );
+
+  /// Ground state U variables of an FXC contraction for a single task
+  struct fxc_ground_state {
+    std::vector<value_type> den, gamma, tau, lapl;
+  };
+
+  /// Ground state U variables of the last FXC contraction, reused by 
+  /// subsequent contractions with the same (Ps, Pz) and the same task
+  /// generation of the load balancer (see LoadBalancer::task_generation).
+  /// Within a generation the in-core tasks are only reordered, entries are
+  /// keyed by their point storage
+  struct fxc_ground_state_cache {
+    size_t generation = 0;
+    size_t bytes      = 0; ///< Bytes held by Ps / Pz and the task entries
+    std::vector<value_type> Ps, Pz;
+    std::unordered_map< const void*, fxc_ground_state > tasks;
+  };
+  fxc_ground_state_cache fxc_cache_;
+
+  // Execute op( task_begin, task_end, accumulate ) over the local tasks, 
+  // streamed in chunks if they are held out-of-core (see 
+  // detail::stream_local_work)
+  template <typename Op>
+  void stream_local_work_( Op&& op ) {
+    stream_local_work( *this->load_balancer_, std::forward<Op>(op) );
+  }
 
 public:
 
@@ -42,18 +42,19 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     GAUXC_GENERIC_EXCEPTION("Invalid LDPX");
 
 
-  // Get Tasks
-  auto& tasks = this->load_balancer_->get_tasks();
-
   // Temporary electron count to judge integrator accuracy
   value_type N_EL;
 
-  // Compute Local contributions to EXC / VXC
+  // Compute Local contributions to EXC / VXC (streamed over the tasks)
   this->timer_.time_op("XCIntegrator.LocalWork", [&](){
     //exc_vxc_local_work_( P, ldp, VXC, ldvxc, EXC, &N_EL );
-    exc_vxc_local_work_( basis, Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx,
-                         nullptr, 0, nullptr, 0, nullptr, 0, nullptr, 0, 
-                         EXC, &N_EL, ks_settings, tasks.begin(), tasks.end() );
+    stream_local_work_( 
+      [&]( task_iterator task_begin, task_iterator task_end, bool accumulate ) {
+      exc_vxc_local_work_( basis, Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx,
+                           nullptr, 0, nullptr, 0, nullptr, 0, nullptr, 0, 
+                           EXC, &N_EL, ks_settings, task_begin, task_end,
+                           accumulate );
+    });
   });
 
 
@@ -63,8 +64,9 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     if( not this->reduction_driver_->takes_host_memory() )
       GAUXC_GENERIC_EXCEPTION("This Module Only Works With Host Reductions");
 
-    this->reduction_driver_->allreduce_inplace( EXC,   1    , ReductionOp::Sum );
-    this->reduction_driver_->allreduce_inplace( &N_EL, 1    , ReductionOp::Sum );
+    this->reduction_driver_->template allreduce_packed<value_type>( 
+      { ReductionBuffer::scalar(EXC), ReductionBuffer::scalar(&N_EL) },
+      ReductionOp::Sum );
 
   });
 
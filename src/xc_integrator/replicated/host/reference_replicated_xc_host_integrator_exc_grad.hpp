@@ -8,6 +8,7 @@
 #pragma once
 
 #include "reference_replicated_xc_host_integrator.hpp"
+#include "integrator_util/point_group_symmetrizer.hpp"
 #include "integrator_util/integrator_common.hpp"
 #include "host/local_host_work_driver.hpp"
 #include "host/blas.hpp"
@@ -15,10 +16,21 @@
 
 namespace GauXC::detail {
 
+/**
+ *  Generic implementation of the EXC gradient for RKS/UKS/GKS
+ *  
+ *  If passed pointers are null-y and the leading dimensions
+ *  are zero, RKS/UKS are deduced. RKS/UKS drivers delegate
+ *  to this function
+ */
 template <typename ValueType>
 void ReferenceReplicatedXCHostIntegrator<ValueType>::
-  eval_exc_grad_( int64_t m, int64_t n, const value_type* P,
-                 int64_t ldp, value_type* EXC_GRAD ) { 
+  eval_exc_grad_( int64_t m, int64_t n, 
+                  const value_type* Ps, int64_t ldps,
+                  const value_type* Pz, int64_t ldpz,
+                  const value_type* Py, int64_t ldpy,
+                  const value_type* Px, int64_t ldpx,
+                  value_type* EXC_GRAD, const IntegratorSettingsXC& settings ) { 
                  
                  
   const auto& basis = this->load_balancer_->basis();
@@ -29,16 +41,24 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     GAUXC_GENERIC_EXCEPTION("P Must Be Square");
   if( m != nbf ) 
     GAUXC_GENERIC_EXCEPTION("P Must Have Same Dimension as Basis");
-  if( ldp < nbf )
-    GAUXC_GENERIC_EXCEPTION("Invalid LDP");
+  if( ldps < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDPS");
+  if( ldpz and ldpz < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDPZ");
+  if( ldpy and ldpy < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDPY");
+  if( ldpx and ldpx < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDPX");
                  
                  
-  // Get Tasks
-  this->load_balancer_->get_tasks();
-                 
-  // Compute Local contributions to EXC / VXC
+  // Compute Local contributions to EXC_GRAD (streamed over the tasks)
+  const int64_t natoms = this->load_balancer_->molecule().natoms();
   this->timer_.time_op("XCIntegrator.LocalWork", [&](){
-    exc_grad_local_work_( P, ldp, EXC_GRAD );
+    stream_local_work_( 
+      [&]( task_iterator task_begin, task_iterator task_end, bool accumulate ) {
+      exc_grad_local_work_( Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx, EXC_GRAD,
+        settings, task_begin, task_end, accumulate );
+    });
   });
 
 
@@ -48,15 +68,82 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     if( not this->reduction_driver_->takes_host_memory() )
       GAUXC_GENERIC_EXCEPTION("This Module Only Works With Host Reductions");
 
-    const int natoms = this->load_balancer_->molecule().natoms();
     this->reduction_driver_->allreduce_inplace( EXC_GRAD, 3*natoms, ReductionOp::Sum );
   });
 
+  // Symmetrize over the point group exploited by the load balancer
+  const auto& point_group = this->load_balancer_->state().point_group;
+  if( not point_group.is_trivial() )
+  this->timer_.time_op("XCIntegrator.Symmetrize", [&](){
+    PointGroupSymmetrizer sym( point_group, this->load_balancer_->molecule(), 
+      basis );
+    sym.symmetrize_gradient( EXC_GRAD );
+  });
+
 }
 
+/// RKS EXC Gradient driver - delegates to generic GKS impl
 template <typename ValueType>
 void ReferenceReplicatedXCHostIntegrator<ValueType>::
-  exc_grad_local_work_( const value_type* P, int64_t ldp, value_type* EXC_GRAD ) {
+  eval_exc_grad_( int64_t m, int64_t n, const value_type* P,
+                  int64_t ldp, value_type* EXC_GRAD, 
+                  const IntegratorSettingsXC& settings ) { 
+
+  eval_exc_grad_( m, n, P, ldp, nullptr, 0, nullptr, 0, nullptr, 0,
+    EXC_GRAD, settings );
+
+}
+
+/// UKS EXC Gradient driver - delegates to generic GKS impl
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  eval_exc_grad_( int64_t m, int64_t n, 
+                  const value_type* Ps, int64_t ldps,
+                  const value_type* Pz, int64_t ldpz,
+                  value_type* EXC_GRAD, const IntegratorSettingsXC& settings ) { 
+
+  eval_exc_grad_( m, n, Ps, ldps, Pz, ldpz, nullptr, 0, nullptr, 0,
+    EXC_GRAD, settings );
+
+}
+
+/// Generic implementation details of the EXC gradient local work - deduces 
+/// RKS/UKS/GKS based on null-y / zero parameters
+///
+/// With the scalar / magnetization densities rho_c = P_c(mu,nu) B_mu B_nu,
+/// c = s (,z (,x,y)), the (fixed-point) basis function contributions read
+///
+///   dE/dR_A = -2 sum_i sum_{mu in A} sum_c [ a_c(i) X_c(mu,i) dB_mu(i) +
+///     A_c(i) . ( d(grad B_mu)(i) X_c(mu,i) + dB_mu(i) grad X_c(mu,i) ) ]
+///
+/// where X_c = P_c * B, a_c = w_i d eps / d rho_c and A_c = w_i d eps / d grad(rho_c)
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  exc_grad_local_work_( const value_type* Ps, int64_t ldps,
+                        const value_type* Pz, int64_t ldpz,
+                        const value_type* Py, int64_t ldpy,
+                        const value_type* Px, int64_t ldpx,
+                        value_type* EXC_GRAD, const IntegratorSettingsXC& settings,
+                        task_iterator task_begin, task_iterator task_end,
+                        bool accumulate ) {
+
+  const bool is_gks = (Pz != nullptr) and (Py != nullptr) and (Px != nullptr);
+  const bool is_uks = (Pz != nullptr) and (Py == nullptr) and (Px == nullptr);
+  const bool is_rks = (Pz == nullptr) and (Py == nullptr) and (Px == nullptr);
+  if (not is_rks and not is_uks and not is_gks) {
+    GAUXC_GENERIC_EXCEPTION("Must Be Either RKS, UKS, or GKS!");
+  }
+
+  // Misc gradient settings
+  IntegratorSettingsEXCGrad grad_settings;
+  if( auto* tmp = dynamic_cast<const IntegratorSettingsEXCGrad*>(&settings) ) {
+    grad_settings = *tmp;
+  } else if( auto* tmp = dynamic_cast<const IntegratorSettingsKS*>(&settings) ) {
+    grad_settings.gks_dtol = tmp->gks_dtol;
+  }
+
+  const double gks_dtol      = grad_settings.gks_dtol;
+  const bool   weight_derivs = grad_settings.include_weight_derivatives;
 
   // Cast LWD to LocalHostWorkDriver
   auto* lwd = dynamic_cast<LocalHostWorkDriver*>(this->local_work_driver_.get());
@@ -65,24 +152,24 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   const auto& func  = *this->func_;
   const auto& basis = this->load_balancer_->basis();
   const auto& mol   = this->load_balancer_->molecule();
+  const auto& meta  = this->load_balancer_->molmeta();
+
+  if( func.is_mgga() )
+    GAUXC_GENERIC_EXCEPTION("MGGA Gradients Not Yet Implemented");
 
-  // MGGA constants
-  const size_t mmga_dim_scal = func.is_mgga() ? 4 : 1;
-  const bool needs_laplacian = func.is_mgga() ? true : false; // TODO: Check for Laplacian dependence
-							      //
   // Get basis map
-  BasisSetMap basis_map(basis,mol);
+  const auto& basis_map = this->load_balancer_->basis_map();
 
   const int32_t nbf = basis.nbf();
   const int32_t natoms = mol.natoms();
 
-  // Sort tasks on size (XXX: maybe doesnt matter?)
-  auto task_comparator = []( const XCTask& a, const XCTask& b ) {
-    return (a.points.size() * a.bfn_screening.nbe) > (b.points.size() * b.bfn_screening.nbe);
+  // Order tasks on size (see LoadBalancerState::task_ordering)
+  auto task_cost = []( const XCTask& t ) {
+    return double(t.points.size() * t.bfn_screening.nbe);
   };
 
-  auto& tasks = this->load_balancer_->get_tasks();
-  std::sort( tasks.begin(), tasks.end(), task_comparator );
+  order_tasks( this->load_balancer_->state().task_ordering, task_begin, task_end,
+    task_cost );
 
 
   // Check that Partition Weights have been calculated
@@ -91,101 +178,103 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     GAUXC_GENERIC_EXCEPTION("Weights Have Not Been Modified"); 
   }
 
+  // Populate SoA point storage and submatrix maps consumed by the host kernels
+  generate_points_soa( task_begin, task_end );
+  populate_submat_maps( nbf, task_begin, task_end, basis_map );
+
   // Zero out integrands
+  if( not accumulate )
   for( auto i = 0; i < 3*natoms; ++i ) {
     EXC_GRAD[i] = 0.;
   }
 
+  // Density components (s, z, x, y) and the corresponding density matrices
+  const int32_t ncomp = is_rks ? 1 : is_uks ? 2 : 4;
+  const value_type* Pc[4]   = { Ps,   Pz,   Px,   Py   };
+  const int64_t     ldpc[4] = { ldps, ldpz, ldpx, ldpy };
+
+  // Component offsets into the GKS gradient and K / H storage 
+  // (see eval_uvvar_gga_gks)
+  const int32_t dden_off[4] = { 0, 1, 3, 2 };
+  const int32_t kh_off[4]   = { 0, 0, 2, 1 };
+
   // Loop over tasks
-  const size_t ntasks = tasks.size();
+  const size_t ntasks = std::distance(task_begin, task_end);
   #pragma omp parallel
   {
 
   XCHostData<value_type> host_data; // Thread local host data
+  std::vector<value_type> exc_grad_w( weight_derivs ? 3*natoms : 0, 0. );
 
   #pragma omp for schedule(dynamic)
   for( size_t iT = 0; iT < ntasks; ++iT ) {
 
     // Alias current task
-    const auto& task = tasks[iT];
+    const auto& task = *(task_begin + iT);
 
     // Get tasks constants
     const int32_t  npts    = task.points.size();
     const int32_t  nbe     = task.bfn_screening.nbe;
     const int32_t  nshells = task.bfn_screening.shell_list.size();
 
-    const auto* points      = task.points.data()->data();
+    const auto* points      = task.points_soa.data();
     const auto* weights     = task.weights.data();
     const int32_t* shell_list = task.bfn_screening.shell_list.data();
 
     // Allocate enough memory for batch
+    const size_t sds          = is_rks ? 1 : 2;
+    const size_t gga_dim_scal = is_rks ? 1 : 3;
+    const size_t xmat_dim     = func.is_gga() ? 4 : 1; // basis (+ grad)
 
     // Things that every calc needs
     host_data.nbe_scr .resize( nbe * nbe  );
     host_data.eps     .resize( npts );
-    host_data.vrho    .resize( npts );
-    host_data.den_scr .resize( 4 * npts );
+    host_data.vrho    .resize( sds * npts );
+    host_data.den_scr .resize( 4 * ncomp * npts );
+    host_data.zmat    .resize( ncomp * xmat_dim * npts * nbe );
+    host_data.gmat    .resize( 4 * ncomp * npts + (is_gks ? 6 * npts : 0) );
 
     if( func.is_lda() ) {
       host_data.basis_eval .resize( 4 * npts * nbe );
-      host_data.zmat       .resize( npts * nbe );
     }
 
     if( func.is_gga() ){
       host_data.basis_eval .resize( 10 * npts * nbe );
-      host_data.zmat       .resize( 4  * npts * nbe );
-      host_data.gamma      .resize( npts );
-      host_data.vgamma     .resize( npts );
+      host_data.gamma      .resize( gga_dim_scal * npts );
+      host_data.vgamma     .resize( gga_dim_scal * npts );
     }
 
-#if 0
-    if( func.is_mgga() ) {
-      host_data.basis_eval .resize( 11 * npts * nbe ); // basis + grad(3) + hess(6) + lapl
-      host_data.zmat       .resize(  7 * npts * nbe ); // basis + grad(3) + grad(3)
-      host_data.mmat       .resize( npts * nbe );
-      host_data.gamma      .resize( npts );
-      host_data.vgamma     .resize( npts );
-      host_data.tau        .resize( npts );
-      host_data.vtau       .resize( npts );
-      if ( needs_laplacian ) {
-	host_data.basis_eval.resize( 24 * npts * nbe );
-	host_data.lapl      .resize( npts );
-	host_data.vlapl     .resize( npts );
-      }
-    }
-#endif
-
     // Alias/Partition out scratch memory
     auto* basis_eval = host_data.basis_eval.data();
     auto* den_eval   = host_data.den_scr.data();
     auto* nbe_scr    = host_data.nbe_scr.data();
-    auto* zmat       = host_data.zmat.data();
 
-    auto* zmat_x = zmat   + npts*nbe;
-    auto* zmat_y = zmat_x + npts*nbe;
-    auto* zmat_z = zmat_y + npts*nbe;
+    // X_c = P_c * B (+ P_c * grad(B)) for each density component
+    value_type* xmat[4] = {};
+    for( int32_t c = 0; c < ncomp; ++c )
+      xmat[c] = host_data.zmat.data() + c * xmat_dim * npts * nbe;
+
+    // Per-point coefficients a_c / A_c (+ GKS K / H)
+    value_type* coef_a[4] = {};
+    value_type* coef_A[4] = {};
+    for( int32_t c = 0; c < ncomp; ++c ) {
+      coef_a[c] = host_data.gmat.data() + 4 * c * npts;
+      coef_A[c] = coef_a[c] + npts; // (3,npts)
+    }
+    value_type* K = is_gks ? host_data.gmat.data() + 4 * ncomp * npts : nullptr;
+    value_type* H = is_gks ? K + 3*npts : nullptr;
 
     auto* eps        = host_data.eps.data();
     auto* gamma      = host_data.gamma.data();
     auto* vrho       = host_data.vrho.data();
     auto* vgamma     = host_data.vgamma.data();
 
-#if 0
-    auto* tau        = host_data.tau.data();
-    auto* lapl       = host_data.lapl.data();
-    auto* vtau       = host_data.vtau.data();
-    auto* vlapl      = host_data.vlapl.data();
-    auto* mmat_x      = mmat;
-    auto* mmat_y      = mmat_x + npts * nbe;
-    auto* mmat_z      = mmat_y + npts * nbe;
-#endif
-
     auto* dbasis_x_eval = basis_eval    + npts * nbe;
     auto* dbasis_y_eval = dbasis_x_eval + npts * nbe;
     auto* dbasis_z_eval = dbasis_y_eval + npts * nbe;
-    auto* dden_x_eval   = den_eval    + npts;
-    auto* dden_y_eval   = dden_x_eval + npts;
-    auto* dden_z_eval   = dden_y_eval + npts;
+    auto* dden_x_eval   = den_eval    + ncomp * npts;
+    auto* dden_y_eval   = dden_x_eval + ncomp * npts;
+    auto* dden_z_eval   = dden_y_eval + ncomp * npts;
 
     value_type* d2basis_xx_eval = nullptr;
     value_type* d2basis_xy_eval = nullptr;
@@ -193,22 +282,6 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     value_type* d2basis_yy_eval = nullptr;
     value_type* d2basis_yz_eval = nullptr;
     value_type* d2basis_zz_eval = nullptr;
-#if 0
-    value_type* lbasis_eval = nullptr;
-    value_type* d3basis_xxx_eval = nullptr;
-    value_type* d3basis_xxy_eval = nullptr;
-    value_type* d3basis_xxz_eval = nullptr;
-    value_type* d3basis_xyy_eval = nullptr;
-    value_type* d3basis_xyz_eval = nullptr;
-    value_type* d3basis_xzz_eval = nullptr;
-    value_type* d3basis_yyy_eval = nullptr;
-    value_type* d3basis_yyz_eval = nullptr;
-    value_type* d3basis_yzz_eval = nullptr;
-    value_type* d3basis_zzz_eval = nullptr;
-    value_type* dlbasis_x_eval = nullptr;
-    value_type* dlbasis_y_eval = nullptr;
-    value_type* dlbasis_z_eval = nullptr;
-#endif
 
     if( func.is_gga() ) {
       d2basis_xx_eval = dbasis_z_eval   + npts * nbe;
@@ -219,51 +292,11 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
       d2basis_zz_eval = d2basis_yz_eval + npts * nbe;
     }
 
-#if 0
-    if( func.is_mgga() ) {
-      d2basis_xx_eval = dbasis_z_eval   + npts * nbe;
-      d2basis_xy_eval = d2basis_xx_eval + npts * nbe;
-      d2basis_xz_eval = d2basis_xy_eval + npts * nbe;
-      d2basis_yy_eval = d2basis_xz_eval + npts * nbe;
-      d2basis_yz_eval = d2basis_yy_eval + npts * nbe;
-      d2basis_zz_eval = d2basis_yz_eval + npts * nbe;
-      if ( true ) {
-	lbasis_eval   = d2basis_zz_eval + npts * nbe;
-	d3basis_xxx_eval = lbasis_eval + npts * nbe;
-	d3basis_xxy_eval = d3basis_xxx_eval + npts * nbe;
-	d3basis_xxz_eval = d3basis_xxy_eval + npts * nbe;
-	d3basis_xyy_eval = d3basis_xxz_eval + npts * nbe;
-	d3basis_xyz_eval = d3basis_xyy_eval + npts * nbe;
-	d3basis_xzz_eval = d3basis_xyz_eval + npts * nbe;
-	d3basis_yyy_eval = d3basis_xzz_eval + npts * nbe;
-	d3basis_yyz_eval = d3basis_yyy_eval + npts * nbe;
-	d3basis_yzz_eval = d3basis_yyz_eval + npts * nbe;
-	d3basis_zzz_eval = d3basis_yzz_eval + npts * nbe;
-        dlbasis_x_eval = d3basis_zzz_eval + npts * nbe;
-	dlbasis_y_eval = dlbasis_x_eval + npts * nbe;
-	dlbasis_z_eval = dlbasis_y_eval + npts * nbe;
-      }
-    }
-#endif
-
 
     // Get the submatrix map for batch
-    auto [submat_map, foo] = 
-      gen_compressed_submat_map( basis_map, task.bfn_screening.shell_list, nbf, nbf );
+    const auto& submat_map = task.bfn_screening.submat_map;
 
     // Evaluate Collocation Gradient (+ Hessian)
-#if 0
-    if( func.is_mgga() ) {
-      lwd->eval_collocation_der3( npts, nshells, nbe, points, basis, shell_list, 
-        basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval, d2basis_xx_eval,
-        d2basis_xy_eval, d2basis_xz_eval, d2basis_yy_eval, d2basis_yz_eval,
-        d2basis_zz_eval, d3basis_xxx_eval, d3basis_xxy_eval, d3basis_xxz_eval,
-	d3basis_xyy_eval, d3basis_xyz_eval, d3basis_xzz_eval, d3basis_yyy_eval,
-	d3basis_yyz_eval, d3basis_yzz_eval, d3basis_zzz_eval);
-
-    }
-    else if( func.is_gga() )
-#endif
     if( func.is_gga() )
       lwd->eval_collocation_hessian( npts, nshells, nbe, points, basis, shell_list, 
         basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval, d2basis_xx_eval,
@@ -274,64 +307,113 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
         basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval );
 
 
-    // Evaluate X matrix (2 * P * B/Bx/By/Bz) -> store in Z
+    // Evaluate X matrix (fac * P * B/Bx/By/Bz)
     // XXX: This assumes that bfn + gradients are contiguous in memory
-    if( func.is_gga() or func.is_mgga() ) {
-      lwd->eval_xmat( 4*npts, nbf, nbe, submat_map, 2.0, P, ldp, basis_eval, nbe,
-        zmat, nbe, nbe_scr );
-    } else {
-      lwd->eval_xmat( npts, nbf, nbe, submat_map, 2.0, P, ldp, basis_eval, nbe,
-        zmat, nbe, nbe_scr );
+    const auto xmat_fac = is_rks ? 2.0 : 1.0;
+    for( int32_t c = 0; c < ncomp; ++c ) {
+      lwd->eval_xmat( xmat_dim*npts, nbf, nbe, submat_map, xmat_fac, Pc[c], ldpc[c], 
+        basis_eval, nbe, xmat[c], nbe, nbe_scr );
     }
 
     // Evaluate U and V variables
-#if 0
-    if( func.is_mgga() ) {
-      if ( needs_laplacian ) {
-        blas::lacpy( 'A', nbe, npts, d2basis_xx_eval, nbe, lbasis_eval, nbe );
-        blas::axpy( nbe * npts, 1., d2basis_yy_eval, 1, lbasis_eval, 1);
-        blas::axpy( nbe * npts, 1., d2basis_zz_eval, 1, lbasis_eval, 1);
-
-	blas::lacpy( 'A', nbe, npts, d3basis_xxx_eval, nbe, dlbasis_x_eval, nbe );
-        blas::axpy( nbe * npts, 1., d3basis_xyy_eval, 1, dlbasis_x_eval, 1);
-        blas::axpy( nbe * npts, 1., d3basis_xzz_eval, 1, dlbasis_x_eval, 1);
-
-	blas::lacpy( 'A', nbe, npts, d3basis_xxy_eval, nbe, dlbasis_y_eval, nbe );
-        blas::axpy( nbe * npts, 1., d3basis_yyy_eval, 1, dlbasis_y_eval, 1);
-        blas::axpy( nbe * npts, 1., d3basis_yzz_eval, 1, dlbasis_y_eval, 1);
-
-	blas::lacpy( 'A', nbe, npts, d3basis_xxz_eval, nbe, dlbasis_z_eval, nbe );
-        blas::axpy( nbe * npts, 1., d3basis_yyz_eval, 1, dlbasis_z_eval, 1);
-        blas::axpy( nbe * npts, 1., d3basis_zzz_eval, 1, dlbasis_z_eval, 1);
+    if( func.is_gga() ) {
+      if( is_rks ) {
+        lwd->eval_uvvar_gga_rks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+          dbasis_z_eval, xmat[0], nbe, den_eval, dden_x_eval, dden_y_eval, dden_z_eval,
+          gamma );
+      } else if( is_uks ) {
+        lwd->eval_uvvar_gga_uks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+          dbasis_z_eval, xmat[0], nbe, xmat[1], nbe, den_eval, dden_x_eval, 
+          dden_y_eval, dden_z_eval, gamma );
+      } else {
+        lwd->eval_uvvar_gga_gks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+          dbasis_z_eval, xmat[0], nbe, xmat[1], nbe, xmat[2], nbe, xmat[3], nbe, 
+          den_eval, dden_x_eval, dden_y_eval, dden_z_eval, gamma, K, H, gks_dtol );
+      }
+    } else {
+      if( is_rks ) {
+        lwd->eval_uvvar_lda_rks( npts, nbe, basis_eval, xmat[0], nbe, den_eval );
+      } else if( is_uks ) {
+        lwd->eval_uvvar_lda_uks( npts, nbe, basis_eval, xmat[0], nbe, xmat[1], nbe,
+          den_eval );
+      } else {
+        lwd->eval_uvvar_lda_gks( npts, nbe, basis_eval, xmat[0], nbe, xmat[1], nbe,
+          xmat[2], nbe, xmat[3], nbe, den_eval, K, gks_dtol );
       }
-      lwd->eval_uvvar_mgga_rks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
-        dbasis_z_eval, lbasis_eval, zmat, nbe, mmat_x, mmat_y, mmat_z, nbe, 
-	den_eval, dden_x_eval, dden_y_eval, dden_z_eval,
-        gamma, tau, lapl );
     }
-    else if( func.is_gga() )
-#endif
-    if( func.is_gga() )
-      lwd->eval_uvvar_gga_rks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
-        dbasis_z_eval, zmat, nbe, den_eval, dden_x_eval, dden_y_eval, dden_z_eval,
-        gamma );
-     else
-      lwd->eval_uvvar_lda_rks( npts, nbe, basis_eval, zmat, nbe, den_eval );
 
 
     // Evaluate XC functional
-#if 0
-    if( func.is_mgga() )
-      func.eval_exc_vxc( npts, den_eval, gamma, lapl, tau, eps, vrho, vgamma, vlapl, vtau );
-    else if(func.is_gga() )
-#endif
     if( func.is_gga() )
       func.eval_exc_vxc( npts, den_eval, gamma, eps, vrho, vgamma );
     else
       func.eval_exc_vxc( npts, den_eval, eps, vrho );
 
 
+    // Weighted derivatives of eps wrt the density components (a_c) and 
+    // their gradients (A_c)
+    for( int32_t i = 0; i < npts; ++i ) {
+
+      const double w = weights[i];
+
+      if( is_rks ) {
+        coef_a[0][i] = w * vrho[i];
+        if( func.is_gga() ) {
+          const double fact = 2. * w * vgamma[i];
+          coef_A[0][i]          = fact * dden_x_eval[i];
+          coef_A[0][i + npts]   = fact * dden_y_eval[i];
+          coef_A[0][i + 2*npts] = fact * dden_z_eval[i];
+        }
+        continue;
+      }
+
+      // rho_+- = 0.5 * (rho_s +- |m|)
+      const double a_s = 0.5 * w * (vrho[2*i] + vrho[2*i+1]);
+      const double a_m = 0.5 * w * (vrho[2*i] - vrho[2*i+1]);
+      coef_a[0][i] = a_s;
+      if( is_uks ) coef_a[1][i] = a_m;
+      else {
+        for( int32_t c = 1; c < 4; ++c ) coef_a[c][i] = K[kh_off[c]*npts + i] * a_m;
+      }
+
+      if( not func.is_gga() ) continue;
+
+      const double gga_fact_pp = vgamma[3*i];
+      const double gga_fact_pm = vgamma[3*i+1];
+      const double gga_fact_mm = vgamma[3*i+2];
+
+      const double gga_fact_1 = 0.5 * w * (gga_fact_pp + gga_fact_pm + gga_fact_mm);
+      const double gga_fact_2 = 0.5 * w * (gga_fact_pp - gga_fact_mm);
+      const double gga_fact_3 = 0.5 * w * (gga_fact_pp - gga_fact_pm + gga_fact_mm);
+
+      const double* dden[3] = { dden_x_eval, dden_y_eval, dden_z_eval };
+      for( int k = 0; k < 3; ++k ) {
+
+        const double dn = dden[k][ncomp*i];
+        
+        // Projection of grad(m) onto the magnetization (UKS: grad(m_z))
+        double dm = 0.;
+        if( is_uks ) dm = dden[k][2*i+1];
+        else {
+          for( int32_t c = 1; c < 4; ++c ) 
+            dm += H[kh_off[c]*npts + i] * dden[k][4*i + dden_off[c]];
+        }
+
+        coef_A[0][i + k*npts] = gga_fact_1 * dn + gga_fact_2 * dm;
+        if( is_uks ) coef_A[1][i + k*npts] = gga_fact_3 * dm + gga_fact_2 * dn;
+        else {
+          for( int32_t c = 1; c < 4; ++c ) 
+            coef_A[c][i + k*npts] = gga_fact_3 * dden[k][4*i + dden_off[c]] +
+              gga_fact_2 * H[kh_off[c]*npts + i] * dn;
+        }
+
+      }
+
+    }
+
+
     // Increment EXC Gradient
+    double g_task_x(0), g_task_y(0), g_task_z(0);
     size_t bf_off = 0;
     for( auto ish = 0; ish < nshells; ++ish ) {
       const int sh_idx = shell_list[ish];
@@ -342,91 +424,53 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
       for( int ibf = 0, mu = bf_off; ibf < sh_sz; ++ibf, ++mu )
       for( int ipt = 0; ipt < npts; ++ipt ) {
 
-	      const int32_t mu_i = mu + ipt*nbe;
-
-	      // LDA Contributions
-        const double vrho_ipt = weights[ipt] * vrho[ipt];
-
-	      const double z = zmat[mu_i]; // Z = N * B
-
-	      const double dbx = dbasis_x_eval[mu_i]; // B_x
-	      const double dby = dbasis_y_eval[mu_i]; // B_y
-	      const double dbz = dbasis_z_eval[mu_i]; // B_z
-
-	      g_acc_x += vrho_ipt * z * dbx;
-	      g_acc_y += vrho_ipt * z * dby;
-	      g_acc_z += vrho_ipt * z * dbz;
-
-	      if( func.is_gga() or func.is_mgga() ) {
-      	  // GGA Contributions
-          const double vgamma_ipt = weights[ipt] * vgamma[ipt];
-
-          const double dden_x = dden_x_eval[ipt];
-          const double dden_y = dden_y_eval[ipt];
-          const double dden_z = dden_z_eval[ipt];
-
-	        const double zx = zmat_x[mu_i]; // Z_x = N * B_x
-	        const double zy = zmat_y[mu_i]; // Z_y = N * B_y
-	        const double zz = zmat_z[mu_i]; // Z_z = N * B_z
-
-	        const double d2bxx = d2basis_xx_eval[mu_i]; // B^2_xx
-	        const double d2bxy = d2basis_xy_eval[mu_i]; // B^2_xy
-	        const double d2bxz = d2basis_xz_eval[mu_i]; // B^2_xz
-	        const double d2byy = d2basis_yy_eval[mu_i]; // B^2_yy
-	        const double d2byz = d2basis_yz_eval[mu_i]; // B^2_yz
-	        const double d2bzz = d2basis_zz_eval[mu_i]; // B^2_zz
-
-	        // sum_j B^2_{ij} * d_j n
-	        double d2_term_x = d2bxx * dden_x + d2bxy * dden_y + d2bxz * dden_z;
-	        double d2_term_y = d2bxy * dden_x + d2byy * dden_y + d2byz * dden_z;
-	        double d2_term_z = d2bxz * dden_x + d2byz * dden_y + d2bzz * dden_z;
-
-	        // sum_j (d_j n) * Z^j
-	        double d11_zmat_term = dden_x * zx + dden_y * zy + dden_z * zz;
-
-	        g_acc_x += 2 * vgamma_ipt * ( z * d2_term_x + dbx * d11_zmat_term );
-	        g_acc_y += 2 * vgamma_ipt * ( z * d2_term_y + dby * d11_zmat_term );
-	        g_acc_z += 2 * vgamma_ipt * ( z * d2_term_z + dbz * d11_zmat_term );
-	      }
-#if 0
-	      if( func.is_mgga() ) {
-
-                const double vtau_ipt = 0.5 * weights[ipt] * vtau[ipt];
-	        const double zx = zmat_x[mu_i]; // Z_x = N * B_x
-	        const double zy = zmat_y[mu_i]; // Z_y = N * B_y
-	        const double zz = zmat_z[mu_i]; // Z_z = N * B_z
-	        const double d2bxx = d2basis_xx_eval[mu_i]; // B^2_xx
-	        const double d2bxy = d2basis_xy_eval[mu_i]; // B^2_xy
-	        const double d2bxz = d2basis_xz_eval[mu_i]; // B^2_xz
-	        const double d2byy = d2basis_yy_eval[mu_i]; // B^2_yy
-	        const double d2byz = d2basis_yz_eval[mu_i]; // B^2_yz
-	        const double d2bzz = d2basis_zz_eval[mu_i]; // B^2_zz
-		double d2_term_x = d2bxx * zx + d2bxy * zy + d2bxz * zz;
-		double d2_term_y = d2bxy * zx + d2byy * zy + d2byz * zz;
-		double d2_term_z = d2bxz * zx + d2byz * zy + d2bzz * zz;
-
-		g_acc_x += vtau_ipt * d2_term_x;
-		g_acc_y += vtau_ipt * d2_term_y;
-		g_acc_z += vtau_ipt * d2_term_z;
-
-		if ( needs_laplacian ) {
-		  const double vlapl_ipt = weights[ipt] * vlapl[ipt];
-		  const double lbf = lbasis_eval[mu_i];
-                  const double dlbx = dlbasis_x_eval[mu_i];
-                  const double dlby = dlbasis_y_eval[mu_i];
-                  const double dlbz = dlbasis_z_eval[mu_i];
-		  d2_term_x = z * dlbx + zx * lbf + 2.0*d2_term_x;
-		  d2_term_y = z * dlby + zy * lbf + 2.0*d2_term_y;
-		  d2_term_z = z * dlbz + zz * lbf + 2.0*d2_term_z;
-
-		  g_acc_x += vlapl_ipt * d2_term_x;
-		  g_acc_y += vlapl_ipt * d2_term_y;
-		  g_acc_z += vlapl_ipt * d2_term_z;
-
-		}
-
-	      }
-#endif
+        const int32_t mu_i = mu + ipt*nbe;
+
+        const double dbx = dbasis_x_eval[mu_i]; // B_x
+        const double dby = dbasis_y_eval[mu_i]; // B_y
+        const double dbz = dbasis_z_eval[mu_i]; // B_z
+
+        for( int32_t c = 0; c < ncomp; ++c ) {
+
+          // LDA Contributions
+          const double a_ipt = coef_a[c][ipt];
+          const double z = xmat[c][mu_i]; // Z = N * B
+
+          g_acc_x += a_ipt * z * dbx;
+          g_acc_y += a_ipt * z * dby;
+          g_acc_z += a_ipt * z * dbz;
+
+          if( func.is_gga() ) {
+            // GGA Contributions
+            const double A_x = coef_A[c][ipt];
+            const double A_y = coef_A[c][ipt + npts];
+            const double A_z = coef_A[c][ipt + 2*npts];
+
+            const double zx = xmat[c][mu_i +   npts*nbe]; // Z_x = N * B_x
+            const double zy = xmat[c][mu_i + 2*npts*nbe]; // Z_y = N * B_y
+            const double zz = xmat[c][mu_i + 3*npts*nbe]; // Z_z = N * B_z
+
+            const double d2bxx = d2basis_xx_eval[mu_i]; // B^2_xx
+            const double d2bxy = d2basis_xy_eval[mu_i]; // B^2_xy
+            const double d2bxz = d2basis_xz_eval[mu_i]; // B^2_xz
+            const double d2byy = d2basis_yy_eval[mu_i]; // B^2_yy
+            const double d2byz = d2basis_yz_eval[mu_i]; // B^2_yz
+            const double d2bzz = d2basis_zz_eval[mu_i]; // B^2_zz
+
+            // sum_j B^2_{ij} * A_j
+            double d2_term_x = d2bxx * A_x + d2bxy * A_y + d2bxz * A_z;
+            double d2_term_y = d2bxy * A_x + d2byy * A_y + d2byz * A_z;
+            double d2_term_z = d2bxz * A_x + d2byz * A_y + d2bzz * A_z;
+
+            // sum_j A_j * Z^j
+            double d11_zmat_term = A_x * zx + A_y * zy + A_z * zz;
+
+            g_acc_x += z * d2_term_x + dbx * d11_zmat_term;
+            g_acc_y += z * d2_term_y + dby * d11_zmat_term;
+            g_acc_z += z * d2_term_z + dbz * d11_zmat_term;
+          }
+
+        }
 
       } // loop over bfns + grid points
 
@@ -437,12 +481,42 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
       #pragma omp atomic
       EXC_GRAD[3*iAt + 2] += -2 * g_acc_z;
 
+      g_task_x += -2 * g_acc_x;
+      g_task_y += -2 * g_acc_y;
+      g_task_z += -2 * g_acc_z;
+
       bf_off += sh_sz; // Increment basis offset
 
     } // End loop over shells 
+
+    if( weight_derivs ) {
+
+      // The grid points move with the parent atom. By translational invariance,
+      // their contribution is minus the sum of the basis function terms
+      const int iParent = task.iParent;
+      exc_grad_w[3*iParent + 0] -= g_task_x;
+      exc_grad_w[3*iParent + 1] -= g_task_y;
+      exc_grad_w[3*iParent + 2] -= g_task_z;
+
+      // Partition weight derivatives contracted with eps * rho
+      for( int32_t i = 0; i < npts; ++i ) {
+        const auto den = is_rks ? den_eval[i] : (den_eval[2*i] + den_eval[2*i+1]);
+        eps[i] *= weights[i] * den;
+      }
+      lwd->eval_weight_1st_deriv_contracted( lb_state.weight_alg, mol, meta,
+        task, eps, exc_grad_w.data() );
+
+    }
         
   } // End loop over tasks
 
+  if( weight_derivs ) {
+    for( auto i = 0; i < 3*natoms; ++i ) {
+      #pragma omp atomic
+      EXC_GRAD[i] += exc_grad_w[i];
+    }
+  }
+
   } // OpenMP Region
 
   
@@ -8,10 +8,14 @@
 #pragma once
 
 #include "reference_replicated_xc_host_integrator.hpp"
+#include "integrator_util/point_group_symmetrizer.hpp"
+#include "integrator_util/host_buffer_placement.hpp"
 #include "integrator_util/integrator_common.hpp"
 #include "host/local_host_work_driver.hpp"
 #include "host/blas.hpp"
 #include <stdexcept>
+#include <optional>
+#include <algorithm>
 
 namespace GauXC::detail {
 
@@ -62,38 +66,102 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   if( ldvxcx and ldvxcx < nbf )
     GAUXC_GENERIC_EXCEPTION("Invalid LDVXCY");
 
-  // Get Tasks
-  auto& tasks = this->load_balancer_->get_tasks();
+  // Symmetrizing over the point group is only exact for totally symmetric
+  // densities, which GKS (spin) densities are not in general
+  const auto& point_group = this->load_balancer_->state().point_group;
+  if( Py and Px and not point_group.is_trivial() )
+    GAUXC_GENERIC_EXCEPTION("GKS Does Not Support Point Group Symmetry");
 
   // Temporary electron count to judge integrator accuracy
   value_type N_EL;
-   
-  // Compute Local contributions to EXC / VXC
-  this->timer_.time_op("XCIntegrator.LocalWork", [&](){
-    exc_vxc_local_work_( basis, Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx, 
-                         VXCs, ldvxcs, VXCz, ldvxcz,
-                         VXCy, ldvxcy, VXCx, ldvxcx, EXC, &N_EL, ks_settings,
-                         tasks.begin(), tasks.end() );
-  });
-
-
-  // Reduce Results
-  this->timer_.time_op("XCIntegrator.Allreduce", [&](){
 
-    if( not this->reduction_driver_->takes_host_memory() )
-      GAUXC_GENERIC_EXCEPTION("This Module Only Works With Host Reductions");
+  // The HIERARCHICAL reduction driver lets the ranks of a node accumulate
+  // VXC directly into a single node-shared buffer, which avoids the per-rank
+  // copies of VXC and their intra-node reduction
+  auto& reduction_driver = *this->reduction_driver_;
+  if( not reduction_driver.takes_host_memory() )
+    GAUXC_GENERIC_EXCEPTION("This Module Only Works With Host Reductions");
+
+  if( reduction_driver.supports_node_shared() ) {
+
+    std::vector<ReductionBuffer> vxc_buffers = {
+      ReductionBuffer::symmetric_matrix( VXCs, nbf, ldvxcs )
+    };
+    if(VXCz) vxc_buffers.push_back(ReductionBuffer::symmetric_matrix(VXCz, nbf, ldvxcz));
+    if(VXCy) vxc_buffers.push_back(ReductionBuffer::symmetric_matrix(VXCy, nbf, ldvxcy));
+    if(VXCx) vxc_buffers.push_back(ReductionBuffer::symmetric_matrix(VXCx, nbf, ldvxcx));
+
+    // Dense nbf x nbf blocks of the node buffer, in the order of vxc_buffers
+    auto* VXC_node = this->timer_.time_op("XCIntegrator.NodeSharedAlloc", [&](){
+      return reduction_driver.template node_shared_buffer<value_type>(
+        vxc_buffers.size() * nbf * nbf );
+    });
+    value_type* VXC_blk[4] = {nullptr, nullptr, nullptr, nullptr};
+    for( size_t i = 0; i < vxc_buffers.size(); ++i )
+      VXC_blk[i] = VXC_node + i * nbf * nbf;
+
+    // Local work increments the node buffer (atomically) and the scalars
+    *EXC = 0.; N_EL = 0.;
+    this->timer_.time_op("XCIntegrator.LocalWork", [&](){
+      stream_local_work_( [&]( task_iterator task_begin, task_iterator task_end, 
+        bool ) {
+        exc_vxc_local_work_( basis, Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx, 
+                             VXC_blk[0], nbf, VXC_blk[1], nbf,
+                             VXC_blk[2], nbf, VXC_blk[3], nbf, EXC, &N_EL, 
+                             ks_settings, task_begin, task_end, true, false );
+      });
+    });
+
+    this->timer_.time_op("XCIntegrator.Allreduce", [&](){
+      reduction_driver.template reduce_node_shared<value_type>( vxc_buffers,
+        ReductionOp::Sum );
+      reduction_driver.template allreduce_packed<value_type>( 
+        { ReductionBuffer::scalar( EXC ), ReductionBuffer::scalar( &N_EL ) },
+        ReductionOp::Sum );
+    });
+
+  } else {
+
+    // Compute Local contributions to EXC / VXC (streamed over the tasks)
+    this->timer_.time_op("XCIntegrator.LocalWork", [&](){
+      stream_local_work_( 
+        [&]( task_iterator task_begin, task_iterator task_end, bool accumulate ) {
+        exc_vxc_local_work_( basis, Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx, 
+                             VXCs, ldvxcs, VXCz, ldvxcz,
+                             VXCy, ldvxcy, VXCx, ldvxcx, EXC, &N_EL, ks_settings,
+                             task_begin, task_end, accumulate );
+      });
+    });
+
+    // Reduce Results
+    this->timer_.time_op("XCIntegrator.Allreduce", [&](){
+
+      // Single reduction of the (symmetric) VXC LTs + scalars
+      std::vector<ReductionBuffer> red_buffers = {
+        ReductionBuffer::symmetric_matrix( VXCs, nbf, ldvxcs ),
+        ReductionBuffer::scalar( EXC ),
+        ReductionBuffer::scalar( &N_EL )
+      };
+      if(VXCz) red_buffers.push_back(ReductionBuffer::symmetric_matrix(VXCz, nbf, ldvxcz));
+      if(VXCy) red_buffers.push_back(ReductionBuffer::symmetric_matrix(VXCy, nbf, ldvxcy));
+      if(VXCx) red_buffers.push_back(ReductionBuffer::symmetric_matrix(VXCx, nbf, ldvxcx));
+
+      reduction_driver.template allreduce_packed<value_type>( 
+        red_buffers, ReductionOp::Sum );
+
+    });
 
-    this->reduction_driver_->allreduce_inplace( VXCs, nbf*nbf, ReductionOp::Sum );
-    if(VXCz) this->reduction_driver_->allreduce_inplace( VXCz, nbf*nbf, ReductionOp::Sum );
-    if(VXCy) this->reduction_driver_->allreduce_inplace( VXCy, nbf*nbf, ReductionOp::Sum ); 
-    if(VXCx) this->reduction_driver_->allreduce_inplace( VXCx, nbf*nbf, ReductionOp::Sum );
-
-    this->reduction_driver_->allreduce_inplace( EXC,   1    , ReductionOp::Sum );
-    this->reduction_driver_->allreduce_inplace( &N_EL, 1    , ReductionOp::Sum );
+  }
 
+  // Symmetrize over the point group exploited by the load balancer
+  if( not point_group.is_trivial() )
+  this->timer_.time_op("XCIntegrator.Symmetrize", [&](){
+    PointGroupSymmetrizer sym( point_group, this->load_balancer_->molecule(), 
+      basis );
+    sym.symmetrize_matrix( VXCs, ldvxcs );
+    if(VXCz) sym.symmetrize_matrix( VXCz, ldvxcz );
   });
 
-
 }
 
 
@@ -111,7 +179,8 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
                        value_type* VXCx, int64_t ldvxcx,
                        value_type* EXC, value_type *N_EL, 
                        const IntegratorSettingsXC& settings,
-                       task_iterator task_begin, task_iterator task_end) {
+                       task_iterator task_begin, task_iterator task_end,
+                       bool accumulate, bool symmetrize ) {
 
   const bool is_gks = (Pz != nullptr) and (Py != nullptr) and (Px != nullptr);
   const bool is_uks = (Pz != nullptr) and (Py == nullptr) and (Px == nullptr);
@@ -132,31 +201,32 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
   const double gks_dtol = ks_settings.gks_dtol;
 
-  // Cast LWD to LocalHostWorkDriver
-  auto* lwd = dynamic_cast<LocalHostWorkDriver*>(this->local_work_driver_.get());
+  // Mixed precision is used until the SCF error drops below the tolerance
+  const bool use_mixed_precision = ks_settings.mixed_precision and 
+    ks_settings.scf_error >= ks_settings.mixed_precision_tol and
+    not is_gks and not this->func_->is_mgga();
 
   // Setup Aliases
-  const auto& func  = *this->func_;
   const auto& mol   = this->load_balancer_->molecule();
 
-  const bool needs_laplacian = func.needs_laplacian(); 
-  
-  if (func.is_mgga() and is_gks) {
-    GAUXC_GENERIC_EXCEPTION("GKS Not Yet Implemented With MGGA Functionals!");
-  }
-
   // Get basis map
-  BasisSetMap basis_map(basis,mol);
+  // Reuse the load balancer's BasisSetMap (and the submatrix maps cached on
+  // the tasks) unless integrating over a sub-basis (e.g. shell batching)
+  const bool is_lb_basis = &basis == &this->load_balancer_->basis();
+  std::optional<BasisSetMap> sub_basis_map;
+  if( not is_lb_basis ) sub_basis_map.emplace( basis, mol );
+  const auto& basis_map = 
+    is_lb_basis ? this->load_balancer_->basis_map() : *sub_basis_map;
 
   const int32_t nbf = basis.nbf();
 
-  // Sort tasks on size (XXX: maybe doesnt matter?)
-  auto task_comparator = []( const XCTask& a, const XCTask& b ) {
-    return (a.points.size() * a.bfn_screening.nbe) > (b.points.size() * b.bfn_screening.nbe);
+  // Order tasks on size (see LoadBalancerState::task_ordering)
+  auto task_cost = []( const XCTask& t ) {
+    return double(t.points.size() * t.bfn_screening.nbe);
   };
 
-  auto& tasks = this->load_balancer_->get_tasks();
-  std::sort( task_begin, task_end, task_comparator );
+  order_tasks( this->load_balancer_->state().task_ordering, task_begin, task_end,
+    task_cost );
 
 
   // Check that Partition Weights have been calculated
@@ -165,32 +235,110 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     GAUXC_GENERIC_EXCEPTION("Weights Have Not Been Modified");
   }
 
-  // Zero out integrands
-  
-  if(VXCs)
-  for( auto j = 0; j < nbf; ++j ) {
-    for( auto i = 0; i < nbf; ++i ) {
-      VXCs[i + j*ldvxcs] = 0.;
+  // Populate SoA point storage and submatrix maps consumed by the host kernels
+  generate_points_soa( task_begin, task_end );
+  populate_submat_maps( nbf, task_begin, task_end, basis_map );
+
+  // Zero out integrands (see RuntimeEnvironment host placement)
+  const auto placement = 
+    this->load_balancer_->runtime().host_placement_policy().placement;
+  if( not accumulate ) {
+    zero_host_matrix( placement, nbf, nbf, VXCs, ldvxcs );
+    zero_host_matrix( placement, nbf, nbf, VXCz, ldvxcz );
+    if(VXCx and VXCy) {
+      zero_host_matrix( placement, nbf, nbf, VXCy, ldvxcy );
+      zero_host_matrix( placement, nbf, nbf, VXCx, ldvxcx );
     }
   }
+ 
+  double EXC_WORK = 0.0;
+  double NEL_WORK = 0.0;
+    
+  // Loop over tasks
+  if( use_mixed_precision ) 
+    exc_vxc_local_work_tasks_<float>( basis, Ps, ldps, Pz, ldpz, Py, ldpy, 
+      Px, ldpx, VXCs, ldvxcs, VXCz, ldvxcz, VXCy, ldvxcy, VXCx, ldvxcx, 
+      gks_dtol, &EXC_WORK, &NEL_WORK, task_begin, task_end );
+  else
+    exc_vxc_local_work_tasks_<value_type>( basis, Ps, ldps, Pz, ldpz, Py, ldpy, 
+      Px, ldpx, VXCs, ldvxcs, VXCz, ldvxcz, VXCy, ldvxcy, VXCx, ldvxcx, 
+      gks_dtol, &EXC_WORK, &NEL_WORK, task_begin, task_end );
 
-  if(VXCz) {
-    for( auto j = 0; j < nbf; ++j ) {
-      for( auto i = 0; i < nbf; ++i ) {
-        VXCz[i + j*ldvxcz] = 0.;
-      }
-    }
+
+  // Set scalar return values
+  if( accumulate ) {
+    *EXC  += EXC_WORK;
+    *N_EL += NEL_WORK;
+  } else {
+    *EXC  = EXC_WORK;
+    *N_EL = NEL_WORK;
   }
 
-  if(VXCx and VXCy) {
-    for( auto j = 0; j < nbf; ++j ) {
-      for( auto i = 0; i < nbf; ++i ) {
-        VXCy[i + j*ldvxcy] = 0.;
-        VXCx[i + j*ldvxcx] = 0.;
+  if(not is_exc_only and symmetrize) {
+    // Symmetrize VXC
+    for( int32_t j = 0;   j < nbf; ++j ) {
+      for( int32_t i = j+1; i < nbf; ++i ) {
+        VXCs[ j + i*ldvxcs ] = VXCs[ i + j*ldvxcs ];
+      }
+    }
+    if(not is_rks) {
+      for( int32_t j = 0;   j < nbf; ++j ) {
+        for( int32_t i = j+1; i < nbf; ++i ) {
+          VXCz[ j + i*ldvxcz ] = VXCz[ i + j*ldvxcz ];
+        }
+      }
+    }
+    if( is_gks) {
+      for( int32_t j = 0;   j < nbf; ++j ) {
+        for( int32_t i = j+1; i < nbf; ++i ) {
+          VXCy[ j + i*ldvxcy ] = VXCy[ i + j*ldvxcy ];
+          VXCx[ j + i*ldvxcx ] = VXCx[ i + j*ldvxcx ];
+        }
       }
     }
   }
- 
+
+} 
+
+
+
+/// Task loop of the EXC/VXC local work (RKS/UKS/GKS deduced from null-y
+/// parameters). The collocation, X and Z matrices are of type BasisType:
+/// float32 for the mixed precision path (RKS/UKS LDA/GGA only), whose 
+/// collocation is evaluated in double and rounded. The U/V variables, EXC 
+/// and VXC are always accumulated in double. VXC is incremented (LT only).
+template <typename ValueType>
+template <typename BasisType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  exc_vxc_local_work_tasks_( const basis_type& basis, const value_type* Ps, int64_t ldps,
+                             const value_type* Pz, int64_t ldpz,
+                             const value_type* Py, int64_t ldpy,
+                             const value_type* Px, int64_t ldpx,
+                             value_type* VXCs, int64_t ldvxcs,
+                             value_type* VXCz, int64_t ldvxcz,
+                             value_type* VXCy, int64_t ldvxcy,
+                             value_type* VXCx, int64_t ldvxcx,
+                             double gks_dtol, value_type* EXC, value_type *N_EL, 
+                             task_iterator task_begin, task_iterator task_end ) {
+
+  constexpr bool is_mixed = not std::is_same_v<BasisType, value_type>;
+
+  const bool is_gks = (Pz != nullptr) and (Py != nullptr) and (Px != nullptr);
+  const bool is_uks = (Pz != nullptr) and (Py == nullptr) and (Px == nullptr);
+  const bool is_rks = not is_uks and not is_gks;
+  const bool is_exc_only = (!VXCs) and (!VXCz) and (!VXCy) and (!VXCx);
+
+  // Cast LWD to LocalHostWorkDriver
+  auto* lwd = dynamic_cast<LocalHostWorkDriver*>(this->local_work_driver_.get());
+
+  // Setup Aliases
+  const auto& func = *this->func_;
+  const bool needs_laplacian = func.needs_laplacian(); 
+  if( is_mixed and (is_gks or func.is_mgga()) )
+    GAUXC_GENERIC_EXCEPTION("Mixed Precision NYI for GKS / MGGA");
+
+  const int32_t nbf = basis.nbf();
+
   double EXC_WORK = 0.0;
   double NEL_WORK = 0.0;
     
@@ -215,7 +363,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     const int32_t  nbe     = task.bfn_screening.nbe;
     const int32_t  nshells = task.bfn_screening.shell_list.size();
 
-    const auto* points      = task.points.data()->data();
+    const auto* points      = task.points_soa.data();
     const auto* weights     = task.weights.data();
     const int32_t* shell_list = task.bfn_screening.shell_list.data();
 
@@ -226,22 +374,31 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     const size_t gks_mod_KH = is_gks ? 6*npts : 0; // used to store H and H
     const size_t mgga_dim_scal = func.is_mgga() ? 4 : 1; // basis + d1basis
 
+    // basis (+ grad (3)) (+ lapl)
+    const size_t nbasis_comp = func.is_lda() ? 1 : 
+      (func.is_mgga() and needs_laplacian) ? 5 : 4;
+
+    // Collocation / X / Z buffers of precision BasisType. The collocation
+    // is always evaluated in basis_eval (double) and rounded if needed
+    auto [bf_buf, zmat_buf, nbe_scr_buf] = 
+      host_data.template basis_buffers<BasisType>();
+
     // Things that every calc needs
-    host_data.nbe_scr .resize(nbe  * nbe);
-    host_data.zmat    .resize(npts * nbe * spin_dim_scal * mgga_dim_scal + gks_mod_KH); 
-    host_data.eps     .resize(npts);
-    host_data.vrho    .resize(npts * spin_dim_scal);
+    host_data.basis_eval .resize( nbasis_comp * npts * nbe );
+    bf_buf               .resize( nbasis_comp * npts * nbe );
+    nbe_scr_buf          .resize(nbe  * nbe);
+    zmat_buf             .resize(npts * nbe * spin_dim_scal * mgga_dim_scal + gks_mod_KH); 
+    host_data.eps        .resize(npts);
+    host_data.vrho       .resize(npts * spin_dim_scal);
 
     // LDA data requirements
     if( func.is_lda() ){
-      host_data.basis_eval .resize( npts * nbe );
       host_data.den_scr    .resize( npts * spin_dim_scal);
     }
      
     // GGA data requirements
     const size_t gga_dim_scal = is_rks ? 1 : 3;
     if( func.is_gga() ){
-      host_data.basis_eval .resize( 4 * npts * nbe );
       host_data.den_scr    .resize( spin_dim_scal * 4 * npts );
       host_data.gamma      .resize( gga_dim_scal * npts );
       host_data.vgamma     .resize( gga_dim_scal * npts );
@@ -249,11 +406,8 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
     if( func.is_mgga() ){
       if ( needs_laplacian ) {
-        host_data.basis_eval .resize( 11 * npts * nbe ); // basis + grad (3) + hess (6) + lapl 
         host_data.lapl       .resize( spin_dim_scal * npts );
         host_data.vlapl      .resize( spin_dim_scal * npts );
-      } else {
-        host_data.basis_eval .resize( 4 * npts * nbe ); // basis + grad (3)
       }
 
       host_data.den_scr    .resize( spin_dim_scal * 4 * npts );
@@ -264,10 +418,10 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     }
 
     // Alias/Partition out scratch memory
-    auto* basis_eval = host_data.basis_eval.data();
+    auto* basis_eval = bf_buf.data();
     auto* den_eval   = host_data.den_scr.data();
-    auto* nbe_scr    = host_data.nbe_scr.data();
-    auto* zmat       = host_data.zmat.data();
+    auto* nbe_scr    = nbe_scr_buf.data();
+    auto* zmat       = zmat_buf.data();
 
     decltype(zmat) zmat_z = nullptr;
     decltype(zmat) zmat_x = nullptr;
@@ -276,8 +430,8 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
       zmat_z = zmat + mgga_dim_scal * nbe * npts;
     }
     if(is_gks) {
-      zmat_x = zmat_z + nbe * npts;
-      zmat_y = zmat_x + nbe * npts;
+      zmat_x = zmat_z + mgga_dim_scal * nbe * npts;
+      zmat_y = zmat_x + mgga_dim_scal * nbe * npts;
     }
      
     auto* eps        = host_data.eps.data();
@@ -290,28 +444,28 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     auto* vlapl      = host_data.vlapl.data();
 
 
-    value_type* dbasis_x_eval = nullptr;
-    value_type* dbasis_y_eval = nullptr;
-    value_type* dbasis_z_eval = nullptr;
-    value_type* d2basis_xx_eval = nullptr;
-    value_type* d2basis_xy_eval = nullptr;
-    value_type* d2basis_xz_eval = nullptr;
-    value_type* d2basis_yy_eval = nullptr;
-    value_type* d2basis_yz_eval = nullptr;
-    value_type* d2basis_zz_eval = nullptr;
-    value_type* lbasis_eval = nullptr;
+    BasisType*  dbasis_x_eval = nullptr;
+    BasisType*  dbasis_y_eval = nullptr;
+    BasisType*  dbasis_z_eval = nullptr;
+    BasisType*  lbasis_eval = nullptr;
     value_type* dden_x_eval = nullptr;
     value_type* dden_y_eval = nullptr;
     value_type* dden_z_eval = nullptr;
-    value_type* K = nullptr;
-    value_type* H = nullptr;
-    if (is_gks) { K = zmat + npts * nbe * 4; }
-    value_type* mmat_x      = nullptr;
-    value_type* mmat_y      = nullptr;
-    value_type* mmat_z      = nullptr;
-    value_type* mmat_x_z    = nullptr;
-    value_type* mmat_y_z    = nullptr;
-    value_type* mmat_z_z    = nullptr;
+    BasisType*  K = nullptr;
+    BasisType*  H = nullptr;
+    if (is_gks) { K = zmat + npts * nbe * spin_dim_scal * mgga_dim_scal; }
+    BasisType*  mmat_x      = nullptr;
+    BasisType*  mmat_y      = nullptr;
+    BasisType*  mmat_z      = nullptr;
+    BasisType*  mmat_x_z    = nullptr;
+    BasisType*  mmat_y_z    = nullptr;
+    BasisType*  mmat_z_z    = nullptr;
+    BasisType*  mmat_x_x    = nullptr;
+    BasisType*  mmat_y_x    = nullptr;
+    BasisType*  mmat_z_x    = nullptr;
+    BasisType*  mmat_x_y    = nullptr;
+    BasisType*  mmat_y_y    = nullptr;
+    BasisType*  mmat_z_y    = nullptr;
 
     if( func.is_gga() ) {
       dbasis_x_eval = basis_eval    + npts * nbe;
@@ -334,50 +488,54 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
       mmat_y        = mmat_x + npts * nbe;
       mmat_z        = mmat_y + npts * nbe;
       if ( needs_laplacian ) {
-        d2basis_xx_eval = dbasis_z_eval + npts * nbe;
-        d2basis_xy_eval = d2basis_xx_eval + npts * nbe;
-        d2basis_xz_eval = d2basis_xy_eval + npts * nbe;
-        d2basis_yy_eval = d2basis_xz_eval + npts * nbe;
-        d2basis_yz_eval = d2basis_yy_eval + npts * nbe;
-        d2basis_zz_eval = d2basis_yz_eval + npts * nbe;
-        lbasis_eval     = d2basis_zz_eval + npts * nbe;
+        lbasis_eval     = dbasis_z_eval + npts * nbe;
       }
-      if(is_uks) {
+      if(not is_rks) {
         mmat_x_z = zmat_z + npts * nbe;
         mmat_y_z = mmat_x_z + npts * nbe;
         mmat_z_z = mmat_y_z + npts * nbe;
       }
+      if(is_gks) {
+        mmat_x_x = zmat_x + npts * nbe;
+        mmat_y_x = mmat_x_x + npts * nbe;
+        mmat_z_x = mmat_y_x + npts * nbe;
+        mmat_x_y = zmat_y + npts * nbe;
+        mmat_y_y = mmat_x_y + npts * nbe;
+        mmat_z_y = mmat_y_y + npts * nbe;
+        H = K + 3*npts;
+      }
     }
 
 
     // Get the submatrix map for batch
-    std::vector< std::array<int32_t, 3> > submat_map;
-    std::tie(submat_map, std::ignore) =
-          gen_compressed_submat_map(basis_map, task.bfn_screening.shell_list, nbf, nbf);
+    const auto& submat_map = task.bfn_screening.submat_map;
 
-    // Evaluate Collocation (+ Grad and Hessian)
+    // Evaluate Collocation (+ Grad and Laplacian), always in double
+    auto* col_eval = host_data.basis_eval.data();
+    const size_t col_stride = npts * nbe;
     if( func.is_mgga() ) {
       if ( needs_laplacian ) {
-        // TODO: Modify gau2grid to compute Laplacian instead of full hessian
-        lwd->eval_collocation_hessian( npts, nshells, nbe, points, basis, shell_list,
-          basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval, d2basis_xx_eval,
-          d2basis_xy_eval, d2basis_xz_eval, d2basis_yy_eval, d2basis_yz_eval,
-          d2basis_zz_eval);
-        blas::lacpy( 'A', nbe, npts, d2basis_xx_eval, nbe, lbasis_eval, nbe );
-        blas::axpy( nbe * npts, 1., d2basis_yy_eval, 1, lbasis_eval, 1);
-        blas::axpy( nbe * npts, 1., d2basis_zz_eval, 1, lbasis_eval, 1);
+        lwd->eval_collocation_laplacian( npts, nshells, nbe, points, basis, shell_list,
+          col_eval, col_eval + col_stride, col_eval + 2*col_stride, 
+          col_eval + 3*col_stride, col_eval + 4*col_stride );
       } else {
         lwd->eval_collocation_gradient( npts, nshells, nbe, points, basis, shell_list,
-          basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval );
+          col_eval, col_eval + col_stride, col_eval + 2*col_stride, 
+          col_eval + 3*col_stride );
       }
     }
     // Evaluate Collocation (+ Grad)
     else if( func.is_gga() )
       lwd->eval_collocation_gradient( npts, nshells, nbe, points, basis, shell_list,
-        basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval );
+        col_eval, col_eval + col_stride, col_eval + 2*col_stride, 
+        col_eval + 3*col_stride );
     else
       lwd->eval_collocation( npts, nshells, nbe, points, basis, shell_list,
-        basis_eval );
+        col_eval );
+
+    // Round the collocation to float32 for the mixed precision path
+    if constexpr ( is_mixed )
+      std::copy_n( col_eval, nbasis_comp * col_stride, basis_eval );
 
      
     // Evaluate X matrix (fac * P * B) -> store in Z
@@ -393,23 +551,32 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     }
      
     if(is_gks) {
-      lwd->eval_xmat( npts, nbf, nbe, submat_map, 1.0, Py, ldpy, basis_eval, nbe,
+      lwd->eval_xmat( mgga_dim_scal * npts, nbf, nbe, submat_map, 1.0, Py, ldpy, basis_eval, nbe,
         zmat_x, nbe, nbe_scr);
-      lwd->eval_xmat( npts, nbf, nbe, submat_map, 1.0, Px, ldpx, basis_eval, nbe,
+      lwd->eval_xmat( mgga_dim_scal * npts, nbf, nbe, submat_map, 1.0, Px, ldpx, basis_eval, nbe,
         zmat_y, nbe, nbe_scr);
     }
      
     // Evaluate U and V variables
     if( func.is_mgga() ) {
-      if (is_rks) {
-        lwd->eval_uvvar_mgga_rks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
-          dbasis_z_eval, lbasis_eval, zmat, nbe, mmat_x, mmat_y, mmat_z, 
-          nbe, den_eval, dden_x_eval, dden_y_eval, dden_z_eval, gamma, tau, lapl);
-      } else if (is_uks) {
-        lwd->eval_uvvar_mgga_uks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
-          dbasis_z_eval, lbasis_eval, zmat, nbe, zmat_z, nbe, 
-          mmat_x, mmat_y, mmat_z, nbe, mmat_x_z, mmat_y_z, mmat_z_z, nbe, 
-          den_eval, dden_x_eval, dden_y_eval, dden_z_eval, gamma, tau, lapl);
+      if constexpr ( not is_mixed ) { // double precision only
+        if (is_rks) {
+          lwd->eval_uvvar_mgga_rks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+            dbasis_z_eval, lbasis_eval, zmat, nbe, mmat_x, mmat_y, mmat_z, 
+            nbe, den_eval, dden_x_eval, dden_y_eval, dden_z_eval, gamma, tau, lapl);
+        } else if (is_uks) {
+          lwd->eval_uvvar_mgga_uks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+            dbasis_z_eval, lbasis_eval, zmat, nbe, zmat_z, nbe, 
+            mmat_x, mmat_y, mmat_z, nbe, mmat_x_z, mmat_y_z, mmat_z_z, nbe, 
+            den_eval, dden_x_eval, dden_y_eval, dden_z_eval, gamma, tau, lapl);
+        } else if (is_gks) {
+          lwd->eval_uvvar_mgga_gks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+            dbasis_z_eval, lbasis_eval, zmat, nbe, zmat_z, nbe, zmat_x, nbe, zmat_y, nbe,
+            mmat_x, mmat_y, mmat_z, nbe, mmat_x_z, mmat_y_z, mmat_z_z, nbe, 
+            mmat_x_x, mmat_y_x, mmat_z_x, nbe, mmat_x_y, mmat_y_y, mmat_z_y, nbe, 
+            den_eval, dden_x_eval, dden_y_eval, dden_z_eval, gamma, tau, lapl, K, H,
+            gks_dtol );
+        }
       }
     } else if ( func.is_gga() ) {
       if(is_rks) {
@@ -420,7 +587,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
         lwd->eval_uvvar_gga_uks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
           dbasis_z_eval, zmat, nbe, zmat_z, nbe, den_eval, dden_x_eval, 
           dden_y_eval, dden_z_eval, gamma );
-      } else if(is_gks) {
+      } else if constexpr ( not is_mixed ) { // GKS (double precision only)
         lwd->eval_uvvar_gga_gks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
           dbasis_z_eval, zmat, nbe, zmat_z, nbe, zmat_x, nbe, zmat_y, nbe, den_eval, dden_x_eval,
           dden_y_eval, dden_z_eval, gamma, K, H, gks_dtol );
@@ -432,7 +599,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
       } else if(is_uks) {
         lwd->eval_uvvar_lda_uks( npts, nbe, basis_eval, zmat, nbe, zmat_z, nbe,
           den_eval );
-      } else if(is_gks) {
+      } else if constexpr ( not is_mixed ) { // GKS (double precision only)
         lwd->eval_uvvar_lda_gks( npts, nbe, basis_eval, zmat, nbe, zmat_z, nbe,
           zmat_x, nbe, zmat_y, nbe, den_eval, K, gks_dtol );
       }
@@ -464,19 +631,19 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
     if( func.is_mgga() ){
       for( int32_t i = 0; i < npts; ++i) {
-        vtau[spin_dim_scal*i]  *= weights[i];
+        vtau[sds*i]  *= weights[i];
         vgamma[gga_dim_scal*i] *= weights[i];
         if(not is_rks) {
           vgamma[gga_dim_scal*i+1] *= weights[i];
           vgamma[gga_dim_scal*i+2] *= weights[i];
-          vtau[spin_dim_scal*i+1]  *= weights[i];
+          vtau[sds*i+1]  *= weights[i];
         }
 
         // TODO: Add checks for Lapacian-dependent functionals
         if( needs_laplacian ) {
-          vlapl[spin_dim_scal*i] *= weights[i];
+          vlapl[sds*i] *= weights[i];
           if(not is_rks) {
-            vlapl[spin_dim_scal*i+1] *= weights[i];
+            vlapl[sds*i+1] *= weights[i];
           }
         }
       }
@@ -502,18 +669,29 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
     // Evaluate Z matrix for VXC
     if( func.is_mgga() ) {
-      if(is_rks) {
-        lwd->eval_zmat_mgga_vxc_rks( npts, nbe, vrho, vgamma, vlapl, basis_eval, dbasis_x_eval,
-                                     dbasis_y_eval, dbasis_z_eval, lbasis_eval,
-                                     dden_x_eval, dden_y_eval, dden_z_eval, zmat, nbe);
-        lwd->eval_mmat_mgga_vxc_rks( npts, nbe, vtau, vlapl, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval,
-                                     mmat_x, mmat_y, mmat_z, nbe);
-      } else if (is_uks) {
-        lwd->eval_zmat_mgga_vxc_uks( npts, nbe, vrho, vgamma, vlapl, basis_eval, dbasis_x_eval,
-                                     dbasis_y_eval, dbasis_z_eval, lbasis_eval,
-                                     dden_x_eval, dden_y_eval, dden_z_eval, zmat, nbe, zmat_z, nbe);
-        lwd->eval_mmat_mgga_vxc_uks( npts, nbe, vtau, vlapl, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval,
-                                     mmat_x, mmat_y, mmat_z, nbe, mmat_x_z, mmat_y_z, mmat_z_z, nbe);
+      if constexpr ( not is_mixed ) { // double precision only
+        if(is_rks) {
+          lwd->eval_zmat_mgga_vxc_rks( npts, nbe, vrho, vgamma, vlapl, basis_eval, dbasis_x_eval,
+                                       dbasis_y_eval, dbasis_z_eval, lbasis_eval,
+                                       dden_x_eval, dden_y_eval, dden_z_eval, zmat, nbe);
+          lwd->eval_mmat_mgga_vxc_rks( npts, nbe, vtau, vlapl, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval,
+                                       mmat_x, mmat_y, mmat_z, nbe);
+        } else if (is_uks) {
+          lwd->eval_zmat_mgga_vxc_uks( npts, nbe, vrho, vgamma, vlapl, basis_eval, dbasis_x_eval,
+                                       dbasis_y_eval, dbasis_z_eval, lbasis_eval,
+                                       dden_x_eval, dden_y_eval, dden_z_eval, zmat, nbe, zmat_z, nbe);
+          lwd->eval_mmat_mgga_vxc_uks( npts, nbe, vtau, vlapl, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval,
+                                       mmat_x, mmat_y, mmat_z, nbe, mmat_x_z, mmat_y_z, mmat_z_z, nbe);
+        } else if (is_gks) {
+          lwd->eval_zmat_mgga_vxc_gks( npts, nbe, vrho, vgamma, vlapl, basis_eval, dbasis_x_eval,
+                                       dbasis_y_eval, dbasis_z_eval, lbasis_eval,
+                                       dden_x_eval, dden_y_eval, dden_z_eval, zmat, nbe, zmat_z, nbe,
+                                       zmat_x, nbe, zmat_y, nbe, K, H);
+          lwd->eval_mmat_mgga_vxc_gks( npts, nbe, vtau, vlapl, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval,
+                                       mmat_x, mmat_y, mmat_z, nbe, mmat_x_z, mmat_y_z, mmat_z_z, nbe,
+                                       mmat_x_x, mmat_y_x, mmat_z_x, nbe, mmat_x_y, mmat_y_y, mmat_z_y, nbe,
+                                       K);
+        }
       }
     }
     else if( func.is_gga() ) {
@@ -525,7 +703,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
         lwd->eval_zmat_gga_vxc_uks( npts, nbe, vrho, vgamma, basis_eval, dbasis_x_eval,
                                 dbasis_y_eval, dbasis_z_eval, dden_x_eval, dden_y_eval,
                                 dden_z_eval, zmat, nbe, zmat_z, nbe);
-      } else if(is_gks) {
+      } else if constexpr ( not is_mixed ) { // GKS (double precision only)
         lwd->eval_zmat_gga_vxc_gks( npts, nbe, vrho, vgamma, basis_eval, dbasis_x_eval,
                                 dbasis_y_eval, dbasis_z_eval, dden_x_eval, dden_y_eval,
                                 dden_z_eval, zmat, nbe, zmat_z, nbe, zmat_x, nbe, zmat_y, nbe,
@@ -537,7 +715,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
         lwd->eval_zmat_lda_vxc_rks( npts, nbe, vrho, basis_eval, zmat, nbe );
       } else if(is_uks) {
         lwd->eval_zmat_lda_vxc_uks( npts, nbe, vrho, basis_eval, zmat, nbe, zmat_z, nbe );
-      } else if(is_gks) {
+      } else if constexpr ( not is_mixed ) { // GKS (double precision only)
         lwd->eval_zmat_lda_vxc_gks( npts, nbe, vrho, basis_eval, zmat, nbe, zmat_z, nbe, 
                                     zmat_x, nbe, zmat_y, nbe, K);
       }
@@ -554,9 +732,9 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
         lwd->inc_vxc( mgga_dim_scal * npts, nbf, nbe, basis_eval, submat_map, zmat_z, nbe,VXCz, ldvxcz, nbe_scr);
       }
       if(is_gks) {
-        lwd->inc_vxc( npts, nbf, nbe, basis_eval, submat_map, zmat_x, nbe, VXCy, ldvxcy,
+        lwd->inc_vxc( mgga_dim_scal * npts, nbf, nbe, basis_eval, submat_map, zmat_x, nbe, VXCy, ldvxcy,
           nbe_scr);
-        lwd->inc_vxc( npts, nbf, nbe, basis_eval, submat_map, zmat_y, nbe, VXCx, ldvxcx,
+        lwd->inc_vxc( mgga_dim_scal * npts, nbf, nbe, basis_eval, submat_map, zmat_y, nbe, VXCx, ldvxcx,
           nbe_scr);
       }
        
@@ -566,38 +744,10 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
   } // End OpenMP region
 
-
-  // Set scalar return values
   *EXC  = EXC_WORK;
   *N_EL = NEL_WORK;
 
-  if(not is_exc_only) {
-    // Symmetrize VXC
-    for( int32_t j = 0;   j < nbf; ++j ) {
-      for( int32_t i = j+1; i < nbf; ++i ) {
-        VXCs[ j + i*ldvxcs ] = VXCs[ i + j*ldvxcs ];
-      }
-    }
-    if(not is_rks) {
-      for( int32_t j = 0;   j < nbf; ++j ) {
-        for( int32_t i = j+1; i < nbf; ++i ) {
-          VXCz[ j + i*ldvxcz ] = VXCz[ i + j*ldvxcz ];
-        }
-      }
-    }
-    if( is_gks) {
-      for( int32_t j = 0;   j < nbf; ++j ) {
-        for( int32_t i = j+1; i < nbf; ++i ) {
-          VXCy[ j + i*ldvxcy ] = VXCy[ i + j*ldvxcy ];
-          VXCx[ j + i*ldvxcx ] = VXCx[ i + j*ldvxcx ];
-        }
-      }
-    }
-  }
-
-} 
-
-
+}
 
 /// RKS EXC/VXC driver - delegates to generic GKS impl
 template <typename ValueType>
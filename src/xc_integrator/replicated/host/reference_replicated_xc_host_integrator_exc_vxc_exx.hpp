@@ -0,0 +1,432 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include "reference_replicated_xc_host_integrator.hpp"
+#include "integrator_util/point_group_symmetrizer.hpp"
+#include "integrator_util/host_buffer_placement.hpp"
+#include "integrator_util/integrator_common.hpp"
+#include "host/local_host_work_driver.hpp"
+#include "host/blas.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <iterator>
+
+#include <gauxc/util/unused.hpp>
+
+namespace GauXC::detail {
+
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  eval_exc_vxc_exx_( int64_t m, int64_t n, const value_type* P,
+                     int64_t ldp, value_type* VXC, int64_t ldvxc,
+                     value_type* K, int64_t ldk, value_type* EXC,
+                     const IntegratorSettingsXC&  ks_settings,
+                     const IntegratorSettingsEXX& exx_settings ) {
+
+  const auto& basis = this->load_balancer_->basis();
+
+  // Check that P / VXC / K are sane
+  const int64_t nbf = basis.nbf();
+  if( m != n )
+    GAUXC_GENERIC_EXCEPTION("P/VXC/K Must Be Square");
+  if( m != nbf )
+    GAUXC_GENERIC_EXCEPTION("P/VXC/K Must Have Same Dimension as Basis");
+  if( ldp < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDP");
+  if( ldvxc < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDVXC");
+  if( ldk < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDK");
+
+  // Temporary electron count to judge integrator accuracy
+  value_type N_EL;
+
+  // Compute Local contributions to EXC / VXC / K
+  this->timer_.time_op("XCIntegrator.LocalWork", [&](){
+    exc_vxc_exx_local_work_( P, ldp, VXC, ldvxc, K, ldk, EXC, &N_EL,
+      ks_settings, exx_settings );
+  });
+
+  // Reduce Results in a single step
+  this->timer_.time_op("XCIntegrator.Allreduce", [&](){
+
+    if( not this->reduction_driver_->takes_host_memory() )
+      GAUXC_GENERIC_EXCEPTION("This Module Only Works With Host Reductions");
+
+    this->reduction_driver_->template allreduce_packed<value_type>( {
+      ReductionBuffer::symmetric_matrix( VXC, nbf, ldvxc ),
+      ReductionBuffer::symmetric_matrix( K,   nbf, ldk   ),
+      ReductionBuffer::scalar( EXC ),
+      ReductionBuffer::scalar( &N_EL ) }, ReductionOp::Sum );
+
+  });
+
+  // Symmetrize over the point group exploited by the load balancer
+  const auto& point_group = this->load_balancer_->state().point_group;
+  if( not point_group.is_trivial() )
+  this->timer_.time_op("XCIntegrator.Symmetrize", [&](){
+    PointGroupSymmetrizer sym( point_group, this->load_balancer_->molecule(), 
+      basis );
+    sym.symmetrize_matrix( VXC, ldvxc );
+    sym.symmetrize_matrix( K,   ldk   );
+  });
+
+}
+
+
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  exc_vxc_exx_local_work_( const value_type* P, int64_t ldp,
+    value_type* VXC, int64_t ldvxc, value_type* K, int64_t ldk,
+    value_type* EXC, value_type* N_EL, const IntegratorSettingsXC& ks_settings,
+    const IntegratorSettingsEXX& exx_settings ) {
+
+  util::unused(ks_settings);
+
+  // Cast LWD to LocalHostWorkDriver
+  auto* lwd = dynamic_cast<LocalHostWorkDriver*>(this->local_work_driver_.get());
+
+  // Setup Aliases
+  const auto& func    = *this->func_;
+  const auto& basis   = this->load_balancer_->basis();
+  const auto& mol     = this->load_balancer_->molecule();
+  const auto& shpairs = this->load_balancer_->shell_pairs();
+
+  if( func.is_polarized() )
+    GAUXC_GENERIC_EXCEPTION("Fused EXC/VXC + EXX Only Supports RKS");
+
+  const bool needs_laplacian = func.needs_laplacian();
+
+  // Get basis map
+  const auto& basis_map = this->load_balancer_->basis_map();
+
+  const int32_t nbf = basis.nbf();
+
+  // Check that Partition Weights have been calculated
+  auto& lb_state = this->load_balancer_->state();
+  if( not lb_state.modified_weights_are_stored ) {
+    GAUXC_GENERIC_EXCEPTION("Weights Have Not Been Modified");
+  }
+
+  // Zero out integrands (see RuntimeEnvironment host placement)
+  const auto placement = 
+    this->load_balancer_->runtime().host_placement_policy().placement;
+  zero_host_matrix( placement, nbf, nbf, VXC, ldvxc );
+  zero_host_matrix( placement, nbf, nbf, K,   ldk   );
+
+  // Screen and merge (a private copy of) the tasks for sn-LinK. Merged tasks
+  // share the same basis function screening, so they remain valid for the 
+  // XC pipeline
+  auto tasks = exx_screen_tasks_( 1, P, ldp, exx_settings );
+  IntegratorSettingsSNLinK sn_link_settings;
+  if( auto* tmp = dynamic_cast<const IntegratorSettingsSNLinK*>(&exx_settings) ) {
+    sn_link_settings = *tmp;
+  }
+  const auto op = exx_operator( sn_link_settings );
+  generate_points_soa( tasks.begin(), tasks.end() );
+  populate_submat_maps( nbf, tasks.begin(), tasks.end(), basis_map );
+
+  double EXC_WORK = 0.0;
+  double NEL_WORK = 0.0;
+
+  // Loop over tasks
+  const size_t ntasks = tasks.size();
+
+  #pragma omp parallel
+  {
+
+  XCHostData<value_type> host_data; // Thread local host data
+  std::vector<value_type> fmat_union, fmat_ek;
+
+  #pragma omp for schedule(dynamic)
+  for( size_t iT = 0; iT < ntasks; ++iT ) {
+
+    // Alias current task
+    const auto& task = tasks[iT];
+
+    // Get tasks constants
+    const int32_t  npts    = task.points.size();
+    const int32_t  nbe     = task.bfn_screening.nbe;
+    const int32_t  nshells = task.bfn_screening.shell_list.size();
+
+    const auto* points      = task.points_soa.data();
+    const auto* weights     = task.weights.data();
+    const auto& shell_list_ = task.bfn_screening.shell_list;
+    const int32_t* shell_list = shell_list_.data();
+
+    const auto& ek_shell_list = task.cou_screening.shell_list;
+    const bool  do_exx        = ek_shell_list.size() > 0;
+    const int32_t nbe_ek = do_exx ?
+      basis.nbf_subset( ek_shell_list.begin(), ek_shell_list.end() ) : 0;
+
+    // Union of the basis function and EK shell lists: P*B is evaluated once
+    // over the union and partitioned into the XC (X) and EXX (F) matrices
+    std::vector<int32_t> union_shell_list;
+    std::set_union( shell_list_.begin(), shell_list_.end(),
+      ek_shell_list.begin(), ek_shell_list.end(),
+      std::back_inserter(union_shell_list) );
+    const int32_t nbe_union =
+      basis.nbf_subset( union_shell_list.begin(), union_shell_list.end() );
+
+    // Row offsets of the bfn / EK functions within the union
+    std::vector<int32_t> bfn_rows, ek_rows;
+    bfn_rows.reserve(nbe); ek_rows.reserve(nbe_ek);
+    {
+      auto bfn_it = shell_list_.begin();
+      auto ek_it  = ek_shell_list.begin();
+      int32_t ioff = 0;
+      for( auto ish : union_shell_list ) {
+        const int32_t sh_sz = basis_map.shell_size(ish);
+        const bool in_bfn = bfn_it != shell_list_.end() and *bfn_it == ish;
+        const bool in_ek  = ek_it  != ek_shell_list.end() and *ek_it == ish;
+        for( int32_t i = 0; i < sh_sz; ++i ) {
+          if( in_bfn ) bfn_rows.push_back( ioff + i );
+          if( in_ek  ) ek_rows .push_back( ioff + i );
+        }
+        if( in_bfn ) ++bfn_it;
+        if( in_ek  ) ++ek_it;
+        ioff += sh_sz;
+      }
+    }
+
+    const auto& submat_map    = task.bfn_screening.submat_map;
+    const auto& ek_submat_map = task.cou_screening.submat_map;
+    std::vector< std::array<int32_t, 3> > union_submat_map;
+    std::tie(union_submat_map, std::ignore) =
+      gen_compressed_submat_map(basis_map, union_shell_list, nbf, nbf);
+
+    // Allocate enough memory for batch
+    const size_t mgga_dim_scal = func.is_mgga() ? 4 : 1; // basis + d1basis
+
+    host_data.nbe_scr .resize(std::max(nbe_union, nbf) * nbe);
+    host_data.zmat    .resize(npts * nbe * mgga_dim_scal);
+    host_data.eps     .resize(npts);
+    host_data.vrho    .resize(npts);
+    fmat_union        .resize(npts * nbe_union * mgga_dim_scal);
+
+    if( func.is_lda() ){
+      host_data.basis_eval .resize( npts * nbe );
+      host_data.den_scr    .resize( npts );
+    }
+
+    if( func.is_gga() ){
+      host_data.basis_eval .resize( 4 * npts * nbe );
+      host_data.den_scr    .resize( 4 * npts );
+      host_data.gamma      .resize( npts );
+      host_data.vgamma     .resize( npts );
+    }
+
+    if( func.is_mgga() ){
+      if ( needs_laplacian ) {
+        host_data.basis_eval .resize( 5 * npts * nbe ); // basis + grad (3) + lapl
+        host_data.lapl       .resize( npts );
+        host_data.vlapl      .resize( npts );
+      } else {
+        host_data.basis_eval .resize( 4 * npts * nbe ); // basis + grad (3)
+      }
+      host_data.den_scr    .resize( 4 * npts );
+      host_data.gamma      .resize( npts );
+      host_data.vgamma     .resize( npts );
+      host_data.tau        .resize( npts );
+      host_data.vtau       .resize( npts );
+    }
+
+    if( do_exx ) {
+      fmat_ek       .resize( npts * nbe_ek );
+      host_data.gmat.resize( npts * nbe_ek );
+    }
+
+    // Alias/Partition out scratch memory
+    auto* basis_eval = host_data.basis_eval.data();
+    auto* den_eval   = host_data.den_scr.data();
+    auto* nbe_scr    = host_data.nbe_scr.data();
+    auto* zmat       = host_data.zmat.data();
+    auto* gmat       = host_data.gmat.data();
+
+    auto* eps        = host_data.eps.data();
+    auto* gamma      = host_data.gamma.data();
+    auto* tau        = host_data.tau.data();
+    auto* lapl       = host_data.lapl.data();
+    auto* vrho       = host_data.vrho.data();
+    auto* vgamma     = host_data.vgamma.data();
+    auto* vtau       = host_data.vtau.data();
+    auto* vlapl      = host_data.vlapl.data();
+
+    value_type* dbasis_x_eval = nullptr;
+    value_type* dbasis_y_eval = nullptr;
+    value_type* dbasis_z_eval = nullptr;
+    value_type* lbasis_eval = nullptr;
+    value_type* dden_x_eval = nullptr;
+    value_type* dden_y_eval = nullptr;
+    value_type* dden_z_eval = nullptr;
+    value_type* mmat_x      = nullptr;
+    value_type* mmat_y      = nullptr;
+    value_type* mmat_z      = nullptr;
+
+    if( func.is_gga() or func.is_mgga() ) {
+      dbasis_x_eval = basis_eval    + npts * nbe;
+      dbasis_y_eval = dbasis_x_eval + npts * nbe;
+      dbasis_z_eval = dbasis_y_eval + npts * nbe;
+      dden_x_eval   = den_eval    + npts;
+      dden_y_eval   = dden_x_eval + npts;
+      dden_z_eval   = dden_y_eval + npts;
+    }
+
+    if( func.is_mgga() ) {
+      mmat_x        = zmat + npts * nbe;
+      mmat_y        = mmat_x + npts * nbe;
+      mmat_z        = mmat_y + npts * nbe;
+      if ( needs_laplacian ) {
+        lbasis_eval     = dbasis_z_eval + npts * nbe;
+      }
+    }
+
+    // Evaluate Collocation (+ Grad and Laplacian) - shared by XC and EXX
+    if( func.is_mgga() ) {
+      if ( needs_laplacian ) {
+        lwd->eval_collocation_laplacian( npts, nshells, nbe, points, basis, shell_list,
+          basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval, lbasis_eval );
+      } else {
+        lwd->eval_collocation_gradient( npts, nshells, nbe, points, basis, shell_list,
+          basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval );
+      }
+    }
+    else if( func.is_gga() )
+      lwd->eval_collocation_gradient( npts, nshells, nbe, points, basis, shell_list,
+        basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval );
+    else
+      lwd->eval_collocation( npts, nshells, nbe, points, basis, shell_list,
+        basis_eval );
+
+    // Evaluate F(mu,i) = P(mu,nu) * B(nu,i) once over the union shell list
+    // mu runs over the union of the bfn and EK shells
+    // nu runs over the bfn shell list
+    const size_t ncol = mgga_dim_scal * npts;
+    lwd->eval_exx_fmat( ncol, nbf, nbe_union, nbe, union_submat_map,
+      submat_map, P, ldp, basis_eval, nbe, fmat_union.data(), nbe_union, nbe_scr );
+
+    // Partition F into X = 2 * P * B (bfn rows) and F (EK rows)
+    for( size_t i = 0; i < ncol; ++i ) {
+      const auto* F_i = fmat_union.data() + i * nbe_union;
+      for( int32_t mu = 0; mu < nbe; ++mu )
+        zmat[mu + i*nbe] = 2. * F_i[bfn_rows[mu]];
+    }
+    if( do_exx )
+    for( int32_t i = 0; i < npts; ++i ) {
+      const auto* F_i = fmat_union.data() + i * nbe_union;
+      for( int32_t mu = 0; mu < nbe_ek; ++mu )
+        fmat_ek[mu + i*nbe_ek] = F_i[ek_rows[mu]];
+    }
+
+    // Evaluate U and V variables
+    if( func.is_mgga() )
+      lwd->eval_uvvar_mgga_rks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+        dbasis_z_eval, lbasis_eval, zmat, nbe, mmat_x, mmat_y, mmat_z,
+        nbe, den_eval, dden_x_eval, dden_y_eval, dden_z_eval, gamma, tau, lapl);
+    else if( func.is_gga() )
+      lwd->eval_uvvar_gga_rks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+        dbasis_z_eval, zmat, nbe, den_eval, dden_x_eval, dden_y_eval, dden_z_eval,
+        gamma );
+    else
+      lwd->eval_uvvar_lda_rks( npts, nbe, basis_eval, zmat, nbe, den_eval );
+
+    // Evaluate XC functional
+    if( func.is_mgga() )
+      func.eval_exc_vxc( npts, den_eval, gamma, lapl, tau, eps, vrho, vgamma, vlapl, vtau);
+    else if( func.is_gga() )
+      func.eval_exc_vxc( npts, den_eval, gamma, eps, vrho, vgamma );
+    else
+      func.eval_exc_vxc( npts, den_eval, eps, vrho );
+
+    // Factor weights into XC results
+    for( int32_t i = 0; i < npts; ++i ) {
+      eps[i]  *= weights[i];
+      vrho[i] *= weights[i];
+      if( func.is_gga() or func.is_mgga() ) vgamma[i] *= weights[i];
+      if( func.is_mgga() ) vtau[i] *= weights[i];
+      if( needs_laplacian ) vlapl[i] *= weights[i];
+    }
+
+    // Scalar integrations
+    double NEL_local = 0.0;
+    double EXC_local = 0.0;
+    for( int32_t i = 0; i < npts; ++i ) {
+      NEL_local += weights[i] * den_eval[i];
+      EXC_local += eps[i]     * den_eval[i];
+    }
+
+    // Atomic updates
+    #pragma omp atomic
+    EXC_WORK += EXC_local;
+    #pragma omp atomic
+    NEL_WORK += NEL_local;
+
+    // Evaluate Z matrix for VXC
+    if( func.is_mgga() ) {
+      lwd->eval_zmat_mgga_vxc_rks( npts, nbe, vrho, vgamma, vlapl, basis_eval, dbasis_x_eval,
+                                   dbasis_y_eval, dbasis_z_eval, lbasis_eval,
+                                   dden_x_eval, dden_y_eval, dden_z_eval, zmat, nbe);
+      lwd->eval_mmat_mgga_vxc_rks( npts, nbe, vtau, vlapl, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval,
+                                   mmat_x, mmat_y, mmat_z, nbe);
+    }
+    else if( func.is_gga() )
+      lwd->eval_zmat_gga_vxc_rks( npts, nbe, vrho, vgamma, basis_eval, dbasis_x_eval,
+                                  dbasis_y_eval, dbasis_z_eval, dden_x_eval, dden_y_eval,
+                                  dden_z_eval, zmat, nbe);
+    else
+      lwd->eval_zmat_lda_vxc_rks( npts, nbe, vrho, basis_eval, zmat, nbe );
+
+    // Increment LT of VXC
+    lwd->inc_vxc( mgga_dim_scal * npts, nbf, nbe, basis_eval, submat_map, zmat, nbe,
+      VXC, ldvxc, nbe_scr );
+
+    if( not do_exx ) continue;
+
+    // Compute G(mu,i) = w(i) * A(mu,nu,i) * F(nu,i)
+    // mu/nu run over significant ek shells
+    // i runs over all points
+    const size_t nshell_pairs = task.cou_screening.shell_pair_list.size();
+    const auto*  shell_pair_list = task.cou_screening.shell_pair_list.data();
+    lwd->eval_exx_gmat( npts, ek_shell_list.size(), nshell_pairs, nbe_ek, points,
+      weights, basis, shpairs, basis_map, ek_shell_list.data(), shell_pair_list,
+      1, fmat_ek.data(), nbe_ek, gmat, nbe_ek, op );
+
+    // Increment K(mu,nu) += B(mu,i) * G(nu,i)
+    // mu runs over bfn shell list
+    // nu runs over ek shells
+    // i runs over all points
+    lwd->inc_exx_k( npts, nbf, nbe, nbe_ek, basis_eval, submat_map,
+      ek_submat_map, gmat, nbe_ek, K, ldk, nbe_scr );
+
+  } // Loop over tasks
+
+  } // End OpenMP region
+
+  // Set scalar return values
+  *EXC  = EXC_WORK;
+  *N_EL = NEL_WORK;
+
+  // Symmetrize VXC
+  for( int32_t j = 0;   j < nbf; ++j )
+  for( int32_t i = j+1; i < nbf; ++i )
+    VXC[ j + i*ldvxc ] = VXC[ i + j*ldvxc ];
+
+  // Symmetrize K
+  for( auto j = 0; j < nbf; ++j )
+  for( auto i = 0; i < j;   ++i ) {
+    const auto K_ij = K[i + j*ldk];
+    const auto K_ji = K[j + i*ldk];
+    const auto K_symm = 0.5 * (K_ij + K_ji);
+    K[i + j*ldk] = K_symm;
+    K[j + i*ldk] = K_symm;
+  }
+
+}
+
+} // namespace GauXC::detail
@@ -8,15 +8,19 @@
 #pragma once
 
 #include "reference_replicated_xc_host_integrator.hpp"
+#include "integrator_util/point_group_symmetrizer.hpp"
+#include "integrator_util/host_buffer_placement.hpp"
 #include "integrator_util/integrator_common.hpp"
 #include "integrator_util/integral_bounds.hpp"
 #include "integrator_util/exx_screening.hpp"
+#include "task_merge.hpp"
 #include "host/local_host_work_driver.hpp"
 #include "host/blas.hpp"
 #include <stdexcept>
 #include <set>
 
 #include <gauxc/util/geometry.hpp>
+#include <gauxc/util/unused.hpp>
 
 
 namespace std {
@@ -35,6 +39,16 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
              int64_t ldp, value_type* K, int64_t ldk,
              const IntegratorSettingsEXX& settings ) {
 
+  eval_exx_( m, n, 1, P, ldp, K, ldk, settings );
+
+}
+
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  eval_exx_( int64_t m, int64_t n, int64_t nmat, const value_type* P,
+             int64_t ldp, value_type* K, int64_t ldk,
+             const IntegratorSettingsEXX& settings ) {
+
   const auto& basis = this->load_balancer_->basis();
 
   // Check that P / VXC are sane
@@ -47,30 +61,56 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     GAUXC_GENERIC_EXCEPTION("Invalid LDP");
   if( ldk < nbf )
     GAUXC_GENERIC_EXCEPTION("Invalid LDVXC");
+  if( nmat < 1 )
+    GAUXC_GENERIC_EXCEPTION("Invalid Number of Density Matrices");
+
+  // Symmetrizing over the point group is only exact for totally symmetric
+  // densities, which is not the case in general for several densities
+  const auto& point_group = this->load_balancer_->state().point_group;
+  if( nmat > 1 and not point_group.is_trivial() )
+    GAUXC_GENERIC_EXCEPTION("Multi-Matrix EXX Does Not Support Point Group Symmetry");
+
+  // K is reduced and symmetrized as a symmetric matrix, which is only valid
+  // for symmetric densities
+  for( int64_t imat = 0; imat < nmat; ++imat ) {
+    const auto* P_mat = P + imat*ldp*nbf;
+    double P_max = 0., P_asym = 0.;
+    for( int64_t j = 0; j < nbf; ++j )
+    for( int64_t i = 0; i < nbf; ++i ) {
+      P_max  = std::max( P_max,  std::abs(P_mat[i + j*ldp]) );
+      P_asym = std::max( P_asym, std::abs(P_mat[i + j*ldp] - P_mat[j + i*ldp]) );
+    }
+    if( P_asym > 1e-10 * P_max )
+      GAUXC_GENERIC_EXCEPTION("EXX Requires Symmetric Density Matrices");
+  }
 
 
-  // Get Tasks
-  this->load_balancer_->get_tasks();
-
   // Compute Local contributions to EXC / VXC
   this->timer_.time_op("XCIntegrator.LocalWork", [&](){
-    exx_local_work_( P, ldp, K, ldk, settings );
+    exx_local_work_( nmat, P, ldp, K, ldk, settings );
   });
 
-  #ifdef GAUXC_HAS_MPI
-  this->timer_.time_op("XCIntegrator.LocalWait", [&](){
-    MPI_Barrier( this->load_balancer_->runtime().comm() );
-  });
-  #endif
-
   // Reduce Results
   this->timer_.time_op("XCIntegrator.Allreduce", [&](){
 
     if( not this->reduction_driver_->takes_host_memory() )
       GAUXC_GENERIC_EXCEPTION("This Module Only Works With Host Reductions");
 
-    this->reduction_driver_->allreduce_inplace( K, nbf*nbf, ReductionOp::Sum );
+    std::vector<ReductionBuffer> bufs;
+    for( int64_t imat = 0; imat < nmat; ++imat )
+      bufs.emplace_back( ReductionBuffer::symmetric_matrix(K + imat*ldk*nbf, 
+        nbf, ldk) );
+    this->reduction_driver_->template allreduce_packed<value_type>( bufs, 
+      ReductionOp::Sum );
+
+  });
 
+  // Symmetrize over the point group exploited by the load balancer
+  if( not point_group.is_trivial() )
+  this->timer_.time_op("XCIntegrator.Symmetrize", [&](){
+    PointGroupSymmetrizer sym( point_group, this->load_balancer_->molecule(), 
+      basis );
+    sym.symmetrize_matrix( K, ldk );
   });
 
 }
@@ -265,10 +305,13 @@ auto compute_sn_LinK_ek_set( size_t nshells, const std::vector<int32_t>& shell_l
 
 
 
+/// Perform sn-LinK EK screening on a private copy of the local tasks and
+/// merge tasks which share both basis function and EK screening data. The
+/// tasks of the load balancer are not modified
 template <typename ValueType>
-void ReferenceReplicatedXCHostIntegrator<ValueType>::
-  exx_local_work_( const value_type* P, int64_t ldp, 
-    value_type* K, int64_t ldk, const IntegratorSettingsEXX& settings ) {
+std::vector<XCTask> ReferenceReplicatedXCHostIntegrator<ValueType>::
+  exx_screen_tasks_( int64_t nmat, const value_type* P, int64_t ldp, 
+    const IntegratorSettingsEXX& settings ) {
 
   // Cast LWD to LocalHostWorkDriver
   auto* lwd = dynamic_cast<LocalHostWorkDriver*>(this->local_work_driver_.get());
@@ -280,7 +323,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
 
   // Get basis map
-  BasisSetMap basis_map(basis,mol);
+  const auto& basis_map = this->load_balancer_->basis_map();
 
   const int32_t nbf = basis.nbf();
 
@@ -289,22 +332,14 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     return (a.points.size() * a.bfn_screening.nbe) > (b.points.size() * b.bfn_screening.nbe);
   };
 
-  auto& tasks = this->load_balancer_->get_tasks();
+  // Screening modifies a private copy of the tasks, out-of-core tasks are
+  // streamed into it s.t. the task store of the LoadBalancer remains valid
+  std::vector<XCTask> tasks;
+  this->load_balancer_->stream_tasks( [&]( std::vector<XCTask>& chunk ) {
+    tasks.insert( tasks.end(), chunk.begin(), chunk.end() );
+  });
   std::sort( tasks.begin(), tasks.end(), task_comparator );
 
-
-  // Check that Partition Weights have been calculated
-  auto& lb_state = this->load_balancer_->state();
-  if( not lb_state.modified_weights_are_stored ) {
-    GAUXC_GENERIC_EXCEPTION("Weights Have Not Been Modified"); 
-  }
-
-  // Zero out integrands
-  for( auto j = 0; j < nbf; ++j )
-  for( auto i = 0; i < nbf; ++i ) 
-    K[i + j*ldk] = 0.;
-
-   
   // Compute V upper bounds per shell pair
   const size_t nshells_bf = basis.size();
   std::vector<double> V_max( nshells_bf * nshells_bf );
@@ -322,9 +357,15 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     }
   }
 
-  // Absolute value of P
-  std::vector<double> P_abs(nbf*nbf);
-  for( auto i = 0; i < nbf*nbf; ++i ) P_abs[i] = std::abs(P[i]);
+  // Absolute value of P, for several P take the elementwise max such that
+  // the screening is valid for all of them
+  std::vector<double> P_abs(nbf*nbf, 0.);
+  for( int64_t imat = 0; imat < nmat; ++imat ) {
+    const auto* P_mat = P + imat*ldp*nbf;
+    for( auto j = 0; j < nbf; ++j )
+    for( auto i = 0; i < nbf; ++i ) 
+      P_abs[i + j*nbf] = std::max( P_abs[i + j*nbf], std::abs(P_mat[i + j*ldp]) );
+  }
 
   // Full shell list
   std::vector<int32_t> full_shell_list_( basis.nshells() );
@@ -341,11 +382,12 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   const double eps_K   = sn_link_settings.k_tol;
   const double eps_E   = sn_link_settings.energy_tol;
 
-  int world_rank = 0;
-  #ifdef GAUXC_HAS_MPI
-  auto comm = this->load_balancer_->runtime().comm();
-  MPI_Comm_rank( comm, &world_rank );
-  #endif
+  // Bound the integrals of the (attenuated) exchange operator
+  const double op_bound = exx_operator_bound( exx_operator(sn_link_settings) );
+  for( auto& v : V_max ) v *= op_bound;
+
+  int world_rank = this->load_balancer_->runtime().comm_rank();
+  util::unused(world_rank);
   //if( !world_rank ) {
   //  std::cout << "sn-LinK Settings:" << std::endl
   //            << "  SCREEN_EK     = " << std::boolalpha << screen_ek << std::endl
@@ -361,73 +403,71 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   exx_ek_screening( basis, basis_map, shpairs, P_abs.data(), nbf, V_max.data(), 
     nshells_bf, eps_E, eps_K, lwd, tasks.begin(), tasks.end() );
 
-  // Allow for merging of tasks with different iParent
+  // Allow for merging of tasks with different iParent, the merged tasks
+  // are private to sn-LinK (the partition weight derivatives of 
+  // eval_exc_grad require the parent atoms of the load balancer tasks)
   for(auto& task : tasks) task.iParent = 0;
 
-#if 1
-  // Lexicographic ordering of tasks
-  auto task_order = []( const auto& a, const auto& b ) {
+  // Merge tasks which share both bfn and EK screening data
+  const auto merge_policy = sn_link_settings.merge_policy;
+  this->timer_.time_op("XCIntegrator.EXX_MergeTasks(" + 
+    detail::to_string(merge_policy) + ")", [&](){
+    tasks = detail::merge_equivalent_tasks( std::move(tasks), merge_policy, 
+      true );
+  });
 
-    // Sort by iParent first
-    if( a.iParent < b.iParent )      return true;
-    else if( a.iParent > b.iParent ) return false;
+  // Order tasks on EK work (see LoadBalancerState::task_ordering)
+  order_tasks( this->load_balancer_->state().task_ordering, tasks.begin(), 
+    tasks.end(), []( const XCTask& t ) {
+      return double(t.cou_screening.shell_pair_list.size());
+    });
 
-    // Equal iParent: lex sort on bfn shell list
-    else if(a.bfn_screening.shell_list < b.bfn_screening.shell_list) return true;
-    else if(a.bfn_screening.shell_list > b.bfn_screening.shell_list) return false;
-    
-    // Equal iParent and bfn shell list: lex sort on cou shell list
-    else return a.cou_screening.shell_list < b.cou_screening.shell_list;
+  return tasks;
 
-  };
+}
 
-  std::sort( tasks.begin(), tasks.end(), task_order ); 
-  auto task_equiv = []( const auto& a, const auto& b ) {
-    return a.equiv_with(b) and 
-      a.cou_screening.equiv_with(b.cou_screening);
-  };
-  std::vector<XCTask> local_work_unique(tasks.begin(), tasks.end());
-  auto last_unique =
-    std::unique( local_work_unique.begin(),
-                 local_work_unique.end(),
-                 task_equiv );
-  local_work_unique.erase( last_unique, local_work_unique.end() );
-
-  // Merge tasks
-  for( auto&& t : local_work_unique ) {
-    t.points.clear();
-    t.weights.clear();
-    t.npts = 0;
-  }
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  exx_local_work_( int64_t nmat, const value_type* P, int64_t ldp, 
+    value_type* K, int64_t ldk, const IntegratorSettingsEXX& settings ) {
 
-  auto cur_lw_begin = tasks.begin();
-  auto cur_uniq_it  = local_work_unique.begin();
+  // Cast LWD to LocalHostWorkDriver
+  auto* lwd = dynamic_cast<LocalHostWorkDriver*>(this->local_work_driver_.get());
 
-  for( auto lw_it = tasks.begin(); lw_it != tasks.end(); ++lw_it ) 
-  if( not task_equiv( *lw_it, *cur_uniq_it ) ) {
+  // Setup Aliases
+  const auto& basis   = this->load_balancer_->basis();
+  const auto& mol     = this->load_balancer_->molecule();
+  const auto& shpairs = this->load_balancer_->shell_pairs();
 
-    if( cur_uniq_it == local_work_unique.end() )
-      GAUXC_GENERIC_EXCEPTION("Messed up in unique");
 
-    cur_uniq_it->merge_with( cur_lw_begin, lw_it );
+  // Get basis map
+  const auto& basis_map = this->load_balancer_->basis_map();
 
-    cur_lw_begin = lw_it;
-    cur_uniq_it++;
+  const int32_t nbf = basis.nbf();
 
+  // Check that Partition Weights have been calculated
+  auto& lb_state = this->load_balancer_->state();
+  if( not lb_state.modified_weights_are_stored ) {
+    GAUXC_GENERIC_EXCEPTION("Weights Have Not Been Modified"); 
   }
 
-  // Merge the last set of batches
-  for( ; cur_lw_begin != tasks.end(); ++cur_lw_begin )
-    cur_uniq_it->merge_with( *cur_lw_begin );
-  cur_uniq_it++;
-
-  tasks = std::move(local_work_unique);
-#endif
+  // Exchange operator
+  IntegratorSettingsSNLinK sn_link_settings;
+  if( auto* tmp = dynamic_cast<const IntegratorSettingsSNLinK*>(&settings) ) {
+    sn_link_settings = *tmp;
+  }
+  const auto op = exx_operator( sn_link_settings );
 
-  std::sort(tasks.begin(),tasks.end(),
-    [](auto& a, auto& b){ return a.cou_screening.shell_pair_list.size() >
-      b.cou_screening.shell_pair_list.size(); });
+  // Zero out integrands (see RuntimeEnvironment host placement)
+  const auto placement = 
+    this->load_balancer_->runtime().host_placement_policy().placement;
+  for( int64_t imat = 0; imat < nmat; ++imat )
+    zero_host_matrix( placement, nbf, nbf, K + imat*ldk*nbf, ldk );
 
+  // Screen and merge tasks
+  auto tasks = exx_screen_tasks_( nmat, P, ldp, settings );
+  generate_points_soa( tasks.begin(), tasks.end() );
+  populate_submat_maps( nbf, tasks.begin(), tasks.end(), basis_map );
 
   // Loop over tasks
   const size_t ntasks = tasks.size();
@@ -451,14 +491,12 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     if( ek_shell_list.size() == 0 ) {
       continue;
     }
-    std::vector< std::array<int32_t,3> > ek_submat_map;
-    std::tie( ek_submat_map, std::ignore ) =
-      gen_compressed_submat_map( basis_map, ek_shell_list, nbf, nbf );
+    const auto& ek_submat_map = task.cou_screening.submat_map;
 
     // Get tasks constants
     const int32_t  npts    = task.points.size();
 
-    const auto* points      = task.points.data()->data();
+    const auto* points      = task.points_soa.data();
     const auto* weights     = task.weights.data();
 
     // Basis function shell list
@@ -468,15 +506,13 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     size_t nbe_bfn     = 
       basis.nbf_subset( shell_list_bfn_.begin(), shell_list_bfn_.end() );
 
-    std::vector< std::array<int32_t, 3> > submat_map_bfn;
-    std::tie(submat_map_bfn, std::ignore) =
-      gen_compressed_submat_map( basis_map, shell_list_bfn_, nbf, nbf );
+    const auto& submat_map_bfn = task.bfn_screening.submat_map;
     
 
 
     // Allocate data screening independent data
     host_data.basis_eval.resize( npts * nbe_bfn );
-    host_data.nbe_scr   .resize( nbe_bfn * nbf );
+    host_data.nbe_scr   .resize( nmat * nbe_bfn * nbf );
     auto* basis_eval = host_data.basis_eval.data();
     auto* nbe_scr    = host_data.nbe_scr.data();
 
@@ -492,8 +528,10 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
 
     // Allocate Screening Dependent Data
-    host_data.zmat.resize( npts * nbe_ek );
-    host_data.gmat.resize( npts * nbe_ek );
+    // F / G for the different P are stacked by rows (ld = nmat * nbe_ek)
+    const size_t ld_ek = nmat * nbe_ek;
+    host_data.zmat.resize( npts * ld_ek );
+    host_data.gmat.resize( npts * ld_ek );
     auto* zmat = host_data.zmat.data();
     auto* gmat = host_data.gmat.data();
 
@@ -502,7 +540,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     // nu runs over the bfn shell list
     // i runs over all points
     lwd->eval_exx_fmat( npts, nbf, nbe_ek, nbe_bfn, ek_submat_map,
-      submat_map_bfn, P, ldp, basis_eval, nbe_bfn, zmat, nbe_ek, nbe_scr );
+      submat_map_bfn, nmat, P, ldp, basis_eval, nbe_bfn, zmat, ld_ek, nbe_scr );
 
     // Get True Max F for shell pairs
     //auto max_F = compute_true_f_max( npts, nshells_ek, nbe_ek, basis_map,
@@ -512,18 +550,19 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     // Compute G(mu,i) = w(i) * A(mu,nu,i) * F(nu,i)
     // mu/nu run over significant ek shells
     // i runs over all points
+    // A(mu,nu,i) is evaluated once and contracted with all F
     const size_t nshell_pairs = task.cou_screening.shell_pair_list.size();
     const auto*  shell_pair_list = task.cou_screening.shell_pair_list.data();
     lwd->eval_exx_gmat( npts, nshells_ek, nshell_pairs, nbe_ek, points, weights, 
-      basis, shpairs,basis_map, ek_shell_list.data(), shell_pair_list, zmat, 
-      nbe_ek, gmat, nbe_ek );
+      basis, shpairs,basis_map, ek_shell_list.data(), shell_pair_list, nmat, 
+      zmat, ld_ek, gmat, ld_ek, op );
 
     // Increment K(mu,nu) += B(mu,i) * G(nu,i)
     // mu runs over bfn shell list
     // nu runs over ek shells
     // i runs over all points
     lwd->inc_exx_k( npts, nbf, nbe_bfn, nbe_ek, basis_eval, submat_map_bfn,
-      ek_submat_map, gmat, nbe_ek, K, ldk, nbe_scr );
+      ek_submat_map, nmat, gmat, ld_ek, K, ldk, nbe_scr );
 
   } // Loop over tasks 
 
@@ -531,13 +570,16 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   } // End OpenMP region
 
   // Symmetrize K
-  for( auto j = 0; j < nbf; ++j ) 
-  for( auto i = 0; i < j;   ++i ) {
-    const auto K_ij = K[i + j*ldk];
-    const auto K_ji = K[j + i*ldk];
-    const auto K_symm = 0.5 * (K_ij + K_ji);
-    K[i + j*ldk] = K_symm;
-    K[j + i*ldk] = K_symm;
+  for( int64_t imat = 0; imat < nmat; ++imat ) {
+    auto* K_mat = K + imat*ldk*nbf;
+    for( auto j = 0; j < nbf; ++j ) 
+    for( auto i = 0; i < j;   ++i ) {
+      const auto K_ij = K_mat[i + j*ldk];
+      const auto K_ji = K_mat[j + i*ldk];
+      const auto K_symm = 0.5 * (K_ij + K_ji);
+      K_mat[i + j*ldk] = K_symm;
+      K_mat[j + i*ldk] = K_symm;
+    }
   }
 
 }
@@ -0,0 +1,638 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include "reference_replicated_xc_host_integrator.hpp"
+#include "integrator_util/host_buffer_placement.hpp"
+#include "integrator_util/integrator_common.hpp"
+#include "host/local_host_work_driver.hpp"
+#include "host/blas.hpp"
+#include <stdexcept>
+#include <optional>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+
+namespace GauXC::detail {
+
+/**
+ *  Generic implementation of the FXC contraction for RKS/UKS
+ *
+ *  Evaluates FXC[tP_k] = d/dh VXC[P + h*tP_k] |_{h=0} for a set of trial
+ *  densities in a single sweep over the quadrature. If Pz is null-y, RKS is
+ *  deduced. RKS driver delegates to this function.
+ */
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  eval_fxc_contraction_( int64_t m, int64_t n,
+                         const value_type* Ps, int64_t ldps,
+                         const value_type* Pz, int64_t ldpz,
+                         int64_t ntrial,
+                         const value_type* tPs, int64_t ldtps,
+                         const value_type* tPz, int64_t ldtpz,
+                         value_type* FXCs, int64_t ldfxcs,
+                         value_type* FXCz, int64_t ldfxcz,
+                         const IntegratorSettingsXC& ks_settings ) {
+
+  const auto& basis = this->load_balancer_->basis();
+
+  // Check that P / FXC are sane
+  const int64_t nbf = basis.nbf();
+  if( m != n )
+    GAUXC_GENERIC_EXCEPTION("P/FXC Must Be Square");
+  if( m != nbf )
+    GAUXC_GENERIC_EXCEPTION("P/FXC Must Have Same Dimension as Basis");
+
+  if( ldps < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDPS");
+  if( ldpz and ldpz < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDPZ");
+  if( ldtps < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDTPS");
+  if( ldtpz and ldtpz < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDTPZ");
+  if( ldfxcs < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDFXCS");
+  if( ldfxcz and ldfxcz < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDFXCZ");
+
+  if( ntrial < 0 )
+    GAUXC_GENERIC_EXCEPTION("Invalid Number of Trial Densities");
+  if( ntrial == 0 ) return;
+
+  // Symmetrizing over the point group is only exact for totally symmetric 
+  // trial densities, which is not the case in general
+  if( not this->load_balancer_->state().point_group.is_trivial() )
+    GAUXC_GENERIC_EXCEPTION("FXC Contraction Does Not Support Point Group Symmetry");
+
+  // Compute Local contributions to FXC (streamed over the tasks)
+  this->timer_.time_op("XCIntegrator.LocalWork", [&](){
+    stream_local_work_( 
+      [&]( task_iterator task_begin, task_iterator task_end, bool accumulate ) {
+      fxc_contraction_local_work_( basis, Ps, ldps, Pz, ldpz, ntrial,
+                                   tPs, ldtps, tPz, ldtpz,
+                                   FXCs, ldfxcs, FXCz, ldfxcz, ks_settings,
+                                   task_begin, task_end, accumulate );
+    });
+  });
+
+
+  // Reduce Results
+  this->timer_.time_op("XCIntegrator.Allreduce", [&](){
+
+    if( not this->reduction_driver_->takes_host_memory() )
+      GAUXC_GENERIC_EXCEPTION("This Module Only Works With Host Reductions");
+
+    std::vector<ReductionBuffer> red_buffers;
+    for( int64_t k = 0; k < ntrial; ++k ) {
+      red_buffers.push_back( ReductionBuffer::symmetric_matrix( 
+        FXCs + k*ldfxcs*n, nbf, ldfxcs ) );
+      if(FXCz) red_buffers.push_back( ReductionBuffer::symmetric_matrix( 
+        FXCz + k*ldfxcz*n, nbf, ldfxcz ) );
+    }
+
+    this->reduction_driver_->template allreduce_packed<value_type>( 
+      red_buffers, ReductionOp::Sum );
+
+  });
+
+}
+
+
+/// Generic implementation details of FXC contraction local work - deduces
+/// RKS/UKS based on null-y / zero parameters
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  fxc_contraction_local_work_( const basis_type& basis,
+                               const value_type* Ps, int64_t ldps,
+                               const value_type* Pz, int64_t ldpz,
+                               int64_t ntrial,
+                               const value_type* tPs, int64_t ldtps,
+                               const value_type* tPz, int64_t ldtpz,
+                               value_type* FXCs, int64_t ldfxcs,
+                               value_type* FXCz, int64_t ldfxcz,
+                               const IntegratorSettingsXC& settings,
+                               task_iterator task_begin, task_iterator task_end,
+                               bool accumulate ) {
+
+  const bool is_uks = (Pz != nullptr);
+  const bool is_rks = not is_uks;
+  if( is_uks and (tPz == nullptr or FXCz == nullptr) )
+    GAUXC_GENERIC_EXCEPTION("UKS FXC Contraction Requires Z Trial Densities");
+
+  // Misc FXC settings
+  IntegratorSettingsFXC fxc_settings;
+  if( auto* tmp = dynamic_cast<const IntegratorSettingsFXC*>(&settings) ) {
+    fxc_settings = *tmp;
+  }
+  const double fd_step = fxc_settings.fd_step;
+  if( fd_step <= 0. or fd_step >= 1. )
+    GAUXC_GENERIC_EXCEPTION("FXC Finite Difference Step Must Lie in (0,1)");
+
+  // Cast LWD to LocalHostWorkDriver
+  auto* lwd = dynamic_cast<LocalHostWorkDriver*>(this->local_work_driver_.get());
+
+  // Setup Aliases
+  const auto& func  = *this->func_;
+  const auto& mol   = this->load_balancer_->molecule();
+
+  const bool needs_laplacian = func.needs_laplacian();
+
+  // Get basis map
+  // Reuse the load balancer's BasisSetMap (and the submatrix maps cached on
+  // the tasks) unless integrating over a sub-basis (e.g. shell batching)
+  const bool is_lb_basis = &basis == &this->load_balancer_->basis();
+  std::optional<BasisSetMap> sub_basis_map;
+  if( not is_lb_basis ) sub_basis_map.emplace( basis, mol );
+  const auto& basis_map = 
+    is_lb_basis ? this->load_balancer_->basis_map() : *sub_basis_map;
+
+  const int32_t nbf = basis.nbf();
+
+  // Order tasks on size (see LoadBalancerState::task_ordering)
+  auto task_cost = []( const XCTask& t ) {
+    return double(t.points.size() * t.bfn_screening.nbe);
+  };
+  order_tasks( this->load_balancer_->state().task_ordering, task_begin, task_end,
+    task_cost );
+
+  // Check that Partition Weights have been calculated
+  auto& lb_state = this->load_balancer_->state();
+  if( not lb_state.modified_weights_are_stored ) {
+    GAUXC_GENERIC_EXCEPTION("Weights Have Not Been Modified");
+  }
+
+  // Populate SoA point storage and submatrix maps consumed by the host kernels
+  generate_points_soa( task_begin, task_end );
+  populate_submat_maps( nbf, task_begin, task_end, basis_map );
+
+  // Zero out integrands (see RuntimeEnvironment host placement)
+  const auto placement = 
+    this->load_balancer_->runtime().host_placement_policy().placement;
+  if( not accumulate )
+  for( int64_t k = 0; k < ntrial; ++k ) {
+    zero_host_matrix( placement, nbf, nbf, FXCs + k*ldfxcs*nbf, ldfxcs );
+    if(is_uks) 
+      zero_host_matrix( placement, nbf, nbf, FXCz + k*ldfxcz*nbf, ldfxcz );
+  }
+
+  // Loop over tasks
+  const size_t ntasks = std::distance(task_begin, task_end);
+
+  // Reuse the ground state U variables of the previous contraction if the
+  // density and the tasks of the load balancer are unchanged. Only in-core 
+  // tasks of the load balancer basis persist between contractions, tasks
+  // beyond fxc_settings.ground_state_cache_bytes are not cached
+  std::vector<fxc_ground_state*> task_ground_state( ntasks, nullptr );
+  auto& cache = fxc_cache_;
+  const auto generation = this->load_balancer_->task_generation();
+  const auto cache_bytes = fxc_settings.ground_state_cache_bytes;
+  const bool use_cache = is_lb_basis and cache_bytes and 
+    not this->load_balancer_->tasks_out_of_core();
+  if( not use_cache or cache.generation != generation )
+    cache = fxc_ground_state_cache{};
+
+  if( use_cache ) {
+
+    cache.generation = generation;
+
+    // The density is compared in place and only copied if it changed
+    auto update_density = [&]( std::vector<value_type>& cached, 
+      const value_type* P, int64_t ldp ) {
+      bool same = cached.size() == size_t(P ? nbf*nbf : 0);
+      for( int32_t j = 0; same and j < nbf; ++j )
+        same = std::equal( P + j*ldp, P + j*ldp + nbf, cached.data() + j*nbf );
+      if( same ) return true;
+      cached.resize( P ? nbf*nbf : 0 );
+      if( P ) for( int32_t j = 0; j < nbf; ++j )
+        std::copy_n( P + j*ldp, nbf, cached.data() + j*nbf );
+      return false;
+    };
+    const bool same_s = update_density( cache.Ps, Ps, ldps );
+    const bool same_z = update_density( cache.Pz, Pz, ldpz );
+    if( not (same_s and same_z) ) {
+      cache.tasks.clear();
+      cache.bytes = (cache.Ps.size() + cache.Pz.size()) * sizeof(value_type);
+    }
+
+    // den, gamma, tau and lapl per grid point
+    const size_t nspin_scal = is_rks ? 1 : 2;
+    size_t gs_dim = nspin_scal * (func.is_lda() ? 1 : 4);
+    if( not func.is_lda() ) gs_dim += is_rks ? 1 : 3;
+    if( func.is_mgga()    ) gs_dim += nspin_scal;
+    if( func.is_mgga() and needs_laplacian ) gs_dim += nspin_scal;
+
+    for( size_t iT = 0; iT < ntasks; ++iT ) {
+      const auto& task = *(task_begin + iT);
+      if( task.points.empty() ) continue;
+      auto it = cache.tasks.find( task.points.data() );
+      if( it == cache.tasks.end() ) {
+        const size_t task_bytes = 
+          gs_dim * task.points.size() * sizeof(value_type);
+        if( cache.bytes + task_bytes > cache_bytes ) continue;
+        it = cache.tasks.emplace( task.points.data(), fxc_ground_state{} ).first;
+        cache.bytes += task_bytes;
+      }
+      task_ground_state[iT] = &it->second;
+    }
+
+  }
+
+  #pragma omp parallel
+  {
+
+  XCHostData<value_type> host_data; // Thread local host data
+
+  // Thread local trial / perturbed data
+  std::vector<value_type> xmat_trial, zmat_p, zmat_m;
+  std::vector<value_type> den_trial, tau_trial, lapl_trial;
+  std::vector<value_type> den_pert, gamma_pert, tau_pert, lapl_pert;
+  std::vector<value_type> gamma_scr, h_pt;
+
+  #pragma omp for schedule(dynamic)
+  for( size_t iT = 0; iT < ntasks; ++iT ) {
+
+    // Alias current task
+    const auto& task = *(task_begin + iT);
+
+    // Get tasks constants
+    const int32_t  npts    = task.points.size();
+    const int32_t  nbe     = task.bfn_screening.nbe;
+    const int32_t  nshells = task.bfn_screening.shell_list.size();
+
+    const auto* points      = task.points_soa.data();
+    const auto* weights     = task.weights.data();
+    const int32_t* shell_list = task.bfn_screening.shell_list.data();
+
+    // Allocate enough memory for batch
+    const size_t spin_dim_scal = is_rks ? 1 : 2;
+    const size_t mgga_dim_scal = func.is_mgga() ? 4 : 1; // basis + d1basis
+    const size_t gga_dim_scal  = is_rks ? 1 : 3;
+    const size_t den_dim_scal  = func.is_lda() ? 1 : 4;  // den + grad (3)
+    const size_t zmat_sz       = npts * nbe * spin_dim_scal * mgga_dim_scal;
+
+    host_data.nbe_scr .resize(nbe  * nbe);
+    host_data.zmat    .resize(zmat_sz);
+    host_data.eps     .resize(npts);
+    host_data.vrho    .resize(npts * spin_dim_scal);
+    host_data.den_scr .resize(npts * spin_dim_scal * den_dim_scal);
+
+    xmat_trial.resize(zmat_sz);
+    zmat_p    .resize(zmat_sz);
+    zmat_m    .resize(zmat_sz);
+    den_trial .resize(npts * spin_dim_scal * den_dim_scal);
+    den_pert  .resize(npts * spin_dim_scal * den_dim_scal);
+    h_pt      .resize(npts);
+
+    if( func.is_lda() ) {
+      host_data.basis_eval .resize( npts * nbe );
+    }
+
+    if( func.is_gga() or func.is_mgga() ) {
+      host_data.basis_eval .resize( 4 * npts * nbe );
+      host_data.gamma      .resize( gga_dim_scal * npts );
+      host_data.vgamma     .resize( gga_dim_scal * npts );
+      gamma_pert           .resize( gga_dim_scal * npts );
+      gamma_scr            .resize( gga_dim_scal * npts );
+    }
+
+    if( func.is_mgga() ) {
+      if( needs_laplacian ) {
+        host_data.basis_eval .resize( 5 * npts * nbe ); // basis + grad (3) + lapl
+        host_data.lapl       .resize( spin_dim_scal * npts );
+        host_data.vlapl      .resize( spin_dim_scal * npts );
+        lapl_trial           .resize( spin_dim_scal * npts );
+        lapl_pert            .resize( spin_dim_scal * npts );
+      }
+      host_data.tau        .resize( spin_dim_scal * npts );
+      host_data.vtau       .resize( spin_dim_scal * npts );
+      tau_trial            .resize( spin_dim_scal * npts );
+      tau_pert             .resize( spin_dim_scal * npts );
+    }
+
+    // Alias/Partition out scratch memory
+    auto* basis_eval = host_data.basis_eval.data();
+    auto* nbe_scr    = host_data.nbe_scr.data();
+
+    auto* eps        = host_data.eps.data();
+    auto* vrho       = host_data.vrho.data();
+    auto* vgamma     = host_data.vgamma.data();
+    auto* vtau       = host_data.vtau.data();
+    auto* vlapl      = host_data.vlapl.data();
+
+    value_type* dbasis_x_eval = nullptr;
+    value_type* dbasis_y_eval = nullptr;
+    value_type* dbasis_z_eval = nullptr;
+    value_type* lbasis_eval = nullptr;
+
+    if( func.is_gga() or func.is_mgga() ) {
+      dbasis_x_eval = basis_eval    + npts * nbe;
+      dbasis_y_eval = dbasis_x_eval + npts * nbe;
+      dbasis_z_eval = dbasis_y_eval + npts * nbe;
+    }
+    if( func.is_mgga() and needs_laplacian ) {
+      lbasis_eval     = dbasis_z_eval + npts * nbe;
+    }
+
+    // Partition a density buffer into den / dden_{x,y,z}
+    auto dden_ptr = [&]( value_type* den, int d ) -> value_type* {
+      return func.is_lda() ? nullptr : den + (d+1) * spin_dim_scal * npts;
+    };
+
+    // Partition a Z (or X) buffer into scalar / Z spin components and
+    // the MGGA M matrices
+    auto zmat_ptr = [&]( value_type* zmat, int spin, int d ) -> value_type* {
+      if( (spin and is_rks) or (d and not func.is_mgga()) ) return nullptr;
+      return zmat + (spin * mgga_dim_scal + d) * npts * nbe;
+    };
+
+
+    // Get the submatrix map for batch
+    const auto& submat_map = task.bfn_screening.submat_map;
+
+    // Evaluate Collocation (+ Grad and Laplacian) once for all trial densities
+    if( func.is_mgga() ) {
+      if ( needs_laplacian ) {
+        lwd->eval_collocation_laplacian( npts, nshells, nbe, points, basis, shell_list,
+          basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval, lbasis_eval );
+      } else {
+        lwd->eval_collocation_gradient( npts, nshells, nbe, points, basis, shell_list,
+          basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval );
+      }
+    }
+    else if( func.is_gga() )
+      lwd->eval_collocation_gradient( npts, nshells, nbe, points, basis, shell_list,
+        basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval );
+    else
+      lwd->eval_collocation( npts, nshells, nbe, points, basis, shell_list,
+        basis_eval );
+
+    const auto xmat_fac = is_rks ? 2.0 : 1.0;
+
+    // Evaluate X = fac * P * B for the S/Z components of a density
+    auto eval_xmat = [&]( const value_type* P_s, int64_t ldp_s,
+                          const value_type* P_z, int64_t ldp_z, value_type* X ) {
+      lwd->eval_xmat( mgga_dim_scal * npts, nbf, nbe, submat_map, xmat_fac, P_s, ldp_s,
+        basis_eval, nbe, zmat_ptr(X,0,0), nbe, nbe_scr );
+      if( is_uks )
+        lwd->eval_xmat( mgga_dim_scal * npts, nbf, nbe, submat_map, 1.0, P_z, ldp_z,
+          basis_eval, nbe, zmat_ptr(X,1,0), nbe, nbe_scr );
+    };
+
+    // Evaluate U variables from a precomputed X matrix. All quantities are
+    // linear in X except for gamma
+    auto eval_uvvar = [&]( value_type* X, value_type* den, value_type* gamma,
+                           value_type* tau, value_type* lapl ) {
+      auto* Xs = zmat_ptr(X,0,0); auto* Xz = zmat_ptr(X,1,0);
+      auto* dden_x = dden_ptr(den,0);
+      auto* dden_y = dden_ptr(den,1);
+      auto* dden_z = dden_ptr(den,2);
+      if( func.is_mgga() ) {
+        if( is_rks )
+          lwd->eval_uvvar_mgga_rks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+            dbasis_z_eval, lbasis_eval, Xs, nbe, zmat_ptr(X,0,1), zmat_ptr(X,0,2),
+            zmat_ptr(X,0,3), nbe, den, dden_x, dden_y, dden_z, gamma, tau, lapl );
+        else
+          lwd->eval_uvvar_mgga_uks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+            dbasis_z_eval, lbasis_eval, Xs, nbe, Xz, nbe, zmat_ptr(X,0,1), zmat_ptr(X,0,2),
+            zmat_ptr(X,0,3), nbe, zmat_ptr(X,1,1), zmat_ptr(X,1,2), zmat_ptr(X,1,3), nbe,
+            den, dden_x, dden_y, dden_z, gamma, tau, lapl );
+      } else if( func.is_gga() ) {
+        if( is_rks )
+          lwd->eval_uvvar_gga_rks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+            dbasis_z_eval, Xs, nbe, den, dden_x, dden_y, dden_z, gamma );
+        else
+          lwd->eval_uvvar_gga_uks( npts, nbe, basis_eval, dbasis_x_eval, dbasis_y_eval,
+            dbasis_z_eval, Xs, nbe, Xz, nbe, den, dden_x, dden_y, dden_z, gamma );
+      } else {
+        if( is_rks ) lwd->eval_uvvar_lda_rks( npts, nbe, basis_eval, Xs, nbe, den );
+        else lwd->eval_uvvar_lda_uks( npts, nbe, basis_eval, Xs, nbe, Xz, nbe, den );
+      }
+    };
+
+    // Evaluate the XC functional on a (perturbed) density, factor in the
+    // quadrature weights and form the Z (and M) matrices for VXC
+    auto eval_vxc_zmat = [&]( value_type* den, value_type* gamma, value_type* tau,
+                              value_type* lapl, value_type* Z ) {
+
+      if( func.is_mgga() )
+        func.eval_exc_vxc( npts, den, gamma, lapl, tau, eps, vrho, vgamma, vlapl, vtau);
+      else if( func.is_gga() )
+        func.eval_exc_vxc( npts, den, gamma, eps, vrho, vgamma );
+      else
+        func.eval_exc_vxc( npts, den, eps, vrho );
+
+      for( int32_t i = 0; i < npts; ++i ) {
+        for( size_t s = 0; s < spin_dim_scal; ++s ) {
+          vrho[spin_dim_scal*i + s] *= weights[i];
+          if( func.is_mgga() ) vtau[spin_dim_scal*i + s] *= weights[i];
+          if( needs_laplacian ) vlapl[spin_dim_scal*i + s] *= weights[i];
+        }
+        if( func.is_gga() or func.is_mgga() )
+        for( size_t s = 0; s < gga_dim_scal; ++s )
+          vgamma[gga_dim_scal*i + s] *= weights[i];
+      }
+
+      auto* Zs = zmat_ptr(Z,0,0); auto* Zz = zmat_ptr(Z,1,0);
+      auto* dden_x = dden_ptr(den,0);
+      auto* dden_y = dden_ptr(den,1);
+      auto* dden_z = dden_ptr(den,2);
+      if( func.is_mgga() ) {
+        if( is_rks ) {
+          lwd->eval_zmat_mgga_vxc_rks( npts, nbe, vrho, vgamma, vlapl, basis_eval,
+            dbasis_x_eval, dbasis_y_eval, dbasis_z_eval, lbasis_eval,
+            dden_x, dden_y, dden_z, Zs, nbe );
+          lwd->eval_mmat_mgga_vxc_rks( npts, nbe, vtau, vlapl, dbasis_x_eval,
+            dbasis_y_eval, dbasis_z_eval, zmat_ptr(Z,0,1), zmat_ptr(Z,0,2),
+            zmat_ptr(Z,0,3), nbe );
+        } else {
+          lwd->eval_zmat_mgga_vxc_uks( npts, nbe, vrho, vgamma, vlapl, basis_eval,
+            dbasis_x_eval, dbasis_y_eval, dbasis_z_eval, lbasis_eval,
+            dden_x, dden_y, dden_z, Zs, nbe, Zz, nbe );
+          lwd->eval_mmat_mgga_vxc_uks( npts, nbe, vtau, vlapl, dbasis_x_eval,
+            dbasis_y_eval, dbasis_z_eval, zmat_ptr(Z,0,1), zmat_ptr(Z,0,2),
+            zmat_ptr(Z,0,3), nbe, zmat_ptr(Z,1,1), zmat_ptr(Z,1,2), zmat_ptr(Z,1,3),
+            nbe );
+        }
+      } else if( func.is_gga() ) {
+        if( is_rks )
+          lwd->eval_zmat_gga_vxc_rks( npts, nbe, vrho, vgamma, basis_eval, dbasis_x_eval,
+            dbasis_y_eval, dbasis_z_eval, dden_x, dden_y, dden_z, Zs, nbe );
+        else
+          lwd->eval_zmat_gga_vxc_uks( npts, nbe, vrho, vgamma, basis_eval, dbasis_x_eval,
+            dbasis_y_eval, dbasis_z_eval, dden_x, dden_y, dden_z, Zs, nbe, Zz, nbe );
+      } else {
+        if( is_rks ) lwd->eval_zmat_lda_vxc_rks( npts, nbe, vrho, basis_eval, Zs, nbe );
+        else lwd->eval_zmat_lda_vxc_uks( npts, nbe, vrho, basis_eval, Zs, nbe, Zz, nbe );
+      }
+
+    };
+
+    // Recompute gamma from (perturbed) density gradients
+    auto eval_gamma = [&]( value_type* den, value_type* gamma ) {
+      const auto* dx = dden_ptr(den,0);
+      const auto* dy = dden_ptr(den,1);
+      const auto* dz = dden_ptr(den,2);
+      for( int32_t i = 0; i < npts; ++i ) {
+        if( is_rks ) {
+          gamma[i] = dx[i]*dx[i] + dy[i]*dy[i] + dz[i]*dz[i];
+        } else {
+          const auto dn_sq  = dx[2*i]*dx[2*i] + dy[2*i]*dy[2*i] + dz[2*i]*dz[2*i];
+          const auto dMz_sq = dx[2*i+1]*dx[2*i+1] + dy[2*i+1]*dy[2*i+1] +
+                              dz[2*i+1]*dz[2*i+1];
+          const auto dn_dMz = dx[2*i]*dx[2*i+1] + dy[2*i]*dy[2*i+1] +
+                              dz[2*i]*dz[2*i+1];
+          gamma[3*i  ] = 0.25*(dn_sq + dMz_sq) + 0.5*dn_dMz;
+          gamma[3*i+1] = 0.25*(dn_sq - dMz_sq);
+          gamma[3*i+2] = 0.25*(dn_sq + dMz_sq) - 0.5*dn_dMz;
+        }
+      }
+    };
+
+    // Ground state U variables - shared by all trial densities
+    auto* den_eval = host_data.den_scr.data();
+    auto* gamma    = host_data.gamma.data();
+    auto* tau      = host_data.tau.data();
+    auto* lapl     = host_data.lapl.data();
+    auto* gs       = task_ground_state[iT];
+    const bool cached = gs and not gs->den.empty();
+    if( gs ) {
+      if( not cached ) {
+        gs->den  .resize( host_data.den_scr.size() );
+        gs->gamma.resize( host_data.gamma.size()   );
+        gs->tau  .resize( host_data.tau.size()     );
+        gs->lapl .resize( host_data.lapl.size()    );
+      }
+      den_eval = gs->den.data();
+      gamma    = gs->gamma.data();
+      tau      = gs->tau.data();
+      lapl     = gs->lapl.data();
+    }
+    if( not cached ) {
+      eval_xmat( Ps, ldps, Pz, ldpz, host_data.zmat.data() );
+      eval_uvvar( host_data.zmat.data(), den_eval, gamma, tau, lapl );
+    }
+
+    for( int64_t k = 0; k < ntrial; ++k ) {
+
+      const auto* tPs_k = tPs + k*ldtps*nbf;
+      const auto* tPz_k = is_uks ? tPz + k*ldtpz*nbf : nullptr;
+
+      // Trial U variables (gamma is not linear and is discarded)
+      eval_xmat( tPs_k, ldtps, tPz_k, ldtpz, xmat_trial.data() );
+      eval_uvvar( xmat_trial.data(), den_trial.data(), gamma_scr.data(),
+        tau_trial.data(), lapl_trial.data() );
+
+      // Pointwise step: the perturbed spin densities (and kinetic energy
+      // densities) may differ by at most fd_step relative to the ground state
+      for( int32_t i = 0; i < npts; ++i ) {
+        double h = std::numeric_limits<double>::infinity();
+        auto constrain = [&]( double x0, double x1 ) {
+          if( x1 == 0. ) return;
+          h = (x0 > 0.) ? std::min( h, fd_step * x0 / std::abs(x1) ) : 0.;
+        };
+        for( size_t s = 0; s < spin_dim_scal; ++s ) {
+          constrain( den_eval[spin_dim_scal*i+s], den_trial[spin_dim_scal*i+s] );
+          if( func.is_mgga() )
+            constrain( tau[spin_dim_scal*i+s], tau_trial[spin_dim_scal*i+s] );
+        }
+
+        // Pure gradient perturbations
+        if( std::isinf(h) and not func.is_lda() ) {
+          double g0 = 0., g1 = 0.;
+          for( int d = 0; d < 3; ++d )
+          for( size_t s = 0; s < spin_dim_scal; ++s ) {
+            const auto x0 = dden_ptr(den_eval,d)[spin_dim_scal*i+s];
+            const auto x1 = dden_ptr(den_trial.data(),d)[spin_dim_scal*i+s];
+            g0 += x0*x0; g1 += x1*x1;
+          }
+          if( g1 > 0. ) h = fd_step * std::sqrt(g0 / g1);
+        }
+
+        h_pt[i] = std::isinf(h) ? 0. : h;
+      }
+
+      // Central difference of Z(P + h*tP) along the trial direction
+      for( int isgn = 0; isgn < 2; ++isgn ) {
+        const double sgn = isgn ? -1. : 1.;
+        const size_t den_sz = den_pert.size() / npts;
+        for( int32_t i = 0; i < npts; ++i ) {
+          const double sh = sgn * h_pt[i];
+          for( size_t j = 0; j < den_sz; ++j ) {
+            // den_{x,y,z} are stored as [spin_dim_scal * npts] blocks
+            const size_t blk = j / spin_dim_scal;
+            const size_t idx = blk*spin_dim_scal*npts + spin_dim_scal*i +
+                               (j % spin_dim_scal);
+            den_pert[idx] = den_eval[idx] + sh * den_trial[idx];
+          }
+          if( func.is_mgga() )
+          for( size_t s = 0; s < spin_dim_scal; ++s ) {
+            const size_t idx = spin_dim_scal*i + s;
+            tau_pert[idx] = tau[idx] + sh * tau_trial[idx];
+            if( needs_laplacian ) lapl_pert[idx] = lapl[idx] + sh * lapl_trial[idx];
+          }
+        }
+        if( not func.is_lda() ) eval_gamma( den_pert.data(), gamma_pert.data() );
+
+        eval_vxc_zmat( den_pert.data(), gamma_pert.data(), tau_pert.data(),
+          lapl_pert.data(), isgn ? zmat_m.data() : zmat_p.data() );
+      }
+
+      // dZ = (Z+ - Z-) / 2h -> stored in Z+
+      const size_t nblk = spin_dim_scal * mgga_dim_scal;
+      for( size_t b = 0; b < nblk; ++b )
+      for( int32_t i = 0; i < npts; ++i ) {
+        const double fac = h_pt[i] > 0. ? 0.5 / h_pt[i] : 0.;
+        auto* zp_i = zmat_p.data() + b*npts*nbe + i*nbe;
+        auto* zm_i = zmat_m.data() + b*npts*nbe + i*nbe;
+        for( int32_t mu = 0; mu < nbe; ++mu )
+          zp_i[mu] = fac * (zp_i[mu] - zm_i[mu]);
+      }
+
+      // Increment LT of FXC
+      lwd->inc_vxc( mgga_dim_scal * npts, nbf, nbe, basis_eval, submat_map,
+        zmat_ptr(zmat_p.data(),0,0), nbe, FXCs + k*ldfxcs*nbf, ldfxcs, nbe_scr );
+      if( is_uks )
+        lwd->inc_vxc( mgga_dim_scal * npts, nbf, nbe, basis_eval, submat_map,
+          zmat_ptr(zmat_p.data(),1,0), nbe, FXCz + k*ldfxcz*nbf, ldfxcz, nbe_scr );
+
+    } // Loop over trial densities
+
+  } // Loop over tasks
+
+  } // End OpenMP region
+
+  // Symmetrize FXC
+  for( int64_t k = 0; k < ntrial; ++k ) {
+    auto* FXCs_k = FXCs + k*ldfxcs*nbf;
+    auto* FXCz_k = is_uks ? FXCz + k*ldfxcz*nbf : nullptr;
+    for( int32_t j = 0;   j < nbf; ++j )
+    for( int32_t i = j+1; i < nbf; ++i ) {
+      FXCs_k[ j + i*ldfxcs ] = FXCs_k[ i + j*ldfxcs ];
+      if(is_uks) FXCz_k[ j + i*ldfxcz ] = FXCz_k[ i + j*ldfxcz ];
+    }
+  }
+
+}
+
+
+/// RKS FXC contraction driver - delegates to generic UKS impl
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  eval_fxc_contraction_( int64_t m, int64_t n,
+                         const value_type* P, int64_t ldp,
+                         int64_t ntrial, const value_type* tP, int64_t ldtp,
+                         value_type* FXC, int64_t ldfxc,
+                         const IntegratorSettingsXC& ks_settings ) {
+
+  eval_fxc_contraction_( m, n, P, ldp, nullptr, 0, ntrial, tP, ldtp, nullptr, 0,
+    FXC, ldfxc, nullptr, 0, ks_settings );
+
+}
+
+} // namespace GauXC::detail
@@ -31,13 +31,12 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     GAUXC_GENERIC_EXCEPTION("Invalid LDP");
 
 
-  // Get Tasks
-  this->load_balancer_->get_tasks();
-
-  *N_EL = 0.;
-  // Compute Local contributions to EXC / VXC
+  // Compute Local contributions to N_EL (streamed over the tasks)
   this->timer_.time_op("XCIntegrator.LocalWork", [&](){
-    integrate_den_local_work_( P, ldp, N_EL );
+    stream_local_work_( 
+      [&]( task_iterator task_begin, task_iterator task_end, bool accumulate ) {
+      integrate_den_local_work_( P, ldp, N_EL, task_begin, task_end, accumulate );
+    });
   });
 
 
@@ -56,7 +55,8 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 template <typename ValueType>
 void ReferenceReplicatedXCHostIntegrator<ValueType>::
   integrate_den_local_work_( const value_type* P, int64_t ldp, 
-    value_type* N_EL ) {
+    value_type* N_EL, task_iterator task_begin, task_iterator task_end,
+    bool accumulate ) {
 
   // Cast LWD to LocalHostWorkDriver
   auto* lwd = dynamic_cast<LocalHostWorkDriver*>(this->local_work_driver_.get());
@@ -66,17 +66,17 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   const auto& mol   = this->load_balancer_->molecule();
 
   // Get basis map
-  BasisSetMap basis_map(basis,mol);
+  const auto& basis_map = this->load_balancer_->basis_map();
 
   const int32_t nbf = basis.nbf();
 
-  // Sort tasks on size (XXX: maybe doesnt matter?)
-  auto task_comparator = []( const XCTask& a, const XCTask& b ) {
-    return (a.points.size() * a.bfn_screening.nbe) > (b.points.size() * b.bfn_screening.nbe);
+  // Order tasks on size (see LoadBalancerState::task_ordering)
+  auto task_cost = []( const XCTask& t ) {
+    return double(t.points.size() * t.bfn_screening.nbe);
   };
 
-  auto& tasks = this->load_balancer_->get_tasks();
-  std::sort( tasks.begin(), tasks.end(), task_comparator );
+  order_tasks( this->load_balancer_->state().task_ordering, task_begin, task_end,
+    task_cost );
 
 
   // Compute Partition Weights
@@ -85,9 +85,13 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     GAUXC_GENERIC_EXCEPTION("Weights Have Not Been Modified"); 
   }
 
+  // Populate SoA point storage and submatrix maps consumed by the host kernels
+  generate_points_soa( task_begin, task_end );
+  populate_submat_maps( nbf, task_begin, task_end, basis_map );
+
 
   // Loop over tasks
-  const size_t ntasks = tasks.size();
+  const size_t ntasks = std::distance(task_begin, task_end);
   double N_EL_WORK = 0.0;
 
   #pragma omp parallel
@@ -101,14 +105,14 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
     //std::cout << iT << "/" << ntasks << std::endl;
     // Alias current task
-    const auto& task = tasks[iT];
+    const auto& task = *(task_begin + iT);
 
     // Get tasks constants
     const int32_t  npts    = task.points.size();
     const int32_t  nbe     = task.bfn_screening.nbe;
     const int32_t  nshells = task.bfn_screening.shell_list.size();
 
-    const auto* points      = task.points.data()->data();
+    const auto* points      = task.points_soa.data();
     const auto* weights     = task.weights.data();
     const int32_t* shell_list = task.bfn_screening.shell_list.data();
 
@@ -129,9 +133,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
 
     // Get the submatrix map for batch
-    std::vector< std::array<int32_t, 3> > submat_map;
-    std::tie(submat_map, std::ignore) =
-          gen_compressed_submat_map(basis_map, task.bfn_screening.shell_list, nbf, nbf);
+    const auto& submat_map = task.bfn_screening.submat_map;
 
     // Evaluate Collocation (+ Grad)
     lwd->eval_collocation( npts, nshells, nbe, points, basis, shell_list, 
@@ -159,7 +161,8 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   } // End OpenMP region
 
   // Commit return value
-  *N_EL = N_EL_WORK;
+  if( accumulate ) *N_EL += N_EL_WORK;
+  else             *N_EL  = N_EL_WORK;
 
 }
 
@@ -8,31 +8,53 @@
 #pragma once
 #include <vector>
 #include <cstdint>
+#include <tuple>
+#include <type_traits>
 
 #include <gauxc/gauxc_config.hpp>
+#include <gauxc/util/aligned_allocator.hpp>
 
 namespace GauXC {
 
 template <typename F>
 struct XCHostData {
 
-  std::vector<F> eps;
-  std::vector<F> gamma;
-  std::vector<F> tau;
-  std::vector<F> lapl;
-  std::vector<F> vrho;
-  std::vector<F> vgamma;
-  std::vector<F> vtau;
-  std::vector<F> vlapl;
+  // Batch buffers are 64-byte aligned so the leading point/bfn of every
+  // batch starts on a cache line
+  template <typename T>
+  using buffer_type = util::aligned_vector<T>;
+
+  buffer_type<F> eps;
+  buffer_type<F> gamma;
+  buffer_type<F> tau;
+  buffer_type<F> lapl;
+  buffer_type<F> vrho;
+  buffer_type<F> vgamma;
+  buffer_type<F> vtau;
+  buffer_type<F> vlapl;
  
-  std::vector<F> zmat;
-  std::vector<F> gmat;
-  std::vector<F> nbe_scr;
-  std::vector<F> den_scr;
-  std::vector<F> basis_eval;
+  buffer_type<F> zmat;
+  buffer_type<F> gmat;
+  buffer_type<F> nbe_scr;
+  buffer_type<F> den_scr;
+  buffer_type<F> basis_eval;
+
+  // Single precision buffers of the mixed precision path
+  buffer_type<float> basis_eval_sp;
+  buffer_type<float> zmat_sp;
+  buffer_type<float> nbe_scr_sp;
    
   inline XCHostData() {}
 
+  /// Collocation, Z and nbe scratch buffers of precision T
+  template <typename T>
+  inline auto basis_buffers() {
+    if constexpr ( std::is_same_v<T,float> and not std::is_same_v<F,float> )
+      return std::tie( basis_eval_sp, zmat_sp, nbe_scr_sp );
+    else
+      return std::tie( basis_eval, zmat, nbe_scr );
+  }
+
 };
 
 }
@@ -117,12 +117,69 @@ void ReplicatedXCIntegratorImpl<ValueType>::
 
 }
 
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_fxc_contraction( int64_t m, int64_t n, const value_type* P,
+                        int64_t ldp, int64_t ntrial, 
+                        const value_type* tP, int64_t ldtp,
+                        value_type* FXC, int64_t ldfxc,
+                        const IntegratorSettingsXC& ks_settings ) {
+
+    eval_fxc_contraction_(m,n,P,ldp,ntrial,tP,ldtp,FXC,ldfxc,ks_settings);
+
+}
+
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_fxc_contraction( int64_t m, int64_t n, const value_type* Ps,
+                        int64_t ldps,
+                        const value_type* Pz,
+                        int64_t ldpz,
+                        int64_t ntrial,
+                        const value_type* tPs, int64_t ldtps,
+                        const value_type* tPz, int64_t ldtpz,
+                        value_type* FXCs, int64_t ldfxcs,
+                        value_type* FXCz, int64_t ldfxcz,
+                        const IntegratorSettingsXC& ks_settings ) {
+
+    eval_fxc_contraction_(m,n,Ps,ldps,
+                          Pz,ldpz,ntrial,
+                          tPs,ldtps,
+                          tPz,ldtpz,
+                          FXCs,ldfxcs,
+                          FXCz,ldfxcz,ks_settings);
+
+}
+
 template <typename ValueType>
 void ReplicatedXCIntegratorImpl<ValueType>::
   eval_exc_grad( int64_t m, int64_t n, const value_type* P,
-                int64_t ldp, value_type* EXC_GRAD ) {
+                int64_t ldp, value_type* EXC_GRAD, 
+                const IntegratorSettingsXC& settings ) {
 
-    eval_exc_grad_(m,n,P,ldp,EXC_GRAD);
+    eval_exc_grad_(m,n,P,ldp,EXC_GRAD,settings);
+
+}
+
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_exc_grad( int64_t m, int64_t n, const value_type* Ps,
+                int64_t ldps, const value_type* Pz, int64_t ldpz,
+                value_type* EXC_GRAD, const IntegratorSettingsXC& settings ) {
+
+    eval_exc_grad_(m,n,Ps,ldps,Pz,ldpz,EXC_GRAD,settings);
+
+}
+
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_exc_grad( int64_t m, int64_t n, const value_type* Ps,
+                int64_t ldps, const value_type* Pz, int64_t ldpz,
+                const value_type* Py, int64_t ldpy,
+                const value_type* Px, int64_t ldpx,
+                value_type* EXC_GRAD, const IntegratorSettingsXC& settings ) {
+
+    eval_exc_grad_(m,n,Ps,ldps,Pz,ldpz,Py,ldpy,Px,ldpx,EXC_GRAD,settings);
 
 }
 
@@ -136,6 +193,28 @@ void ReplicatedXCIntegratorImpl<ValueType>::
 
 }
 
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_exx( int64_t m, int64_t n, int64_t nmat, const value_type* P,
+            int64_t ldp, value_type* K, int64_t ldk,
+            const IntegratorSettingsEXX& settings ) {
+
+    eval_exx_(m,n,nmat,P,ldp,K,ldk,settings);
+
+}
+
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_exc_vxc_exx( int64_t m, int64_t n, const value_type* P,
+                    int64_t ldp, value_type* VXC, int64_t ldvxc,
+                    value_type* K, int64_t ldk, value_type* EXC,
+                    const IntegratorSettingsXC&  ks_settings,
+                    const IntegratorSettingsEXX& exx_settings ) {
+
+    eval_exc_vxc_exx_(m,n,P,ldp,VXC,ldvxc,K,ldk,EXC,ks_settings,exx_settings);
+
+}
+
 template class ReplicatedXCIntegratorImpl<double>;
 
 }
@@ -8,6 +8,9 @@
 #pragma once
 #include <gauxc/gauxc_config.hpp>
 #include "shell_batched_xc_integrator.hpp"
+#include "integrator_util/stream_local_work.hpp"
+#include <gauxc/basisset_map.hpp>
+#include <gauxc/util/timer.hpp>
 #ifdef GAUXC_HAS_DEVICE
 #include "device/xc_device_data.hpp"
 #endif
@@ -38,6 +41,7 @@ protected:
 
   using incore_integrator_type = IncoreIntegratorType;
   using incore_task_data = ShellBatchedXCIntegratorBase::incore_task_data;
+  using incore_task_batch = ShellBatchedXCIntegratorBase::incore_task_batch;
 
   // Density Integration 
   void integrate_den_( int64_t m, int64_t n, const value_type* P, int64_t ldp, value_type* N_EL ) override;
@@ -82,19 +86,58 @@ protected:
                       value_type* EXC, const IntegratorSettingsXC& ks_settings ) override;
 
 
+  /// RKS FXC Contraction
+  void eval_fxc_contraction_( int64_t m, int64_t n, const value_type* P, int64_t ldp,
+                              int64_t ntrial, const value_type* tP, int64_t ldtp,
+                              value_type* FXC, int64_t ldfxc,
+                              const IntegratorSettingsXC& ks_settings ) override;
+
+  /// UKS FXC Contraction
+  void eval_fxc_contraction_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps,
+                              const value_type* Pz, int64_t ldpz, int64_t ntrial,
+                              const value_type* tPs, int64_t ldtps,
+                              const value_type* tPz, int64_t ldtpz,
+                              value_type* FXCs, int64_t ldfxcs,
+                              value_type* FXCz, int64_t ldfxcz,
+                              const IntegratorSettingsXC& ks_settings ) override;
+
   /// RKS EXC Gradient
   void eval_exc_grad_( int64_t m, int64_t n, const value_type* P,
-                       int64_t ldp, value_type* EXC_GRAD ) override;
+                       int64_t ldp, value_type* EXC_GRAD, 
+                       const IntegratorSettingsXC& settings ) override;
+
+  /// UKS EXC Gradient
+  void eval_exc_grad_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps,
+                       const value_type* Pz, int64_t ldpz, value_type* EXC_GRAD, 
+                       const IntegratorSettingsXC& settings ) override;
+
+  /// GKS EXC Gradient
+  void eval_exc_grad_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps,
+                       const value_type* Pz, int64_t ldpz,
+                       const value_type* Py, int64_t ldpy,
+                       const value_type* Px, int64_t ldpx, value_type* EXC_GRAD, 
+                       const IntegratorSettingsXC& settings ) override;
 
   /// sn-LinK
   void eval_exx_( int64_t m, int64_t n, const value_type* P,
                   int64_t ldp, value_type* K, int64_t ldk,
                   const IntegratorSettingsEXX& settings ) override;
+  void eval_exx_( int64_t m, int64_t n, int64_t nmat, const value_type* P,
+                  int64_t ldp, value_type* K, int64_t ldk,
+                  const IntegratorSettingsEXX& settings ) override;
+
+  /// RKS EXC/VXC + sn-LinK
+  void eval_exc_vxc_exx_( int64_t m, int64_t n, const value_type* P,
+                          int64_t ldp, value_type* VXC, int64_t ldvxc,
+                          value_type* K, int64_t ldk, value_type* EXC,
+                          const IntegratorSettingsXC&  ks_settings,
+                          const IntegratorSettingsEXX& exx_settings ) override;
 
 
 
 
-  // Implementation details of exc_vxc (for RKS/UKS/GKS deduced from input character)
+  // Implementation details of exc_vxc (for RKS/UKS/GKS deduced from input character).
+  // If accumulate is set, VXC and EXC / N_EL are incremented rather than overwritten
   void exc_vxc_local_work_( const basis_type& basis, const value_type* Ps, int64_t ldps,
                             const value_type* Pz, int64_t ldpz,
                             const value_type* Py, int64_t ldpy,
@@ -104,11 +147,22 @@ protected:
                             value_type* VXCy, int64_t ldvxcy,
                             value_type* VXCx, int64_t ldvxcx,
                             value_type* EXC, value_type *N_EL,
-                            host_task_iterator task_begin, host_task_iterator task_end, incore_integrator_type& incore_integrator
-                             );
-
-
-  void execute_task_batch( incore_task_data& task, const basis_type& basis, const Molecule& mol, 
+                            const IntegratorSettingsXC& settings,
+                            host_task_iterator task_begin, host_task_iterator task_end, incore_integrator_type& incore_integrator,
+                            bool accumulate = false );
+
+
+  // Remap the batch to its sub-basis and extract the P submatrices (staging thread)
+  void stage_task_batch( incore_task_batch& batch, const basis_type& basis, 
+                         const BasisSetMap& basis_map,
+                         const value_type* Ps, int64_t ldps,
+                         const value_type* Pz, int64_t ldpz,
+                         const value_type* Py, int64_t ldpy,
+                         const value_type* Px, int64_t ldpx,
+                         bool has_vxc, util::Timer& timer );
+
+  // Integrate a staged batch and increment the full VXC
+  void execute_task_batch( incore_task_batch& batch, const basis_type& basis, 
                            const value_type* Ps, int64_t ldps,
                            const value_type* Pz, int64_t ldpz,
                            const value_type* Py, int64_t ldpy,
@@ -117,7 +171,9 @@ protected:
                            value_type* VXCz, int64_t ldvxcz,
                            value_type* VXCy, int64_t ldvxcy,
                            value_type* VXCx, int64_t ldvxcx,
-                           value_type* EXC, value_type* N_EL, incore_integrator_type& incore_integrator);
+                           value_type* EXC, value_type* N_EL, 
+                           const IntegratorSettingsKS& ks_settings,
+                           incore_integrator_type& incore_integrator);
 public:
 
   template <typename... Args>
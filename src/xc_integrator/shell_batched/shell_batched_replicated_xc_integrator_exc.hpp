@@ -55,9 +55,6 @@ void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType
   if( ldpx and ldpx < nbf )
     GAUXC_GENERIC_EXCEPTION("Invalid LDPY");
 
-  // Get Tasks
-  auto& tasks = this->load_balancer_->get_tasks();
-
   #ifdef GAUXC_HAS_DEVICE
   // Allocate Device memory
   auto* lwd = dynamic_cast<LocalDeviceWorkDriver*>(this->local_work_driver_.get() );
@@ -76,11 +73,16 @@ void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType
   // Temporary electron count to judge integrator accuracy
   value_type N_EL;
 
-  // Compute local contributions to EXC/VXC
+  // Compute local contributions to EXC (streamed over the tasks)
   this->timer_.time_op("XCIntegrator.LocalWork", [&](){
-    exc_vxc_local_work_( basis, Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx,
-      nullptr, 0, nullptr, 0, nullptr, 0, nullptr, 0, EXC, 
-      &N_EL, tasks.begin(), tasks.end(), incore_integrator );
+    stream_local_work( *this->load_balancer_, 
+      [&]( host_task_iterator task_begin, host_task_iterator task_end, 
+        bool accumulate ) {
+      exc_vxc_local_work_( basis, Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx,
+        nullptr, 0, nullptr, 0, nullptr, 0, nullptr, 0, EXC, 
+        &N_EL, ks_settings, task_begin, task_end, incore_integrator, 
+        accumulate );
+    });
   });
 
   // Release ownership of LWD back to this integrator instance
@@ -92,8 +94,9 @@ void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType
     if( not this->reduction_driver_->takes_host_memory() )
       GAUXC_GENERIC_EXCEPTION("This Module Only Works With Host Reductions");
 
-    this->reduction_driver_->allreduce_inplace( EXC,   1    , ReductionOp::Sum );
-    this->reduction_driver_->allreduce_inplace( &N_EL, 1    , ReductionOp::Sum );
+    this->reduction_driver_->template allreduce_packed<value_type>( 
+      { ReductionBuffer::scalar(EXC), ReductionBuffer::scalar(&N_EL) },
+      ReductionOp::Sum );
   });
 
   #ifdef GAUXC_HAS_DEVICE
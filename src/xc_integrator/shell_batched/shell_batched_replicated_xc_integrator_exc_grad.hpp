@@ -16,10 +16,33 @@ namespace detail {
 template <typename BaseIntegratorType, typename IncoreIntegratorType>
 void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType>::
   eval_exc_grad_( int64_t m, int64_t n, const value_type* P,
-                 int64_t ldp, value_type* EXC_GRAD ) { 
+                 int64_t ldp, value_type* EXC_GRAD, 
+                 const IntegratorSettingsXC& settings ) { 
                  
   GAUXC_GENERIC_EXCEPTION("ShellBatched exc_grad NYI" );                 
-  util::unused(m,n,P,ldp,EXC_GRAD);
+  util::unused(m,n,P,ldp,EXC_GRAD,settings);
+}
+
+template <typename BaseIntegratorType, typename IncoreIntegratorType>
+void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType>::
+  eval_exc_grad_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps,
+                 const value_type* Pz, int64_t ldpz, value_type* EXC_GRAD, 
+                 const IntegratorSettingsXC& settings ) { 
+                 
+  GAUXC_GENERIC_EXCEPTION("ShellBatched exc_grad NYI" );                 
+  util::unused(m,n,Ps,ldps,Pz,ldpz,EXC_GRAD,settings);
+}
+
+template <typename BaseIntegratorType, typename IncoreIntegratorType>
+void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType>::
+  eval_exc_grad_( int64_t m, int64_t n, const value_type* Ps, int64_t ldps,
+                 const value_type* Pz, int64_t ldpz, 
+                 const value_type* Py, int64_t ldpy, 
+                 const value_type* Px, int64_t ldpx, value_type* EXC_GRAD, 
+                 const IntegratorSettingsXC& settings ) { 
+                 
+  GAUXC_GENERIC_EXCEPTION("ShellBatched exc_grad NYI" );                 
+  util::unused(m,n,Ps,ldps,Pz,ldpz,Py,ldpy,Px,ldpx,EXC_GRAD,settings);
 }
 
 }
@@ -12,15 +12,14 @@
 #include "device/xc_device_aos_data.hpp"
 #endif
 #include "integrator_util/integrator_common.hpp"
+#include "integrator_util/point_group_symmetrizer.hpp"
+#include "integrator_util/host_buffer_placement.hpp"
 #include "host/util.hpp"
 #include <gauxc/util/misc.hpp>
 #include <gauxc/util/unused.hpp>
 
 #include <stdexcept>
 #include <fstream>
-#include <queue>
-#include <mutex>
-#include <future>
 #include <set>
 
 namespace GauXC  {
@@ -68,9 +67,12 @@ void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType
   if( ldvxcx and ldvxcx < nbf )
     GAUXC_GENERIC_EXCEPTION("Invalid LDVXCY");
 
+  // Symmetrizing over the point group is only exact for totally symmetric
+  // densities, which GKS (spin) densities are not in general
+  const auto& point_group = this->load_balancer_->state().point_group;
+  if( Py and Px and not point_group.is_trivial() )
+    GAUXC_GENERIC_EXCEPTION("GKS Does Not Support Point Group Symmetry");
 
-  // Get Tasks
-  auto& tasks = this->load_balancer_->get_tasks();
 
   #ifdef GAUXC_HAS_DEVICE
   // Allocate Device memory
@@ -90,11 +92,16 @@ void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType
   // Temporary electron count to judge integrator accuracy
   value_type N_EL;
 
-  // Compute local contributions to EXC/VXC
+  // Compute local contributions to EXC/VXC (streamed over the tasks)
   this->timer_.time_op("XCIntegrator.LocalWork", [&](){
-    exc_vxc_local_work_( basis, Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx,
-      VXCs, ldvxcs, VXCz, ldvxcz, VXCy, ldvxcy, VXCx, ldvxcx, EXC, 
-      &N_EL, tasks.begin(), tasks.end(), incore_integrator );
+    stream_local_work( *this->load_balancer_, 
+      [&]( host_task_iterator task_begin, host_task_iterator task_end, 
+        bool accumulate ) {
+      exc_vxc_local_work_( basis, Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx,
+        VXCs, ldvxcs, VXCz, ldvxcz, VXCy, ldvxcy, VXCx, ldvxcx, EXC, 
+        &N_EL, ks_settings, task_begin, task_end, incore_integrator, 
+        accumulate );
+    });
   });
 
   // Release ownership of LWD back to this integrator instance
@@ -106,12 +113,26 @@ void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType
     if( not this->reduction_driver_->takes_host_memory() )
       GAUXC_GENERIC_EXCEPTION("This Module Only Works With Host Reductions");
 
-    this->reduction_driver_->allreduce_inplace( VXCs, nbf*nbf, ReductionOp::Sum );
-    if(VXCz) this->reduction_driver_->allreduce_inplace( VXCz, nbf*nbf, ReductionOp::Sum );
-    if(VXCy) this->reduction_driver_->allreduce_inplace( VXCy, nbf*nbf, ReductionOp::Sum ); 
-    if(VXCx) this->reduction_driver_->allreduce_inplace( VXCx, nbf*nbf, ReductionOp::Sum );
-    this->reduction_driver_->allreduce_inplace( EXC,   1    , ReductionOp::Sum );
-    this->reduction_driver_->allreduce_inplace( &N_EL, 1    , ReductionOp::Sum );
+    std::vector<ReductionBuffer> red_buffers = {
+      ReductionBuffer::symmetric_matrix( VXCs, nbf, ldvxcs ),
+      ReductionBuffer::scalar( EXC ),
+      ReductionBuffer::scalar( &N_EL )
+    };
+    if(VXCz) red_buffers.push_back(ReductionBuffer::symmetric_matrix(VXCz, nbf, ldvxcz));
+    if(VXCy) red_buffers.push_back(ReductionBuffer::symmetric_matrix(VXCy, nbf, ldvxcy));
+    if(VXCx) red_buffers.push_back(ReductionBuffer::symmetric_matrix(VXCx, nbf, ldvxcx));
+
+    this->reduction_driver_->template allreduce_packed<value_type>( 
+      red_buffers, ReductionOp::Sum );
+  });
+
+  // Symmetrize over the point group exploited by the load balancer
+  if( not point_group.is_trivial() )
+  this->timer_.time_op("XCIntegrator.Symmetrize", [&](){
+    PointGroupSymmetrizer sym( point_group, this->load_balancer_->molecule(), 
+      basis );
+    sym.symmetrize_matrix( VXCs, ldvxcs );
+    if(VXCz) sym.symmetrize_matrix( VXCz, ldvxcz );
   });
 
   #ifdef GAUXC_HAS_DEVICE
@@ -161,156 +182,98 @@ void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType
                        value_type* VXCy, int64_t ldvxcy,
                        value_type* VXCx, int64_t ldvxcx,
                        value_type* EXC, value_type *N_EL, 
+                       const IntegratorSettingsXC& settings,
                        host_task_iterator task_begin, host_task_iterator task_end,
-                       incore_integrator_type& incore_integrator ) {
+                       incore_integrator_type& incore_integrator, 
+                       bool accumulate ) {
+
+  // Misc KS settings
+  IntegratorSettingsKS ks_settings;
+  if( auto* tmp = dynamic_cast<const IntegratorSettingsKS*>(&settings) ) {
+    ks_settings = *tmp;
+  }
+
+  const auto nbf = basis.nbf();
 
-  //incore_integrator.exc_vxc_local_work( basis, P, ldp, VXC, ldvxc, EXC, N_EL, task_begin, task_end, device_data );
-  //return;
+  // Shared by the staging thread, obtain before it is launched
+  const auto& basis_map = this->load_balancer_->basis_map();
 
+  // Size the batches s.t. the P / VXC submatrices of the batch being
+  // integrated and of the prefetched batch fit in the memory budget
+  const bool   has_vxc = VXCs or VXCz or VXCy or VXCx;
+  const size_t nmat    = (Ps ? 1 : 0) + (Pz ? 1 : 0) + (Py ? 1 : 0) + 
+    (Px ? 1 : 0) + (VXCs ? 1 : 0) + (VXCz ? 1 : 0) + (VXCy ? 1 : 0) + 
+    (VXCx ? 1 : 0);
+  const uint32_t nbf_threshold = batch_nbf_threshold( 
+    ks_settings.host_memory_budget, nmat, 
+    this->load_balancer_->runtime().node_size() );
 
-  const auto     nbf = basis.nbf();
-  const uint32_t nbf_threshold = 8000;
-  const auto&    mol = this->load_balancer_->molecule();
   // Zero out integrands on host
+  if( not accumulate )
   this->timer_.time_op("XCIntegrator.ZeroHost", [&](){
     *EXC  = 0.;
     *N_EL = 0.;
-    if(VXCs)
-    for( auto j = 0; j < nbf; ++j )
-    for( auto i = 0; i < nbf; ++i ) {
-      VXCs[i + j*ldvxcs] = 0.;
-    }
-    if(VXCz)
-    for( auto j = 0; j < nbf; ++j )
-    for( auto i = 0; i < nbf; ++i ) {
-      VXCz[i + j*ldvxcz] = 0.;
-    }
-    if(VXCy)
-    for( auto j = 0; j < nbf; ++j )
-    for( auto i = 0; i < nbf; ++i ) {
-      VXCy[i + j*ldvxcy] = 0.;
-    }
-    if(VXCx)
-    for( auto j = 0; j < nbf; ++j )
-    for( auto i = 0; i < nbf; ++i ) {
-      VXCx[i + j*ldvxcx] = 0.;
-    }
+    const auto placement = 
+      this->load_balancer_->runtime().host_placement_policy().placement;
+    zero_host_matrix( placement, nbf, nbf, VXCs, ldvxcs );
+    zero_host_matrix( placement, nbf, nbf, VXCz, ldvxcz );
+    zero_host_matrix( placement, nbf, nbf, VXCy, ldvxcy );
+    zero_host_matrix( placement, nbf, nbf, VXCx, ldvxcx );
   });
 
+  // Timer is not thread safe, staging timings are merged after completion
+  util::Timer stage_timer;
 
-  // Task queue
-  std::queue< incore_task_data > incore_task_data_queue;
-
-  // Task queue modification mutex
-  std::mutex queue_mod_ex;
-
-  // Lambda for the execution of incore tasks on the device
-  auto execute_incore_task = [&]() {
+  pipeline_task_batches( nbf_threshold, basis, task_begin, task_end,
+    [&]( incore_task_batch& batch ) {
+      stage_task_batch( batch, basis, basis_map, Ps, ldps, Pz, ldpz, 
+        Py, ldpy, Px, ldpx, has_vxc, stage_timer );
+    },
+    [&]( incore_task_batch& batch ) {
+      execute_task_batch( batch, basis, Ps, ldps, Pz, ldpz, Py, ldpy, 
+        Px, ldpx, VXCs, ldvxcs, VXCz, ldvxcz, VXCy, ldvxcy, VXCx, ldvxcx, 
+        EXC, N_EL, ks_settings, incore_integrator );
+    } );
 
-    // Early return if there is no task to execute
-    if( incore_task_data_queue.empty() ) return;
+  for( const auto& [name, dur] : stage_timer.all_timings() )
+    this->timer_.add_or_accumulate_timing( name, dur );
 
-    incore_task_data next_task;
-    {
-      std::lock_guard<std::mutex> lock(queue_mod_ex);
-
-      // Move the next task into local scope and remove
-      // from queue
-      next_task = std::move( incore_task_data_queue.front() );
-      incore_task_data_queue.pop();
-    }
-
-    // Execute task
-    execute_task_batch( next_task, basis, mol, Ps, ldps, Pz, ldpz,
-      Py, ldpy, Px, ldpx, VXCs, ldvxcs, VXCz, ldvxcz, VXCy, ldvxcy,
-      VXCx, ldvxcx, EXC, N_EL, incore_integrator );
-  };
-
-
-  // Setup future to track execution of currently running
-  // device task
-  std::future<void> task_future;
-
-  auto task_it = task_begin;
-  while( task_it != task_end ) {
-
-    // Generate and enqueue task
-    incore_task_data_queue.emplace(
-      generate_incore_task( nbf_threshold, basis, task_it, task_end )
-    );
-
-    // Update iterator for next task generation
-    task_it = incore_task_data_queue.back().task_end;
-
-    if( not task_future.valid() ) {
-      // No device task to wait on
-      task_future = std::async( std::launch::async, execute_incore_task );
-    } else {
-      // Check the status of current device task
-      auto status = task_future.wait_for( std::chrono::milliseconds(5) );
-      if( status == std::future_status::ready ) {
-        // If the status is ready - execute the next task in queue
-        task_future.get();
-        task_future = std::async( std::launch::async, execute_incore_task ); 
-      }
-    }
-
-  } // Loop until all tasks have been enqued 
-
-  // TODO: Try to merge remaining tasks appropriately
-
-  // Execute remaining tasks sequentially
-  if( task_future.valid() ) {
-    task_future.wait();
-    task_future.get(); // Propagate trailing exceptions if present
-  }
-  while( not incore_task_data_queue.empty() ) {
-    execute_incore_task();
-  }
 }
 
 
 
 template <typename BaseIntegratorType, typename IncoreIntegratorType>
 void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType>::
-  execute_task_batch( incore_task_data& task, const basis_type& basis, const Molecule& mol, 
-                      const value_type* Ps, int64_t ldps,
-                      const value_type* Pz, int64_t ldpz,
-                      const value_type* Py, int64_t ldpy,
-                      const value_type* Px, int64_t ldpx,
-                      value_type* VXCs, int64_t ldvxcs,
-                      value_type* VXCz, int64_t ldvxcz,
-                      value_type* VXCy, int64_t ldvxcy,
-                      value_type* VXCx, int64_t ldvxcx,
-                      value_type* EXC, value_type *N_EL, 
-                      incore_integrator_type& incore_integrator ) {
+  stage_task_batch( incore_task_batch& batch, const basis_type& basis,
+                    const BasisSetMap& basis_map,
+                    const value_type* Ps, int64_t ldps,
+                    const value_type* Pz, int64_t ldpz,
+                    const value_type* Py, int64_t ldpy,
+                    const value_type* Px, int64_t ldpx,
+                    bool has_vxc, util::Timer& timer ) {
 
+  // A single batch is integrated directly over the full basis / matrices
+  if( batch.single_batch ) return;
 
   // Alias information
-  auto task_begin  = task.task_begin;
-  auto task_end    = task.task_end;
-  auto& union_shell_list = task.shell_list;
-
-
-  // Extract subbasis
-  BasisSet<double> basis_subset; basis_subset.reserve(union_shell_list.size());
-  this->timer_.time_op_accumulate("XCIntegrator.CopySubBasis",[&]() {
+  auto task_begin  = batch.task.task_begin;
+  auto task_end    = batch.task.task_end;
+  const auto& union_shell_list = batch.task.shell_list;
+
+  // Extract subbasis (reuses the shell storage of the slot)
+  auto& basis_subset = batch.basis_subset;
+  timer.time_op_accumulate("XCIntegrator.CopySubBasis",[&]() {
+    basis_subset.clear();
+    basis_subset.reserve(union_shell_list.size());
     for( auto i : union_shell_list ) {
       basis_subset.emplace_back( basis.at(i) );
     }
   });
 
-  // Setup basis maps
-  BasisSetMap basis_map( basis, mol );
-
-  //const size_t nshells = basis_subset.nshells();
-  const size_t nbe     = basis_subset.nbf();
-  //std::cout << "TASK_UNION HAS:"   << std::endl
-  //          << "  NSHELLS    = " <<  nshells << std::endl
-  //          << "  NBE        = " <<  nbe     << std::endl;
+  const size_t nbe = basis_subset.nbf();
 
   // Recalculate shell_list based on subbasis
-  this->timer_.time_op_accumulate("XCIntegrator.RecalcShellList",[&]() {
+  timer.time_op_accumulate("XCIntegrator.RecalcShellList",[&]() {
     for( auto _it = task_begin; _it != task_end; ++_it ) {
       auto union_list_idx = 0;
       auto& cur_shell_list = _it->bfn_screening.shell_list;
@@ -319,75 +282,90 @@ void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType
           union_list_idx++;
         cur_shell_list[j] = union_list_idx;
       }
+      // Cached submatrix maps refer to the full basis
+      _it->bfn_screening.submat_map.clear();
+      _it->bfn_screening.submat_block.clear();
     }
   } );
 
+  // Extract subdensity
+  std::tie(batch.submat_cut, std::ignore) = 
+    gen_compressed_submat_map( basis_map, union_shell_list, 
+      basis.nbf(), basis.nbf() );
 
-  // Allocate host temporaries
-  double EXC_tmp, NEL_tmp;
-  std::vector<double> Ps_submat_host(nbe*nbe); 
-  double* Ps_submat   = Ps_submat_host.data();
-  std::vector<double> VXCs_submat_host(VXCs ? nbe*nbe : 0); 
-  double* VXCs_submat = VXCs ? VXCs_submat_host.data() : nullptr;
-
-  std::vector<double> Pz_submat_host, Py_submat_host, Px_submat_host;
-  std::vector<double> VXCz_submat_host, VXCy_submat_host, VXCx_submat_host;
-  double *Pz_submat = nullptr, *Py_submat = nullptr, *Px_submat = nullptr;
-  double *VXCz_submat = nullptr, *VXCy_submat = nullptr , *VXCx_submat = nullptr;
-
-  if(Pz) {
-    Pz_submat_host.resize(nbe*nbe);
-    Pz_submat = Pz_submat_host.data();
-    if(VXCz) {
-      VXCz_submat_host.resize(nbe*nbe, 0.0);
-      VXCz_submat = VXCz_submat_host.data();
-    }
+  // Resize the slot buffers, allocation is retained across batches. VXC
+  // submatrices are overwritten by the incore integrator
+  const std::array<const value_type*,4> P   = { Ps, Pz, Py, Px };
+  const std::array<int64_t,4>           ldp = { ldps, ldpz, ldpy, ldpx };
+  for( int i = 0; i < 4; ++i ) {
+    batch.P_submat[i]  .resize( P[i] ? nbe*nbe : 0 );
+    batch.VXC_submat[i].resize( P[i] and has_vxc ? nbe*nbe : 0 );
   }
 
-  if(Py) {
-    Py_submat_host.resize(nbe*nbe);
-    Py_submat = Py_submat_host.data();
-    if(VXCy) {
-      VXCy_submat_host.resize(nbe*nbe, 0.0);
-      VXCy_submat = VXCy_submat_host.data();
-    }
-  }
+  timer.time_op_accumulate("XCIntegrator.ExtractSubDensity",[&]() {
+    for( int i = 0; i < 4; ++i ) 
+    if( P[i] )
+      detail::submat_set( basis.nbf(), basis.nbf(), nbe, nbe, P[i], ldp[i], 
+                          batch.P_submat[i].data(), nbe, batch.submat_cut );
+  } );
 
-  if(Px) {
-    Px_submat_host.resize(nbe*nbe);
-    Px_submat = Px_submat_host.data();
-    if(VXCx) {
-      VXCx_submat_host.resize(nbe*nbe, 0.0);
-      VXCx_submat = VXCx_submat_host.data();
-    }
-  }
+}
 
 
-  // Extract subdensity
-  std::vector<std::array<int32_t,3>> union_submat_cut;
-  std::vector<int32_t> foo;
-  std::tie(union_submat_cut,foo) = 
-    gen_compressed_submat_map( basis_map, union_shell_list, 
-      basis.nbf(), basis.nbf() );
 
-  this->timer_.time_op_accumulate("XCIntegrator.ExtractSubDensity",[&]() {
-    detail::submat_set( basis.nbf(), basis.nbf(), nbe, nbe, Ps, ldps, 
-                        Ps_submat, nbe, union_submat_cut );
-    if(Pz)
-    detail::submat_set( basis.nbf(), basis.nbf(), nbe, nbe, Pz, ldpz, 
-                        Pz_submat, nbe, union_submat_cut );
+template <typename BaseIntegratorType, typename IncoreIntegratorType>
+void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType>::
+  execute_task_batch( incore_task_batch& batch, const basis_type& basis,
+                      const value_type* Ps, int64_t ldps,
+                      const value_type* Pz, int64_t ldpz,
+                      const value_type* Py, int64_t ldpy,
+                      const value_type* Px, int64_t ldpx,
+                      value_type* VXCs, int64_t ldvxcs,
+                      value_type* VXCz, int64_t ldvxcz,
+                      value_type* VXCy, int64_t ldvxcy,
+                      value_type* VXCx, int64_t ldvxcx,
+                      value_type* EXC, value_type *N_EL, 
+                      const IntegratorSettingsKS& ks_settings,
+                      incore_integrator_type& incore_integrator ) {
+
+  // Alias information
+  auto task_begin  = batch.task.task_begin;
+  auto task_end    = batch.task.task_end;
+  const auto& union_shell_list = batch.task.shell_list;
 
-    if(Py)
-    detail::submat_set( basis.nbf(), basis.nbf(), nbe, nbe, Py, ldpy, 
-                        Py_submat, nbe, union_submat_cut );
+  // Single batch: integrate the full matrices in place
+  if( batch.single_batch ) {
+#ifdef GAUXC_HAS_DEVICE
+    if constexpr (IncoreIntegratorType::is_device) {
+      incore_integrator.exc_vxc_local_work( basis, Ps, ldps, Pz, ldpz, 
+        Py, ldpy, Px, ldpx, VXCs, ldvxcs, VXCz, ldvxcz, VXCy, ldvxcy, 
+        VXCx, ldvxcx, EXC, N_EL, task_begin, task_end, *device_data_ptr_ );
+    } else if constexpr (not IncoreIntegratorType::is_device) {
+#endif
+      incore_integrator.exc_vxc_local_work( basis, Ps, ldps, Pz, ldpz, 
+        Py, ldpy, Px, ldpx, VXCs, ldvxcs, VXCz, ldvxcz, VXCy, ldvxcy, 
+        VXCx, ldvxcx, EXC, N_EL, ks_settings, task_begin, task_end );
+#ifdef GAUXC_HAS_DEVICE
+    }
+#endif
+    return;
+  }
 
-    if(Px)
-    detail::submat_set( basis.nbf(), basis.nbf(), nbe, nbe, Px, ldpx, 
-                        Px_submat, nbe, union_submat_cut );
-  } );
+  const auto& basis_subset = batch.basis_subset;
+  const size_t nbe = basis_subset.nbf();
 
+  auto submat_ptr = []( auto& v ) { return v.size() ? v.data() : nullptr; };
+  const double* Ps_submat = submat_ptr( batch.P_submat[0] );
+  const double* Pz_submat = submat_ptr( batch.P_submat[1] );
+  const double* Py_submat = submat_ptr( batch.P_submat[2] );
+  const double* Px_submat = submat_ptr( batch.P_submat[3] );
+  double* VXCs_submat = VXCs ? submat_ptr( batch.VXC_submat[0] ) : nullptr;
+  double* VXCz_submat = VXCz ? submat_ptr( batch.VXC_submat[1] ) : nullptr;
+  double* VXCy_submat = VXCy ? submat_ptr( batch.VXC_submat[2] ) : nullptr;
+  double* VXCx_submat = VXCx ? submat_ptr( batch.VXC_submat[3] ) : nullptr;
 
   // Process selected task batch
+  double EXC_tmp, NEL_tmp;
 #ifdef GAUXC_HAS_DEVICE
   if constexpr (IncoreIntegratorType::is_device) {
 
@@ -400,7 +378,7 @@ void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType
     incore_integrator.exc_vxc_local_work( basis_subset, Ps_submat, nbe, 
       Pz_submat, nbe, Py_submat, nbe, Px_submat, nbe, VXCs_submat, nbe,
       VXCz_submat, nbe, VXCy_submat, nbe, VXCx_submat, nbe,
-      &EXC_tmp, &NEL_tmp, IntegratorSettingsKS{}, task_begin, task_end );
+      &EXC_tmp, &NEL_tmp, ks_settings, task_begin, task_end );
 #ifdef GAUXC_HAS_DEVICE
   }
 #endif
@@ -409,6 +387,7 @@ void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType
   // Update full quantities
   *EXC += EXC_tmp;
   *N_EL += NEL_tmp;
+  const auto& union_submat_cut = batch.submat_cut;
   this->timer_.time_op_accumulate("XCIntegrator.IncrementSubPotential",[&]() {
     if(VXCs)
     detail::inc_by_submat( basis.nbf(), basis.nbf(), nbe, nbe, VXCs, ldvxcs, 
@@ -430,9 +409,13 @@ void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType
 
   // Reset shell_list to be wrt full basis
   this->timer_.time_op_accumulate("XCIntegrator.ResetShellList",[&]() {
-    for( auto _it = task_begin; _it != task_end; ++_it ) 
-    for( auto j = 0ul; j < _it->bfn_screening.shell_list.size();  ++j  ) {
-      _it->bfn_screening.shell_list[j] = union_shell_list[_it->bfn_screening.shell_list[j]];
+    for( auto _it = task_begin; _it != task_end; ++_it ) {
+      for( auto j = 0ul; j < _it->bfn_screening.shell_list.size();  ++j  ) {
+        _it->bfn_screening.shell_list[j] = union_shell_list[_it->bfn_screening.shell_list[j]];
+      }
+      // Drop the sub-basis submatrix maps
+      _it->bfn_screening.submat_map.clear();
+      _it->bfn_screening.submat_block.clear();
     }
   });
 
@@ -440,4 +423,3 @@ void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType
 
 }
 }
-
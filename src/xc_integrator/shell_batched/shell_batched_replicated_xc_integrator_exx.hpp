@@ -22,5 +22,25 @@ void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType
   util::unused(m,n,P,ldp,K,ldk,settings);
 }
 
+template <typename BaseIntegratorType, typename IncoreIntegratorType>
+void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType>::
+  eval_exx_( int64_t m, int64_t n, int64_t nmat, const value_type* P,
+             int64_t ldp, value_type* K, int64_t ldk, 
+             const IntegratorSettingsEXX& settings ) { 
+  GAUXC_GENERIC_EXCEPTION("ShellBatched EXX NYI");                 
+  util::unused(m,n,nmat,P,ldp,K,ldk,settings);
+}
+
+template <typename BaseIntegratorType, typename IncoreIntegratorType>
+void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType>::
+  eval_exc_vxc_exx_( int64_t m, int64_t n, const value_type* P,
+                     int64_t ldp, value_type* VXC, int64_t ldvxc,
+                     value_type* K, int64_t ldk, value_type* EXC,
+                     const IntegratorSettingsXC&  ks_settings,
+                     const IntegratorSettingsEXX& exx_settings ) { 
+  GAUXC_GENERIC_EXCEPTION("ShellBatched EXC/VXC + EXX NYI");                 
+  util::unused(m,n,P,ldp,VXC,ldvxc,K,ldk,EXC,ks_settings,exx_settings);
+}
+
 }
 }
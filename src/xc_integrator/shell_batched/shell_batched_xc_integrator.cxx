@@ -11,14 +11,57 @@
 #include <map>
 #include <algorithm>
 #include <numeric>
+#include <cmath>
+#include <limits>
+#include <unistd.h>
 #include <gauxc/util/misc.hpp>
 
 namespace GauXC::detail {
 
+void ShellBatchedXCIntegratorBase::remaining_shell_union::add( 
+  const basis_type& basis, host_task_iterator task_begin, 
+  host_task_iterator task_end ) {
+
+  task_count.resize( basis.nshells(), 0 );
+  for( auto it = task_begin; it != task_end; ++it )
+  for( auto sh : it->bfn_screening.shell_list ) 
+    if( not task_count[sh]++ ) nbf += basis.at(sh).size();
+
+}
+
+void ShellBatchedXCIntegratorBase::remaining_shell_union::remove( 
+  const basis_type& basis, host_task_iterator task_begin, 
+  host_task_iterator task_end ) {
+
+  for( auto it = task_begin; it != task_end; ++it )
+  for( auto sh : it->bfn_screening.shell_list ) 
+    if( not --task_count[sh] ) nbf -= basis.at(sh).size();
+
+}
+
+std::vector<int32_t> 
+  ShellBatchedXCIntegratorBase::remaining_shell_union::shell_list() const {
+
+  std::vector<int32_t> list;
+  for( size_t i = 0; i < task_count.size(); ++i )
+    if( task_count[i] ) list.emplace_back(i);
+  return list;
+
+}
+
 ShellBatchedXCIntegratorBase::incore_task_data
   ShellBatchedXCIntegratorBase::generate_incore_task( uint32_t nbf_threshold,
     const basis_type& basis, host_task_iterator task_begin,
-    host_task_iterator task_end ) {
+    host_task_iterator task_end, const remaining_shell_union& remaining ) {
+
+  // Take all remaining tasks if their union fits within the threshold
+  if( remaining.nbf < nbf_threshold ) {
+    incore_task_data ex_task;
+    ex_task.task_begin = task_begin;
+    ex_task.task_end   = task_end;
+    ex_task.shell_list = remaining.shell_list();
+    return ex_task;
+  }
 
   // Find task with largest NBE
   auto nbe_comparator = []( const auto& task_a, const auto& task_b ) {
@@ -149,4 +192,27 @@ ShellBatchedXCIntegratorBase::incore_task_data
   return ex_task;
 }
 
+uint32_t ShellBatchedXCIntegratorBase::batch_nbf_threshold( size_t budget,
+  size_t nmat, int node_size ) {
+
+  if( not budget ) {
+#if defined(_SC_AVPHYS_PAGES) && defined(_SC_PAGESIZE)
+    const long npages = sysconf( _SC_AVPHYS_PAGES );
+    const long page   = sysconf( _SC_PAGESIZE );
+    if( npages > 0 and page > 0 ) 
+      budget = size_t(npages) * size_t(page) / 2 / std::max(node_size, 1);
+#endif
+    // Fixed threshold if the available memory can not be queried
+    if( not budget ) return 8000;
+  }
+
+  // Two staged batches (integrated + prefetched) of nmat NBE x NBE matrices.
+  // A single task exceeding the threshold still forms its own batch
+  const double nbe = std::sqrt( double(budget) / 
+    (2. * std::max<size_t>(nmat, 1) * sizeof(double)) );
+  return uint32_t( std::min( std::max( nbe, 1. ), 
+    double(std::numeric_limits<uint32_t>::max()) ) );
+
+}
+
 }
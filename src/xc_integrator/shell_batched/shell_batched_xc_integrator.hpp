@@ -9,6 +9,13 @@
 #include <gauxc/basisset.hpp>
 #include <gauxc/xc_task.hpp>
 
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 namespace GauXC {
 namespace detail {
 
@@ -26,13 +33,156 @@ struct ShellBatchedXCIntegratorBase {
     std::vector<int32_t> shell_list;
   };
 
+  // Host staging buffers of a task batch (sub-basis, submatrix map and the
+  // P / VXC submatrices ordered S,Z,Y,X). Reused across batches and calls
+  struct incore_task_batch {
+    incore_task_data task;
+    bool single_batch = false; ///< Batch spans all tasks, no sub-basis is staged
+
+    basis_type                         basis_subset;
+    std::vector<std::array<int32_t,3>> submat_cut;
+    std::array<std::vector<double>,4>  P_submat;
+    std::array<std::vector<double>,4>  VXC_submat;
+  };
+
+  // Union of the shell lists of the tasks which remain to be batched. Tasks
+  // are added / removed once, s.t. tracking the union over all batches is
+  // linear in the total length of the shell lists
+  struct remaining_shell_union {
+    std::vector<int32_t> task_count; ///< Number of remaining tasks per shell
+    int64_t              nbf = 0;    ///< Number of basis functions in the union
+
+    void add( const basis_type& basis, host_task_iterator task_begin,
+      host_task_iterator task_end );
+    void remove( const basis_type& basis, host_task_iterator task_begin,
+      host_task_iterator task_end );
+    std::vector<int32_t> shell_list() const;
+  };
+
   incore_task_data generate_incore_task( 
     uint32_t nbf_threshold, const basis_type& basis,
-    host_task_iterator task_begin, host_task_iterator task_end );
+    host_task_iterator task_begin, host_task_iterator task_end,
+    const remaining_shell_union& remaining );
+
+  /// Largest batch NBE s.t. two staged batches of nmat NBE x NBE submatrices
+  /// fit in budget bytes. If budget = 0, half of the available physical 
+  /// memory is shared evenly by the node_size ranks on the node
+  static uint32_t batch_nbf_threshold( size_t budget, size_t nmat, 
+    int node_size );
+
+  /// Partition [task_begin,task_end) into batches and integrate them. A
+  /// persistent staging thread generates / stages (stage_op) the next batch
+  /// while the calling thread integrates (execute_op) the current one
+  template <typename StageOp, typename ExecuteOp>
+  void pipeline_task_batches( uint32_t nbf_threshold, const basis_type& basis,
+    host_task_iterator task_begin, host_task_iterator task_end,
+    const StageOp& stage_op, const ExecuteOp& execute_op );
 
   virtual ~ShellBatchedXCIntegratorBase() noexcept = default;
 
+protected:
+
+  std::array<incore_task_batch,2> task_batches_; ///< Staging slots
+
 };
 
+template <typename StageOp, typename ExecuteOp>
+void ShellBatchedXCIntegratorBase::pipeline_task_batches( uint32_t nbf_threshold,
+  const basis_type& basis, host_task_iterator task_begin, 
+  host_task_iterator task_end, const StageOp& stage_op, 
+  const ExecuteOp& execute_op ) {
+
+  std::mutex              slot_mutex;
+  std::condition_variable slot_cv;
+  std::deque<incore_task_batch*> free_slots, staged_slots;
+  for( auto& batch : task_batches_ ) free_slots.push_back( &batch );
+
+  bool staging_done = false, abort_staging = false;
+  std::exception_ptr staging_exception;
+
+  // Task batches are disjoint ranges of the task container, the staging
+  // thread only partitions / remaps tasks past the batch being integrated
+  std::thread stager( [&]() {
+    try {
+      remaining_shell_union remaining;
+      remaining.add( basis, task_begin, task_end );
+
+      auto task_it = task_begin;
+      while( task_it != task_end ) {
+
+        incore_task_batch* batch = nullptr;
+        {
+          std::unique_lock<std::mutex> lock(slot_mutex);
+          slot_cv.wait( lock, [&](){ 
+            return abort_staging or not free_slots.empty(); 
+          });
+          if( abort_staging ) break;
+          batch = free_slots.front(); free_slots.pop_front();
+        }
+
+        batch->task = generate_incore_task( nbf_threshold, basis, task_it, 
+          task_end, remaining );
+        remaining.remove( basis, batch->task.task_begin, batch->task.task_end );
+        task_it = batch->task.task_end;
+        batch->single_batch = batch->task.task_begin == task_begin and 
+                              batch->task.task_end   == task_end;
+        stage_op( *batch );
+
+        {
+          std::lock_guard<std::mutex> lock(slot_mutex);
+          staged_slots.push_back( batch );
+        }
+        slot_cv.notify_all();
+
+      }
+    } catch(...) {
+      std::lock_guard<std::mutex> lock(slot_mutex);
+      staging_exception = std::current_exception();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(slot_mutex);
+      staging_done = true;
+    }
+    slot_cv.notify_all();
+  });
+
+  try {
+    while( true ) {
+
+      incore_task_batch* batch = nullptr;
+      {
+        std::unique_lock<std::mutex> lock(slot_mutex);
+        slot_cv.wait( lock, [&](){ 
+          return staging_done or not staged_slots.empty(); 
+        });
+        if( staged_slots.empty() ) break;
+        batch = staged_slots.front(); staged_slots.pop_front();
+      }
+
+      execute_op( *batch );
+
+      {
+        std::lock_guard<std::mutex> lock(slot_mutex);
+        free_slots.push_back( batch );
+      }
+      slot_cv.notify_all();
+
+    }
+  } catch(...) {
+    {
+      std::lock_guard<std::mutex> lock(slot_mutex);
+      abort_staging = true;
+    }
+    slot_cv.notify_all();
+    stager.join();
+    throw;
+  }
+
+  stager.join();
+  if( staging_exception ) std::rethrow_exception( staging_exception );
+
+}
+
 }
 }
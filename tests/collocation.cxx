@@ -53,6 +53,18 @@ TEST_CASE( "Water / cc-pVDZ", "[collocation]" ) {
   SECTION( "Host Eval Hessian" ) {
     test_host_collocation_deriv2( basis, ref_data );
   }
+
+  SECTION( "Host Eval Laplacian" ) {
+    test_host_collocation_laplacian( basis, ref_data );
+  }
+
+  SECTION( "Host Eval Screened" ) {
+    test_host_collocation_screened( basis, ref_data );
+  }
+
+  SECTION( "Host Native Eval" ) {
+    test_host_native_collocation( basis, ref_data );
+  }
 #endif
 
 #ifdef GAUXC_HAS_CUDA
@@ -92,3 +104,9 @@ TEST_CASE( "Water / cc-pVDZ", "[collocation]" ) {
 #endif
 
 }
+
+#if defined(GAUXC_HAS_HOST) && !defined(GENERATE_TESTS)
+TEST_CASE( "Native Collocation / High L", "[collocation]" ) {
+  test_host_native_collocation_gau2grid();
+}
+#endif
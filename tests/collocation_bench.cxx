@@ -0,0 +1,150 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+
+/**
+ *  Benchmark of the host collocation required by Laplacian dependent MGGAs
+ *
+ *  Compares, over the local tasks of a test molecule, the collocation
+ *  Hessian followed by the assembly of the Laplacian (lacpy + 2 axpy) with
+ *  the direct evaluation of the Laplacian (eval_collocation_laplacian).
+ *  Reports the time and the collocation scratch footprint per task.
+ *
+ *  Usage: collocation_bench [WATER|BENZENE|TAXOL|UBIQUITIN] [NREP]
+ */
+#include "standards.hpp"
+#include "integrator_util/integrator_common.hpp"
+#include "host/local_host_work_driver.hpp"
+#include "host/blas.hpp"
+#include <gauxc/load_balancer.hpp>
+#include <gauxc/molecular_weights.hpp>
+#include <gauxc/molgrid/defaults.hpp>
+#include <gauxc/runtime_environment.hpp>
+#include <gauxc/util/aligned_allocator.hpp>
+#include <gauxc/xc_integrator/local_work_driver.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+
+using namespace GauXC;
+
+int main( int argc, char** argv ) {
+
+#ifdef GAUXC_HAS_MPI
+  MPI_Init( NULL, NULL );
+#endif
+  {
+
+  std::string mol_name = argc > 1 ? argv[1] : "BENZENE";
+  const int   nrep     = argc > 2 ? std::stoi(argv[2]) : 5;
+  std::transform( mol_name.begin(), mol_name.end(), mol_name.begin(), ::toupper );
+
+  std::map< std::string, Molecule(*)() > mol_map = {
+    { "WATER",     make_water     },
+    { "BENZENE",   make_benzene   },
+    { "TAXOL",     make_taxol     },
+    { "UBIQUITIN", make_ubiquitin }
+  };
+
+  auto rt    = RuntimeEnvironment( GAUXC_MPI_CODE(MPI_COMM_WORLD) );
+  auto mol   = mol_map.at(mol_name)();
+  auto basis = make_ccpvdz( mol, SphericalType(true) );
+  auto mg    = MolGridFactory::create_default_molgrid( mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::UltraFineGrid );
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb = lb_factory.get_instance( rt, mol, mg, basis );
+  MolecularWeightsFactory mw_factory( ExecutionSpace::Host, "Default",
+    MolecularWeightsSettings{} );
+  mw_factory.get_instance().modify_weights( lb );
+
+  auto lwd_base = LocalWorkDriverFactory::make_local_work_driver(
+    ExecutionSpace::Host, "Default" );
+  auto* lwd = dynamic_cast<LocalHostWorkDriver*>( lwd_base.get() );
+
+  auto tasks = lb.get_tasks();
+  generate_points_soa( tasks.begin(), tasks.end() );
+
+  const size_t ntasks = tasks.size();
+  size_t max_size = 0, tot_size = 0;
+  for( const auto& task : tasks ) {
+    const size_t sz = task.npts * task.bfn_screening.nbe;
+    max_size  = std::max( max_size, sz );
+    tot_size += sz;
+  }
+
+  std::cout << "MOLECULE = " << mol_name << ", NBF = " << basis.nbf()
+            << ", NTASKS = " << ntasks << ", NREP = " << nrep << std::endl;
+  std::cout << std::setw(12) << "METHOD" << std::setw(16) << "TOTAL (s)"
+            << std::setw(20) << "PER TASK (us)" << std::setw(20)
+            << "AVG SCR (MiB)" << std::setw(20) << "MAX SCR (MiB)" << std::endl;
+
+  // Number of (npts x nbe) collocation arrays required by each method
+  for( auto [name, nc] : std::vector<std::pair<std::string,size_t>>{
+    {"HESSIAN", 11}, {"LAPLACIAN", 5} } ) {
+
+    const size_t ncomp  = nc;
+    const bool   direct = ncomp == 5;
+    double time = 0.;
+    for( int irep = 0; irep < nrep; ++irep ) {
+
+      auto st = std::chrono::high_resolution_clock::now();
+
+      #pragma omp parallel
+      {
+      util::aligned_vector<double> basis_eval;
+
+      #pragma omp for schedule(dynamic)
+      for( size_t iT = 0; iT < ntasks; ++iT ) {
+        const auto& task = tasks[iT];
+        const size_t npts    = task.npts;
+        const size_t nbe     = task.bfn_screening.nbe;
+        const size_t nshells = task.bfn_screening.shell_list.size();
+        const auto*  shells  = task.bfn_screening.shell_list.data();
+        const auto*  points  = task.points_soa.data();
+        basis_eval.resize( ncomp * npts * nbe );
+
+        auto* b   = basis_eval.data();
+        auto comp = [&]( int i ) { return b + i * npts * nbe; };
+        if( direct ) {
+          lwd->eval_collocation_laplacian( npts, nshells, nbe, points, basis,
+            shells, comp(0), comp(1), comp(2), comp(3), comp(4) );
+        } else {
+          lwd->eval_collocation_hessian( npts, nshells, nbe, points, basis,
+            shells, comp(0), comp(1), comp(2), comp(3), comp(4), comp(5),
+            comp(6), comp(7), comp(8), comp(9) );
+          blas::lacpy( 'A', nbe, npts, comp(4), nbe, comp(10), nbe );
+          blas::axpy( nbe * npts, 1., comp(7), 1, comp(10), 1 );
+          blas::axpy( nbe * npts, 1., comp(9), 1, comp(10), 1 );
+        }
+      }
+      }
+
+      auto en = std::chrono::high_resolution_clock::now();
+      time += std::chrono::duration<double>( en - st ).count();
+
+    }
+
+    const double mib = 1024. * 1024.;
+    std::cout << std::setw(12) << name
+              << std::setw(16) << time / nrep
+              << std::setw(20) << 1e6 * time / nrep / ntasks
+              << std::setw(20) << ncomp * tot_size * sizeof(double) / ntasks / mib
+              << std::setw(20) << ncomp * max_size * sizeof(double) / mib
+              << std::endl;
+
+  }
+
+  }
+#ifdef GAUXC_HAS_MPI
+  MPI_Finalize();
+#endif
+
+}
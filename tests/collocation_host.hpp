@@ -8,6 +8,20 @@
 #ifdef GAUXC_HAS_HOST
 #include "collocation_common.hpp"
 #include "host/reference/collocation.hpp"
+#include <numeric>
+#include <random>
+
+// Host collocation kernels consume SoA points (x(npts), y(npts), z(npts))
+inline std::vector<double> points_to_soa( const std::vector<std::array<double,3>>& pts ) {
+  const auto npts = pts.size();
+  std::vector<double> soa( 3 * npts );
+  for( size_t i = 0; i < npts; ++i ) {
+    soa[i]          = pts[i][0];
+    soa[i + npts]   = pts[i][1];
+    soa[i + 2*npts] = pts[i][2];
+  }
+  return soa;
+}
 
 void generate_collocation_data( const Molecule& mol, const BasisSet<double>& basis,
                                 std::ofstream& out_file, size_t ntask_save = 10 ) {
@@ -49,7 +63,7 @@ void generate_collocation_data( const Molecule& mol, const BasisSet<double>& bas
                         d2eval_zz( nbf * npts );
 
     gau2grid_collocation_hessian( npts, mask.size(), nbf,
-      pts.data()->data(), basis, mask.data(), eval.data(), 
+      points_to_soa(pts).data(), basis, mask.data(), eval.data(), 
       deval_x.data(), deval_y.data(), deval_z.data(),
       d2eval_xx.data(), d2eval_xy.data(), d2eval_xz.data(),
       d2eval_yy.data(), d2eval_yz.data(), d2eval_zz.data() );
@@ -99,7 +113,7 @@ void test_host_collocation( const BasisSet<double>& basis, std::ifstream& in_fil
 
 
     gau2grid_collocation( npts, mask.size(), nbf,
-                          pts.data()->data(), basis,
+                          points_to_soa(pts).data(), basis,
                           mask.data(),
                           eval.data() );
 
@@ -136,7 +150,7 @@ void test_host_collocation_deriv1( const BasisSet<double>& basis, std::ifstream&
 
 
     gau2grid_collocation_gradient( npts, mask.size(), nbf,
-                                   pts.data()->data(), basis,
+                                   points_to_soa(pts).data(), basis,
                                    mask.data(),
                                    eval.data(), deval_x.data(),
                                    deval_y.data(), deval_z.data() );
@@ -185,7 +199,7 @@ void test_host_collocation_deriv2( const BasisSet<double>& basis, std::ifstream&
 
 
     gau2grid_collocation_hessian( npts, mask.size(), nbf,
-      pts.data()->data(), basis, mask.data(), eval.data(), 
+      points_to_soa(pts).data(), basis, mask.data(), eval.data(), 
       deval_x.data(), deval_y.data(), deval_z.data(),
       d2eval_xx.data(), d2eval_xy.data(), d2eval_xz.data(),
       d2eval_yy.data(), d2eval_yz.data(), d2eval_zz.data() );
@@ -213,5 +227,301 @@ void test_host_collocation_deriv2( const BasisSet<double>& basis, std::ifstream&
       CHECK( d2eval_zz[i] == Approx( d.d2eval_zz[i] ) );
   }
 
+}
+
+void test_host_collocation_laplacian( const BasisSet<double>& basis, std::ifstream& in_file) {
+
+  std::vector<ref_collocation_data> ref_data;
+
+  {
+    cereal::BinaryInputArchive ar( in_file );
+    ar( ref_data );
+  }
+
+  for( auto& d : ref_data ) {
+
+    const auto npts = d.pts.size();
+    const auto nbf  = d.eval.size() / npts;
+
+    const auto& mask = d.mask;
+    const auto& pts  = d.pts;
+
+    std::vector<double> eval   ( nbf * npts ),
+                        deval_x( nbf * npts ),
+                        deval_y( nbf * npts ),
+                        deval_z( nbf * npts ),
+                        leval  ( nbf * npts );
+
+    // Odd block size to exercise a partial trailing block
+    for( size_t block_size : { 7ul, 64ul } ) {
+
+      gau2grid_collocation_laplacian( npts, mask.size(), nbf,
+        points_to_soa(pts).data(), basis, mask.data(), eval.data(), 
+        deval_x.data(), deval_y.data(), deval_z.data(), leval.data(),
+        CollocationScreening{ 0., block_size } );
+
+      for( auto i = 0; i < npts * nbf; ++i )
+        CHECK( eval[i] == Approx( d.eval[i] ) );
+      for( auto i = 0; i < npts * nbf; ++i )
+        CHECK( deval_x[i] == Approx( d.deval_x[i] ) );
+      for( auto i = 0; i < npts * nbf; ++i )
+        CHECK( deval_y[i] == Approx( d.deval_y[i] ) );
+      for( auto i = 0; i < npts * nbf; ++i )
+        CHECK( deval_z[i] == Approx( d.deval_z[i] ) );
+      for( auto i = 0; i < npts * nbf; ++i )
+        CHECK( leval[i] == Approx( d.d2eval_xx[i] + d.d2eval_yy[i] + 
+          d.d2eval_zz[i] ).margin(1e-12) );
+
+    }
+  }
+
+}
+
+void test_host_collocation_screened( const BasisSet<double>& basis, std::ifstream& in_file) {
+
+  std::vector<ref_collocation_data> ref_data;
+
+  {
+    cereal::BinaryInputArchive ar( in_file );
+    ar( ref_data );
+  }
+
+  // Small blocks to exercise the per-block shell / primitive screening
+  const double tol = 1e-12;
+  CollocationScreening screen{ tol, 8 };
+
+  for( auto& d : ref_data ) {
+
+    const auto npts = d.pts.size();
+    const auto nbf  = d.eval.size() / npts;
+
+    const auto& mask = d.mask;
+    const auto& pts  = d.pts;
+
+    std::vector<double> eval   ( nbf * npts ),
+                        deval_x( nbf * npts ),
+                        deval_y( nbf * npts ),
+                        deval_z( nbf * npts ),
+                        d2eval_xx( nbf * npts ),
+                        d2eval_xy( nbf * npts ),
+                        d2eval_xz( nbf * npts ),
+                        d2eval_yy( nbf * npts ),
+                        d2eval_yz( nbf * npts ),
+                        d2eval_zz( nbf * npts );
+
+    gau2grid_collocation_hessian( npts, mask.size(), nbf,
+      points_to_soa(pts).data(), basis, mask.data(), eval.data(), 
+      deval_x.data(), deval_y.data(), deval_z.data(),
+      d2eval_xx.data(), d2eval_xy.data(), d2eval_xz.data(),
+      d2eval_yy.data(), d2eval_yz.data(), d2eval_zz.data(), screen );
+
+    auto check = [&]( const auto& v, const auto& ref ) {
+      for( auto i = 0ul; i < npts * nbf; ++i )
+        CHECK( std::abs( v[i] - ref[i] ) < 10 * tol );
+    };
+
+    check( eval,      d.eval      );
+    check( deval_x,   d.deval_x   );
+    check( deval_y,   d.deval_y   );
+    check( deval_z,   d.deval_z   );
+    check( d2eval_xx, d.d2eval_xx );
+    check( d2eval_xy, d.d2eval_xy );
+    check( d2eval_xz, d.d2eval_xz );
+    check( d2eval_yy, d.d2eval_yy );
+    check( d2eval_yz, d.d2eval_yz );
+    check( d2eval_zz, d.d2eval_zz );
+
+    // Screened values and gradients through the lower order entry point
+    gau2grid_collocation_gradient( npts, mask.size(), nbf,
+      points_to_soa(pts).data(), basis, mask.data(), eval.data(),
+      deval_x.data(), deval_y.data(), deval_z.data(), screen );
+
+    check( eval,    d.eval    );
+    check( deval_x, d.deval_x );
+    check( deval_y, d.deval_y );
+    check( deval_z, d.deval_z );
+  }
+
+}
+
+void test_host_native_collocation( const BasisSet<double>& basis, std::ifstream& in_file) {
+
+  std::vector<ref_collocation_data> ref_data;
+
+  {
+    cereal::BinaryInputArchive ar( in_file );
+    ar( ref_data );
+  }
+
+  for( auto& d : ref_data ) {
+
+    const auto npts = d.pts.size();
+    const auto nbf  = d.eval.size() / npts;
+
+    const auto& mask = d.mask;
+    const auto  pts  = points_to_soa(d.pts);
+
+    // 0-9: value through Hessian, 10-19: third derivatives, 20: Laplacian
+    std::vector<std::vector<double>> e( 21, std::vector<double>(nbf * npts) );
+    std::vector<std::vector<double>> g( 20, std::vector<double>(nbf * npts) );
+
+    auto check = [&]( const auto& v, const auto& ref ) {
+      for( auto i = 0ul; i < npts * nbf; ++i )
+        CHECK( v[i] == Approx( ref[i] ).margin(1e-12) );
+    };
+
+    // Third derivatives are checked against gau2grid
+    gau2grid_collocation_der3( npts, mask.size(), nbf, pts.data(), basis, 
+      mask.data(), g[0].data(), g[1].data(), g[2].data(), g[3].data(), 
+      g[4].data(), g[5].data(), g[6].data(), g[7].data(), g[8].data(), 
+      g[9].data(), g[10].data(), g[11].data(), g[12].data(), g[13].data(), 
+      g[14].data(), g[15].data(), g[16].data(), g[17].data(), g[18].data(), 
+      g[19].data(), CollocationScreening{ 0., 64 } );
+
+    // Odd block size to exercise a partial trailing block
+    for( size_t block_size : { 7ul, 64ul } ) {
+
+      CollocationScreening screen{ 0., block_size };
+
+      native_collocation( npts, mask.size(), nbf, pts.data(), basis,
+        mask.data(), e[0].data(), screen );
+      check( e[0], d.eval );
+
+      native_collocation_gradient( npts, mask.size(), nbf, pts.data(), basis,
+        mask.data(), e[0].data(), e[1].data(), e[2].data(), e[3].data(), 
+        screen );
+      check( e[0], d.eval    );
+      check( e[1], d.deval_x );
+      check( e[2], d.deval_y );
+      check( e[3], d.deval_z );
+
+      native_collocation_laplacian( npts, mask.size(), nbf, pts.data(), basis,
+        mask.data(), e[0].data(), e[1].data(), e[2].data(), e[3].data(), 
+        e[20].data(), screen );
+      for( auto i = 0ul; i < npts * nbf; ++i )
+        CHECK( e[20][i] == Approx( d.d2eval_xx[i] + d.d2eval_yy[i] + 
+          d.d2eval_zz[i] ).margin(1e-12) );
+
+      native_collocation_der3( npts, mask.size(), nbf, pts.data(), basis, 
+        mask.data(), e[0].data(), e[1].data(), e[2].data(), e[3].data(), 
+        e[4].data(), e[5].data(), e[6].data(), e[7].data(), e[8].data(), 
+        e[9].data(), e[10].data(), e[11].data(), e[12].data(), e[13].data(), 
+        e[14].data(), e[15].data(), e[16].data(), e[17].data(), e[18].data(), 
+        e[19].data(), screen );
+      check( e[4], d.d2eval_xx );
+      check( e[5], d.d2eval_xy );
+      check( e[6], d.d2eval_xz );
+      check( e[7], d.d2eval_yy );
+      check( e[8], d.d2eval_yz );
+      check( e[9], d.d2eval_zz );
+      for( int k = 10; k < 20; ++k ) check( e[k], g[k] );
+
+    }
+
+    // Screened Hessian
+    const double tol = 1e-12;
+    native_collocation_hessian( npts, mask.size(), nbf, pts.data(), basis,
+      mask.data(), e[0].data(), e[1].data(), e[2].data(), e[3].data(), 
+      e[4].data(), e[5].data(), e[6].data(), e[7].data(), e[8].data(), 
+      e[9].data(), CollocationScreening{ tol, 8 } );
+
+    const std::vector<double>* ref[10] = { &d.eval, &d.deval_x, &d.deval_y,
+      &d.deval_z, &d.d2eval_xx, &d.d2eval_xy, &d.d2eval_xz, &d.d2eval_yy,
+      &d.d2eval_yz, &d.d2eval_zz };
+    for( int k = 0; k < 10; ++k )
+    for( auto i = 0ul; i < npts * nbf; ++i )
+      CHECK( std::abs( e[k][i] - (*ref[k])[i] ) < 10 * tol );
+  }
+
+}
+
+// Native kernels against gau2grid for contracted Cartesian / spherical shells
+// through L = 6, individually and mixed in a single basis
+void test_host_native_collocation_gau2grid() {
+
+  const std::vector<std::array<double,3>> centers = {
+    {0.0, 0.0, 0.0}, {1.4, 0.0, 0.0}, {0.0, 1.8, 0.3}, {-0.9, -0.6, 1.2}
+  };
+  const std::vector<std::array<double,3>> exponents = {
+    {8.0, 1.6, 0.4}, {2.0, 0.6, 0.2}, {0.9, 0.3, 0.1}
+  };
+
+  const size_t npts = 67;
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist( -3., 3. );
+  std::vector<double> points( 3 * npts );
+  for( auto& p : points ) p = dist(gen);
+
+  auto make_shell = []( int l, bool pure, const auto& a, const auto& O ) {
+    Shell<double>::prim_array alpha{}, coeff{};
+    for( int i = 0; i < 3; ++i ) { alpha[i] = a[i]; coeff[i] = 1.; }
+    return Shell<double>( PrimSize(3), AngularMomentum(l), SphericalType(pure),
+      alpha, coeff, O );
+  };
+
+  auto check_basis = [&]( const BasisSet<double>& basis ) {
+
+    const size_t nshells = basis.size();
+    const size_t nbe     = basis.nbf();
+    std::vector<int32_t> mask( nshells );
+    std::iota( mask.begin(), mask.end(), 0 );
+
+    // [0,20): gau2grid, [20,40): native
+    std::vector<std::vector<double>> v( 40, std::vector<double>(npts * nbe) );
+    auto o = [&]( bool native, int i ){ return v[20*native + i].data(); };
+
+    auto check = [&]( int ncomp ) {
+      for( int k = 0; k < ncomp; ++k )
+      for( auto i = 0ul; i < npts * nbe; ++i )
+        CHECK( v[20+k][i] == Approx( v[k][i] ).epsilon(1e-10).margin(1e-12) );
+    };
+
+    // Odd block size to exercise a partial trailing block
+    const CollocationScreening screen{ 0., 7 };
+    const auto* pts = points.data();
+    for( bool native : { false, true } )
+      (native ? native_collocation_hessian : gau2grid_collocation_hessian)(
+        npts, nshells, nbe, pts, basis, mask.data(), o(native,0), 
+        o(native,1), o(native,2), o(native,3), o(native,4), o(native,5), 
+        o(native,6), o(native,7), o(native,8), o(native,9), screen );
+    check( 10 );
+
+    for( bool native : { false, true } )
+      (native ? native_collocation_laplacian : gau2grid_collocation_laplacian)(
+        npts, nshells, nbe, pts, basis, mask.data(), o(native,0), 
+        o(native,1), o(native,2), o(native,3), o(native,4), screen );
+    check( 5 );
+
+    for( bool native : { false, true } )
+      (native ? native_collocation_der3 : gau2grid_collocation_der3)(
+        npts, nshells, nbe, pts, basis, mask.data(), o(native,0), 
+        o(native,1), o(native,2), o(native,3), o(native,4), o(native,5), 
+        o(native,6), o(native,7), o(native,8), o(native,9), o(native,10), 
+        o(native,11), o(native,12), o(native,13), o(native,14), o(native,15),
+        o(native,16), o(native,17), o(native,18), o(native,19), screen );
+    check( 20 );
+
+  };
+
+  BasisSet<double> mixed;
+  for( int l = 0; l <= 6; ++l )
+  for( bool pure : { false, true } ) {
+
+    BasisSet<double> basis;
+    for( const auto& O : centers )
+    for( const auto& a : exponents ) 
+      basis.emplace_back( make_shell( l, pure, a, O ) );
+
+    mixed.emplace_back( make_shell( l, pure, exponents[l % 3], 
+      centers[l % 4] ) );
+
+    INFO( "L = " << l << ", PURE = " << pure );
+    check_basis( basis );
+
+  }
+
+  INFO( "MIXED L" );
+  check_basis( mixed );
+
 }
 #endif
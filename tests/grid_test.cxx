@@ -14,6 +14,7 @@
 #include <integratorxx/composite_quadratures/spherical_quadrature.hpp>
 
 #include <random>
+#include <vector>
 
 using namespace GauXC;
 
@@ -59,6 +60,40 @@ TEST_CASE("Grid", "[grid]") {
 
   }
 
+  SECTION("Translated Batches") {
+
+    Grid grid( mk_sphere, BatchSize(batch_sz) );
+    REQUIRE( grid.nbatches() == grid.batcher().nbatches() );
+
+    const std::array<double,3> center = { pos_real_dist(gen), 
+      pos_real_dist(gen), pos_real_dist(gen) };
+
+    std::vector<grid_batch_type> translated;
+    for( auto i = 0ul; i < grid.nbatches(); ++i )
+      translated.emplace_back( grid.translated_batch(i, center) );
+
+    // Bitwise identical to recentering the reference quadrature
+    grid.batcher().quadrature().recenter( center );
+    for( auto i = 0ul; i < grid.nbatches(); ++i ) {
+      auto&& [box_lo_ref, box_up_ref, points_ref, weights_ref] = grid.batcher().at(i);
+      auto&& [box_lo, box_up, points, weights] = translated[i];
+      CHECK( points_ref  == points  );
+      CHECK( weights_ref == weights );
+      for( int k = 0; k < 3; ++k ) {
+        CHECK( box_lo_ref[k] == box_lo[k] );
+        CHECK( box_up_ref[k] == box_up[k] );
+      }
+    }
+
+    // Translated batches do not depend on the state of the shared quadrature
+    grid.batcher().quadrature().recenter( {0., 0., 0.} );
+    for( auto i = 0ul; i < grid.nbatches(); ++i ) {
+      auto&& [box_lo, box_up, points, weights] = grid.translated_batch(i, center);
+      CHECK( points == std::get<2>(translated[i]) );
+    }
+
+  }
+
 #if 0
     SECTION("Default Batch Size") {
       Grid grid( rquad, RadialSize(n_rad), AngularSize(n_ang), 
@@ -8,6 +8,18 @@
 #include "ut_common.hpp"
 #include <gauxc/load_balancer.hpp>
 #include <gauxc/molgrid/defaults.hpp>
+#include <gauxc/xc_integrator.hpp>
+#include <gauxc/xc_integrator/impl.hpp>
+#include <gauxc/xc_integrator/integrator_factory.hpp>
+#include <gauxc/molecular_weights.hpp>
+#include "integrator_util/integrator_common.hpp"
+#include "host/batch_partition.hpp"
+#include <gauxc/util/div_ceil.hpp>
+#include <Eigen/Core>
+#include <random>
+#include <sstream>
+#include <numeric>
+#include <map>
 
 using namespace GauXC;
 
@@ -34,11 +46,8 @@ void gen_ref_lb_data( std::vector<XCTask>& tasks ) {
 
 }
 
-void check_lb_data( const std::vector<XCTask>& tasks ) {
-
-  auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
-  int world_rank = rt.comm_rank();
-  int world_size = rt.comm_size();
+void check_lb_data( const std::vector<XCTask>& tasks, int world_rank, 
+  int world_size ) {
 
   std::string ref_file = GAUXC_REF_DATA_PATH "/benzene_cc-pvdz_ufg_tasks_" + std::to_string(world_size) + "mpi_rank" + std::to_string(world_rank) + 
     "_pv" + std::to_string(1) + ".bin";
@@ -83,6 +92,12 @@ void check_lb_data( const std::vector<XCTask>& tasks ) {
 }
 
 
+void check_lb_data( const std::vector<XCTask>& tasks ) {
+  auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+  check_lb_data( tasks, rt.comm_rank(), rt.comm_size() );
+}
+
+
 //#define GAUXC_GEN_TESTS
 TEST_CASE( "DefaultLoadBalancer", "[load_balancer]" ) {
 
@@ -117,6 +132,213 @@ TEST_CASE( "DefaultLoadBalancer", "[load_balancer]" ) {
 
   }
 
+  SECTION("Threaded Host") {
+
+    // Reproduce the 2 rank reference data with virtual ranks
+    const int nranks = 2;
+    std::vector<std::vector<XCTask>> rank_tasks(nranks);
+    ThreadedRuntimeEnvironment::launch( nranks, [&]( const RuntimeEnvironment& rt ) {
+      // Molecular grids are stateful, each virtual rank requires its own
+      auto rank_mg = MolGridFactory::create_default_molgrid(mol, 
+        PruningScheme::Unpruned, BatchSize(512), RadialQuad::MuraKnowles, 
+        AtomicGridSizeDefault::UltraFineGrid);
+      LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+      auto lb = lb_factory.get_instance( rt, mol, rank_mg, basis );
+      rank_tasks[rt.comm_rank()] = lb.get_tasks();
+    });
+
+    for( int r = 0; r < nranks; ++r ) check_lb_data( rank_tasks[r], r, nranks );
+
+    // Rebalancing between virtual ranks conserves the tasks and evens out
+    // their cost
+    auto cost = []( const auto& tasks ) {
+      return std::accumulate( tasks.begin(), tasks.end(), 0ul, 
+        []( auto a, const auto& t ){ return a + t.cost_exc_vxc(1); } );
+    };
+    std::vector<std::vector<XCTask>> rebal_tasks(nranks);
+    ThreadedRuntimeEnvironment::launch( nranks, [&]( const RuntimeEnvironment& rt ) {
+      auto rank_mg = MolGridFactory::create_default_molgrid(mol, 
+        PruningScheme::Unpruned, BatchSize(512), RadialQuad::MuraKnowles, 
+        AtomicGridSizeDefault::UltraFineGrid);
+      LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+      auto lb = lb_factory.get_instance( rt, mol, rank_mg, basis );
+      lb.rebalance_exc_vxc();
+      rebal_tasks[rt.comm_rank()] = lb.get_tasks();
+    });
+
+    size_t ntasks = 0, rebal_ntasks = 0, total_cost = 0, max_cost = 0, 
+      max_task_cost = 0;
+    for( int r = 0; r < nranks; ++r ) {
+      ntasks       += rank_tasks[r].size();
+      rebal_ntasks += rebal_tasks[r].size();
+      total_cost   += cost(rank_tasks[r]);
+      max_cost      = std::max( max_cost, cost(rebal_tasks[r]) );
+      for( const auto& t : rank_tasks[r] ) 
+        max_task_cost = std::max( max_task_cost, t.cost_exc_vxc(1) );
+    }
+    CHECK( rebal_ntasks == ntasks );
+    CHECK( max_cost <= util::div_ceil(total_cost, nranks) + max_task_cost );
+
+  }
+
+  SECTION("Task Merge Policies") {
+
+    LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+    auto lb_sort = lb_factory.get_instance( world, mol, mg, basis);
+    auto lb_hash = lb_factory.get_instance( world, mol, mg, basis);
+    lb_sort.state().task_merge_policy = TaskMergePolicy::Sort;
+    lb_hash.state().task_merge_policy = TaskMergePolicy::Hash;
+
+    const auto& sort_tasks = lb_sort.get_tasks();
+    const auto& hash_tasks = lb_hash.get_tasks();
+    check_lb_data( sort_tasks );
+    check_lb_data( hash_tasks );
+
+    REQUIRE( sort_tasks.size() == hash_tasks.size() );
+    for( size_t i = 0; i < sort_tasks.size(); ++i ) {
+      CHECK( sort_tasks[i].equiv_with( hash_tasks[i] ) );
+      CHECK( sort_tasks[i].npts == hash_tasks[i].npts );
+      CHECK( std::accumulate( sort_tasks[i].weights.begin(), 
+        sort_tasks[i].weights.end(), 0. ) == Approx( std::accumulate(
+        hash_tasks[i].weights.begin(), hash_tasks[i].weights.end(), 0. ) ) );
+    }
+
+    // Chosen policy is reported in the timings
+    const auto& sort_timings = lb_sort.get_timings().all_timings();
+    const auto& hash_timings = lb_hash.get_timings().all_timings();
+    CHECK( sort_timings.count("LoadBalancer.MergeTasks(Sort)") );
+    CHECK( hash_timings.count("LoadBalancer.MergeTasks(Hash)") );
+
+  }
+
+  SECTION("Batch Partitioners") {
+
+    using matrix_type = Eigen::MatrixXd;
+    const size_t nbf = basis.nbf();
+    std::mt19937 gen(13);
+    std::uniform_real_distribution<double> dist( 0., 1. );
+    matrix_type C( nbf, 21 );
+    for( auto i = 0; i < C.size(); ++i ) C.data()[i] = dist(gen) / nbf;
+    matrix_type P = C * C.transpose();
+
+    functional_type func( ExchCXX::Backend::builtin, ExchCXX::Functional::SVWN5,
+      ExchCXX::Spin::Unpolarized );
+    MolecularWeightsFactory mw_factory( ExecutionSpace::Host, "Default",
+      MolecularWeightsSettings{} );
+
+    LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+    double N_EL_ref = 0.;
+    for( auto part : { BatchPartitioner::Spherical, BatchPartitioner::Octree, 
+                       BatchPartitioner::Bisection } ) {
+
+      auto lb = lb_factory.get_instance( world, mol, mg, basis);
+      lb.state().batch_partitioner = part;
+      const auto& tasks = lb.get_tasks();
+      REQUIRE( tasks.size() );
+
+      for( const auto& t : tasks ) {
+        REQUIRE( t.bfn_screening.shell_list.size() );
+        CHECK( t.npts == t.points.size() );
+        CHECK( t.points.size() == t.weights.size() );
+        CHECK( t.bfn_screening.nbe == std::accumulate( 
+          t.bfn_screening.shell_list.begin(), t.bfn_screening.shell_list.end(), 
+          0ul, [&]( auto a, auto sh ){ return a + basis[sh].size(); } ) );
+      }
+
+      // Batch quality metrics
+      CHECK( lb.mean_nbe() > 0. );
+      CHECK( lb.mean_nbe() <= lb.max_nbe() );
+      CHECK( lb.total_exc_vxc_cost() > 0ul );
+
+      // Only points without any surviving shells may be discarded, the
+      // integrated density is independent of the partitioning
+      mw_factory.get_instance().modify_weights( lb );
+      auto integrator = XCIntegratorFactory<matrix_type>( ExecutionSpace::Host,
+        "Replicated", "Default", "Default", "Default" ).get_instance( func, lb );
+      const double N_EL = integrator.integrate_den( P );
+      if( part == BatchPartitioner::Spherical ) N_EL_ref = N_EL;
+      else CHECK( N_EL == Approx( N_EL_ref ).epsilon(1e-10) );
+
+    }
+
+  }
+
+  SECTION("Task Ordering") {
+
+    // Consecutive Hilbert indices are lattice neighbours
+    std::map< uint64_t, std::array<int,3> > curve;
+    for( int x = 0; x < 4; ++x )
+    for( int y = 0; y < 4; ++y )
+    for( int z = 0; z < 4; ++z ) curve[ hilbert_index(x,y,z) ] = {x,y,z};
+    REQUIRE( curve.rbegin()->first == 63 );
+    for( auto it = std::next(curve.begin()); it != curve.end(); ++it ) {
+      const auto& a = std::prev(it)->second; const auto& b = it->second;
+      CHECK( std::abs(a[0]-b[0]) + std::abs(a[1]-b[1]) + std::abs(a[2]-b[2]) == 1 );
+    }
+
+    // Orderings permute the tasks into cost-descending (power of two) chunks
+    LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+    auto lb = lb_factory.get_instance( world, mol, mg, basis);
+    auto task_cost = []( const XCTask& t ) {
+      return double(t.points.size() * t.bfn_screening.nbe);
+    };
+    for( auto ordering : { TaskOrdering::Cost, TaskOrdering::Morton, 
+                           TaskOrdering::Hilbert } ) {
+      auto tasks = lb.get_tasks();
+      order_tasks( ordering, tasks.begin(), tasks.end(), task_cost );
+      REQUIRE( tasks.size() == lb.get_tasks().size() );
+      CHECK( std::accumulate( tasks.begin(), tasks.end(), 0ul, 
+        []( auto a, const auto& t ){ return a + t.npts; } ) == 
+        std::accumulate( lb.get_tasks().begin(), lb.get_tasks().end(), 0ul, 
+        []( auto a, const auto& t ){ return a + t.npts; } ) );
+      for( size_t i = 1; i < tasks.size(); ++i )
+        CHECK( std::ilogb(task_cost(tasks[i])) <= std::ilogb(task_cost(tasks[i-1])) );
+    }
+
+  }
+
+  SECTION("Host SoA Points") {
+
+    LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+    auto lb = lb_factory.get_instance( world, mol, mg, basis);
+    auto tasks = lb.get_tasks();
+
+    auto check_soa = []( const XCTask& t ) {
+      REQUIRE( t.has_points_soa() );
+      CHECK( reinterpret_cast<std::uintptr_t>(t.points_soa.data()) % 64 == 0 );
+      for( size_t j = 0; j < t.points.size(); ++j ) {
+        CHECK( t.points_x()[j] == t.points[j][0] );
+        CHECK( t.points_y()[j] == t.points[j][1] );
+        CHECK( t.points_z()[j] == t.points[j][2] );
+      }
+    };
+
+    auto& task = tasks.front();
+    task.generate_points_soa();
+    check_soa( task );
+
+    // Merges invalidate the SoA storage
+    auto other = task;
+    task.merge_with( other );
+    CHECK( not task.has_points_soa() );
+    task.generate_points_soa();
+    check_soa( task );
+
+    // SoA storage is derived data and does not alter the serialized format
+    std::stringstream ss_soa, ss_aos;
+    auto aos_task = task; aos_task.points_soa.clear();
+    { cereal::BinaryOutputArchive ar(ss_soa); ar( task );     }
+    { cereal::BinaryOutputArchive ar(ss_aos); ar( aos_task ); }
+    CHECK( ss_soa.str() == ss_aos.str() );
+
+    XCTask read_task;
+    { cereal::BinaryInputArchive ar(ss_soa); ar( read_task ); }
+    CHECK( not read_task.has_points_soa() );
+    read_task.generate_points_soa();
+    check_soa( read_task );
+
+  }
+
 #ifdef GAUXC_HAS_DEVICE
   SECTION("Default Device") {
 
@@ -156,3 +378,71 @@ TEST_CASE( "DefaultLoadBalancer", "[load_balancer]" ) {
 
 
 }
+
+
+TEST_CASE( "Batch Partitioning", "[load_balancer]" ) {
+
+  using namespace detail;
+
+  // Uniformly distributed points in the unit cube
+  const size_t npts = 4096, max_npts = 512, min_npts = 32;
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<double> dist( 0., 1. );
+  quadrature_type::point_container  ref_points( npts );
+  quadrature_type::weight_container ref_weights( npts );
+  for( auto& p : ref_points ) for( auto& x : p ) x = dist(gen);
+  for( auto& w : ref_weights ) w = dist(gen);
+  const std::array<double,3> root_lo = {0., 0., 0.}, root_up = {1., 1., 1.};
+
+  auto box_volume = []( const auto& lo, const auto& up ) {
+    return (up[0] - lo[0]) * (up[1] - lo[1]) * (up[2] - lo[2]);
+  };
+  auto box_diagonal = []( const auto& lo, const auto& up ) {
+    return std::hypot( up[0] - lo[0], up[1] - lo[1], up[2] - lo[2] );
+  };
+
+  // Screened basis dimension which is independent of the box, which decreases
+  // slightly and which decreases strongly with the size of the box
+  batch_screen_type no_screen = []( const auto&, const auto& ) {
+    return std::make_pair( std::vector<int32_t>{0}, 100ul );
+  };
+  batch_screen_type weak_screen = [&]( const auto& lo, const auto& up ) {
+    return std::make_pair( std::vector<int32_t>{0}, 
+      100ul + size_t(10. * box_diagonal(lo, up)) );
+  };
+  batch_screen_type strong_screen = [&]( const auto& lo, const auto& up ) {
+    return std::make_pair( std::vector<int32_t>{0}, 
+      1ul + size_t(1e4 * box_volume(lo, up)) );
+  };
+
+  for( auto part : { BatchPartitioner::Octree, BatchPartitioner::Bisection } ) 
+  for( auto* screen : { &no_screen, &weak_screen, &strong_screen } ) {
+
+    auto points  = ref_points;
+    auto weights = ref_weights;
+    auto batches = partition_points( part, std::move(points), 
+      std::move(weights), root_lo, root_up, max_npts, min_npts, *screen );
+    REQUIRE( batches.size() );
+
+    // Points and weights are conserved
+    std::vector<std::pair<std::array<double,3>,double>> ref_pw, batch_pw;
+    for( size_t i = 0; i < npts; ++i ) 
+      ref_pw.emplace_back( ref_points[i], ref_weights[i] );
+    for( const auto& b : batches ) {
+      REQUIRE( b.points.size() == b.weights.size() );
+      CHECK( b.points.size() <= max_npts );
+      for( size_t i = 0; i < b.points.size(); ++i )
+        batch_pw.emplace_back( b.points[i], b.weights[i] );
+    }
+    std::sort( ref_pw.begin(), ref_pw.end() );
+    std::sort( batch_pw.begin(), batch_pw.end() );
+    CHECK( batch_pw == ref_pw );
+
+    // Splits have to pay for the per-batch overhead
+    const double mean_npts = double(npts) / batches.size();
+    if( screen == &strong_screen ) CHECK( mean_npts < 2 * min_npts );
+    else                           CHECK( mean_npts > 2 * min_npts );
+    
+  }
+
+}
@@ -0,0 +1,249 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "ut_common.hpp"
+#include "xc_integrator_fixture.hpp"
+#include <gauxc/xc_integrator.hpp>
+#include <gauxc/xc_integrator/impl.hpp>
+#include <gauxc/xc_integrator/integrator_factory.hpp>
+#include <gauxc/xc_integrator/memory_estimate.hpp>
+#include <gauxc/molecular_weights.hpp>
+#include <gauxc/molgrid/defaults.hpp>
+#include <Eigen/Core>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace GauXC;
+
+// Peak tracking replacement of the global allocation functions. The size and
+// offset of every allocation is stored in a header preceding the returned
+// pointer so that all delete variants can release and account for it.
+namespace {
+
+std::atomic<bool>    track_allocations{false};
+std::atomic<int64_t> current_bytes{0};
+std::atomic<int64_t> peak_bytes{0};
+
+void* counted_alloc( size_t sz, size_t align ) noexcept {
+  const size_t offset = std::max( align, alignof(std::max_align_t) );
+  const size_t total  = ((sz + offset + offset - 1) / offset) * offset;
+  auto* base = static_cast<char*>( std::aligned_alloc( offset, total ) );
+  if( not base ) return nullptr;
+
+  auto* ptr = base + offset;
+  reinterpret_cast<size_t*>(ptr)[-1] = sz;
+  reinterpret_cast<size_t*>(ptr)[-2] = offset;
+
+  if( track_allocations ) {
+    const int64_t cur = current_bytes += sz;
+    int64_t peak = peak_bytes;
+    while( cur > peak and not peak_bytes.compare_exchange_weak( peak, cur ) );
+  }
+  return ptr;
+}
+
+void counted_free( void* ptr ) noexcept {
+  if( not ptr ) return;
+  auto* p = static_cast<char*>(ptr);
+  const size_t sz     = reinterpret_cast<size_t*>(p)[-1];
+  const size_t offset = reinterpret_cast<size_t*>(p)[-2];
+  if( track_allocations ) current_bytes -= sz;
+  std::free( p - offset );
+}
+
+void* counted_new( size_t sz, size_t align ) {
+  auto* ptr = counted_alloc( sz, align );
+  if( not ptr ) throw std::bad_alloc();
+  return ptr;
+}
+
+/// Peak bytes allocated through the global allocation functions by op
+template <typename Op>
+size_t measure_peak( Op&& op ) {
+  current_bytes = 0; peak_bytes = 0;
+  track_allocations = true;
+  op();
+  track_allocations = false;
+  return peak_bytes;
+}
+
+#ifdef _OPENMP
+/// Sets the number of OpenMP threads, restored on scope exit
+struct omp_num_threads_guard {
+  int saved = omp_get_max_threads();
+  explicit omp_num_threads_guard( int n ) { omp_set_num_threads(n); }
+  ~omp_num_threads_guard() noexcept { omp_set_num_threads(saved); }
+};
+#endif
+
+}
+
+void* operator new  ( size_t sz ) { return counted_new( sz, 0 ); }
+void* operator new[]( size_t sz ) { return counted_new( sz, 0 ); }
+void* operator new  ( size_t sz, std::align_val_t al ) { return counted_new( sz, size_t(al) ); }
+void* operator new[]( size_t sz, std::align_val_t al ) { return counted_new( sz, size_t(al) ); }
+void* operator new  ( size_t sz, const std::nothrow_t& ) noexcept { return counted_alloc( sz, 0 ); }
+void* operator new[]( size_t sz, const std::nothrow_t& ) noexcept { return counted_alloc( sz, 0 ); }
+void* operator new  ( size_t sz, std::align_val_t al, const std::nothrow_t& ) noexcept {
+  return counted_alloc( sz, size_t(al) );
+}
+void* operator new[]( size_t sz, std::align_val_t al, const std::nothrow_t& ) noexcept {
+  return counted_alloc( sz, size_t(al) );
+}
+
+void operator delete  ( void* ptr ) noexcept { counted_free( ptr ); }
+void operator delete[]( void* ptr ) noexcept { counted_free( ptr ); }
+void operator delete  ( void* ptr, size_t ) noexcept { counted_free( ptr ); }
+void operator delete[]( void* ptr, size_t ) noexcept { counted_free( ptr ); }
+void operator delete  ( void* ptr, std::align_val_t ) noexcept { counted_free( ptr ); }
+void operator delete[]( void* ptr, std::align_val_t ) noexcept { counted_free( ptr ); }
+void operator delete  ( void* ptr, size_t, std::align_val_t ) noexcept { counted_free( ptr ); }
+void operator delete[]( void* ptr, size_t, std::align_val_t ) noexcept { counted_free( ptr ); }
+void operator delete  ( void* ptr, const std::nothrow_t& ) noexcept { counted_free( ptr ); }
+void operator delete[]( void* ptr, const std::nothrow_t& ) noexcept { counted_free( ptr ); }
+void operator delete  ( void* ptr, std::align_val_t, const std::nothrow_t& ) noexcept {
+  counted_free( ptr );
+}
+void operator delete[]( void* ptr, std::align_val_t, const std::nothrow_t& ) noexcept {
+  counted_free( ptr );
+}
+
+#ifdef GAUXC_HAS_HOST
+TEST_CASE( "Memory Estimate", "[memory-estimate]" ) {
+
+  using matrix_type = Eigen::MatrixXd;
+  auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  auto mol   = make_water();
+  auto basis = make_ccpvdz( mol, SphericalType(true) );
+
+  random_test_densities dens( basis.nbf(), 17 );
+  const matrix_type& Ps = dens.Ps;
+  const matrix_type& Pz = dens.Pz;
+  auto lb = make_test_load_balancer( rt, mol, basis );
+
+  // The estimate models the per thread buffers of a single thread exactly
+#ifdef _OPENMP
+  omp_num_threads_guard omp_guard(1);
+#endif
+
+  MemoryEstimateSettings settings;
+  settings.nthreads = 1;
+
+  // The replicated outputs are Eigen matrices (malloc) and are not tracked
+  auto expected_bytes = [&]() {
+    auto est = estimate_memory( lb, settings );
+    REQUIRE( est.nthreads == 1 );
+    REQUIRE( est.rank_peak_bytes.size() == size_t(rt.comm_size()) );
+    CHECK( est.peak_bytes() >= est.call_bytes() );
+    size_t output_bytes = 0;
+    for( const auto& c : est.components )
+      if( c.name == "XCIntegrator.Output" ) output_bytes += c.bytes;
+    return est.call_bytes() - output_bytes;
+  };
+
+  SECTION( "Invalid Settings" ) {
+    settings.nspin = 3;
+    CHECK_THROWS( estimate_memory( lb, settings ) );
+    settings.nspin = 1;
+    settings.integrand  = XCIntegrand::EXC_Grad;
+    settings.func_class = XCFunctionalClass::MGGA;
+    CHECK_THROWS( estimate_memory( lb, settings ) );
+  }
+
+  SECTION( "EXC / VXC" ) {
+    using func_pair = std::pair<ExchCXX::Functional,XCFunctionalClass>;
+    for( auto [func_key, func_class] : { func_pair{ ExchCXX::Functional::SVWN5, XCFunctionalClass::LDA },
+                                         func_pair{ ExchCXX::Functional::PBE0,  XCFunctionalClass::GGA } } )
+    for( auto spin : { ExchCXX::Spin::Unpolarized, ExchCXX::Spin::Polarized } ) {
+      auto integrator = XCIntegratorFactory<matrix_type>( ExecutionSpace::Host,
+        "Replicated", "Default", "Default", "Default" ).get_instance(
+        functional_type( ExchCXX::Backend::builtin, func_key, spin ), lb );
+
+      settings.integrand  = XCIntegrand::EXC_VXC;
+      settings.func_class = func_class;
+      settings.nspin      = spin == ExchCXX::Spin::Unpolarized ? 1 : 2;
+
+      // The first invocation generates the task data held by the LoadBalancer
+      for( int irep = 0; irep < 2; ++irep ) {
+        const size_t expected = expected_bytes();
+        const size_t measured = measure_peak( [&]() {
+          if( settings.nspin == 1 ) integrator.eval_exc_vxc( Ps );
+          else                      integrator.eval_exc_vxc( Ps, Pz );
+        });
+        CHECK( measured <= 1.5 * expected );
+        CHECK( expected <= 3.0 * measured );
+      }
+    }
+  }
+
+  SECTION( "Density" ) {
+    auto integrator = XCIntegratorFactory<matrix_type>( ExecutionSpace::Host,
+      "Replicated", "Default", "Default", "Default" ).get_instance(
+      functional_type( ExchCXX::Backend::builtin, ExchCXX::Functional::PBE0,
+        ExchCXX::Spin::Unpolarized ), lb );
+
+    settings.integrand = XCIntegrand::Density;
+    const size_t expected = expected_bytes();
+    const size_t measured = measure_peak( [&]() { integrator.integrate_den( Ps ); } );
+    CHECK( measured <= 1.5 * expected );
+    CHECK( expected <= 3.0 * measured );
+  }
+
+  SECTION( "EXX" ) {
+    auto integrator = XCIntegratorFactory<matrix_type>( ExecutionSpace::Host,
+      "Replicated", "Default", "Default", "Default" ).get_instance(
+      functional_type( ExchCXX::Backend::builtin, ExchCXX::Functional::PBE0,
+        ExchCXX::Spin::Unpolarized ), lb );
+
+    // The EK dimensions are bounded by nbf, only check the bound
+    settings.integrand = XCIntegrand::EXX;
+    const size_t expected = expected_bytes();
+    const size_t measured = measure_peak( [&]() { integrator.eval_exx( Ps ); } );
+    CHECK( measured <= 1.5 * expected );
+  }
+
+}
+
+TEST_CASE( "Memory Estimate Threaded Runtime", "[memory-estimate]" ) {
+
+  auto mol   = make_water();
+  auto basis = make_ccpvdz( mol, SphericalType(true) );
+
+  // The per rank summary is gathered over the virtual ranks
+  const int nranks = 3;
+  std::vector<MemoryEstimate> estimates(nranks);
+  ThreadedRuntimeEnvironment::launch( nranks, [&]( const RuntimeEnvironment& rt ) {
+    // Molecular grids are stateful, each virtual rank requires its own
+    auto lb = make_test_load_balancer( rt, mol, basis );
+
+    MemoryEstimateSettings settings;
+    settings.integrand = XCIntegrand::EXC_VXC;
+    estimates[rt.comm_rank()] = estimate_memory( lb, settings );
+  });
+
+  size_t ntasks = 0;
+  for( int r = 0; r < nranks; ++r ) {
+    const auto& est = estimates[r];
+    REQUIRE( est.rank_peak_bytes.size() == size_t(nranks) );
+    CHECK( est.rank_peak_bytes == estimates[0].rank_peak_bytes );
+    CHECK( est.rank_ntasks     == estimates[0].rank_ntasks     );
+    CHECK( est.rank_task_cost  == estimates[0].rank_task_cost  );
+    CHECK( est.rank_peak_bytes[r] == est.peak_bytes() );
+    CHECK( est.rank_ntasks[r]     == est.ntasks );
+    ntasks += est.ntasks;
+  }
+  CHECK( ntasks > 0 );
+
+}
+#endif
@@ -0,0 +1,148 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+
+/**
+ *  Benchmark of the mixed precision host XC integration
+ *
+ *  Times eval_exc_vxc of the Default host integrator in full double and in
+ *  mixed precision (IntegratorSettingsKS::mixed_precision) for an RKS and a
+ *  UKS density and an LDA and a GGA functional. Reports the time of each,
+ *  the speedup and the EXC / VXC errors of the mixed precision results.
+ *
+ *  Usage: mixed_precision_bench [WATER|BENZENE|TAXOL|UBIQUITIN] [NREP]
+ */
+#include "standards.hpp"
+#include <gauxc/load_balancer.hpp>
+#include <gauxc/molecular_weights.hpp>
+#include <gauxc/molgrid/defaults.hpp>
+#include <gauxc/runtime_environment.hpp>
+#include <gauxc/xc_integrator.hpp>
+#include <gauxc/xc_integrator/impl.hpp>
+#include <gauxc/xc_integrator/integrator_factory.hpp>
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <random>
+
+using namespace GauXC;
+
+int main( int argc, char** argv ) {
+
+#ifdef GAUXC_HAS_MPI
+  MPI_Init( NULL, NULL );
+#endif
+  {
+
+  using matrix_type = Eigen::MatrixXd;
+
+  std::string mol_name = argc > 1 ? argv[1] : "BENZENE";
+  const int   nrep     = argc > 2 ? std::stoi(argv[2]) : 3;
+  std::transform( mol_name.begin(), mol_name.end(), mol_name.begin(), ::toupper );
+
+  std::map< std::string, Molecule(*)() > mol_map = {
+    { "WATER",     make_water     },
+    { "BENZENE",   make_benzene   },
+    { "TAXOL",     make_taxol     },
+    { "UBIQUITIN", make_ubiquitin }
+  };
+
+  auto rt    = RuntimeEnvironment( GAUXC_MPI_CODE(MPI_COMM_WORLD) );
+  auto mol   = mol_map.at(mol_name)();
+  auto basis = make_ccpvdz( mol, SphericalType(true) );
+  auto mg    = MolGridFactory::create_default_molgrid( mol, PruningScheme::Robust,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::UltraFineGrid );
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb = lb_factory.get_instance( rt, mol, mg, basis );
+  MolecularWeightsFactory mw_factory( ExecutionSpace::Host, "Default",
+    MolecularWeightsSettings{} );
+  mw_factory.get_instance().modify_weights( lb );
+
+  // Densities from random orbitals: Pa = Ca Ca**T, Pb = Cb Cb**T
+  const int64_t nbf  = basis.nbf();
+  const int64_t nel  = std::accumulate( mol.begin(), mol.end(), 0l,
+    []( auto a, const auto& b ){ return a + b.Z.get(); } );
+  const int64_t nocc = std::max<int64_t>( (nel + 1) / 2, 1 );
+
+  std::mt19937 gen(42);
+  std::normal_distribution<double> dist( 0., 1. / std::sqrt(double(nbf)) );
+  matrix_type C( nbf, nocc );
+  for( int64_t i = 0; i < C.size(); ++i ) C.data()[i] = dist(gen);
+  matrix_type Pa = C * C.transpose();
+  matrix_type Pb = C.leftCols( nocc - 1 ) * C.leftCols( nocc - 1 ).transpose();
+  matrix_type Ps = Pa + Pb;
+  matrix_type Pz = Pa - Pb;
+
+  IntegratorSettingsKS dp_settings, mp_settings;
+  mp_settings.mixed_precision = true;
+
+  std::cout << "MOLECULE = " << mol_name << ", NBF = " << nbf
+            << ", NTASKS = " << lb.get_tasks().size() << ", NREP = " << nrep
+            << std::endl;
+  std::cout << std::setw(10) << "FUNC" << std::setw(6) << "SPIN"
+            << std::setw(14) << "DOUBLE (s)" << std::setw(14) << "MIXED (s)"
+            << std::setw(12) << "SPEEDUP" << std::setw(14) << "|dEXC|"
+            << std::setw(14) << "max|dVXC|" << std::endl;
+
+  for( auto [name, func_key] :
+    std::vector<std::pair<std::string,ExchCXX::Functional>>{
+    {"SVWN5", ExchCXX::Functional::SVWN5},
+    {"PBE0",  ExchCXX::Functional::PBE0} } )
+  for( auto spin : { ExchCXX::Spin::Unpolarized, ExchCXX::Spin::Polarized } ) {
+
+    const bool rks = spin == ExchCXX::Spin::Unpolarized;
+    functional_type func( ExchCXX::Backend::builtin, func_key, spin );
+    XCIntegratorFactory<matrix_type> integrator_factory( ExecutionSpace::Host,
+      "Replicated", "Default", "Default", "Default" );
+    auto integrator = integrator_factory.get_instance( func, lb );
+
+    // EXC and VXC (VXCs for UKS) in the given precision
+    auto integrate = [&]( const IntegratorSettingsKS& settings ) {
+      if( rks ) return integrator.eval_exc_vxc( Ps, settings );
+      auto [ EXC, VXCs, VXCz ] = integrator.eval_exc_vxc( Ps, Pz, settings );
+      return std::make_tuple( EXC, VXCs );
+    };
+
+    double dp_time = 0., mp_time = 0.;
+    double exc_dp = 0., exc_mp = 0.;
+    matrix_type vxc_dp, vxc_mp;
+    for( int irep = 0; irep < nrep; ++irep ) {
+
+      auto st = std::chrono::high_resolution_clock::now();
+      std::tie( exc_dp, vxc_dp ) = integrate( dp_settings );
+      auto md = std::chrono::high_resolution_clock::now();
+      std::tie( exc_mp, vxc_mp ) = integrate( mp_settings );
+      auto en = std::chrono::high_resolution_clock::now();
+
+      dp_time += std::chrono::duration<double>( md - st ).count();
+      mp_time += std::chrono::duration<double>( en - md ).count();
+
+    }
+
+    std::cout << std::setw(10) << name << std::setw(6) << (rks ? "RKS" : "UKS")
+              << std::setw(14) << dp_time / nrep
+              << std::setw(14) << mp_time / nrep
+              << std::setw(12) << dp_time / mp_time
+              << std::setw(14) << std::abs( exc_mp - exc_dp )
+              << std::setw(14) << (vxc_mp - vxc_dp).cwiseAbs().maxCoeff()
+              << std::endl;
+
+  }
+
+  }
+#ifdef GAUXC_HAS_MPI
+  MPI_Finalize();
+#endif
+
+}
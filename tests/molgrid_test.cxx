@@ -458,4 +458,75 @@ TEST_CASE("MolGrid", "[molgrid]") {
 #endif
 
 
+TEST_CASE("Adaptive Pruning", "[molgrid]") {
+
+  SECTION("Promolecular Density") {
+    for( int64_t Z : {1, 6, 26, 54, 86} ) {
+      // Integrate 4 pi r**2 rho(r) with r = x / (1 - x)
+      const int n = 20000;
+      double nel = 0.;
+      for( int i = 0; i < n; ++i ) {
+        const double x  = (i + 0.5) / n;
+        const double r  = x / (1. - x);
+        const double dr = 1. / ((1. - x) * (1. - x) * n);
+        nel += 4. * M_PI * r * r * promolecular_density(AtomicNumber(Z), r) * dr;
+      }
+      CHECK( nel == Approx(Z).epsilon(1e-6) );
+    }
+  }
+
+  SECTION("TA Scaling Factors") {
+    for( int64_t Z = 1; Z <= 86; ++Z ) {
+      CHECK( default_ta_radial_scaling_factor(AtomicNumber(Z)).get() > 0. );
+    }
+    CHECK_THROWS( default_ta_radial_scaling_factor(AtomicNumber(87)) );
+  }
+
+  for( auto rq : {RadialQuad::MuraKnowles, RadialQuad::TreutlerAldrichs} )
+  for( int64_t _Z = 1; _Z <= 86; ++_Z ) {
+
+    AtomicNumber Z(_Z);
+    auto unp = MolGridFactory::create_default_unpruned_grid_spec( Z, rq,
+      AtomicGridSizeDefault::UltraFineGrid );
+    const size_t rsz = unp.radial_size.get();
+
+    auto gs = adaptive_pruning_scheme( Z, unp );
+    REQUIRE( gs.radial_quad  == unp.radial_quad  );
+    REQUIRE( gs.radial_size  == unp.radial_size  );
+    REQUIRE( gs.radial_scale == unp.radial_scale );
+
+    // Contiguous regions covering the radial quadrature
+    size_t idx = 0, npts = 0;
+    for( const auto& region : gs.pruning_regions ) {
+      REQUIRE( region.idx_st == idx );
+      REQUIRE( region.idx_en >  idx );
+      REQUIRE( region.angular_size.get() <= unp.angular_size.get() );
+      npts += (region.idx_en - region.idx_st) * region.angular_size.get();
+      idx = region.idx_en;
+    }
+    REQUIRE( idx == rsz );
 
+    // The core is pruned to the lowest order
+    CHECK( gs.pruning_regions.front().angular_size.get() == 26 );
+    CHECK( npts < rsz * unp.angular_size.get() );
+
+    // Tighter targets do not remove points
+    auto gs_tight = adaptive_pruning_scheme( Z, unp, 1e-11 );
+    size_t npts_tight = 0;
+    for( const auto& region : gs_tight.pruning_regions ) 
+      npts_tight += (region.idx_en - region.idx_st) * region.angular_size.get();
+    CHECK( npts_tight >= npts );
+
+    // Plugs into the MolGridFactory
+    auto gs_factory = MolGridFactory::create_default_pruned_grid_spec(
+      PruningScheme::Adaptive, Z, rq, AtomicGridSizeDefault::UltraFineGrid );
+    REQUIRE( std::get<PrunedAtomicGridSpecification>(gs_factory).pruning_regions ==
+      gs.pruning_regions );
+
+  }
+
+  CHECK_THROWS( create_pruned_spec( PruningScheme::Adaptive,
+    MolGridFactory::create_default_unpruned_grid_spec( AtomicNumber(6), 
+      RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid ) ) );
+
+}
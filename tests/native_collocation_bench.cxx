@@ -0,0 +1,143 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+
+/**
+ *  Per angular momentum benchmark of the native host collocation kernels
+ *
+ *  For each L (0-6) and shell type (Cartesian / spherical), builds a batch
+ *  of contracted shells on a few centers and times the gau2grid and native
+ *  evaluation of the collocation through derivative order 0-3 (and the
+ *  Laplacian) on a task sized block of points. Reports the time per call
+ *  of each backend, the speedup and the largest absolute deviation.
+ *
+ *  Usage: native_collocation_bench [NPTS] [NREP]
+ */
+#include "host/reference/collocation.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace GauXC;
+
+int main( int argc, char** argv ) {
+
+  const size_t npts = argc > 1 ? std::stoul(argv[1]) : 512;
+  const int    nrep = argc > 2 ? std::stoi(argv[2])  : 200;
+
+  // Contracted shells (3 primitives) on 4 centers with 3 shells / center
+  const std::vector<std::array<double,3>> centers = {
+    {0.0, 0.0, 0.0}, {1.4, 0.0, 0.0}, {0.0, 1.8, 0.3}, {-0.9, -0.6, 1.2}
+  };
+  const std::vector<std::array<double,3>> exponents = {
+    {8.0, 1.6, 0.4}, {2.0, 0.6, 0.2}, {0.9, 0.3, 0.1}
+  };
+
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist( -3., 3. );
+  std::vector<double> points( 3 * npts );
+  for( auto& p : points ) p = dist(gen);
+
+  std::cout << "NPTS = " << npts << ", NREP = " << nrep << std::endl;
+  std::cout << std::setw(4) << "L" << std::setw(6) << "TYPE"
+            << std::setw(10) << "DERIV" << std::setw(16) << "G2G (us)"
+            << std::setw(16) << "NATIVE (us)" << std::setw(12) << "SPEEDUP"
+            << std::setw(14) << "MAX |DIFF|" << std::endl;
+
+  for( int l = 0; l <= 6; ++l )
+  for( bool pure : { false, true } ) {
+
+    BasisSet<double> basis;
+    for( const auto& O : centers )
+    for( const auto& a : exponents ) {
+      Shell<double>::prim_array alpha{}, coeff{};
+      for( int i = 0; i < 3; ++i ) { alpha[i] = a[i]; coeff[i] = 1.; }
+      basis.emplace_back( PrimSize(3), AngularMomentum(l), SphericalType(pure),
+        alpha, coeff, O );
+    }
+
+    const size_t nshells = basis.size();
+    std::vector<int32_t> shell_list( nshells );
+    for( size_t i = 0; i < nshells; ++i ) shell_list[i] = i;
+    const size_t nbe = basis.nbf();
+
+    // Output arrays: [0,20) for the gau2grid and [20,40) for the native kernels
+    std::vector<std::vector<double>> v( 40, std::vector<double>(npts * nbe) );
+    auto out = [&]( bool native, int i ){ return v[20*native + i].data(); };
+
+    using coll_fn = std::function<void(bool)>;
+    const CollocationScreening screen;
+    const auto* pts = points.data();
+    const auto* sl  = shell_list.data();
+
+    std::vector<std::tuple<std::string,int,coll_fn>> variants = {
+      { "VALUE", 1, [&]( bool native ) {
+        auto o = [&]( int i ){ return out( native, i ); };
+        (native ? native_collocation : gau2grid_collocation)( npts, nshells,
+          nbe, pts, basis, sl, o(0), screen );
+      }},
+      { "GRADIENT", 4, [&]( bool native ) {
+        auto o = [&]( int i ){ return out( native, i ); };
+        (native ? native_collocation_gradient : gau2grid_collocation_gradient)(
+          npts, nshells, nbe, pts, basis, sl, o(0), o(1), o(2), o(3), screen );
+      }},
+      { "HESSIAN", 10, [&]( bool native ) {
+        auto o = [&]( int i ){ return out( native, i ); };
+        (native ? native_collocation_hessian : gau2grid_collocation_hessian)(
+          npts, nshells, nbe, pts, basis, sl, o(0), o(1), o(2), o(3), o(4),
+          o(5), o(6), o(7), o(8), o(9), screen );
+      }},
+      { "LAPLACIAN", 5, [&]( bool native ) {
+        auto o = [&]( int i ){ return out( native, i ); };
+        (native ? native_collocation_laplacian : gau2grid_collocation_laplacian)(
+          npts, nshells, nbe, pts, basis, sl, o(0), o(1), o(2), o(3), o(4),
+          screen );
+      }},
+      { "DER3", 20, [&]( bool native ) {
+        auto o = [&]( int i ){ return out( native, i ); };
+        (native ? native_collocation_der3 : gau2grid_collocation_der3)(
+          npts, nshells, nbe, pts, basis, sl, o(0), o(1), o(2), o(3), o(4),
+          o(5), o(6), o(7), o(8), o(9), o(10), o(11), o(12), o(13), o(14),
+          o(15), o(16), o(17), o(18), o(19), screen );
+      }}
+    };
+
+    for( auto& [name, ncomp, fn] : variants ) {
+
+      double t[2];
+      for( int native = 0; native < 2; ++native ) {
+        fn( native ); // Warmup
+        auto st = std::chrono::high_resolution_clock::now();
+        for( int irep = 0; irep < nrep; ++irep ) fn( native );
+        auto en = std::chrono::high_resolution_clock::now();
+        t[native] = 1e6 * std::chrono::duration<double>( en - st ).count() / nrep;
+      }
+
+      double max_diff = 0.;
+      for( int k = 0; k < ncomp; ++k )
+      for( size_t i = 0; i < npts * nbe; ++i )
+        max_diff = std::max( max_diff, std::abs( v[k][i] - v[20+k][i] ) );
+
+      std::cout << std::setw(4) << l << std::setw(6) << (pure ? "SPH" : "CART")
+                << std::setw(10) << name << std::setw(16) << t[0]
+                << std::setw(16) << t[1] << std::setw(12) << t[0] / t[1]
+                << std::setw(14) << max_diff << std::endl;
+
+    }
+
+  }
+
+}
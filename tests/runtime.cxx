@@ -7,6 +7,7 @@
  */
 #include "ut_common.hpp"
 #include <gauxc/runtime_environment.hpp>
+#include <gauxc/reduction_driver.hpp>
 #include <gauxc/exceptions.hpp>
 
 using namespace GauXC;
@@ -56,6 +57,39 @@ TEST_CASE("Runtime", "[runtime]") {
        test_basic_check<RuntimeEnvironment>(GAUXC_MPI_CODE(MPI_COMM_WORLD)); 
     }
 
+    SECTION("Host Placement") {
+      // Default policy leaves the threading environment untouched
+      auto rt_default = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+      REQUIRE( rt_default.host_placement_policy().nthreads == 0 );
+      REQUIRE( rt_default.host_placement_policy().binding == ThreadBinding::Inherit );
+      REQUIRE( rt_default.host_placement_policy().placement == MemoryPlacement::Inherit );
+      const auto nthreads_orig = rt_default.host_placement().nthreads;
+
+      // Thread binding is not exercised here as it would pin the test process
+      HostPlacementPolicy policy{ 2, ThreadBinding::Inherit, MemoryPlacement::FirstTouch };
+      auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD,) policy);
+      REQUIRE( rt.host_placement_policy().nthreads == 2 );
+      REQUIRE( rt.host_placement_policy().placement == MemoryPlacement::FirstTouch );
+
+      auto placement = rt.host_placement();
+      #ifdef _OPENMP
+      REQUIRE( placement.nthreads == 2 );
+      #else
+      REQUIRE( placement.nthreads == 1 );
+      #endif
+      REQUIRE( placement.thread_cpus.size()  == size_t(placement.nthreads) );
+      REQUIRE( placement.thread_nodes.size() == size_t(placement.nthreads) );
+      REQUIRE( placement.nnuma_nodes >= 1 );
+      REQUIRE( placement.threads_per_node.size() == size_t(placement.nnuma_nodes) );
+
+      HostPlacementPolicy bad_policy{ -1 };
+      REQUIRE_THROWS( RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD,) bad_policy) );
+
+      // Restore the original thread count
+      RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD,) 
+        HostPlacementPolicy{ nthreads_orig } );
+    }
+
     #ifdef GAUXC_HAS_DEVICE
     SECTION("Device") {
 
@@ -143,3 +177,163 @@ TEST_CASE("Runtime", "[runtime]") {
     }
     #endif
 }
+
+
+void test_packed_reduction( std::string kernel_name ) {
+
+  RuntimeEnvironment rt(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+  auto rd = ReductionDriverFactory::get_shared_instance(rt, kernel_name);
+
+  const int    world_size = rt.comm_size();
+  const size_t n = 5, ld = 7;
+
+  // Symmetric matrix with padding, only the LT holds valid data
+  std::vector<double> A(ld*n, -1.0), B(3);
+  for( size_t j = 0; j < n; ++j )
+  for( size_t i = j; i < n; ++i ) A[i + j*ld] = i + j*n + 1.0;
+  double scalar = 2.0;
+  for( size_t i = 0; i < B.size(); ++i ) B[i] = i;
+
+  auto check = [&]() {
+    for( size_t j = 0; j < n; ++j )
+    for( size_t i = 0; i < n; ++i ) {
+      const auto ii = std::max(i,j), jj = std::min(i,j);
+      CHECK( A[i + j*ld] == Approx( world_size * (ii + jj*n + 1.0) ) );
+    }
+    // Padding is untouched
+    for( size_t j = 0; j < n; ++j )
+    for( size_t i = n; i < ld; ++i ) CHECK( A[i + j*ld] == -1.0 );
+    CHECK( scalar == Approx( world_size * 2.0 ) );
+    for( size_t i = 0; i < B.size(); ++i ) 
+      CHECK( B[i] == Approx( world_size * i ) );
+  };
+
+  std::vector<ReductionBuffer> buffers = {
+    ReductionBuffer::symmetric_matrix( A.data(), n, ld ),
+    ReductionBuffer::scalar( &scalar ),
+    ReductionBuffer::vector( B.data(), B.size() )
+  };
+
+  SECTION("Blocking") {
+    rd->allreduce_packed<double>( buffers, ReductionOp::Sum );
+    check();
+  }
+
+  SECTION("Non-Blocking") {
+    auto req = rd->iallreduce_packed<double>( buffers, ReductionOp::Sum );
+    req.wait();
+    CHECK( req.test() );
+    check();
+  }
+
+  SECTION("Overlapping Non-Blocking") {
+    std::vector<double> C(1000, 1.0);
+    auto req = rd->iallreduce_packed<double>( buffers, ReductionOp::Sum );
+    auto req_c = rd->iallreduce_packed<double>( 
+      { ReductionBuffer::vector( C.data(), C.size() ) }, ReductionOp::Sum );
+    while( not req_c.test() );
+    req.wait();
+    check();
+    for( auto c : C ) CHECK( c == world_size );
+  }
+
+  SECTION("Node-Shared") {
+    if( not rd->supports_node_shared() ) {
+      CHECK_THROWS( rd->node_shared_buffer<double>( n*n ) );
+      return;
+    }
+
+    // Dense blocks of A / scalar / B, every rank accumulates its copy
+    auto* node = rd->node_shared_buffer<double>( n*n + 1 + B.size() );
+    for( size_t j = 0; j < n; ++j )
+    for( size_t i = j; i < n; ++i ) {
+      #pragma omp atomic
+      node[i + j*n] += A[i + j*ld];
+    }
+    #pragma omp atomic
+    node[n*n] += scalar;
+    for( size_t i = 0; i < B.size(); ++i ) {
+      #pragma omp atomic
+      node[n*n + 1 + i] += B[i];
+    }
+
+    rd->reduce_node_shared<double>( buffers, ReductionOp::Sum );
+    check();
+  }
+
+}
+
+TEST_CASE("Reduction Driver", "[runtime]") {
+
+  SECTION("Default") { test_packed_reduction("Default"); }
+
+  #ifdef GAUXC_HAS_MPI
+  SECTION("Hierarchical") { test_packed_reduction("Hierarchical"); }
+  #endif
+
+}
+
+
+TEST_CASE("Threaded Runtime", "[runtime]") {
+
+  const int nranks = 4;
+  const size_t n = 64;
+
+  std::vector<int> ranks(nranks, -1), sizes(nranks, -1);
+  std::vector<std::vector<double>> results(nranks);
+  std::vector<double> scalars(nranks);
+
+  ThreadedRuntimeEnvironment::launch( nranks, [&]( const RuntimeEnvironment& rt ){
+    const auto rank = rt.comm_rank();
+    ranks[rank] = rank;
+    sizes[rank] = rt.comm_size();
+
+    auto rd = ReductionDriverFactory::get_shared_instance(rt, "Default");
+    std::vector<double> A(n*n);
+    for( size_t j = 0; j < n; ++j )
+    for( size_t i = 0; i < n; ++i ) 
+      A[i + j*n] = (rank + 1) * (std::min(i,j) + 1.0);
+    double scalar = rank;
+
+    rd->allreduce_inplace( A.data(), A.size(), ReductionOp::Sum );
+    auto req = rd->iallreduce_packed<double>( 
+      { ReductionBuffer::scalar(&scalar) }, ReductionOp::Sum );
+    req.wait();
+
+    results[rank] = std::move(A);
+    scalars[rank] = scalar;
+  });
+
+  const double rank_sum = nranks * (nranks+1) / 2;
+  for( int r = 0; r < nranks; ++r ) {
+    CHECK( ranks[r] == r );
+    CHECK( sizes[r] == nranks );
+    CHECK( scalars[r] == nranks * (nranks-1) / 2 );
+    // Bitwise identical on all ranks
+    CHECK( results[r] == results[0] );
+    for( size_t j = 0; j < n; ++j )
+    for( size_t i = 0; i < n; ++i )
+      CHECK( results[r][i + j*n] == Approx( rank_sum * (std::min(i,j) + 1.0) ) );
+  }
+
+  // Exceptions are propagated to the calling thread
+  CHECK_THROWS( ThreadedRuntimeEnvironment::launch( 2, []( const RuntimeEnvironment& rt ) {
+    if( rt.comm_rank() == 1 ) GAUXC_GENERIC_EXCEPTION("Rank Failure");
+  }));
+
+  // A failure outside of a collective releases the ranks blocked in it, and
+  // the original failure is propagated
+  for( int failed_rank : { 0, nranks-1 } ) {
+    std::vector<int> reached(nranks, 0);
+    CHECK_THROWS_WITH( ThreadedRuntimeEnvironment::launch( nranks, 
+      [&]( const RuntimeEnvironment& rt ) {
+        if( rt.comm_rank() == failed_rank ) GAUXC_GENERIC_EXCEPTION("Rank Failure");
+        auto rd = ReductionDriverFactory::get_shared_instance(rt, "Default");
+        std::vector<double> A(n, 1.);
+        rd->allreduce_inplace( A.data(), A.size(), ReductionOp::Sum );
+        reached[rt.comm_rank()] = 1;
+      }), Catch::Contains("Rank Failure") );
+    CHECK( std::count( reached.begin(), reached.end(), 1 ) == 0 );
+  }
+
+}
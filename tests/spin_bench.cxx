@@ -0,0 +1,140 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+
+/**
+ *  Benchmark of the cost of the two-component (GKS) host XC integration
+ *
+ *  Times eval_exc_vxc of the Default host integrator for a UKS density and
+ *  for the same (collinear) density rotated onto an oblique spin axis and
+ *  passed as a GKS density, for a GGA, a tau-only and a Laplacian dependent
+ *  MGGA. Reports the time of each and the GKS / UKS ratio along with the
+ *  EXC difference (which should vanish).
+ *
+ *  Usage: spin_bench [WATER|BENZENE|TAXOL|UBIQUITIN] [NREP]
+ */
+#include "standards.hpp"
+#include <gauxc/load_balancer.hpp>
+#include <gauxc/molecular_weights.hpp>
+#include <gauxc/molgrid/defaults.hpp>
+#include <gauxc/runtime_environment.hpp>
+#include <gauxc/xc_integrator.hpp>
+#include <gauxc/xc_integrator/impl.hpp>
+#include <gauxc/xc_integrator/integrator_factory.hpp>
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <random>
+
+using namespace GauXC;
+
+int main( int argc, char** argv ) {
+
+#ifdef GAUXC_HAS_MPI
+  MPI_Init( NULL, NULL );
+#endif
+  {
+
+  using matrix_type = Eigen::MatrixXd;
+
+  std::string mol_name = argc > 1 ? argv[1] : "BENZENE";
+  const int   nrep     = argc > 2 ? std::stoi(argv[2]) : 3;
+  std::transform( mol_name.begin(), mol_name.end(), mol_name.begin(), ::toupper );
+
+  std::map< std::string, Molecule(*)() > mol_map = {
+    { "WATER",     make_water     },
+    { "BENZENE",   make_benzene   },
+    { "TAXOL",     make_taxol     },
+    { "UBIQUITIN", make_ubiquitin }
+  };
+
+  auto rt    = RuntimeEnvironment( GAUXC_MPI_CODE(MPI_COMM_WORLD) );
+  auto mol   = mol_map.at(mol_name)();
+  auto basis = make_ccpvdz( mol, SphericalType(true) );
+  auto mg    = MolGridFactory::create_default_molgrid( mol, PruningScheme::Robust,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::UltraFineGrid );
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb = lb_factory.get_instance( rt, mol, mg, basis );
+  MolecularWeightsFactory mw_factory( ExecutionSpace::Host, "Default",
+    MolecularWeightsSettings{} );
+  mw_factory.get_instance().modify_weights( lb );
+
+  // Doublet-like densities from random orbitals: Pa = Ca Ca**T, Pb = Cb Cb**T
+  const int64_t nbf  = basis.nbf();
+  const int64_t nel  = std::accumulate( mol.begin(), mol.end(), 0l,
+    []( auto a, const auto& b ){ return a + b.Z.get(); } );
+  const int64_t nocc = std::max<int64_t>( (nel + 1) / 2, 1 );
+
+  std::mt19937 gen(42);
+  std::normal_distribution<double> dist( 0., 1. / std::sqrt(double(nbf)) );
+  matrix_type C( nbf, nocc );
+  for( int64_t i = 0; i < C.size(); ++i ) C.data()[i] = dist(gen);
+  matrix_type Pa = C * C.transpose();
+  matrix_type Pb = C.leftCols( nocc - 1 ) * C.leftCols( nocc - 1 ).transpose();
+
+  matrix_type Ps = Pa + Pb;
+  matrix_type Pz = Pa - Pb;
+
+  // Same magnetization along n = (z,y,x)
+  const double n[3] = { 0.48, 0.6, 0.64 };
+  matrix_type Pz_n = n[0] * Pz, Py_n = n[1] * Pz, Px_n = n[2] * Pz;
+
+  std::cout << "MOLECULE = " << mol_name << ", NBF = " << nbf
+            << ", NTASKS = " << lb.get_tasks().size() << ", NREP = " << nrep
+            << std::endl;
+  std::cout << std::setw(10) << "FUNC" << std::setw(16) << "UKS (s)"
+            << std::setw(16) << "GKS (s)" << std::setw(16) << "GKS / UKS"
+            << std::setw(16) << "|dEXC|" << std::endl;
+
+  for( auto [name, func_key] :
+    std::vector<std::pair<std::string,ExchCXX::Functional>>{
+    {"BLYP",    ExchCXX::Functional::BLYP},
+    {"SCAN",    ExchCXX::Functional::SCAN},
+    {"R2SCANL", ExchCXX::Functional::R2SCANL} } ) {
+
+    functional_type func( ExchCXX::Backend::builtin, func_key,
+      ExchCXX::Spin::Polarized );
+    XCIntegratorFactory<matrix_type> integrator_factory( ExecutionSpace::Host,
+      "Replicated", "Default", "Default", "Default" );
+    auto integrator = integrator_factory.get_instance( func, lb );
+
+    double uks_time = 0., gks_time = 0., exc_uks = 0., exc_gks = 0.;
+    for( int irep = 0; irep < nrep; ++irep ) {
+
+      auto st = std::chrono::high_resolution_clock::now();
+      exc_uks = std::get<0>( integrator.eval_exc_vxc( Ps, Pz ) );
+      auto md = std::chrono::high_resolution_clock::now();
+      exc_gks = std::get<0>( integrator.eval_exc_vxc( Ps, Pz_n, Py_n, Px_n ) );
+      auto en = std::chrono::high_resolution_clock::now();
+
+      uks_time += std::chrono::duration<double>( md - st ).count();
+      gks_time += std::chrono::duration<double>( en - md ).count();
+
+    }
+
+    std::cout << std::setw(10) << name
+              << std::setw(16) << uks_time / nrep
+              << std::setw(16) << gks_time / nrep
+              << std::setw(16) << gks_time / uks_time
+              << std::setw(16) << std::abs( exc_gks - exc_uks )
+              << std::endl;
+
+  }
+
+  }
+#ifdef GAUXC_HAS_MPI
+  MPI_Finalize();
+#endif
+
+}
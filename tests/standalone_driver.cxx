@@ -8,6 +8,7 @@
 #include <gauxc/xc_integrator.hpp>
 #include <gauxc/xc_integrator/impl.hpp>
 #include <gauxc/xc_integrator/integrator_factory.hpp>
+#include <gauxc/xc_integrator/memory_estimate.hpp>
 #include <gauxc/util/div_ceil.hpp>
 #include <gauxc/runtime_environment.hpp>
 #include <gauxc/molecular_weights.hpp>
@@ -31,21 +32,49 @@ int main(int argc, char** argv) {
 #endif
   {
 
+    std::vector< std::string > opts( argc );
+    for( int i = 0; i < argc; ++i ) opts[i] = argv[i];
+
+    auto input_file = opts.at(1);
+    INIFile input(input_file);
+
+    // Host thread / memory placement
+    HostPlacementPolicy host_policy;
+    std::string thread_binding   = "INHERIT";
+    std::string memory_placement = "INHERIT";
+    if( input.containsData("GAUXC.NTHREADS") )
+      host_policy.nthreads = input.getData<int>("GAUXC.NTHREADS");
+    if( input.containsData("GAUXC.THREAD_BINDING") )
+      thread_binding = input.getData<std::string>("GAUXC.THREAD_BINDING");
+    if( input.containsData("GAUXC.MEMORY_PLACEMENT") )
+      memory_placement = input.getData<std::string>("GAUXC.MEMORY_PLACEMENT");
+    std::transform( thread_binding.begin(), thread_binding.end(), 
+      thread_binding.begin(), ::toupper );
+    std::transform( memory_placement.begin(), memory_placement.end(), 
+      memory_placement.begin(), ::toupper );
+
+    std::map< std::string, ThreadBinding > binding_map = {
+      {"INHERIT", ThreadBinding::Inherit},
+      {"COMPACT", ThreadBinding::Compact},
+      {"SCATTER", ThreadBinding::Scatter}
+    };
+    std::map< std::string, MemoryPlacement > placement_map = {
+      {"INHERIT",     MemoryPlacement::Inherit},
+      {"FIRST_TOUCH", MemoryPlacement::FirstTouch},
+      {"INTERLEAVE",  MemoryPlacement::Interleave}
+    };
+    host_policy.binding   = binding_map.at(thread_binding);
+    host_policy.placement = placement_map.at(memory_placement);
+
     // Set up runtimes
     #ifdef GAUXC_HAS_DEVICE
     auto rt = DeviceRuntimeEnvironment( GAUXC_MPI_CODE(MPI_COMM_WORLD,) 0.9 );
     #else
-    auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+    auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD,) host_policy);
     #endif
     auto world_rank = rt.comm_rank();
     auto world_size = rt.comm_size();
 
-    std::vector< std::string > opts( argc );
-    for( int i = 0; i < argc; ++i ) opts[i] = argv[i];
-
-    auto input_file = opts.at(1);
-    INIFile input(input_file);
-
     // Require Ref file
     auto ref_file = input.getData<std::string>("GAUXC.REF_FILE");
 
@@ -57,8 +86,11 @@ int main(int argc, char** argv) {
     std::string integrator_kernel  = "Default";
     std::string lwd_kernel         = "Default";
     std::string reduction_kernel   = "Default";
+    std::string batch_partitioner  = "Spherical";
+    std::string task_scratch_dir;
 
     size_t      batch_size = 512;
+    size_t      task_chunk_size = 64 * 1024 * 1024;
     double      basis_tol  = 1e-10;
     std::string func_spec  = "PBE0";
 
@@ -67,6 +99,9 @@ int main(int argc, char** argv) {
     bool integrate_exx      = false;
     bool integrate_exc_grad = false;
 
+    bool dry_run          = false;
+    int  dry_run_nthreads = 0;
+
     auto string_to_upper = []( auto& str ) {
       std::transform( str.begin(), str.end(), str.begin(), ::toupper );
     };
@@ -84,6 +119,8 @@ int main(int argc, char** argv) {
     OPTIONAL_KEYWORD( "GAUXC.INTEGRATOR_KERNEL", integrator_kernel,  std::string );
     OPTIONAL_KEYWORD( "GAUXC.LWD_KERNEL",        lwd_kernel,         std::string );
     OPTIONAL_KEYWORD( "GAUXC.REDUCTION_KERNEL",  reduction_kernel,   std::string );
+    OPTIONAL_KEYWORD( "GAUXC.BATCH_PARTITIONER", batch_partitioner,  std::string );
+    OPTIONAL_KEYWORD( "GAUXC.TASK_SCRATCH_DIR",  task_scratch_dir,   std::string );
     string_to_upper( grid_spec          );
     string_to_upper( func_spec          );
     string_to_upper( prune_spec         );
@@ -92,18 +129,27 @@ int main(int argc, char** argv) {
     string_to_upper( integrator_kernel  );
     string_to_upper( lwd_kernel         );
     string_to_upper( reduction_kernel   );
+    string_to_upper( batch_partitioner  );
 
     OPTIONAL_KEYWORD( "GAUXC.BATCH_SIZE",     batch_size, size_t );
     OPTIONAL_KEYWORD( "GAUXC.BASIS_TOL",      basis_tol,  double );
+    OPTIONAL_KEYWORD( "GAUXC.TASK_CHUNK_SIZE", task_chunk_size, size_t );
 
     OPTIONAL_KEYWORD( "GAUXC.INTEGRATE_DEN",      integrate_den,      bool );
     OPTIONAL_KEYWORD( "GAUXC.INTEGRATE_VXC",      integrate_vxc,      bool );
     OPTIONAL_KEYWORD( "GAUXC.INTEGRATE_EXX",      integrate_exx,      bool );
     OPTIONAL_KEYWORD( "GAUXC.INTEGRATE_EXC_GRAD", integrate_exc_grad, bool );
 
+    OPTIONAL_KEYWORD( "GAUXC.DRY_RUN",          dry_run,          bool );
+    OPTIONAL_KEYWORD( "GAUXC.DRY_RUN_NTHREADS", dry_run_nthreads, int  );
+
     IntegratorSettingsSNLinK sn_link_settings;
     OPTIONAL_KEYWORD( "EXX.TOL_E", sn_link_settings.energy_tol, double );
     OPTIONAL_KEYWORD( "EXX.TOL_K", sn_link_settings.k_tol,      double );
+    OPTIONAL_KEYWORD( "EXX.OMEGA",       sn_link_settings.omega,             double );
+    OPTIONAL_KEYWORD( "EXX.FULL_RANGE",  sn_link_settings.full_range_coeff,  double );
+    OPTIONAL_KEYWORD( "EXX.LONG_RANGE",  sn_link_settings.long_range_coeff,  double );
+    OPTIONAL_KEYWORD( "EXX.SHORT_RANGE", sn_link_settings.short_range_coeff, double );
 
 
     #ifdef GAUXC_HAS_DEVICE
@@ -126,6 +172,7 @@ int main(int argc, char** argv) {
                 << "  GRID              = " << grid_spec << std::endl
                 << "  PRUNING_SCHEME    = " << prune_spec << std::endl
                 << "  BATCH_SIZE        = " << batch_size << std::endl
+                << "  BATCH_PARTITIONER = " << batch_partitioner << std::endl
                 << "  BASIS_TOL         = " << basis_tol << std::endl
                 << "  FUNCTIONAL        = " << func_spec << std::endl
                 << "  LB_EXEC_SPACE     = " << lb_exec_space_str << std::endl
@@ -136,12 +183,35 @@ int main(int argc, char** argv) {
                 << "  DEN (?)           = " << integrate_den << std::endl
                 << "  VXC (?)           = " << integrate_vxc << std::endl
                 << "  EXX (?)           = " << integrate_exx << std::endl
-                << "  EXC_GRAD (?)      = " << integrate_exc_grad << std::endl;
+                << "  EXC_GRAD (?)      = " << integrate_exc_grad << std::endl
+                << "  DRY_RUN (?)       = " << dry_run << std::endl;
+                if( task_scratch_dir.size() )
+                std::cout << "  TASK_SCRATCH_DIR  = " << task_scratch_dir << std::endl
+                          << "  TASK_CHUNK_SIZE   = " << task_chunk_size << std::endl;
+
+                auto placement = rt.host_placement();
+                std::cout << "  NTHREADS          = " << placement.nthreads << std::endl
+                          << "  THREAD_BINDING    = " << thread_binding << std::endl
+                          << "  MEMORY_PLACEMENT  = " << memory_placement << std::endl
+                          << "  NUMA_NODES        = " << placement.nnuma_nodes << std::endl
+                          << "  THREADS_PER_NODE  =";
+                for( auto n : placement.threads_per_node ) std::cout << " " << n;
+                std::cout << std::endl << "  THREAD_CPUS       =";
+                for( auto c : placement.thread_cpus ) std::cout << " " << c;
+                std::cout << std::endl;
                 if(integrate_exx) {
                   std::cout << "  EXX.TOL_E         = " 
                             << sn_link_settings.energy_tol << std::endl
                             << "  EXX.TOL_K         = " 
-                            << sn_link_settings.k_tol << std::endl;
+                            << sn_link_settings.k_tol << std::endl
+                            << "  EXX.OMEGA         = " 
+                            << sn_link_settings.omega << std::endl
+                            << "  EXX.FULL_RANGE    = " 
+                            << sn_link_settings.full_range_coeff << std::endl
+                            << "  EXX.LONG_RANGE    = " 
+                            << sn_link_settings.long_range_coeff << std::endl
+                            << "  EXX.SHORT_RANGE   = " 
+                            << sn_link_settings.short_range_coeff << std::endl;
                 }
                 std::cout << std::endl;
     }
@@ -167,7 +237,8 @@ int main(int argc, char** argv) {
     std::map< std::string, PruningScheme > prune_map = {
       {"UNPRUNED", PruningScheme::Unpruned},
       {"ROBUST",   PruningScheme::Robust},
-      {"TREUTLER", PruningScheme::Treutler}
+      {"TREUTLER", PruningScheme::Treutler},
+      {"ADAPTIVE", PruningScheme::Adaptive}
     };
 
     auto mg = MolGridFactory::create_default_molgrid(mol, 
@@ -186,12 +257,35 @@ int main(int argc, char** argv) {
     LoadBalancerFactory lb_factory( lb_exec_space, "Replicated");
     auto lb = lb_factory.get_shared_instance( rt, mol, mg, basis);
 
+    std::map< std::string, BatchPartitioner > partitioner_map = {
+      {"SPHERICAL", BatchPartitioner::Spherical},
+      {"OCTREE",    BatchPartitioner::Octree},
+      {"BISECTION", BatchPartitioner::Bisection}
+    };
+    lb->state().batch_partitioner = partitioner_map.at(batch_partitioner);
+    lb->state().task_scratch_dir  = task_scratch_dir;
+    lb->state().task_chunk_size   = task_chunk_size;
+
     // Apply molecular partition weights
     MolecularWeightsFactory mw_factory( int_exec_space, "Default", 
       MolecularWeightsSettings{} );
     auto mw = mw_factory.get_instance();
     mw.modify_weights(*lb);
 
+    // Batch quality (local tasks)
+    if( !world_rank ) {
+      size_t npts = 0;
+      for( const auto& task : lb->get_tasks() ) npts += task.npts;
+      std::cout << "LOAD BALANCER BATCHES (RANK 0):" << std::endl
+                << "  NTASKS            = " << lb->get_tasks().size() << std::endl
+                << "  NPTS              = " << npts << std::endl
+                << "  MAX_NPTS          = " << lb->max_npts() << std::endl
+                << "  MAX_NBE           = " << lb->max_nbe() << std::endl
+                << "  MEAN_NBE          = " << lb->mean_nbe() << std::endl
+                << "  MODELED_COST      = " << lb->total_exc_vxc_cost() << std::endl
+                << std::endl;
+    }
+
     using matrix_type = Eigen::MatrixXd;
     // Read in reference data
     matrix_type P, Pz, Py, Px, VXC_ref, VXCz_ref, VXCy_ref, VXCx_ref, K_ref;
@@ -343,6 +437,61 @@ int main(int argc, char** argv) {
       func = functional_type(funcs);
     }
 
+    // Dry run: report the predicted memory of the requested integrations
+    // and exit without performing them
+    if( dry_run ) {
+
+      MemoryEstimateSettings est_settings;
+      est_settings.nspin    = rks ? 1 : (uks ? 2 : 4);
+      est_settings.nthreads = dry_run_nthreads;
+      est_settings.func_class = func.is_lda() ? XCFunctionalClass::LDA :
+                                func.is_gga() ? XCFunctionalClass::GGA :
+                                func.needs_laplacian() ? 
+                                  XCFunctionalClass::MGGA_Laplacian :
+                                  XCFunctionalClass::MGGA;
+
+      std::vector<std::pair<std::string,XCIntegrand>> integrands;
+      if( integrate_den ) integrands.push_back({"DEN", XCIntegrand::Density});
+      if( integrate_vxc ) integrands.push_back({"EXC_VXC", XCIntegrand::EXC_VXC});
+      if( integrate_exc_grad ) 
+        integrands.push_back({"EXC_GRAD", XCIntegrand::EXC_Grad});
+      if( integrate_exx ) integrands.push_back({"EXX", XCIntegrand::EXX});
+
+      auto to_mib = []( size_t bytes ){ return bytes / (1024. * 1024.); };
+      for( const auto& [name, integrand] : integrands ) {
+        est_settings.integrand = integrand;
+        auto est = estimate_memory( *lb, est_settings );
+        if( world_rank ) continue;
+
+        std::cout << std::fixed << std::setprecision(3);
+        std::cout << "MEMORY ESTIMATE (" << name << ", MiB):" << std::endl
+                  << "  NTHREADS          = " << est.nthreads << std::endl;
+        for( const auto& c : est.components ) {
+          std::cout << "  " << std::setw(30) << std::left << c.name << std::right
+                    << ": " << std::setw(12) << to_mib(c.bytes);
+          if( c.per_thread ) std::cout << " (PER THREAD)";
+          if( c.allocated  ) std::cout << " (HELD BY LB)";
+          if( c.phase      ) std::cout << " (PHASE " << c.phase << ")";
+          std::cout << std::endl;
+        }
+        std::cout << "  PEAK PER THREAD   = " << to_mib(est.per_thread_bytes()) << std::endl
+                  << "  PEAK (CALL)       = " << to_mib(est.call_bytes()) << std::endl
+                  << "  PEAK (TOTAL)      = " << to_mib(est.peak_bytes()) << std::endl;
+        for( size_t i = 0; i < est.rank_peak_bytes.size(); ++i )
+          std::cout << "  RANK " << std::setw(12) << std::left << i << std::right
+                    << " = " << std::setw(12) << to_mib(est.rank_peak_bytes[i])
+                    << " NTASKS = " << est.rank_ntasks[i] 
+                    << " MODELED_COST = " << est.rank_task_cost[i] << std::endl;
+        std::cout << std::endl;
+      }
+
+#ifdef GAUXC_HAS_MPI
+      MPI_Finalize();
+#endif
+      return 0;
+
+    }
+
     // Setup Integrator
     XCIntegratorFactory<matrix_type> integrator_factory( int_exec_space , 
       "Replicated", integrator_kernel, lwd_kernel, reduction_kernel );
@@ -397,12 +546,10 @@ int main(int argc, char** argv) {
         EXC_GRAD = integrator.eval_exc_grad( P );
       }
       else if( uks ) {
-        std::cout << "Warning: eval_exc_grad + UKS NYI!" << std::endl;
-        //EXC_GRAD = integrator.eval_exc_grad( P, Pz );
+        EXC_GRAD = integrator.eval_exc_grad( P, Pz );
       }
       else if( gks ) {
-        std::cout << "Warning: eval_exc_grad + GKS NYI!" << std::endl;
-        //EXC_GRAD = integrator.eval_exc_grad( P, Pz, Py, Px );
+        EXC_GRAD = integrator.eval_exc_grad( P, Pz, Py, Px );
       }
       if(!world_rank) {
         std::cout << "EXC Gradient:" << std::endl;
@@ -500,6 +647,23 @@ int main(int argc, char** argv) {
 
       std::cout << "XC Int Duration  = " << xc_int_dur << " s" << std::endl;
 
+      if( task_scratch_dir.size() ) {
+      const auto& io = lb->task_store_statistics();
+      auto to_mib = []( size_t bytes ){ return bytes / (1024. * 1024.); };
+      std::cout << "Task Store (RANK 0)" << std::endl;
+      std::cout << "  OUT-OF-CORE       = " << std::boolalpha 
+                                           << lb->tasks_out_of_core() << std::endl;
+      std::cout << "  NCHUNKS           = " << io.nchunks << std::endl;
+      std::cout << "  FILE SIZE         = " << to_mib(io.file_bytes) << " MiB" << std::endl;
+      std::cout << "  WRITE             = " << to_mib(io.bytes_written) << " MiB, "
+                << to_mib(io.bytes_written) / io.write_time << " MiB/s" << std::endl;
+      std::cout << "  READ              = " << to_mib(io.bytes_read) << " MiB, "
+                << to_mib(io.bytes_read) / io.read_time << " MiB/s" << std::endl;
+      std::cout << "  READ WAIT         = " << io.read_wait_time << " s" << std::endl;
+      std::cout << "  RESIDENT TASKS    = " << to_mib(io.peak_resident_bytes) 
+                << " MiB" << std::endl;
+      }
+
       if( integrate_den ) {
       std::cout << "N_EL (ref)        = " << (double)N_EL_ref << std::endl;
       std::cout << "N_EL (calc)       = " << N_EL     << std::endl;
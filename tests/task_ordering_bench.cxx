@@ -0,0 +1,229 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+
+/**
+ *  Benchmark of the host task orderings (LoadBalancerState::task_ordering)
+ *
+ *  Runs the X = P * B (eval_xmat) and VXC += B**T * Z (inc_vxc) kernels of the
+ *  host LWD over the local tasks of a test molecule in each TaskOrdering and
+ *  reports the aggregate kernel times along with the hardware cache misses
+ *  (Linux perf events, if accessible) incurred by the task loop.
+ *
+ *  Usage: task_ordering_bench [WATER|BENZENE|TAXOL|UBIQUITIN] [NREP]
+ */
+#include "standards.hpp"
+#include "integrator_util/integrator_common.hpp"
+#include "host/local_host_work_driver.hpp"
+#include <gauxc/load_balancer.hpp>
+#include <gauxc/molecular_weights.hpp>
+#include <gauxc/molgrid/defaults.hpp>
+#include <gauxc/runtime_environment.hpp>
+#include <gauxc/util/aligned_allocator.hpp>
+#include <gauxc/xc_integrator/local_work_driver.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace GauXC;
+
+/// Process-wide hardware cache miss counter (inactive if perf is unavailable)
+class CacheMissCounter {
+
+  int fd_ = -1;
+
+public:
+
+  CacheMissCounter() {
+#ifdef __linux__
+    perf_event_attr attr{};
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.size           = sizeof(attr);
+    attr.config         = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled       = 1;
+    attr.inherit        = 1; // Count threads spawned after construction
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+    fd_ = syscall( __NR_perf_event_open, &attr, 0, -1, -1, 0 );
+#endif
+  }
+
+  ~CacheMissCounter() noexcept {
+#ifdef __linux__
+    if( fd_ >= 0 ) close( fd_ );
+#endif
+  }
+
+  bool active() const { return fd_ >= 0; }
+
+  void start() {
+#ifdef __linux__
+    if( not active() ) return;
+    ioctl( fd_, PERF_EVENT_IOC_RESET,  0 );
+    ioctl( fd_, PERF_EVENT_IOC_ENABLE, 0 );
+#endif
+  }
+
+  long long stop() {
+    long long count = -1;
+#ifdef __linux__
+    if( not active() ) return count;
+    ioctl( fd_, PERF_EVENT_IOC_DISABLE, 0 );
+    if( read( fd_, &count, sizeof(count) ) != sizeof(count) ) count = -1;
+#endif
+    return count;
+  }
+
+};
+
+int main( int argc, char** argv ) {
+
+#ifdef GAUXC_HAS_MPI
+  MPI_Init( NULL, NULL );
+#endif
+  {
+
+  // Counter must be opened before the OpenMP threads are spawned
+  CacheMissCounter counter;
+
+  std::string mol_name = argc > 1 ? argv[1] : "BENZENE";
+  const int   nrep     = argc > 2 ? std::stoi(argv[2]) : 5;
+  std::transform( mol_name.begin(), mol_name.end(), mol_name.begin(), ::toupper );
+
+  std::map< std::string, Molecule(*)() > mol_map = {
+    { "WATER",     make_water     },
+    { "BENZENE",   make_benzene   },
+    { "TAXOL",     make_taxol     },
+    { "UBIQUITIN", make_ubiquitin }
+  };
+
+  auto rt    = RuntimeEnvironment( GAUXC_MPI_CODE(MPI_COMM_WORLD) );
+  auto mol   = mol_map.at(mol_name)();
+  auto basis = make_ccpvdz( mol, SphericalType(true) );
+  auto mg    = MolGridFactory::create_default_molgrid( mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::UltraFineGrid );
+
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb = lb_factory.get_instance( rt, mol, mg, basis );
+  MolecularWeightsFactory mw_factory( ExecutionSpace::Host, "Default",
+    MolecularWeightsSettings{} );
+  mw_factory.get_instance().modify_weights( lb );
+
+  auto lwd_base = LocalWorkDriverFactory::make_local_work_driver(
+    ExecutionSpace::Host, "Default" );
+  auto* lwd = dynamic_cast<LocalHostWorkDriver*>( lwd_base.get() );
+
+  // Random symmetric density
+  const size_t nbf = basis.nbf();
+  std::vector<double> P( nbf * nbf ), VXC( nbf * nbf );
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-1., 1.);
+  for( size_t j = 0; j < nbf; ++j )
+  for( size_t i = 0; i <= j; ++i )
+    P[i + j*nbf] = P[j + i*nbf] = dist(gen);
+
+  auto task_cost = []( const XCTask& t ) {
+    return double(t.points.size() * t.bfn_screening.nbe);
+  };
+
+  std::cout << "MOLECULE = " << mol_name << ", NBF = " << nbf
+            << ", NTASKS = " << lb.get_tasks().size() << ", NREP = " << nrep
+            << std::endl;
+  if( not counter.active() )
+    std::cout << "(perf events unavailable, cache misses not reported)" << std::endl;
+  std::cout << std::setw(10) << "ORDERING" << std::setw(16) << "XMAT (s)"
+            << std::setw(16) << "INC_VXC (s)" << std::setw(16) << "LOOP (s)"
+            << std::setw(20) << "CACHE MISSES" << std::endl;
+
+  for( auto [name, ordering] : std::vector<std::pair<std::string,TaskOrdering>>{
+    {"COST", TaskOrdering::Cost}, {"MORTON", TaskOrdering::Morton},
+    {"HILBERT", TaskOrdering::Hilbert} } ) {
+
+    auto tasks = lb.get_tasks();
+    order_tasks( ordering, tasks.begin(), tasks.end(), task_cost );
+    generate_points_soa( tasks.begin(), tasks.end() );
+    populate_submat_maps( nbf, tasks.begin(), tasks.end(), lb.basis_map() );
+
+    // Collocation is evaluated up front so that only the P / VXC access
+    // pattern of the timed kernels depends on the ordering
+    std::vector< util::aligned_vector<double> > basis_eval( tasks.size() );
+    #pragma omp parallel for schedule(dynamic)
+    for( size_t iT = 0; iT < tasks.size(); ++iT ) {
+      const auto& task = tasks[iT];
+      basis_eval[iT].resize( task.npts * task.bfn_screening.nbe );
+      lwd->eval_collocation( task.npts, task.bfn_screening.shell_list.size(),
+        task.bfn_screening.nbe, task.points_soa.data(), basis,
+        task.bfn_screening.shell_list.data(), basis_eval[iT].data() );
+    }
+
+    double xmat_time = 0., vxc_time = 0., loop_time = 0.;
+    long long misses = 0;
+    for( int irep = 0; irep < nrep; ++irep ) {
+
+      std::fill( VXC.begin(), VXC.end(), 0. );
+      counter.start();
+      auto loop_st = std::chrono::high_resolution_clock::now();
+
+      #pragma omp parallel reduction(+:xmat_time,vxc_time)
+      {
+      util::aligned_vector<double> X, scr;
+
+      #pragma omp for schedule(dynamic)
+      for( size_t iT = 0; iT < tasks.size(); ++iT ) {
+        const auto& task = tasks[iT];
+        const size_t npts = task.npts;
+        const size_t nbe  = task.bfn_screening.nbe;
+        const auto& submat_map = task.bfn_screening.submat_map;
+        X.resize( npts * nbe ); scr.resize( nbe * nbe );
+
+        auto st = std::chrono::high_resolution_clock::now();
+        lwd->eval_xmat( npts, nbf, nbe, submat_map, 1.0, P.data(), nbf,
+          basis_eval[iT].data(), nbe, X.data(), nbe, scr.data() );
+        auto md = std::chrono::high_resolution_clock::now();
+        lwd->inc_vxc( npts, nbf, nbe, basis_eval[iT].data(), submat_map,
+          X.data(), nbe, VXC.data(), nbf, scr.data() );
+        auto en = std::chrono::high_resolution_clock::now();
+
+        xmat_time += std::chrono::duration<double>( md - st ).count();
+        vxc_time  += std::chrono::duration<double>( en - md ).count();
+      }
+      }
+
+      auto loop_en = std::chrono::high_resolution_clock::now();
+      loop_time += std::chrono::duration<double>( loop_en - loop_st ).count();
+      misses    += counter.stop();
+
+    }
+
+    std::cout << std::setw(10) << name
+              << std::setw(16) << xmat_time / nrep
+              << std::setw(16) << vxc_time  / nrep
+              << std::setw(16) << loop_time / nrep
+              << std::setw(20);
+    if( counter.active() ) std::cout << misses / nrep;
+    else                   std::cout << "n/a";
+    std::cout << std::endl;
+
+  }
+
+  }
+#ifdef GAUXC_HAS_MPI
+  MPI_Finalize();
+#endif
+
+}
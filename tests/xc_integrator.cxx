@@ -12,10 +12,14 @@
 #include <gauxc/molecular_weights.hpp>
 
 #include <gauxc/molgrid/defaults.hpp>
+#include <gauxc/point_group.hpp>
+#include "xc_integrator_fixture.hpp"
+#include "integrator_util/point_group_symmetrizer.hpp"
 
 #include <gauxc/external/hdf5.hpp>
 #include <highfive/H5File.hpp>
 #include <Eigen/Core>
+#include <Eigen/Eigenvalues>
 
 using namespace GauXC;
 
@@ -178,6 +182,23 @@ void test_xc_integrator( ExecutionSpace ex, const RuntimeEnvironment& rt,
       CHECK( VXC1_diff_nrm / basis.nbf() < 1e-10 ); 
     }
 
+    // Host integrators cache the submatrix maps on the tasks
+    if( ex == ExecutionSpace::Host and integrator_kernel == "Default" ) {
+      for( const auto& task : integrator.load_balancer().get_tasks() )
+        CHECK( task.bfn_screening.submat_map.size() > 0 );
+    }
+
+    // Space-filling curve task orderings only alter the execution order
+    if( ex == ExecutionSpace::Host and integrator_kernel == "Default" ) {
+      for( auto ordering : { TaskOrdering::Hilbert, TaskOrdering::Morton } ) {
+        integrator.load_balancer().state().task_ordering = ordering;
+        auto [ EXC_sfc, VXC_sfc ] = integrator.eval_exc_vxc( P );
+        CHECK( EXC_sfc == Approx( EXC_ref ) );
+        CHECK( ( VXC_sfc - VXC_ref ).norm() / basis.nbf() < 1e-10 );
+      }
+      integrator.load_balancer().state().task_ordering = TaskOrdering::Cost;
+    }
+
     // Check EXC-only path
     auto EXC2 = integrator.eval_exc( P );
     CHECK(EXC2 == Approx(EXC));
@@ -204,6 +225,26 @@ void test_xc_integrator( ExecutionSpace ex, const RuntimeEnvironment& rt,
     // Check EXC-only path
     auto EXC2 = integrator.eval_exc( P, Pz );
     CHECK(EXC2 == Approx(EXC));
+
+    // GKS MGGA with a collinear magnetization must reproduce UKS, along z
+    // and along an oblique axis n (n_k * Pz)
+    if( ex == ExecutionSpace::Host and integrator_kernel == "Default" and
+        func.is_mgga() ) {
+      matrix_type Zero = matrix_type::Zero( P.rows(), P.cols() );
+      const std::array<std::array<double,3>,2> axes = {{
+        {1.0, 0.0, 0.0}, {0.48, 0.6, 0.64} // (z, y, x)
+      }};
+      for( const auto& n : axes ) {
+        matrix_type Pz_n = n[0] * Pz, Py_n = n[1] * Pz, Px_n = n[2] * Pz;
+        auto [ EXC_g, VXC_g, VXCz_g, VXCy_g, VXCx_g ] =
+          integrator.eval_exc_vxc( P, Pz_n, Py_n, Px_n );
+        CHECK( EXC_g == Approx( EXC_ref ) );
+        CHECK( ( VXC_g  - VXC_ref ).norm() / basis.nbf() < 1e-10 );
+        CHECK( ( VXCz_g - n[0] * VXCz_ref ).norm() / basis.nbf() < 1e-10 );
+        CHECK( ( VXCy_g - n[1] * VXCz_ref ).norm() / basis.nbf() < 1e-10 );
+        CHECK( ( VXCx_g - n[2] * VXCz_ref ).norm() / basis.nbf() < 1e-10 );
+      }
+    }
   } else if (gks) {
     auto [ EXC, VXC, VXCz, VXCy, VXCx ] = integrator.eval_exc_vxc( P, Pz, Py, Px );
 
@@ -239,6 +280,58 @@ void test_xc_integrator( ExecutionSpace ex, const RuntimeEnvironment& rt,
 
 
 
+  // Check FXC contraction against finite differences of VXC
+  if( ex == ExecutionSpace::Host and integrator_kernel == "Default" and not gks ) {
+
+    // Symmetric trial densities
+    const auto nbf = basis.nbf();
+    auto make_trial = [&]( const matrix_type& X, double phase ) {
+      matrix_type T( nbf, nbf );
+      for( int j = 0; j < nbf; ++j )
+      for( int i = 0; i < nbf; ++i )
+        T(i,j) = 0.1 * X(i,j) * std::cos( phase * (i + j) );
+      return T;
+    };
+
+    const double h = 1e-4;
+    auto rel_diff = []( const matrix_type& A, const matrix_type& B ) {
+      return ( A - B ).norm() / std::max( B.norm(), 1e-10 );
+    };
+
+    if( rks ) {
+      auto tP = make_trial( P, 0.3 );
+      auto FXC = integrator.eval_fxc_contraction( P,
+        std::vector<matrix_type>{ tP, matrix_type(2.0 * tP) } );
+      REQUIRE( FXC.size() == 2 );
+
+      auto [EXC_p, VXC_p] = integrator.eval_exc_vxc( P + h * tP );
+      auto [EXC_m, VXC_m] = integrator.eval_exc_vxc( P - h * tP );
+      matrix_type FXC_fd = (VXC_p - VXC_m) / (2.0 * h);
+
+      CHECK( (FXC[0] - FXC[0].transpose()).norm() <
+        std::numeric_limits<double>::epsilon() );
+      CHECK( rel_diff( FXC[0], FXC_fd ) < 1e-4 );
+      CHECK( rel_diff( FXC[1], 2.0 * FXC[0] ) < 1e-8 ); // Linearity
+    } else if( uks ) {
+      auto tPs = make_trial( P,  0.3 );
+      auto tPz = make_trial( Pz, 0.7 );
+      auto [FXCs, FXCz] = integrator.eval_fxc_contraction( P, Pz,
+        std::vector<matrix_type>{tPs}, std::vector<matrix_type>{tPz} );
+      REQUIRE( FXCs.size() == 1 );
+      REQUIRE( FXCz.size() == 1 );
+
+      auto [EXC_p, VXCs_p, VXCz_p] =
+        integrator.eval_exc_vxc( P + h * tPs, Pz + h * tPz );
+      auto [EXC_m, VXCs_m, VXCz_m] =
+        integrator.eval_exc_vxc( P - h * tPs, Pz - h * tPz );
+      matrix_type FXCs_fd = (VXCs_p - VXCs_m) / (2.0 * h);
+      matrix_type FXCz_fd = (VXCz_p - VXCz_m) / (2.0 * h);
+
+      CHECK( rel_diff( FXCs[0], FXCs_fd ) < 1e-4 );
+      CHECK( rel_diff( FXCz[0], FXCz_fd ) < 1e-4 );
+    }
+  }
+
   // Check EXC Grad
   if( check_grad and has_exc_grad and rks) {
     auto EXC_GRAD = integrator.eval_exc_grad( P );
@@ -259,6 +352,54 @@ void test_xc_integrator( ExecutionSpace ex, const RuntimeEnvironment& rt,
     auto K = integrator.eval_exx( P );
     CHECK((K - K.transpose()).norm() < std::numeric_limits<double>::epsilon()); // Symmetric
     CHECK( (K - K_ref).norm() / basis.nbf() < 1e-7 );
+
+    // Fused EXC/VXC + K
+    if( ex == ExecutionSpace::Host and integrator_kernel == "Default" ) {
+      auto [ EXC_f, VXC_f, K_f ] = integrator.eval_exc_vxc_exx( P );
+      CHECK( EXC_f == Approx( EXC_ref ) );
+      CHECK( (VXC_f - VXC_ref).norm() / basis.nbf() < 1e-10 );
+      CHECK( (K_f - K).norm() / basis.nbf() < 1e-10 );
+    }
+
+    // Multiple densities share the screening and grid integrals
+    if( ex == ExecutionSpace::Host and integrator_kernel == "Default" ) {
+      matrix_type P_half = 0.5 * P;
+      auto K_multi = integrator.eval_exx( std::vector<matrix_type>{ P, P_half } );
+      REQUIRE( K_multi.size() == 2 );
+      CHECK( (K_multi[0] - K).norm() / basis.nbf() < 1e-10 );
+      CHECK( (K_multi[1] - 0.5 * K).norm() / basis.nbf() < 1e-10 );
+
+      // Densities with different patterns: from different sets of natural
+      // orbitals and restricted to a block of basis functions. Screening is
+      // disabled s.t. the shared screening matches the separate calls
+      const auto nbf = basis.nbf();
+      Eigen::SelfAdjointEigenSolver<matrix_type> eig( P );
+      const auto& V = eig.eigenvectors();
+      const auto& d = eig.eigenvalues();
+      const int64_t nocc = nbf / 2;
+      matrix_type Pa = V.rightCols(nocc) * d.tail(nocc).asDiagonal() *
+        V.rightCols(nocc).transpose();
+      matrix_type Pb = matrix_type::Zero( nbf, nbf );
+      Pb.topLeftCorner( nbf/3, nbf/3 ) = P.topLeftCorner( nbf/3, nbf/3 );
+      matrix_type Pc = V.leftCols(nbf - nocc) * V.leftCols(nbf - nocc).transpose();
+
+      IntegratorSettingsSNLinK no_screen;
+      no_screen.energy_tol = 0.;
+      no_screen.k_tol      = 0.;
+      const std::vector<matrix_type> Pk = { Pa, Pb, Pc };
+      auto K_k = integrator.eval_exx( Pk, no_screen );
+      REQUIRE( K_k.size() == Pk.size() );
+      for( size_t k = 0; k < Pk.size(); ++k ) {
+        auto K_sep = integrator.eval_exx( Pk[k], no_screen );
+        CHECK( (K_k[k] - K_sep).norm() / basis.nbf() < 1e-10 );
+      }
+
+      // K is only symmetrized correctly for symmetric densities
+      matrix_type P_asym = P;
+      P_asym(0, nbf-1) += 0.1;
+      CHECK_THROWS_WITH( integrator.eval_exx( std::vector<matrix_type>{ P, P_asym } ),
+        Catch::Contains("Symmetric") );
+    }
   }
 
 }
@@ -448,3 +589,674 @@ TEST_CASE( "XC Integrator", "[xc-integrator]" ) {
         func, PruningScheme::Unpruned );
   }
 }
+
+
+#ifdef GAUXC_HAS_HOST
+TEST_CASE( "XC Integrator Point Group Symmetry", "[xc-integrator]" ) {
+
+  using matrix_type = Eigen::MatrixXd;
+  auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  // make_water is in a standard (C2v) orientation
+  auto mol   = make_water();
+  auto basis = make_ccpvdz( mol, SphericalType(true) );
+  for( auto& sh : basis ) 
+    sh.set_shell_tolerance( std::numeric_limits<double>::epsilon() );
+
+  auto pg = detect_point_group( mol );
+  REQUIRE( pg.name() == "C2v" );
+  CHECK( detect_point_group( make_benzene() ).is_trivial() );
+
+  // Totally symmetric, positive semi-definite density
+  const size_t nbf = basis.nbf();
+  matrix_type P = random_test_densities( nbf, 13 ).Pa;
+  detail::PointGroupSymmetrizer( pg, mol, basis ).symmetrize_matrix( P.data(), nbf );
+
+  functional_type func( ExchCXX::Backend::builtin, ExchCXX::Functional::PBE0,
+    ExchCXX::Spin::Unpolarized );
+
+  auto integrate = [&]( const PointGroup& point_group ) {
+    auto lb = make_test_load_balancer( rt, mol, basis, 
+      [&]( LoadBalancer& lb ) { lb.state().point_group = point_group; } );
+
+    size_t npts = 0;
+    for( const auto& task : lb.get_tasks() ) npts += task.npts;
+
+    XCIntegratorFactory<matrix_type> integrator_factory( ExecutionSpace::Host,
+      "Replicated", "Default", "Default", "Default" );
+    auto integrator = integrator_factory.get_instance( func, lb );
+    auto [ EXC, VXC ] = integrator.eval_exc_vxc( P );
+    auto EXC_GRAD     = integrator.eval_exc_grad( P );
+    auto K            = integrator.eval_exx( P );
+
+    // Integrands which are not totally symmetric in general are rejected
+    if( not point_group.is_trivial() ) {
+      CHECK_THROWS_WITH( integrator.eval_exc_vxc( P, P, P, P ),
+        Catch::Contains("Point Group") );
+      CHECK_THROWS_WITH( integrator.eval_fxc_contraction( P, { P } ),
+        Catch::Contains("Point Group") );
+      CHECK_THROWS_WITH( integrator.eval_exx( std::vector<matrix_type>{ P, P } ),
+        Catch::Contains("Point Group") );
+    }
+
+    return std::make_tuple( npts, EXC, VXC, EXC_GRAD, K );
+  };
+
+  auto [ npts_full, EXC_full, VXC_full, GRAD_full, K_full ] = integrate( PointGroup() );
+  auto [ npts_sym,  EXC_sym,  VXC_sym,  GRAD_sym,  K_sym  ] = integrate( pg );
+
+  // Only the symmetry-unique points are integrated
+  CHECK( 2 * npts_sym < npts_full );
+
+  CHECK( EXC_sym == Approx( EXC_full ) );
+  CHECK( ( VXC_sym - VXC_full ).norm() / nbf < 1e-10 );
+  CHECK( ( K_sym - K_full ).norm() / nbf < 1e-8 );
+  for( auto i = 0ul; i < GRAD_full.size(); ++i )
+    CHECK( GRAD_sym[i] == Approx( GRAD_full[i] ).margin(1e-10) );
+
+  // Operations which do not leave the molecule invariant are rejected
+  PointGroup Cs_xz( { {1.,0.,0., 0.,1.,0., 0.,0.,1.}, {1.,0.,0., 0.,-1.,0., 0.,0.,1.} } );
+  CHECK_THROWS( Cs_xz.atom_map( mol, 1 ) );
+
+}
+#endif
+
+#ifdef GAUXC_HAS_HOST
+TEST_CASE( "XC Integrator EXC Gradient", "[xc-integrator]" ) {
+
+  using matrix_type = Eigen::MatrixXd;
+  auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  // Distort water to avoid symmetry-induced zeros in the gradient
+  auto mol_ref = make_water();
+  mol_ref[1].x += 0.1; mol_ref[2].z -= 0.05;
+  const size_t nbf = make_ccpvdz( mol_ref, SphericalType(true) ).nbf();
+
+  // Positive semi-definite (spin) densities, fixed in the AO basis
+  std::mt19937 gen(17);
+  std::uniform_real_distribution<double> dist( 0., 1. );
+  matrix_type C( nbf, 5 );
+  for( auto i = 0; i < C.size(); ++i ) C.data()[i] = dist(gen) / nbf;
+  matrix_type P  = C * C.transpose();
+  matrix_type Pa = P, Pb = 0.9 * P;
+  matrix_type Ps = Pa + Pb, Pz = Pa - Pb;
+
+  // Integrator for a given geometry (basis and grid follow the atoms)
+  auto make_integrator = [&]( Molecule mol, ExchCXX::Spin spin, 
+    ExchCXX::Functional func_key, XCWeightAlg weight_alg ) {
+    auto basis = make_ccpvdz( mol, SphericalType(true) );
+    for( auto& sh : basis ) 
+      sh.set_shell_tolerance( std::numeric_limits<double>::epsilon() );
+    auto mg = MolGridFactory::create_default_molgrid( mol, PruningScheme::Unpruned,
+      BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid );
+
+    LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+    auto lb = lb_factory.get_instance( rt, mol, mg, basis );
+    MolecularWeightsSettings mw_settings;
+    mw_settings.weight_alg = weight_alg;
+    MolecularWeightsFactory mw_factory( ExecutionSpace::Host, "Default",
+      mw_settings );
+    mw_factory.get_instance().modify_weights( lb );
+
+    XCIntegratorFactory<matrix_type> integrator_factory( ExecutionSpace::Host,
+      "Replicated", "Default", "Default", "Default" );
+    return integrator_factory.get_instance( make_functional(func_key, spin), lb );
+  };
+
+  IntegratorSettingsEXCGrad grad_settings;
+  grad_settings.include_weight_derivatives = true;
+
+  auto check_fd = [&]( ExchCXX::Spin spin, ExchCXX::Functional func_key, 
+    XCWeightAlg weight_alg ) {
+
+    const bool rks = spin == ExchCXX::Spin::Unpolarized;
+    auto exc = [&]( const Molecule& mol ) {
+      auto integrator = make_integrator( mol, spin, func_key, weight_alg );
+      return rks ? std::get<0>( integrator.eval_exc_vxc( P ) ) :
+                   std::get<0>( integrator.eval_exc_vxc( Ps, Pz ) );
+    };
+
+    auto integrator = make_integrator( mol_ref, spin, func_key, weight_alg );
+    auto EXC_GRAD = rks ? integrator.eval_exc_grad( P, grad_settings ) :
+                          integrator.eval_exc_grad( Ps, Pz, grad_settings );
+
+    // Translational invariance
+    for( int k = 0; k < 3; ++k ) {
+      double sum = 0.;
+      for( size_t iAt = 0; iAt < mol_ref.size(); ++iAt ) sum += EXC_GRAD[3*iAt+k];
+      CHECK( sum == Approx(0.).margin(1e-10) );
+    }
+
+    // Central finite differences
+    const double h = 1e-4;
+    for( auto [iAt, k] : std::vector<std::pair<int,int>>{ {0,0}, {1,2}, {2,1} } ) {
+      auto mol_p = mol_ref, mol_m = mol_ref;
+      double* xp[3] = { &mol_p[iAt].x, &mol_p[iAt].y, &mol_p[iAt].z };
+      double* xm[3] = { &mol_m[iAt].x, &mol_m[iAt].y, &mol_m[iAt].z };
+      *xp[k] += h; *xm[k] -= h;
+      const double fd = ( exc(mol_p) - exc(mol_m) ) / (2. * h);
+      CHECK( EXC_GRAD[3*iAt+k] == Approx( fd ).margin(1e-6) );
+    }
+
+    return EXC_GRAD;
+  };
+
+  using ExchCXX::Functional;
+  auto unpol = ExchCXX::Spin::Unpolarized;
+  auto pol   = ExchCXX::Spin::Polarized;
+
+  SECTION( "RKS / SVWN5 / SSF" ) {
+    check_fd( unpol, Functional::SVWN5, XCWeightAlg::SSF );
+  }
+
+  SECTION( "RKS / PBE0 / Becke" ) {
+    check_fd( unpol, Functional::PBE0, XCWeightAlg::Becke );
+  }
+
+  SECTION( "UKS / PBE0 / SSF" ) {
+    check_fd( pol, Functional::PBE0, XCWeightAlg::SSF );
+  }
+
+  SECTION( "Spin Consistency" ) {
+    for( auto func_key : { Functional::SVWN5, Functional::PBE0 } ) {
+      auto rks_integrator = make_integrator( mol_ref, unpol, func_key, XCWeightAlg::SSF );
+      auto uks_integrator = make_integrator( mol_ref, pol,   func_key, XCWeightAlg::SSF );
+      
+      // Closed shell UKS == RKS
+      matrix_type Z = matrix_type::Zero( nbf, nbf );
+      auto GRAD_rks = rks_integrator.eval_exc_grad( P, grad_settings );
+      auto GRAD_uks = uks_integrator.eval_exc_grad( P, Z, grad_settings );
+      for( auto i = 0ul; i < GRAD_rks.size(); ++i )
+        CHECK( GRAD_uks[i] == Approx( GRAD_rks[i] ).margin(1e-10) );
+
+      // Collinear GKS == UKS
+      const double n[3] = { 0.48, 0.6, 0.64 };
+      matrix_type Pz_n = n[0] * Pz, Py_n = n[1] * Pz, Px_n = n[2] * Pz;
+      GRAD_uks = uks_integrator.eval_exc_grad( Ps, Pz, grad_settings );
+      auto GRAD_gks = uks_integrator.eval_exc_grad( Ps, Pz_n, Py_n, Px_n, 
+        grad_settings );
+      for( auto i = 0ul; i < GRAD_uks.size(); ++i )
+        CHECK( GRAD_gks[i] == Approx( GRAD_uks[i] ).margin(1e-10) );
+    }
+  }
+
+  SECTION( "sn-LinK Before Gradient" ) {
+    // sn-LinK merges a private copy of the tasks across parent atoms, the
+    // load balancer tasks used by the weight derivatives are left intact
+    auto ref_integrator = make_integrator( mol_ref, unpol, Functional::PBE0, 
+      XCWeightAlg::SSF );
+    auto GRAD_ref = ref_integrator.eval_exc_grad( P, grad_settings );
+
+    auto integrator = make_integrator( mol_ref, unpol, Functional::PBE0, 
+      XCWeightAlg::SSF );
+    auto parents = [&]() {
+      std::vector<int32_t> ip;
+      for( const auto& t : std::as_const(integrator.load_balancer()).get_tasks() )
+        ip.push_back( t.iParent );
+      return ip;
+    };
+    const auto parents_ref = parents();
+
+    integrator.eval_exx( P );
+    CHECK( parents() == parents_ref );
+    auto GRAD = integrator.eval_exc_grad( P, grad_settings );
+    integrator.eval_exc_vxc_exx( P );
+    CHECK( parents() == parents_ref );
+    auto GRAD_fused = integrator.eval_exc_grad( P, grad_settings );
+    for( auto i = 0ul; i < GRAD_ref.size(); ++i ) {
+      CHECK( GRAD[i]       == Approx( GRAD_ref[i] ).margin(1e-10) );
+      CHECK( GRAD_fused[i] == Approx( GRAD_ref[i] ).margin(1e-10) );
+    }
+  }
+
+}
+#endif
+
+#ifdef GAUXC_HAS_HOST
+TEST_CASE( "XC Integrator Adaptive Pruning", "[xc-integrator]" ) {
+
+  using matrix_type = Eigen::MatrixXd;
+  auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  // Unpruned UltraFine reference
+  const std::string reference_file = 
+    GAUXC_REF_DATA_PATH "/benzene_svwn5_cc-pvdz_ufg_ssf.hdf5";
+  Molecule mol;
+  BasisSet<double> basis;
+  matrix_type P;
+  double EXC_ref;
+  {
+    read_hdf5_record( mol,   reference_file, "/MOLECULE" );
+    read_hdf5_record( basis, reference_file, "/BASIS"    );
+
+    HighFive::File file( reference_file, HighFive::File::ReadOnly );
+    auto dset = file.getDataSet("/DENSITY");
+    auto dims = dset.getDimensions();
+    P = matrix_type( dims[0], dims[1] );
+    dset.read( P.data() );
+    dset = file.getDataSet("/EXC");
+    dset.read( &EXC_ref );
+  }
+  for( auto& sh : basis ) 
+    sh.set_shell_tolerance( std::numeric_limits<double>::epsilon() );
+
+  auto func = make_functional( ExchCXX::Functional::SVWN5, 
+    ExchCXX::Spin::Unpolarized );
+
+  auto integrate = [&]( PruningScheme scheme ) {
+    auto mg = MolGridFactory::create_default_molgrid(mol, scheme,
+      BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::UltraFineGrid);
+
+    LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+    auto lb = lb_factory.get_instance( rt, mol, mg, basis );
+    MolecularWeightsFactory mw_factory( ExecutionSpace::Host, "Default",
+      MolecularWeightsSettings{} );
+    mw_factory.get_instance().modify_weights( lb );
+
+    size_t npts = 0;
+    for( const auto& task : lb.get_tasks() ) npts += task.npts;
+
+    XCIntegratorFactory<matrix_type> integrator_factory( ExecutionSpace::Host,
+      "Replicated", "Default", "Default", "Default" );
+    auto integrator = integrator_factory.get_instance( func, lb );
+    auto [ EXC, VXC ] = integrator.eval_exc_vxc( P );
+    return std::make_tuple( npts, EXC );
+  };
+
+  auto [ npts_unpruned, EXC_unpruned ] = integrate( PruningScheme::Unpruned );
+  auto [ npts_robust,   EXC_robust   ] = integrate( PruningScheme::Robust   );
+  auto [ npts_adaptive, EXC_adaptive ] = integrate( PruningScheme::Adaptive );
+
+  INFO( "NPTS Unpruned = " << npts_unpruned << " Robust = " << npts_robust <<
+    " Adaptive = " << npts_adaptive );
+  INFO( "EXC Error Robust = " << std::abs(EXC_robust - EXC_unpruned) <<
+    " Adaptive = " << std::abs(EXC_adaptive - EXC_unpruned) );
+
+  CHECK( EXC_unpruned == Approx( EXC_ref ) );
+  CHECK( npts_adaptive < npts_unpruned );
+  CHECK( std::abs(EXC_adaptive - EXC_unpruned) < 1e-5 );
+
+}
+#endif
+
+#ifdef GAUXC_HAS_HOST
+TEST_CASE( "XC Integrator Range-Separated EXX", "[xc-integrator]" ) {
+
+  using matrix_type = Eigen::MatrixXd;
+  auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  auto mol   = make_water();
+  auto basis = make_ccpvdz( mol, SphericalType(true) );
+  for( auto& sh : basis ) 
+    sh.set_shell_tolerance( std::numeric_limits<double>::epsilon() );
+
+  const size_t nbf = basis.nbf();
+  matrix_type P = random_test_densities( nbf, 7 ).Pa;
+  auto lb = make_test_load_balancer( rt, mol, basis );
+
+  functional_type func( ExchCXX::Backend::builtin, ExchCXX::Functional::PBE0,
+    ExchCXX::Spin::Unpolarized );
+  XCIntegratorFactory<matrix_type> integrator_factory( ExecutionSpace::Host,
+    "Replicated", "Default", "Default", "Default" );
+  auto integrator = integrator_factory.get_instance( func, lb );
+
+  auto eval_k = [&]( double full, double lr, double sr, double omega ) {
+    IntegratorSettingsSNLinK settings;
+    settings.omega             = omega;
+    settings.full_range_coeff  = full;
+    settings.long_range_coeff  = lr;
+    settings.short_range_coeff = sr;
+    return integrator.eval_exx( P, settings );
+  };
+
+  const double omega = 0.33;
+  matrix_type K_full = eval_k( 1., 0., 0., 0.    );
+  matrix_type K_lr   = eval_k( 0., 1., 0., omega );
+  matrix_type K_sr   = eval_k( 0., 0., 1., omega );
+
+  CHECK( (K_lr - K_lr.transpose()).norm() < 1e-12 );
+  CHECK( (K_sr - K_sr.transpose()).norm() < 1e-12 );
+
+  // erf + erfc = 1
+  CHECK( (K_lr + K_sr - K_full).norm() / nbf < 1e-8 );
+
+  // CAM-like operator in a single pass
+  matrix_type K_cam = eval_k( 0.19, 0.46, 0., omega );
+  CHECK( (K_cam - 0.19 * K_full - 0.46 * K_lr).norm() / nbf < 1e-8 );
+
+  // The above hold by construction (erfc = 1/r - erf), check the attenuated
+  // kernels against the limits of erf(omega r) / r.
+  //
+  // omega -> inf: erf(omega r) / r -> 1 / r, the remainder integrates to
+  // O(1/omega^2)
+  matrix_type K_lr_inf = eval_k( 0., 1., 0., 1e4 );
+  CHECK( (K_lr_inf - K_full).norm() / K_full.norm() < 1e-4 );
+  CHECK( (K_lr - K_full).norm() / K_full.norm() > 1e-2 );
+
+  // omega -> 0: erf(omega r) / r = 2 omega / sqrt(pi) + O(omega^3 r^2), K
+  // vanishes linearly in omega
+  matrix_type K_lr_0  = eval_k( 0., 1., 0., 1e-3 );
+  matrix_type K_lr_02 = eval_k( 0., 1., 0., 2e-3 );
+  CHECK( K_lr_0.norm() / K_full.norm() < 1e-2 );
+  CHECK( (K_lr_02 - 2. * K_lr_0).norm() / K_lr_0.norm() < 1e-3 );
+
+  // Attenuated operators require omega > 0
+  CHECK_THROWS( eval_k( 0., 1., 0., 0. ) );
+
+}
+#endif
+
+#ifdef GAUXC_HAS_HOST
+TEST_CASE( "XC Integrator Mixed Precision", "[xc-integrator]" ) {
+
+  using matrix_type = Eigen::MatrixXd;
+  auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  auto mol   = make_water();
+  auto basis = make_ccpvdz( mol, SphericalType(true) );
+  for( auto& sh : basis ) 
+    sh.set_shell_tolerance( std::numeric_limits<double>::epsilon() );
+
+  const size_t nbf = basis.nbf();
+  random_test_densities dens( nbf, 11 );
+  const matrix_type& Ps = dens.Ps;
+  const matrix_type& Pz = dens.Pz;
+  auto lb = make_test_load_balancer( rt, mol, basis );
+
+  IntegratorSettingsKS dp_settings, mp_settings;
+  mp_settings.mixed_precision     = true;
+  mp_settings.mixed_precision_tol = 1e-5;
+
+  for( auto func_key : { ExchCXX::Functional::SVWN5, ExchCXX::Functional::PBE0 } ) {
+    auto rks_integrator = XCIntegratorFactory<matrix_type>( ExecutionSpace::Host,
+      "Replicated", "Default", "Default", "Default" ).get_instance( 
+      make_functional( func_key, ExchCXX::Spin::Unpolarized ), lb );
+    auto uks_integrator = XCIntegratorFactory<matrix_type>( ExecutionSpace::Host,
+      "Replicated", "Default", "Default", "Default" ).get_instance( 
+      make_functional( func_key, ExchCXX::Spin::Polarized ), lb );
+
+    // RKS
+    mp_settings.scf_error = 1.0;
+    auto [ EXC_dp, VXC_dp ] = rks_integrator.eval_exc_vxc( Ps, dp_settings );
+    auto [ EXC_mp, VXC_mp ] = rks_integrator.eval_exc_vxc( Ps, mp_settings );
+    CHECK( std::abs( EXC_mp - EXC_dp ) < 1e-5 );
+    CHECK( (VXC_mp - VXC_dp).norm() / nbf < 1e-5 );
+    CHECK( (VXC_mp - VXC_mp.transpose()).norm() < 1e-12 );
+
+    // UKS
+    auto [ EXC_dp_u, VXCs_dp, VXCz_dp ] = uks_integrator.eval_exc_vxc( Ps, Pz, 
+      dp_settings );
+    auto [ EXC_mp_u, VXCs_mp, VXCz_mp ] = uks_integrator.eval_exc_vxc( Ps, Pz, 
+      mp_settings );
+    CHECK( std::abs( EXC_mp_u - EXC_dp_u ) < 1e-5 );
+    CHECK( (VXCs_mp - VXCs_dp).norm() / nbf < 1e-5 );
+    CHECK( (VXCz_mp - VXCz_dp).norm() / nbf < 1e-5 );
+
+    // Reverts to double once the SCF error drops below the tolerance. The
+    // threaded VXC accumulation is not bitwise reproducible, but far below
+    // the float32 error
+    mp_settings.scf_error = 1e-6;
+    auto [ EXC_sw, VXC_sw ] = rks_integrator.eval_exc_vxc( Ps, mp_settings );
+    CHECK( EXC_sw == Approx( EXC_dp ).epsilon(1e-12) );
+    CHECK( (VXC_sw - VXC_dp).norm() / nbf < 1e-12 );
+  }
+
+}
+TEST_CASE( "XC Integrator ShellBatched Memory Budget", "[xc-integrator]" ) {
+
+  using matrix_type = Eigen::MatrixXd;
+  auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  auto mol   = make_water();
+  auto basis = make_ccpvdz( mol, SphericalType(true) );
+
+  const size_t nbf = basis.nbf();
+  random_test_densities dens( nbf, 13 );
+  const matrix_type& Ps = dens.Ps;
+  const matrix_type& Pz = dens.Pz;
+  auto lb = make_test_load_balancer( rt, mol, basis );
+
+  // Budget of ~10 basis functions / batch forces many staged batches
+  IntegratorSettingsKS batched_settings;
+  batched_settings.host_memory_budget = 4 * 2 * sizeof(double) * 10 * 10;
+
+  for( auto spin : { ExchCXX::Spin::Unpolarized, ExchCXX::Spin::Polarized } ) {
+    auto func = make_functional( ExchCXX::Functional::PBE0, spin );
+    auto ref_integrator = XCIntegratorFactory<matrix_type>( ExecutionSpace::Host,
+      "Replicated", "Default", "Default", "Default" ).get_instance( func, lb );
+    auto sb_integrator = XCIntegratorFactory<matrix_type>( ExecutionSpace::Host,
+      "Replicated", "ShellBatched", "Default", "Default" ).get_instance( func, lb );
+
+    if( spin == ExchCXX::Spin::Unpolarized ) {
+      auto [ EXC_ref, VXC_ref ] = ref_integrator.eval_exc_vxc( Ps );
+      // Repeated invocations reuse the staging buffers
+      for( int irep = 0; irep < 2; ++irep ) {
+        auto [ EXC_sb, VXC_sb ] = sb_integrator.eval_exc_vxc( Ps, batched_settings );
+        CHECK( EXC_sb == Approx( EXC_ref ) );
+        CHECK( (VXC_sb - VXC_ref).norm() / nbf < 1e-10 );
+      }
+      auto [ EXC_sb, VXC_sb ] = sb_integrator.eval_exc_vxc( Ps );
+      CHECK( EXC_sb == Approx( EXC_ref ) );
+      CHECK( (VXC_sb - VXC_ref).norm() / nbf < 1e-10 );
+      CHECK( sb_integrator.eval_exc( Ps, batched_settings ) == Approx( EXC_ref ) );
+    } else {
+      auto [ EXC_ref, VXCs_ref, VXCz_ref ] = ref_integrator.eval_exc_vxc( Ps, Pz );
+      auto [ EXC_sb, VXCs_sb, VXCz_sb ] = sb_integrator.eval_exc_vxc( Ps, Pz, 
+        batched_settings );
+      CHECK( EXC_sb == Approx( EXC_ref ) );
+      CHECK( (VXCs_sb - VXCs_ref).norm() / nbf < 1e-10 );
+      CHECK( (VXCz_sb - VXCz_ref).norm() / nbf < 1e-10 );
+    }
+  }
+
+}
+#endif
+
+#ifdef GAUXC_HAS_HOST
+TEST_CASE( "XC Integrator Out-of-Core Tasks", "[xc-integrator]" ) {
+
+  using matrix_type = Eigen::MatrixXd;
+  auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  auto mol   = make_water();
+  auto basis = make_ccpvdz( mol, SphericalType(true) );
+
+  const size_t nbf = basis.nbf();
+  random_test_densities dens( nbf, 19 );
+  const matrix_type& Ps = dens.Ps;
+  const matrix_type& Pz = dens.Pz;
+  matrix_type tP = dens.C.leftCols(2) * dens.C.leftCols(2).transpose();
+
+  auto ref_lb = make_test_load_balancer( rt, mol, basis );
+
+  // Small chunks force the tasks to be streamed in many pieces
+  auto ooc_lb = make_test_load_balancer( rt, mol, basis, []( LoadBalancer& lb ) {
+    lb.state().task_scratch_dir = ".";
+    lb.state().task_chunk_size  = 16 * 1024;
+  });
+  CHECK( not ooc_lb.tasks_out_of_core() );
+
+  const size_t ntasks   = ref_lb.get_tasks().size();
+  const size_t max_npts = ref_lb.max_npts();
+  const size_t max_nbe  = ref_lb.max_nbe();
+
+  for( auto spin : { ExchCXX::Spin::Unpolarized, ExchCXX::Spin::Polarized } ) {
+    auto func = make_functional( ExchCXX::Functional::PBE0, spin );
+    auto ref_integrator = XCIntegratorFactory<matrix_type>( ExecutionSpace::Host,
+      "Replicated", "Default", "Default", "Default" ).get_instance( func, ref_lb );
+    auto ooc_integrator = XCIntegratorFactory<matrix_type>( ExecutionSpace::Host,
+      "Replicated", "Default", "Default", "Default" ).get_instance( func, ooc_lb );
+
+    if( spin == ExchCXX::Spin::Unpolarized ) {
+      auto [ EXC_ref, VXC_ref ] = ref_integrator.eval_exc_vxc( Ps );
+      auto [ EXC_ooc, VXC_ooc ] = ooc_integrator.eval_exc_vxc( Ps );
+      CHECK( EXC_ooc == Approx( EXC_ref ) );
+      CHECK( (VXC_ooc - VXC_ref).norm() / nbf < 1e-10 );
+      CHECK( ooc_integrator.eval_exc( Ps ) == Approx( EXC_ref ) );
+
+      auto FXC_ref = ref_integrator.eval_fxc_contraction( Ps, 
+        std::vector<matrix_type>{ tP } );
+      auto FXC_ooc = ooc_integrator.eval_fxc_contraction( Ps, 
+        std::vector<matrix_type>{ tP } );
+      CHECK( (FXC_ooc[0] - FXC_ref[0]).norm() / nbf < 1e-10 );
+
+      CHECK( ooc_integrator.integrate_den( Ps ) == 
+        Approx( ref_integrator.integrate_den( Ps ) ) );
+      auto GRAD_ref = ref_integrator.eval_exc_grad( Ps );
+      auto GRAD_ooc = ooc_integrator.eval_exc_grad( Ps );
+      for( auto i = 0ul; i < GRAD_ref.size(); ++i )
+        CHECK( GRAD_ooc[i] == Approx( GRAD_ref[i] ).margin(1e-10) );
+    } else {
+      auto [ EXC_ref, VXCs_ref, VXCz_ref ] = ref_integrator.eval_exc_vxc( Ps, Pz );
+      auto [ EXC_ooc, VXCs_ooc, VXCz_ooc ] = ooc_integrator.eval_exc_vxc( Ps, Pz );
+      CHECK( EXC_ooc == Approx( EXC_ref ) );
+      CHECK( (VXCs_ooc - VXCs_ref).norm() / nbf < 1e-10 );
+      CHECK( (VXCz_ooc - VXCz_ref).norm() / nbf < 1e-10 );
+    }
+  }
+
+  // Tasks are held out-of-core, the task queries remain available
+  REQUIRE( ooc_lb.tasks_out_of_core() );
+  CHECK( ooc_lb.max_npts() == max_npts );
+  CHECK( ooc_lb.max_nbe()  == max_nbe  );
+  const auto& stats = ooc_lb.task_store_statistics();
+  CHECK( stats.nchunks > 1 );
+  CHECK( stats.bytes_written == stats.file_bytes );
+  CHECK( stats.bytes_read == 6 * stats.file_bytes ); // 6 streamed integrations
+  CHECK( stats.peak_resident_bytes < stats.file_bytes );
+
+  // Read-only access loads a copy of the tasks, the store remains valid
+  CHECK( std::as_const(ooc_lb).get_tasks().size() == ntasks );
+  CHECK( ooc_lb.tasks_out_of_core() );
+  CHECK( stats.bytes_read == 7 * stats.file_bytes );
+
+  // Streaming a valid store does not rewrite it
+  ooc_lb.stream_tasks( []( std::vector<XCTask>& ) { } );
+  CHECK( stats.bytes_written == stats.file_bytes );
+
+  // Non-const access discards the store, the next stream rewrites it
+  CHECK( ooc_lb.get_tasks().size() == ntasks );
+  CHECK( not ooc_lb.tasks_out_of_core() );
+  ooc_lb.stream_tasks( []( std::vector<XCTask>& ) { } );
+  CHECK( ooc_lb.tasks_out_of_core() );
+  CHECK( stats.bytes_written == 2 * stats.file_bytes );
+
+}
+#endif
+
+#ifdef GAUXC_HAS_HOST
+TEST_CASE( "XC Integrator FXC Contraction", "[xc-integrator]" ) {
+
+  using matrix_type = Eigen::MatrixXd;
+  auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  auto mol   = make_water();
+  auto basis = make_ccpvdz( mol, SphericalType(true) );
+
+  const size_t nbf = basis.nbf();
+  std::mt19937 gen(23);
+  std::uniform_real_distribution<double> dist( 0., 1. );
+  auto random_density = [&]( int nocc ) {
+    matrix_type C( nbf, nocc );
+    for( auto i = 0; i < C.size(); ++i ) C.data()[i] = dist(gen) / nbf;
+    return matrix_type( C * C.transpose() );
+  };
+  matrix_type Pa = random_density(5), Pb = random_density(4);
+  matrix_type Ps = Pa + Pb, Pz = Pa - Pb;
+  matrix_type tP1 = random_density(2), tP2 = random_density(3);
+
+  auto lb = make_test_load_balancer( rt, mol, basis );
+
+  auto rel_diff = []( const matrix_type& A, const matrix_type& B ) {
+    return ( A - B ).norm() / B.norm();
+  };
+  auto make_integrator = [&]( const functional_type& func ) {
+    return XCIntegratorFactory<matrix_type>( ExecutionSpace::Host,
+      "Replicated", "Default", "Default", "Default" ).get_instance( func, lb );
+  };
+
+  SECTION("Slater Exchange") {
+
+    // VXC is homogeneous of degree 1/3 in the density, such that the exact
+    // FXC contraction along the density itself is VXC / 3
+    for( auto spin : { ExchCXX::Spin::Unpolarized, ExchCXX::Spin::Polarized } ) {
+      functional_type func( std::vector<std::pair<double, ExchCXX::XCKernel>>{ 
+        { 1.0, ExchCXX::XCKernel( ExchCXX::Backend::builtin, 
+                 ExchCXX::Kernel::SlaterExchange, spin ) } } );
+      auto integrator = make_integrator( func );
+      if( spin == ExchCXX::Spin::Unpolarized ) {
+        auto [EXC, VXC] = integrator.eval_exc_vxc( Ps );
+        auto FXC = integrator.eval_fxc_contraction( Ps, 
+          std::vector<matrix_type>{ Ps } );
+        CHECK( rel_diff( FXC[0], matrix_type(VXC / 3.) ) < 1e-7 );
+      } else {
+        auto [EXC, VXCs, VXCz] = integrator.eval_exc_vxc( Ps, Pz );
+        auto [FXCs, FXCz] = integrator.eval_fxc_contraction( Ps, Pz,
+          std::vector<matrix_type>{ Ps }, std::vector<matrix_type>{ Pz } );
+        CHECK( rel_diff( FXCs[0], matrix_type(VXCs / 3.) ) < 1e-7 );
+        CHECK( rel_diff( FXCz[0], matrix_type(VXCz / 3.) ) < 1e-7 );
+      }
+    }
+
+  }
+
+  SECTION("Symmetry and Ground State Reuse") {
+
+    auto integrator = make_integrator( make_functional( ExchCXX::Functional::PBE0,
+      ExchCXX::Spin::Unpolarized ) );
+    auto FXC = integrator.eval_fxc_contraction( Ps, 
+      std::vector<matrix_type>{ tP1, tP2 } );
+
+    // FXC is the second derivative of EXC, its contraction is symmetric in
+    // the trial densities
+    const double t12 = (tP1.transpose() * FXC[1]).trace();
+    const double t21 = (tP2.transpose() * FXC[0]).trace();
+    CHECK( t12 == Approx( t21 ).epsilon(1e-6) );
+
+    // Contractions with cached ground state U variables are unchanged (up to
+    // the order of the accumulation), a change of the density invalidates them
+    auto FXC_cached = integrator.eval_fxc_contraction( Ps, 
+      std::vector<matrix_type>{ tP1, tP2 } );
+    CHECK( rel_diff( FXC_cached[0], FXC[0] ) < 1e-12 );
+    CHECK( rel_diff( FXC_cached[1], FXC[1] ) < 1e-12 );
+
+    // A bounded cache holds the ground state of a subset of the tasks only
+    IntegratorSettingsFXC bounded_settings;
+    bounded_settings.ground_state_cache_bytes = 256 * 1024;
+    for( int irep = 0; irep < 2; ++irep ) {
+      auto FXC_bounded = integrator.eval_fxc_contraction( Ps, 
+        std::vector<matrix_type>{ tP1, tP2 }, bounded_settings );
+      CHECK( rel_diff( FXC_bounded[0], FXC[0] ) < 1e-12 );
+      CHECK( rel_diff( FXC_bounded[1], FXC[1] ) < 1e-12 );
+    }
+
+    // Replacing the tasks of the load balancer advances the task generation
+    // and invalidates the cache
+    auto lb_ptr = std::make_shared<LoadBalancer>( lb );
+    auto shared_integrator = XCIntegratorFactory<matrix_type>( 
+      ExecutionSpace::Host, "Replicated", "Default", "Default", "Default" )
+      .get_instance( make_functional( ExchCXX::Functional::PBE0, 
+        ExchCXX::Spin::Unpolarized ), lb_ptr );
+    shared_integrator.eval_fxc_contraction( Ps, std::vector<matrix_type>{ tP1 } );
+    const auto generation = lb_ptr->task_generation();
+    {
+      auto& tasks = lb_ptr->get_tasks();
+      tasks = std::vector<XCTask>( tasks.begin(), tasks.end() );
+    }
+    CHECK( lb_ptr->task_generation() != generation );
+    auto FXC_regen = shared_integrator.eval_fxc_contraction( Ps, 
+      std::vector<matrix_type>{ tP1, tP2 } );
+    CHECK( rel_diff( FXC_regen[0], FXC[0] ) < 1e-12 );
+    CHECK( rel_diff( FXC_regen[1], FXC[1] ) < 1e-12 );
+
+    auto FXC_other = integrator.eval_fxc_contraction( Pa, 
+      std::vector<matrix_type>{ tP1 } );
+    auto FXC_other_ref = make_integrator( make_functional( 
+      ExchCXX::Functional::PBE0, ExchCXX::Spin::Unpolarized ) )
+      .eval_fxc_contraction( Pa, std::vector<matrix_type>{ tP1 } );
+    CHECK( rel_diff( FXC_other[0], FXC_other_ref[0] ) < 1e-12 );
+
+  }
+
+}
+#endif
@@ -0,0 +1,58 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include "ut_common.hpp"
+#include <gauxc/load_balancer.hpp>
+#include <gauxc/molecular_weights.hpp>
+#include <gauxc/molgrid/defaults.hpp>
+#include <Eigen/Core>
+#include <functional>
+#include <random>
+
+using namespace GauXC;
+
+/// Random positive semi-definite densities with 5 alpha and 4 beta
+/// occupied orbitals, fixed in the AO basis by the seed
+struct random_test_densities {
+  using matrix_type = Eigen::MatrixXd;
+
+  matrix_type C;      ///< Occupied coefficients (nbf x 5)
+  matrix_type Pa, Pb; ///< Alpha / beta densities
+  matrix_type Ps, Pz; ///< Scalar / Z densities
+
+  random_test_densities( size_t nbf, unsigned seed ) : C( nbf, 5 ) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist( 0., 1. );
+    for( auto i = 0; i < C.size(); ++i ) C.data()[i] = dist(gen) / nbf;
+    Pa = C * C.transpose();
+    Pb = C.leftCols(4) * C.leftCols(4).transpose();
+    Ps = Pa + Pb; Pz = Pa - Pb;
+  }
+};
+
+/**
+ *  Host LoadBalancer on the (Robust, MuraKnowles, FineGrid) molecular grid
+ *  of the integrator tests. configure (if set) modifies the LoadBalancer
+ *  prior to the modification of the partition weights.
+ */
+inline LoadBalancer make_test_load_balancer( const RuntimeEnvironment& rt,
+  const Molecule& mol, const BasisSet<double>& basis,
+  const std::function<void(LoadBalancer&)>& configure = {} ) {
+
+  auto mg = MolGridFactory::create_default_molgrid( mol, PruningScheme::Robust,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::FineGrid );
+  LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+  auto lb = lb_factory.get_instance( rt, mol, mg, basis );
+  if( configure ) configure( lb );
+
+  MolecularWeightsFactory mw_factory( ExecutionSpace::Host, "Default",
+    MolecularWeightsSettings{} );
+  mw_factory.get_instance().modify_weights( lb );
+  return lb;
+}